@@ -12,8 +12,6 @@
 #include "log4cplus/logger.h"
 #include "log4cplus/loggingmacros.h"
 
-#define DEBUG
-
 namespace gvirtus::backend {
 
     static int activeChilds = 0;
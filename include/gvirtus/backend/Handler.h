@@ -35,8 +35,10 @@
 
 #pragma once
 
+#include <gvirtus/communicators/LoadReport.h>
 #include <gvirtus/communicators/Result.h>
 #include <memory>
+#include <vector>
 #include "log4cplus/configurator.h"
 #include "log4cplus/logger.h"
 #include "log4cplus/loggingmacros.h"
@@ -52,6 +54,23 @@ class Handler {
       std::string routine,
       std::shared_ptr<communicators::Buffer> input_buffer) = 0;
 
+  /**
+   * Samples the load of the devices the handler drives, for the load report
+   * of the backend. The first handler that fills devices is the one asked.
+   *
+   * @param devices the load of each device, in ordinal order.
+   * @return false if the handler drives no device.
+   */
+  virtual bool ReportLoad(std::vector<communicators::DeviceLoad> &devices) {
+    return false;
+  }
+
+  /**
+   * Releases what the session served on the calling thread was holding,
+   * once its connection is closed, however the frontend went away.
+   */
+  virtual void SessionEnded() {}
+
  private:
   log4cplus::Logger logger;
 };
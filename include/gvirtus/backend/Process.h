@@ -3,6 +3,8 @@
 #include <gvirtus/common/LD_Lib.h>
 #include <gvirtus/common/Observable.h>
 #include <gvirtus/communicators/Communicator.h>
+#include <gvirtus/communicators/LoadReport.h>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -28,10 +30,14 @@ class Process : public common::Observable {
   void Start();
 
  private:
+  communicators::LoadReport ReportLoad();
+
   std::shared_ptr<common::LD_Lib<communicators::Communicator, std::shared_ptr<communicators::Endpoint>>> _communicator;
   std::vector<std::shared_ptr<common::LD_Lib<Handler>>> _handlers;
 
   std::vector<std::string> mPlugins;
+  std::atomic<int> mSessions{0};
+  std::atomic<int> mRequests{0};
   log4cplus::Logger logger;
 };
 }  // namespace gvirtus::backend
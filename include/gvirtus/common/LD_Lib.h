@@ -157,6 +157,19 @@ namespace gvirtus::common {
 #endif
         }
 
+        /* CREATE_OBJ */
+        /**
+         * @brief 创建一个新对象并返回，不保存在_obj_ptr中
+         * 
+         * 同一个库可以创建多个对象（例如每个线程一个通信器），
+         * 返回的对象不能比LD_Lib活得更久。
+         * 
+         * @param args 可变参数列表，用于传递给创建函数的参数。
+         */
+        std::shared_ptr<T> create_obj(Args... args) {
+            return this->sym(args...);
+        }
+
         /* OBJ_PTR */
         std::shared_ptr<T> obj_ptr() {
             return _obj_ptr;
@@ -0,0 +1,159 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   LiveStats.h
+ *
+ * @brief  Counters of a running backend, published in shared memory for
+ * gvirtus-top to read.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace gvirtus::common {
+
+/**
+ * LiveStats publishes, per session and per routine, how many requests the
+ * backend served, the bytes they carried and the time they took, and per
+ * session the device memory the plugins allocated for it. The counters are
+ * in a POSIX shared memory segment, updated with relaxed atomics: a reader
+ * attaches to it without sending the backend anything, and sees every
+ * counter whole but not all of them at the same instant.
+ *
+ * The segment is /gvirtus-<pid>, <pid> being the process serving the
+ * endpoint, unless GVIRTUS_LIVE_STATS names another, where %p stands for
+ * that pid; GVIRTUS_LIVE_STATS=off leaves it out. It is removed when the
+ * process exits.
+ */
+class LiveStats {
+ public:
+  static const uint64_t Magic = 0x314556494c535647ull; /* "GVSLIVE1" */
+  static const uint32_t Version = 1;
+  static const size_t MaxSessions = 256;
+  /* a power of two: the routines are a hash table */
+  static const size_t MaxRoutines = 1024;
+  static const size_t NameSize = 64;
+
+  struct Counters {
+    std::atomic<uint64_t> requests;
+    std::atomic<uint64_t> requestBytes;
+    std::atomic<uint64_t> replyBytes;
+    /* nanoseconds, summed: from the request read to its reply sent */
+    std::atomic<uint64_t> latency;
+    /* nanoseconds, summed: in the handler */
+    std::atomic<uint64_t> execution;
+  };
+
+  struct Session {
+    /* odd while a connection holds the slot, incremented as it is taken and
+     * left: a reader tells two connections of the same slot apart */
+    std::atomic<uint64_t> generation;
+    /* wall clock nanoseconds */
+    std::atomic<int64_t> connected;
+    std::atomic<int32_t> tid;
+    /* bytes of device memory allocated, and not freed, by the session */
+    std::atomic<int64_t> memory;
+    Counters counters;
+  };
+
+  struct Routine {
+    /* 0 free, 1 being named, 2 named */
+    std::atomic<uint32_t> state;
+    char name[NameSize];
+    Counters counters;
+  };
+
+  struct Segment {
+    /* written last: the rest is valid once it reads Magic */
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    int32_t pid;
+    /* wall clock nanoseconds */
+    int64_t started;
+    /* the sessions that found no free slot, and so are not counted */
+    std::atomic<uint64_t> sessionsLost;
+    Session sessions[MaxSessions];
+    Routine routines[MaxRoutines];
+  };
+
+  /**
+   * Creates the segment of the calling process, in the process that serves
+   * the sessions: after any fork. Later calls do nothing.
+   */
+  static void Init();
+
+  static inline bool IsEnabled() { return mpSegment != nullptr; }
+
+  /**
+   * Takes a slot for the connection served by the calling thread.
+   *
+   * @return NULL if disabled or every slot is taken.
+   */
+  static Session *OpenSession();
+
+  static void CloseSession(Session *session);
+
+  /**
+   * Accounts a request of session. latency and execution are in
+   * nanoseconds.
+   */
+  static void Record(Session *session, const char *routine,
+                     size_t request_bytes, size_t reply_bytes,
+                     uint64_t latency, uint64_t execution);
+
+  /**
+   * Accounts device memory allocated, or freed if bytes is negative, for the
+   * session of the calling thread. For the plugins.
+   */
+  static inline void AddMemory(int64_t bytes) {
+    if (tlsSession != nullptr)
+      tlsSession->memory.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  /**
+   * Maps, read only, the segment of another process.
+   *
+   * @throws std::string if it does not exist or is not a segment of this
+   * version.
+   */
+  static const Segment *Attach(const std::string &name);
+
+  /**
+   * The name of the segment of the backend with the given process id.
+   */
+  static std::string DefaultName(int pid);
+
+ private:
+  static Routine *GetRoutine(const char *routine);
+  static void Remove();
+
+  static Segment *mpSegment;
+  static std::string msName;
+  static thread_local Session *tlsSession;
+};
+
+}  // namespace gvirtus::common
@@ -0,0 +1,96 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   Log.h
+ *
+ * @brief  Logging for the request paths: statements below a compile-time
+ * level are not compiled at all, the others cost one relaxed atomic load
+ * when their level is not enabled.
+ *
+ * Use GVIRTUS_LOG_TRACE() ... GVIRTUS_LOG_ERROR() as the LOG4CPLUS_ macros
+ * they wrap. Handlers keep their logger in a static local, so that
+ * log4cplus's hierarchy is looked up once and not on every request:
+ *
+ *   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Routine"));
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+
+#include "log4cplus/logger.h"
+#include "log4cplus/loggingmacros.h"
+
+/* statements below this level are left out of the build */
+#ifndef GVIRTUS_LOG_MIN_LEVEL
+#define GVIRTUS_LOG_MIN_LEVEL log4cplus::DEBUG_LOG_LEVEL
+#endif
+
+namespace gvirtus::common {
+
+class Log {
+ public:
+  static inline bool IsEnabled(log4cplus::LogLevel level) {
+    return level >= msThreshold.load(std::memory_order_relaxed);
+  }
+
+  static inline void SetThreshold(log4cplus::LogLevel level) {
+    msThreshold.store(level, std::memory_order_relaxed);
+  }
+
+  /**
+   * The level set by GVIRTUS_LOGLEVEL, INFO if it is not set.
+   */
+  static inline log4cplus::LogLevel FromEnvironment() {
+    char *val = getenv("GVIRTUS_LOGLEVEL");
+    if (val == NULL || *val == '\0') return log4cplus::INFO_LOG_LEVEL;
+    return atoi(val);
+  }
+
+ private:
+  static inline std::atomic<log4cplus::LogLevel> msThreshold{
+      FromEnvironment()};
+};
+
+}  // namespace gvirtus::common
+
+#define GVIRTUS_LOG(level, statement)                          \
+  do {                                                         \
+    if constexpr ((level) >= (GVIRTUS_LOG_MIN_LEVEL)) {        \
+      if (gvirtus::common::Log::IsEnabled(level)) {            \
+        statement;                                             \
+      }                                                        \
+    }                                                          \
+  } while (0)
+
+#define GVIRTUS_LOG_TRACE(logger, message) \
+  GVIRTUS_LOG(log4cplus::TRACE_LOG_LEVEL, LOG4CPLUS_TRACE(logger, message))
+#define GVIRTUS_LOG_DEBUG(logger, message) \
+  GVIRTUS_LOG(log4cplus::DEBUG_LOG_LEVEL, LOG4CPLUS_DEBUG(logger, message))
+#define GVIRTUS_LOG_INFO(logger, message) \
+  GVIRTUS_LOG(log4cplus::INFO_LOG_LEVEL, LOG4CPLUS_INFO(logger, message))
+#define GVIRTUS_LOG_WARN(logger, message) \
+  GVIRTUS_LOG(log4cplus::WARN_LOG_LEVEL, LOG4CPLUS_WARN(logger, message))
+#define GVIRTUS_LOG_ERROR(logger, message) \
+  GVIRTUS_LOG(log4cplus::ERROR_LOG_LEVEL, LOG4CPLUS_ERROR(logger, message))
@@ -0,0 +1,62 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   Probe.h
+ *
+ * @brief  USDT probes of the "gvirtus" provider, for bpftrace or perf.
+ *
+ * A probe is a single nop until a tracer attaches to it. Without
+ * <sys/sdt.h>, or with GVIRTUS_USDT off, probes are not compiled at all.
+ *
+ * Requests are numbered per connection, from 1, in the same order on both
+ * ends, so (connection, id) matches a frontend request with its handling
+ * on the backend. The probes and their arguments:
+ *
+ *   frontend:
+ *     marshal__start(backend)                  the plugin starts a request
+ *     request__start(routine, id, in_bytes)    the request is marshalled
+ *     request__sent(routine, id, in_bytes)     the request is on the wire
+ *     reply__received(routine, id, exit_code, out_bytes)
+ *   backend:
+ *     frame__received(routine, id, in_bytes)
+ *     handler__start(routine, id)
+ *     handler__end(routine, id, exit_code)
+ *     reply__sent(routine, id, out_bytes)
+ *   communicators:
+ *     read(communicator, requested, read)
+ *     write(communicator, bytes)
+ *
+ * routine is a NUL terminated string: str(arg0) in bpftrace.
+ * tools/usdt/request-latency.bt shows their use.
+ */
+
+#pragma once
+
+#if defined(GVIRTUS_USDT) && __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define GVIRTUS_PROBE(name, ...) STAP_PROBEV(gvirtus, name, ##__VA_ARGS__)
+#else
+#define GVIRTUS_PROBE(name, ...) \
+  do {                           \
+  } while (0)
+#endif
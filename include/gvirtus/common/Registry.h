@@ -0,0 +1,148 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   Registry.h
+ *
+ * @brief  A hash map shared by the threads of a backend process, written
+ * while modules register and read on every request.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace gvirtus::common {
+
+/**
+ * Registry spreads its entries over independently locked shards. Lookups
+ * take the shard lock shared, so readers never wait for each other and only
+ * wait for a writer of the same shard; writes are serialized per shard.
+ *
+ * Values are returned by copy: store pointers, or shared_ptr to const for
+ * large values, so that a lookup stays cheap and what it returned outlives a
+ * concurrent update.
+ */
+template <class K, class V, class Hash = std::hash<K>>
+class Registry {
+ public:
+  Registry() = default;
+  Registry(const Registry &) = delete;
+  Registry &operator=(const Registry &) = delete;
+
+  /**
+   * Looks up key.
+   *
+   * @return false if key is not registered; value is left untouched then.
+   */
+  bool Find(const K &key, V *value) const {
+    const Shard &shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return false;
+    *value = it->second;
+    return true;
+  }
+
+  bool Contains(const K &key) const {
+    const Shard &shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.find(key) != shard.map.end();
+  }
+
+  /**
+   * Registers value under key, replacing what was there.
+   */
+  void Put(const K &key, const V &value) {
+    Shard &shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.map[key] = value;
+  }
+
+  /**
+   * Removes key.
+   *
+   * @param value if not NULL, set to the value removed.
+   * @return false if key was not registered.
+   */
+  bool Erase(const K &key, V *value = NULL) {
+    Shard &shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return false;
+    if (value != NULL) *value = it->second;
+    shard.map.erase(it);
+    return true;
+  }
+
+  /**
+   * Looks for the key of the first value satisfying pred, a reverse lookup
+   * walking every shard.
+   */
+  template <class P>
+  bool FindKey(P pred, K *key) const {
+    for (const Shard &shard : mShards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      for (auto &it : shard.map)
+        if (pred(it.second)) {
+          *key = it.first;
+          return true;
+        }
+    }
+    return false;
+  }
+
+  size_t Size() const {
+    size_t size = 0;
+    for (const Shard &shard : mShards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      size += shard.map.size();
+    }
+    return size;
+  }
+
+ private:
+  static const unsigned ShardBits = 4;
+
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<K, V, Hash> map;
+  };
+
+  /* keys are often aligned addresses: mix the hash before taking a shard */
+  static size_t IndexOf(const K &key) {
+    uint64_t h = (uint64_t)Hash()(key) * 0x9e3779b97f4a7c15ull;
+    return (size_t)(h >> (64 - ShardBits));
+  }
+
+  Shard &ShardOf(const K &key) { return mShards[IndexOf(key)]; }
+  const Shard &ShardOf(const K &key) const { return mShards[IndexOf(key)]; }
+
+  Shard mShards[1 << ShardBits];
+};
+
+}  // namespace gvirtus::common
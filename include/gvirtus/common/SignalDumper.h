@@ -0,0 +1,55 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   SignalDumper.h
+ *
+ * @brief  Runs a dump of the process state when a signal arrives.
+ */
+
+#pragma once
+
+namespace gvirtus::common {
+
+/**
+ * SignalDumper calls a function every time the process receives a signal,
+ * on a thread of its own: the handler only writes to a pipe the thread
+ * reads, since dumping is not async-signal-safe.
+ *
+ * The thread belongs to the process that installs it, so a process that
+ * forks installs after the fork.
+ */
+class SignalDumper {
+ public:
+  /**
+   * Calls dump whenever signo arrives, from now on. Once per signal.
+   *
+   * @return false if the pipe could not be made.
+   */
+  static bool Install(int signo, void (*dump)());
+
+ private:
+  static void OnSignal(int signo);
+  static void Run(int fd, void (*dump)());
+};
+
+}  // namespace gvirtus::common
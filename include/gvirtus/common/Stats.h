@@ -0,0 +1,165 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   Stats.h
+ *
+ * @brief  Per-routine request statistics of a frontend or backend process.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gvirtus::common {
+
+/**
+ * Histogram counts nanosecond durations in logarithmic buckets, each power
+ * of two split in 16: a value is known within 1/16 (6.25%) of itself. Values
+ * below 16 ns are exact; those beyond 2^41 ns (about 36 minutes) go to the
+ * last bucket.
+ */
+class Histogram {
+ public:
+  static const unsigned SubBucketBits = 4;
+  static const unsigned MaxBits = 40;
+  static const size_t Buckets = (MaxBits - SubBucketBits + 2)
+                               << SubBucketBits;
+
+  void Record(uint64_t value);
+  void Merge(const Histogram &other);
+
+  uint64_t Count() const { return mCount; }
+  uint64_t Sum() const { return mSum; }
+  uint64_t Min() const { return mCount == 0 ? 0 : mMin; }
+  uint64_t Max() const { return mMax; }
+
+  /**
+   * Returns the value below which the given fraction of the values lies, as
+   * the upper bound of its bucket.
+   */
+  uint64_t Percentile(double fraction) const;
+
+  uint64_t BucketCount(size_t bucket) const { return mBuckets[bucket]; }
+
+  /**
+   * The largest value counted in bucket.
+   */
+  static uint64_t UpperBound(size_t bucket);
+
+  static size_t BucketOf(uint64_t value);
+
+ private:
+  uint64_t mBuckets[Buckets] = {};
+  uint64_t mCount = 0;
+  uint64_t mSum = 0;
+  uint64_t mMin = UINT64_MAX;
+  uint64_t mMax = 0;
+};
+
+struct RoutineStats {
+  uint64_t calls = 0;
+  uint64_t requestBytes = 0;
+  uint64_t replyBytes = 0;
+  /* as seen by the caller: from the request sent to its reply */
+  Histogram latency;
+  /* spent by the backend in the handler */
+  Histogram execution;
+  /* the rest of latency: transfers and queuing */
+  Histogram wire;
+
+  void Merge(const RoutineStats &other);
+};
+
+/**
+ * Stats collects a RoutineStats for every routine that went through the
+ * process. Each thread updates its own table, under a lock that is only
+ * contended while a dump merges the tables. A thread that is done, such as
+ * the one serving a backend session, folds its table into the totals of the
+ * ended threads with EndThread().
+ *
+ * Enabled by GVIRTUS_STATS=json or GVIRTUS_STATS=prometheus: the merged
+ * tables are then written, in that format, at exit and whenever the process
+ * receives SIGUSR2, to GVIRTUS_STATS_FILE (appending) or to stderr.
+ */
+class Stats {
+ public:
+  enum Format { Json, Prometheus };
+
+  /**
+   * Reads the configuration. side ("frontend" or "backend") labels what is
+   * dumped. Call once, before the first Record().
+   */
+  static void Init(const char *side);
+
+  static inline bool IsEnabled() { return msEnabled; }
+
+  /**
+   * Accounts a request. latency and execution are in nanoseconds.
+   */
+  static void Record(const char *routine, size_t request_bytes,
+                     size_t reply_bytes, uint64_t latency,
+                     uint64_t execution);
+
+  /**
+   * Folds what the calling thread counted into the totals of the ended
+   * threads and releases its table. A later Record() starts a new one.
+   */
+  static void EndThread();
+
+  /**
+   * Writes the statistics of every thread, merged.
+   */
+  static void Dump(std::ostream &os, Format format);
+
+ private:
+  struct ThreadStats {
+    std::mutex mutex;
+    std::unordered_map<std::string, RoutineStats> routines;
+  };
+
+  static thread_local ThreadStats *tlsStats;
+
+  static ThreadStats *GetThreadStats();
+  static std::unordered_map<std::string, RoutineStats> Merge();
+  static void DumpJson(std::ostream &os);
+  static void DumpPrometheus(std::ostream &os);
+  static void DumpToFile();
+
+  static bool msEnabled;
+  static Format msFormat;
+  static std::string msSide;
+  static std::string msFile;
+  static std::mutex msThreadsMutex;
+  static std::vector<std::shared_ptr<ThreadStats>> *mpThreads;
+  /* what the threads already ended counted, under msThreadsMutex */
+  static std::unordered_map<std::string, RoutineStats> *mpEnded;
+};
+
+}  // namespace gvirtus::common
@@ -0,0 +1,227 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   Strided.h
+ *
+ * @brief  Packing and unpacking of strided host memory, so that pitched 2D/3D
+ * copies and BLAS matrices/vectors put only their logical bytes on the wire.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace gvirtus::common {
+
+/**
+ * Describes a strided region of host memory: depth slices of height rows of
+ * width contiguous bytes. Rows are pitch bytes apart, slices slicePitch bytes
+ * apart. A dense layout has pitch == width and slicePitch == pitch * height.
+ */
+typedef struct __stridedLayout {
+  size_t width;
+  size_t height;
+  size_t depth;
+  size_t pitch;
+  size_t slicePitch;
+} StridedLayout;
+
+class Strided {
+ public:
+  /**
+   * Layout of a pitched 2D region.
+   */
+  static inline StridedLayout Layout2D(size_t width, size_t height,
+                                       size_t pitch) {
+    return StridedLayout{width, height, 1, pitch, pitch * height};
+  }
+
+  /**
+   * Layout of a pitched 3D region whose slices are ysize rows apart.
+   */
+  static inline StridedLayout Layout3D(size_t width, size_t height,
+                                       size_t depth, size_t pitch,
+                                       size_t ysize) {
+    return StridedLayout{width, height, depth, pitch, pitch * ysize};
+  }
+
+  /**
+   * Layout of a column-major BLAS matrix: cols columns of rows elements,
+   * ld elements apart.
+   */
+  static inline StridedLayout LayoutMatrix(size_t rows, size_t cols,
+                                           size_t elemSize, size_t ld) {
+    return Layout2D(rows * elemSize, cols, ld * elemSize);
+  }
+
+  /**
+   * Number of logical bytes in the layout, i.e. the size once packed.
+   */
+  static inline size_t PackedSize(const StridedLayout &layout) {
+    return layout.width * layout.height * layout.depth;
+  }
+
+  static inline bool IsDense(const StridedLayout &layout) {
+    return layout.pitch == layout.width &&
+           (layout.depth <= 1 || layout.slicePitch == layout.pitch * layout.height);
+  }
+
+  /**
+   * Gathers the strided region at src into the dense buffer dst, which must
+   * hold PackedSize(layout) bytes.
+   */
+  static void Pack(const void *src, const StridedLayout &layout, void *dst) {
+    if (IsDense(layout)) {
+      memcpy(dst, src, PackedSize(layout));
+      return;
+    }
+    const char *s = static_cast<const char *>(src);
+    char *d = static_cast<char *>(dst);
+    for (size_t z = 0; z < layout.depth; z++) {
+      const char *row = s + z * layout.slicePitch;
+      for (size_t y = 0; y < layout.height; y++) {
+        memcpy(d, row, layout.width);
+        d += layout.width;
+        row += layout.pitch;
+      }
+    }
+  }
+
+  /**
+   * Scatters the dense buffer src into the strided region at dst. Padding
+   * bytes between rows are left untouched.
+   */
+  static void Unpack(const void *src, const StridedLayout &layout, void *dst) {
+    if (IsDense(layout)) {
+      memcpy(dst, src, PackedSize(layout));
+      return;
+    }
+    const char *s = static_cast<const char *>(src);
+    char *d = static_cast<char *>(dst);
+    for (size_t z = 0; z < layout.depth; z++) {
+      char *row = d + z * layout.slicePitch;
+      for (size_t y = 0; y < layout.height; y++) {
+        memcpy(row, s, layout.width);
+        s += layout.width;
+        row += layout.pitch;
+      }
+    }
+  }
+
+  /**
+   * Gathers n elements of elemSize bytes, inc elements apart, into the dense
+   * buffer dst. A negative inc walks the vector backwards as BLAS does: the
+   * first element is at src + (1 - n) * inc * elemSize.
+   */
+  static void PackElements(const void *src, size_t n, size_t elemSize,
+                           long inc, void *dst) {
+    if (inc == 1) {
+      memcpy(dst, src, n * elemSize);
+      return;
+    }
+    const char *s = static_cast<const char *>(src);
+    if (inc < 0) s += (1 - (long)n) * inc * (long)elemSize;
+    long stride = inc * (long)elemSize;
+    switch (elemSize) {
+      case 4:
+        Gather<uint32_t>(s, n, stride, dst);
+        break;
+      case 8:
+        Gather<uint64_t>(s, n, stride, dst);
+        break;
+      case 16:
+        Gather<Element16>(s, n, stride, dst);
+        break;
+      default: {
+        char *d = static_cast<char *>(dst);
+        for (size_t i = 0; i < n; i++, s += stride, d += elemSize)
+          memcpy(d, s, elemSize);
+      }
+    }
+  }
+
+  /**
+   * Scatters n dense elements from src to dst, inc elements apart.
+   */
+  static void UnpackElements(const void *src, size_t n, size_t elemSize,
+                             long inc, void *dst) {
+    if (inc == 1) {
+      memcpy(dst, src, n * elemSize);
+      return;
+    }
+    char *d = static_cast<char *>(dst);
+    if (inc < 0) d += (1 - (long)n) * inc * (long)elemSize;
+    long stride = inc * (long)elemSize;
+    switch (elemSize) {
+      case 4:
+        Scatter<uint32_t>(src, n, stride, d);
+        break;
+      case 8:
+        Scatter<uint64_t>(src, n, stride, d);
+        break;
+      case 16:
+        Scatter<Element16>(src, n, stride, d);
+        break;
+      default: {
+        const char *s = static_cast<const char *>(src);
+        for (size_t i = 0; i < n; i++, d += stride, s += elemSize)
+          memcpy(d, s, elemSize);
+      }
+    }
+  }
+
+ private:
+  /* cuComplex doubles and the like */
+  typedef struct __element16 {
+    uint64_t lo, hi;
+  } Element16;
+
+  /*
+   * Fixed size element loops: a memcpy of sizeof(T) is a plain load or store,
+   * even at -O0, where one of elemSize is a call per element.
+   */
+  template <class T>
+  static inline void Gather(const char *src, size_t n, long stride,
+                            void *dst) {
+    T *d = static_cast<T *>(dst);
+    for (size_t i = 0; i < n; i++) {
+      T value;
+      memcpy(&value, src + (long)i * stride, sizeof(T));
+      d[i] = value;
+    }
+  }
+
+  template <class T>
+  static inline void Scatter(const void *src, size_t n, long stride,
+                             char *dst) {
+    const T *s = static_cast<const T *>(src);
+    for (size_t i = 0; i < n; i++) {
+      T value = s[i];
+      memcpy(dst + (long)i * stride, &value, sizeof(T));
+    }
+  }
+};
+
+}  // namespace gvirtus::common
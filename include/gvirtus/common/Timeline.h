@@ -0,0 +1,153 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   Timeline.h
+ *
+ * @brief  Timeline of the requests of a frontend or backend process, in the
+ * Chrome trace event format that chrome://tracing and Perfetto open.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace gvirtus::common {
+
+/**
+ * Timeline keeps, for the last requests of every thread, when each step of
+ * the request began and ended: on the frontend marshal, send, wait and
+ * receive, on the backend read, dispatch, execute and reply. Each thread
+ * writes to its own ring of GVIRTUS_TIMELINE_EVENTS requests (default
+ * 16384), overwriting the oldest, under a lock only contended by a dump. A
+ * thread that is done, such as the one serving a backend session, hands its
+ * requests over to one more ring, shared by the ended threads, with
+ * EndThread().
+ *
+ * A request is named, on both sides, by the session the frontend gave the
+ * connection and its number on it: flow arrows link the send of the
+ * frontend to the read of the backend and the reply of the backend to the
+ * receive of the frontend. The backend writes the requests of a session in
+ * the frontend's clock, shifted by the difference measured when it
+ * connected (see communicators::ClockSync), so that the files of the two
+ * sides, concatenated, are one timeline.
+ *
+ * Enabled by GVIRTUS_TIMELINE=<path>, where %p stands for the process id:
+ * the file is rewritten with every ring at exit and whenever the process
+ * receives SIGUSR1.
+ */
+class Timeline {
+ public:
+  typedef std::chrono::steady_clock::time_point TimePoint;
+
+  /**
+   * The steps of a request, in order: each ends when the next begins.
+   */
+  struct Steps {
+    TimePoint begin;
+    TimePoint marks[4];
+  };
+
+  /**
+   * Reads the configuration. side ("frontend" or "backend") chooses the names
+   * of the steps. Call once, before the first Record().
+   */
+  static void Init(const char *side);
+
+  static inline bool IsEnabled() { return msEnabled; }
+
+  /**
+   * Returns the wall clock time of t, in nanoseconds since the epoch. Valid
+   * after Init(), enabled or not.
+   */
+  static int64_t WallClock(TimePoint t);
+
+  /**
+   * Accounts a request. On the frontend steps.begin may be the default
+   * time point, when the request was not marshalled by Prepare(): the first
+   * step is then left out. backend is the index of the backend the frontend
+   * sent the request to, -1 on the backend. offset is the difference of the
+   * clock of this process from the one to write the request in.
+   */
+  static void Record(const char *routine, uint64_t session, uint64_t id,
+                     int backend, const Steps &steps, int64_t offset = 0);
+
+  /**
+   * Moves the requests of the calling thread to the ring of the ended
+   * threads and releases its ring. A later Record() starts a new one.
+   */
+  static void EndThread();
+
+  /**
+   * Writes every ring as a JSON array of trace events.
+   */
+  static void Dump(std::ostream &os);
+
+ private:
+  struct Event {
+    char routine[64];
+    uint64_t session;
+    uint64_t id;
+    int32_t backend;
+    /* of the thread that recorded it */
+    int32_t tid;
+    /* wall clock nanoseconds: begin, then the end of each step */
+    int64_t times[5];
+  };
+
+  struct ThreadEvents {
+    std::mutex mutex;
+    std::vector<Event> ring;
+    /* events ever recorded: the next is written at recorded % ring.size() */
+    uint64_t recorded = 0;
+    int32_t tid;
+
+    Event &Next() { return ring[recorded++ % ring.size()]; }
+  };
+
+  static thread_local ThreadEvents *tlsEvents;
+
+  static ThreadEvents *GetThreadEvents();
+  static void DumpEvents(std::ostream &os, ThreadEvents &events);
+  static void DumpEvent(std::ostream &os, const Event &event);
+  static void DumpToFile();
+
+  static bool msEnabled;
+  static bool msFrontend;
+  static size_t msCapacity;
+  static std::string msFile;
+  static TimePoint msSteadyStart;
+  static int64_t msWallStart;
+  static std::mutex msThreadsMutex;
+  static std::vector<std::shared_ptr<ThreadEvents>> *mpThreads;
+  /* the last requests of the threads already ended, under msThreadsMutex */
+  static ThreadEvents *mpEnded;
+};
+
+}  // namespace gvirtus::common
@@ -0,0 +1,192 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   Trace.h
+ *
+ * @brief  Binary trace of the requests of a frontend process, for
+ * gvirtus-replay to send again.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace gvirtus::common {
+
+/**
+ * Trace writes every request of the process, with its reply, to a file: the
+ * frames as sent and received, when the request was sent and how long the
+ * reply took, the thread that sent it, the stream the plugin tagged it with
+ * and how many requests had been answered before it was sent, which is the
+ * order a replay must keep between threads.
+ *
+ * Enabled by GVIRTUS_TRACE=<path>. Frames larger than GVIRTUS_TRACE_BULK
+ * bytes (default 4096; 0 keeps every byte) keep only their first and last
+ * Edge bytes, which hold the arguments around a bulk payload: the bytes in
+ * between are stored as their count and hash, and replayed as zeros.
+ *
+ * The file is the header (Magic, version, bulk threshold, wall clock time of
+ * the start in nanoseconds) and then one record per answered request, in
+ * the order of the replies, in the byte order of the host.
+ */
+class Trace {
+ public:
+  static const char Magic[8];
+  static const uint32_t Version = 1;
+  static const size_t Edge = 256;
+
+  /**
+   * A frame, whole or with its middle elided.
+   */
+  struct Payload {
+    uint64_t size = 0;
+    bool elided = false;
+    /* the whole frame, or its first Edge bytes */
+    std::string head;
+    /* the last Edge bytes of an elided frame */
+    std::string tail;
+    /* of the elided bytes */
+    uint64_t hash = 0;
+
+    /**
+     * Returns the frame, with zeros in place of the elided bytes.
+     */
+    std::string Expand() const;
+  };
+
+  struct Frame {
+    /* nanoseconds from the start of the trace to the request */
+    uint64_t time;
+    /* nanoseconds from the request to the end of its reply */
+    uint64_t duration;
+    /* the requests answered, in any thread, before this one was sent */
+    uint64_t after;
+    uint64_t stream;
+    /* the threads are numbered from 0 in the order of their first request */
+    uint32_t thread;
+    uint32_t backend;
+    int32_t exitCode;
+    std::string routine;
+    Payload request;
+    Payload reply;
+  };
+
+  /**
+   * What is known of a request when it is sent.
+   */
+  struct Pending {
+    uint64_t time;
+    uint64_t after;
+    uint64_t stream;
+  };
+
+  /**
+   * Reads the configuration and opens the file. Call once, before the first
+   * Start().
+   */
+  static void Init();
+
+  static inline bool IsEnabled() { return msEnabled; }
+
+  /**
+   * Tags the next request of the calling thread with a stream. For the
+   * plugins, whose streams the frontend does not know.
+   */
+  static inline void SetStream(uint64_t stream) {
+    if (msEnabled) tlsStream = stream;
+  }
+
+  /**
+   * Returns, and clears, the stream set for the next request.
+   */
+  static inline uint64_t TakeStream() {
+    uint64_t stream = tlsStream;
+    tlsStream = 0;
+    return stream;
+  }
+
+  /**
+   * Notes a request being sent.
+   */
+  static Pending Start(uint64_t stream);
+
+  /**
+   * Writes a request, once its reply has been read.
+   */
+  static void Record(const Pending &pending, const char *routine, int backend,
+                     const char *request, size_t request_size, int exit_code,
+                     const char *reply, size_t reply_size);
+
+  /**
+   * 64-bit FNV-1a, over 8 bytes at a time.
+   */
+  static uint64_t Hash(const char *data, size_t size);
+
+  /**
+   * Reads the frames of a trace file, in the order they were written.
+   */
+  class Reader {
+   public:
+    /**
+     * @throws std::string if the file cannot be read or is not a trace.
+     */
+    explicit Reader(const std::string &path);
+
+    /**
+     * @return false at the end of the file or on a truncated record.
+     */
+    bool Next(Frame &frame);
+
+    inline uint64_t GetStartTime() const { return mStartTime; }
+
+   private:
+    bool ReadPayload(Payload &payload);
+
+    std::ifstream mIn;
+    uint64_t mStartTime;
+  };
+
+ private:
+  static uint64_t Now();
+  static void WritePayload(const char *data, size_t size);
+  static void Close();
+
+  static bool msEnabled;
+  static size_t msBulk;
+  static std::mutex msMutex;
+  static FILE *msOut;
+  /* records written */
+  static std::atomic<uint64_t> msCompleted;
+  static std::atomic<uint32_t> msThreads;
+  static std::chrono::steady_clock::time_point msStart;
+  static thread_local uint64_t tlsStream;
+};
+
+}  // namespace gvirtus::common
@@ -41,6 +41,7 @@
 #include <iostream>
 #include <typeinfo>
 
+#include <gvirtus/common/Strided.h>
 #include <gvirtus/common/gvirtus-type.h>
 
 #include "Communicator.h"
@@ -147,6 +148,39 @@ class Buffer {
     mBackOffset = mLength;
   }
 
+  /**
+   * Packs a strided host region straight into the buffer, as Add(item, n)
+   * would do with its dense copy: only the logical bytes are stored.
+   */
+  void AddStrided(const void *item, const gvirtus::common::StridedLayout &layout) {
+    size_t size = gvirtus::common::Strided::PackedSize(layout);
+    Add(size);
+    if ((mLength + size) >= mSize) {
+      mSize = ((mLength + size) / mBlockSize + 1) * mBlockSize;
+      if ((mpBuffer = (char *)realloc(mpBuffer, mSize)) == NULL)
+        throw "Buffer::AddStrided(item, layout): Can't reallocate memory.";
+    }
+    gvirtus::common::Strided::Pack(item, layout, mpBuffer + mLength);
+    mLength += size;
+    mBackOffset = mLength;
+  }
+
+  /**
+   * Packs n elements, inc elements apart, straight into the buffer.
+   */
+  void AddStridedElements(const void *item, size_t n, size_t elem_size, long inc) {
+    size_t size = n * elem_size;
+    Add(size);
+    if ((mLength + size) >= mSize) {
+      mSize = ((mLength + size) / mBlockSize + 1) * mBlockSize;
+      if ((mpBuffer = (char *)realloc(mpBuffer, mSize)) == NULL)
+        throw "Buffer::AddStridedElements(item, n): Can't reallocate memory.";
+    }
+    gvirtus::common::Strided::PackElements(item, n, elem_size, inc, mpBuffer + mLength);
+    mLength += size;
+    mBackOffset = mLength;
+  }
+
   void AddString(const char *s) {
     size_t size = strlen(s) + 1;
     Add(size);
@@ -251,9 +285,14 @@ class Buffer {
     return result;
   }
 
+  /**
+   * Returns the array Add(item, n) wrote, whatever its length; length, if
+   * given, is set to it.
+   */
   template <class T>
-  T *AssignAll() {
+  T *AssignAll(size_t *length = NULL) {
       size_t size = Get<size_t>();
+      if (length != NULL) *length = size / sizeof(T);
       if (size == 0) return NULL;
       size_t n = size / sizeof(T);
       if (mOffset + sizeof(T) * n > mLength)
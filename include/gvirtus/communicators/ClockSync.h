@@ -0,0 +1,67 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   ClockSync.h
+ *
+ * @brief  The exchange by which a frontend that records a timeline measures
+ * the clock of a backend and tells it the difference, answered to the
+ * reserved routine gvirtusClockSync.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Buffer.h"
+
+namespace gvirtus::communicators {
+
+/**
+ * Each request carries the session the frontend named the connection with
+ * and its best estimate so far of the backend's clock minus its own, in
+ * nanoseconds; the backend keeps the last of them for the connection and
+ * answers its wall clock time. The frontend sends Rounds requests and a
+ * last one with the estimate of the round trip that took the least time.
+ */
+class ClockSync {
+ public:
+  static constexpr const char *Routine = "gvirtusClockSync";
+  static const int Rounds = 8;
+
+  uint64_t session = 0;
+  int64_t offset = 0;
+
+  void Marshal(Buffer *in) const {
+    in->Add(session);
+    in->Add(offset);
+  }
+
+  static ClockSync Unmarshal(Buffer *in) {
+    ClockSync sync;
+    sync.session = in->Get<uint64_t>();
+    sync.offset = in->Get<int64_t>();
+    return sync;
+  }
+};
+
+}  // namespace gvirtus::communicators
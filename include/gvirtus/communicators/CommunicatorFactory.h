@@ -1,8 +1,12 @@
 #pragma once
 
 #include <gvirtus/common/LD_Lib.h>
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 #include <stdlib.h> /* getenv */
@@ -28,6 +32,63 @@ namespace gvirtus::communicators {
 #endif
             std::shared_ptr<common::LD_Lib<Communicator, std::shared_ptr<Endpoint>>> dl;
 
+            std::string dl_string = CommunicatorFactory::library_path(end, secure);
+
+            // dl is a ptr to an LD_Lib<Communicator, *Endpoint>
+            dl =
+                    std::make_shared<
+                            common::LD_Lib<
+                                    Communicator,
+                                    std::shared_ptr<Endpoint>
+                            >
+                    >
+                    (dl_string , "create_communicator");
+
+#ifdef DEBUG
+            std::cout << "CommunicatorFactory::get_communicator(): made dl" << std::endl;
+#endif
+
+            dl->build_obj(end);
+
+#ifdef DEBUG
+            std::cout << "CommunicatorFactory::get_communicator() ended" << std::endl;
+#endif
+            return dl;
+        }
+
+        /**
+         * Creates a communicator for end, loading its library only the first
+         * time the protocol is used in the process. The libraries stay loaded
+         * until exit, so the communicators may be created and dropped by any
+         * thread at any time.
+         */
+        static std::shared_ptr<Communicator> create_communicator(
+                std::shared_ptr<Endpoint> end,
+                bool secure = false
+        ) {
+            std::string dl_string = CommunicatorFactory::library_path(end, secure);
+
+            std::shared_ptr<common::LD_Lib<Communicator, std::shared_ptr<Endpoint>>> dl;
+            {
+                std::lock_guard<std::mutex> lock(libraries_mutex);
+                auto it = libraries->find(dl_string);
+                if (it == libraries->end()) {
+                    it = libraries->emplace(dl_string,
+                                           std::make_shared<
+                                                   common::LD_Lib<
+                                                           Communicator,
+                                                           std::shared_ptr<Endpoint>
+                                                   >
+                                           >(dl_string, "create_communicator")).first;
+                }
+                dl = it->second;
+            }
+
+            return dl->create_obj(end);
+        }
+
+    private:
+        static std::string library_path(std::shared_ptr<Endpoint> end, bool secure) {
             std::string gvirtus_home = CommunicatorFactory::getGVirtuSHome();
 
 #ifdef DEBUG
@@ -76,29 +137,16 @@ namespace gvirtus::communicators {
 #ifdef DEBUG
             std::cout << "CommunicatorFactory::get_communicator(): dl_string: " << dl_string << std::endl;
 #endif
-            // dl is a ptr to an LD_Lib<Communicator, *Endpoint>
-            dl =
-                    std::make_shared<
-                            common::LD_Lib<
-                                    Communicator,
-                                    std::shared_ptr<Endpoint>
-                            >
-                    >
-                    (dl_string , "create_communicator");
-
-#ifdef DEBUG
-            std::cout << "CommunicatorFactory::get_communicator(): made dl" << std::endl;
-#endif
-
-            dl->build_obj(end);
-
-#ifdef DEBUG
-            std::cout << "CommunicatorFactory::get_communicator() ended" << std::endl;
-#endif
-            return dl;
+            return dl_string;
         }
 
-    private:
+        // Libraries loaded by create_communicator(), never unloaded (not even
+        // at exit, where communicators owned by other threads may still run)
+        inline static std::mutex libraries_mutex;
+        inline static std::map<std::string,
+                std::shared_ptr<common::LD_Lib<Communicator, std::shared_ptr<Endpoint>>>> *libraries =
+                new std::map<std::string,
+                        std::shared_ptr<common::LD_Lib<Communicator, std::shared_ptr<Endpoint>>>>();
         static std::string getEnvVar(std::string const &key) {
             char *val = getenv(key.c_str());
             return val == NULL ? std::string("") : std::string(val);
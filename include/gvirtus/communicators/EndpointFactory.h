@@ -2,6 +2,7 @@
 
 #include <gvirtus/common/JSON.h>
 #include <memory>
+#include <vector>
 #include <nlohmann/json.hpp>
 #include "Endpoint.h"
 #include "Endpoint_Rdma.h"
@@ -10,7 +11,6 @@
 /**
  * 代码全在h文件中，EndpointFactory.cpp 文件中只有
  * #include "gvirtus/communicators/EndpointFactory.h"
- * int gvirtus::communicators::EndpointFactory::ind_endpoint = 0;
  *  */ 
 //#define DEBUG
 
@@ -22,12 +22,14 @@ class EndpointFactory {
  *
  * This method reads a JSON configuration file to determine the type of endpoint to create.
  * It supports creating TCP/IP and Infiniband RDMA endpoints.
+ * The endpoint is the one of the index-th communicator listed in the file.
  *
  * @param json_path The file path to the JSON configuration file.
+ * @param index The position of the communicator in the "communicator" list.
  * @return A shared pointer to the created Endpoint object.
- * @throws std::runtime_error if the endpoint suite specified in the JSON file is not supported.
+ * @throws const char * if the endpoint suite specified in the JSON file is not supported.
  */
-  static std::shared_ptr<Endpoint> get_endpoint(const fs::path &json_path) {
+  static std::shared_ptr<Endpoint> get_endpoint(const fs::path &json_path, int index = 0) {
 #ifdef DEBUG
       std::cout << "EndpointFactory::get_endpoint() called" << std::endl;
 #endif
@@ -37,43 +39,79 @@ class EndpointFactory {
     nlohmann::json j;
     ifs >> j;
 
+    ptr = make_endpoint(j["communicator"][index]["endpoint"]);
+
+    j.clear();
+    ifs.close();
+
+#ifdef DEBUG
+    std::cout << "EndpointFactoru::get_endpoint(): end is: " << ptr->to_string() << std::endl;
+    std::cout << "EndpointFactory::get_endpoint() ended" << std::endl;
+#endif
+
+    return ptr;
+  }
+
+  /**
+   * Returns the backends a frontend sends its requests to. They are listed
+   * in the optional "backends" array of the configuration file, each as an
+   * endpoint object or as an array of endpoint objects: a pool of
+   * equivalent backends the frontend picks one of. Without the array the
+   * frontend uses the endpoint of the first communicator, as the backend
+   * does.
+   *
+   * @param json_path The file path to the JSON configuration file.
+   * @return The pools, in the order their devices are numbered.
+   */
+  static std::vector<std::vector<std::shared_ptr<Endpoint>>> get_backends(const fs::path &json_path) {
+    std::vector<std::vector<std::shared_ptr<Endpoint>>> pools;
+    std::ifstream ifs(json_path);
+    nlohmann::json j;
+    ifs >> j;
+
+    if (j.contains("backends")) {
+      for (auto &el : j["backends"]) {
+        std::vector<std::shared_ptr<Endpoint>> pool;
+        if (el.is_array()) {
+          for (auto &member : el) pool.push_back(make_endpoint(member));
+        } else {
+          pool.push_back(make_endpoint(el));
+        }
+        if (pool.empty()) throw "EndpointFactory::get_backends(): Empty backend pool!";
+        pools.push_back(pool);
+      }
+    } else {
+      pools.push_back({make_endpoint(j["communicator"][0]["endpoint"])});
+    }
+
+    if (pools.empty()) throw "EndpointFactory::get_backends(): No backend configured!";
+    return pools;
+  }
+
+ private:
+  static std::shared_ptr<Endpoint> make_endpoint(const nlohmann::json &el) {
+    std::shared_ptr<Endpoint> ptr;
+
     // FIXME: This if-else smells...
     // tcp/ip
-    if ("tcp/ip" == j["communicator"][ind_endpoint]["endpoint"].at("suite")) {
+    if ("tcp/ip" == el.at("suite")) {
 #ifdef DEBUG
         std::cout << "EndpointFactory::get_endpoint() found tcp/ip endpoint" << std::endl;
 #endif
-        auto end = common::JSON<Endpoint_Tcp>(json_path).parser();
-        ptr = std::make_shared<Endpoint_Tcp>(end);
+        ptr = std::make_shared<Endpoint_Tcp>(el.get<Endpoint_Tcp>());
     }
     // infiniband
-    else if ("infiniband-rdma" == j["communicator"][ind_endpoint]["endpoint"].at("suite")) {
+    else if ("infiniband-rdma" == el.at("suite")) {
 #ifdef DEBUG
         std::cout << "EndpointFactory::get_endpoint() found infiniband endpoint" << std::endl;
 #endif
-        auto end = common::JSON<Endpoint_Rdma>(json_path).parser();
-        ptr = std::make_shared<Endpoint_Rdma>(end);
+        ptr = std::make_shared<Endpoint_Rdma>(el.get<Endpoint_Rdma>());
     }
     else {
         throw "EndpointFactory::get_endpoint(): Your suite is not compatible!";
     }
 
-    ind_endpoint++;
-
-    j.clear();
-    ifs.close();
-
-#ifdef DEBUG
-    std::cout << "EndpointFactoru::get_endpoint(): end is: " << ptr->to_string() << std::endl;
-    std::cout << "EndpointFactory::get_endpoint() ended" << std::endl;
-#endif
-
     return ptr;
   }
-
-  static int index() { return ind_endpoint; }
-
- private:
-  static int ind_endpoint;
 };
 }  // namespace gvirtus::communicators
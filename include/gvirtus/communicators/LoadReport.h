@@ -0,0 +1,95 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   LoadReport.h
+ *
+ * @brief  The load a backend reports to the frontends choosing among a pool
+ * of backends, answered to the reserved routine gvirtusLoadReport.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Buffer.h"
+
+namespace gvirtus::communicators {
+
+/**
+ * The load of a device. utilization is a percentage, -1 if the backend
+ * cannot sample it.
+ */
+typedef struct __deviceLoad {
+  uint64_t memoryUsed;
+  uint64_t memoryTotal;
+  int utilization;
+} DeviceLoad;
+
+class LoadReport {
+ public:
+  /**
+   * The routine a backend answers with its load report, before any plugin
+   * is asked.
+   */
+  static constexpr const char *Routine = "gvirtusLoadReport";
+
+  /* the frontends connected */
+  int sessions = 0;
+  /* the requests being executed */
+  int requests = 0;
+  std::vector<DeviceLoad> devices;
+
+  void Marshal(Buffer *out) const {
+    out->Add(sessions);
+    out->Add(requests);
+    out->Add(devices.size());
+    for (auto &device : devices) out->Add(device);
+  }
+
+  static LoadReport Unmarshal(Buffer *in) {
+    LoadReport report;
+    report.sessions = in->Get<int>();
+    report.requests = in->Get<int>();
+    size_t n = in->Get<size_t>();
+    for (size_t i = 0; i < n; i++) report.devices.push_back(in->Get<DeviceLoad>());
+    return report;
+  }
+
+  /**
+   * Orders backends by load, lowest first: every session and every request
+   * counts one, every device adds the fraction of its memory in use and of
+   * its time busy.
+   */
+  double Score() const {
+    double score = sessions + requests;
+    for (auto &device : devices) {
+      if (device.memoryTotal > 0)
+        score += (double) device.memoryUsed / device.memoryTotal;
+      if (device.utilization >= 0) score += device.utilization / 100.0;
+    }
+    return score;
+  }
+};
+
+}  // namespace gvirtus::communicators
@@ -53,6 +53,12 @@ class Result {
 
   void Dump(Communicator *c);
 
+  /* size of the output buffer, in bytes */
+  size_t GetOutputSize() const;
+
+  /* NULL if the routine has no output */
+  std::shared_ptr<Buffer> GetOutputBuffer() const;
+
   void TimeTaken(double time_taken);
   double TimeTaken() const;
 
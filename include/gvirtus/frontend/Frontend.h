@@ -39,7 +39,9 @@
 #include <sys/syscall.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <chrono>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -93,6 +95,66 @@ class Frontend {
   void Execute(const char *routine,
                const communicators::Buffer *input_buffer = NULL);
 
+  /**
+   * Requests the execution of a routine whose effects every backend must
+   * see, like the registration of a module or of a symbol. The request is
+   * sent to every backend this process uses, the selected one last so that
+   * its reply is the one left to read, and it is replayed in order to any
+   * backend the process starts using later.
+   *
+   * @param routine the name of the routine to execute.
+   * @param input_buffer the buffer containing the parameters of the routine.
+   */
+  void Broadcast(const char *routine,
+                 const communicators::Buffer *input_buffer = NULL);
+
+  /**
+   * Requests the execution of a routine on another backend, leaving the one
+   * the thread has selected as it is. The backend is connected to, but not
+   * primed: some thread of the process must have selected it before.
+   *
+   * @param backend the index of the backend in the configuration file.
+   * @param routine the name of the routine to execute.
+   * @param input_buffer the buffer containing the parameters of the routine.
+   */
+  void ExecuteOn(int backend, const char *routine,
+                 const communicators::Buffer *input_buffer);
+
+  /**
+   * Requests the execution of a routine while the thread may be in the
+   * middle of another request, e.g. from a signal handler: the output buffer
+   * and the exit code of the interrupted request are left as they were.
+   *
+   * @param routine the name of the routine to execute.
+   * @param input_buffer the buffer containing the parameters of the routine.
+   * @param exit_code where the exit code of routine goes.
+   *
+   * @return the output buffer of routine.
+   */
+  std::shared_ptr<communicators::Buffer> ExecuteAside(
+      const char *routine, const communicators::Buffer *input_buffer,
+      int *exit_code);
+
+  /**
+   * Returns the number of backends listed in the configuration file.
+   */
+  static int GetBackendCount();
+
+  /**
+   * Returns the backend the requests of this thread are sent to.
+   */
+  int GetBackend() { return mBackend; }
+
+  /**
+   * Sends the next requests of this thread to another backend, connecting
+   * to it the first time. The pre-execute hooks run first, with a NULL
+   * routine, so that requests held back reach the backend they were meant
+   * for.
+   *
+   * @param backend the index of the backend in the configuration file.
+   */
+  void SelectBackend(int backend);
+
   /**
    * Prepares the Frontend for the execution. This method _must_ be called
    * before any requests of execution or any method for adding parameters for
@@ -126,6 +188,26 @@ class Frontend {
    */
   bool Success(int success_value = 0) { return mExitCode == success_value; }
 
+  /**
+   * Registers a function to run before every execution request. A plugin
+   * that holds requests back uses it to send them ahead of anything that
+   * could observe their effects. Hooks must be registered before the first
+   * request, e.g. while the plugin library is being loaded. They also run
+   * before the thread switches backend.
+   *
+   * @param hook the function to run, called with the routine name, or NULL
+   * when the thread is switching backend.
+   */
+  static void AddPreExecuteHook(void (*hook)(const char *routine));
+
+  /**
+   * Registers a function to run once the reply to every execution request
+   * has been read, under the same rules as AddPreExecuteHook().
+   *
+   * @param hook the function to run, called with the routine name.
+   */
+  static void AddPostExecuteHook(void (*hook)(const char *routine));
+
 #if 0
   /**
    * Adds a scalar variabile as an input parameter for the next execution
@@ -231,14 +313,34 @@ class Frontend {
    * setted at compile time.
    */
   void Init(communicators::Communicator *c);
-  std::shared_ptr<common::LD_Lib<communicators::Communicator,std::shared_ptr<communicators::Endpoint>>>
-      _communicator;
+
+  /**
+   * Sets up what every thread shares: the logger and the endpoint read from
+   * the configuration file. Runs once, on the first Init() of the process.
+   */
+  static void Configure();
+
+  void Connect(int backend);
+  void SyncClock(int backend);
+  void Prime(int backend);
+
+  std::shared_ptr<communicators::Communicator> _communicator;
+  std::vector<std::shared_ptr<communicators::Communicator>> mCommunicators;
+  int mBackend = 0;
+  /* requests sent on each connection, numbering them for the probes */
+  std::vector<uint64_t> mRequestIds;
+  /* the name each connection is known by on both timelines, 0 if none */
+  std::vector<uint64_t> mSessions;
+  /* when Prepare() started marshalling the next request, for the timeline */
+  std::chrono::steady_clock::time_point mPrepared;
   std::shared_ptr<communicators::Buffer> mpInputBuffer;
   std::shared_ptr<communicators::Buffer> mpOutputBuffer;
   std::shared_ptr<communicators::Buffer> mpLaunchBuffer;
 
   int mExitCode;
   static std::map<pthread_t, Frontend *> *mpFrontends;
+  static std::vector<void (*)(const char *)> *mpPreExecuteHooks;
+  static std::vector<void (*)(const char *)> *mpPostExecuteHooks;
   bool mpInitialized;
 
 // 已经执行的routine数量
@@ -250,5 +352,6 @@ class Frontend {
   double mSendingTime = 0.0;
   double mReceivingTime = 0.0;
   double mRoutineExecutionTime = 0.0;
+  double mInitTime = 0.0;
 };
 }  // namespace gvirtus::frontend
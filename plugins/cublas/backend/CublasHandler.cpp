@@ -366,7 +366,7 @@ void OpenclHandler::RegisterFatBinary(std::string& handler, void ** fatCubinHand
         mpFatBinary->erase(it);
     }
     mpFatBinary->insert(make_pair(handler, fatCubinHandle));
-    cout << "Registered FatBinary " << fatCubinHandle << " with handler " << handler << endl;
+    GVIRTUS_LOG_DEBUG(logger, "Registered FatBinary " << fatCubinHandle << " with handler " << handler);
 }
 
 void OpenclHandler::RegisterFatBinary(const char* handler, void ** fatCubinHandle) {
@@ -391,8 +391,8 @@ void OpenclHandler::UnregisterFatBinary(std::string& handler) {
     if (it == mpFatBinary->end())
         return;
     // FIXME: think about freeing memory
-    cout << "Unregistered FatBinary " << it->second << " with handler "
-            << handler << endl;
+    GVIRTUS_LOG_DEBUG(logger, "Unregistered FatBinary " << it->second << " with handler "
+            << handler);
     mpFatBinary->erase(it);
 }
 
@@ -406,7 +406,7 @@ void OpenclHandler::RegisterDeviceFunction(std::string & handler, std::string &
     if (it != mpDeviceFunction->end())
         mpDeviceFunction->erase(it);
     mpDeviceFunction->insert(make_pair(handler, function));
-    cout << "Registered DeviceFunction " << function << " with handler " << handler << endl;
+    GVIRTUS_LOG_DEBUG(logger, "Registered DeviceFunction " << function << " with handler " << handler);
 }
 
 void OpenclHandler::RegisterDeviceFunction(const char * handler, const char * function) {
@@ -429,7 +429,7 @@ const char *OpenclHandler::GetDeviceFunction(const char * handler) {
 
 void OpenclHandler::RegisterVar(string & handler, string & symbol) {
     mpVar->insert(make_pair(handler, symbol));
-    cout << "Registered Var " << symbol << " with handler " << handler << endl;
+    GVIRTUS_LOG_DEBUG(logger, "Registered Var " << symbol << " with handler " << handler);
 }
 
 void OpenclHandler::RegisterVar(const char* handler, const char* symbol) {
@@ -454,8 +454,7 @@ const char * OpenclHandler::GetVar(const char* handler) {
 /*
 void OpenclHandler::RegisterTexture(string& handler, textureReference* texref) {
     mpTexture->insert(make_pair(handler, texref));
-    cout << "Registered Texture " << texref << " with handler " << handler
-            << endl;
+    GVIRTUS_LOG_DEBUG(logger, "Registered Texture " << texref << " with handler " << handler);
 }
 
 void OpenclHandler::RegisterTexture(const char* handler,
@@ -44,6 +44,7 @@
 #include "cublas_v2.h"
 
 #include <gvirtus/backend/Handler.h>
+#include <gvirtus/common/Log.h>
 #include <gvirtus/communicators/Result.h>
 
 #include "log4cplus/configurator.h"
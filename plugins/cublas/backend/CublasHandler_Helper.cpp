@@ -29,17 +29,18 @@
 #include <string>
 
 CUBLAS_ROUTINE_HANDLER(Create) {
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Create"));
     cublasHandle_t handle=in->Get<cublasHandle_t>();
     cublasStatus_t cublas_status=cublasCreate(&handle);
 
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
-    cout << "Handler create: " << handle << endl;
+    GVIRTUS_LOG_DEBUG(logger, "Handler create: " << handle);
     out->Add<cublasHandle_t>(handle);
     return std::make_shared<Result>(cublas_status, out);
 }
 
 CUBLAS_ROUTINE_HANDLER(GetVersion_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
     
     cublasHandle_t handle=(cublasHandle_t)in->Get<long long int>();
     int version;
@@ -49,15 +50,15 @@ CUBLAS_ROUTINE_HANDLER(GetVersion_v2){
     try{
         out->Add<int>(version);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    cout << "DEBUG - cublasGetVersion Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasGetVersion Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Create_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Create_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Create_v2"));
     cublasHandle_t handle ;//= in->Assign<cublasHandle_t>();
     cublasStatus_t cs = cublasCreate_v2(&handle);
 
@@ -66,17 +67,15 @@ CUBLAS_ROUTINE_HANDLER(Create_v2){
     try{
         out->Add<cublasHandle_t>(handle);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    if(cs != CUBLAS_STATUS_SUCCESS)
-        cout<<"----Error---"<<endl;
 //    cout << "DEBUG - cublasCreate_v2 Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Destroy_v2) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Destroy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Destroy_v2"));
     cublasHandle_t handle=(cublasHandle_t)in->Get<long long int>();
     cublasStatus_t cs=cublasDestroy(handle);
  //   cout << "DEBUG - cublasDestroy_v2 Executed"<<endl;
@@ -86,7 +85,7 @@ CUBLAS_ROUTINE_HANDLER(Destroy_v2) {
 
 
 CUBLAS_ROUTINE_HANDLER(SetVector){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetVector"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetVector"));
     
     int n = in->Get<int>();
     int elemSize = in->Get<int>();
@@ -97,18 +96,12 @@ CUBLAS_ROUTINE_HANDLER(SetVector){
     const void * x = in->AssignAll<char>();
     
     cublasStatus_t cs = cublasSetVector(n,elemSize,x,incx,y,incy);
-    if(cs == CUBLAS_STATUS_NOT_INITIALIZED)
-        cout<<"1"<<endl;
-    if(cs == CUBLAS_STATUS_INVALID_VALUE)
-        cout<<"2"<<endl;
-    if(cs == CUBLAS_STATUS_MAPPING_ERROR)
-        cout<<"3"<<endl;
-    cout << "DEBUG - cublasSetVector Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasSetVector Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUBLAS_ROUTINE_HANDLER(SetMatrix){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetMatrix"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetMatrix"));
     
     int rows = (int)in->Get<int>();
     int cols = (int)in->Get<int>();
@@ -119,19 +112,13 @@ CUBLAS_ROUTINE_HANDLER(SetMatrix){
     
     void * A = in->AssignAll<char>();
     cublasStatus_t cs = cublasSetMatrix(rows,cols,elemSize,A,lda,B,ldb);
-    if(cs == CUBLAS_STATUS_NOT_INITIALIZED)
-        cout<<"1"<<endl;
-    if(cs == CUBLAS_STATUS_INVALID_VALUE)
-        cout<<"2"<<endl;
-    if(cs == CUBLAS_STATUS_MAPPING_ERROR)
-        cout<<"3"<<endl;
-    cout << "DEBUG - cublasSetVector Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasSetMatrix Executed");
     return std::make_shared<Result>(cs);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(GetVector){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetVector"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetVector"));
     
     int n = (int)in->Get<int>();
     int elemSize = (int)in->Get<int>();
@@ -139,60 +126,65 @@ CUBLAS_ROUTINE_HANDLER(GetVector){
     int incy = (int)in->Get<int>();
     
     void * x = in->GetFromMarshal<void*>();
-    void * y = in->Assign<void>();
+    /* y is packed here and scattered by the frontend with incy */
+    char * y = new char[n*elemSize];
     
     cublasStatus_t cs;
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
 
     try{
-        cs = cublasGetVector(n,elemSize,x,incx,y,incy);
+        cs = cublasGetVector(n,elemSize,x,incx,y,1);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        delete[] y;
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
     
-    out->Add<char>((char*)y,n*elemSize);
-    cout << "DEBUG - cublasGetVector Executed"<<endl;
+    out->Add<char>(y,n*elemSize);
+    delete[] y;
+    GVIRTUS_LOG_DEBUG(logger, "cublasGetVector Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(GetMatrix) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetMatrix"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetMatrix"));
     
     int rows = (int)in->Get<int>();
     int cols = (int)in->Get<int>();
     int elemSize = (int)in->Get<int>();
     void * A = in->GetFromMarshal<void*>();
     int lda = (int)in->Get<int>();
-    void * B = in->Assign<void>();
-    int ldb = (int)in->Get<int>();
+    /* B is packed here and scattered by the frontend with ldb */
+    char * B = new char[rows*cols*elemSize];
     
     cublasStatus_t cs;
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
 
     try{
-        cs = cublasGetMatrix(rows,cols,elemSize,A,lda,B,ldb);
+        cs = cublasGetMatrix(rows,cols,elemSize,A,lda,B,rows);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        delete[] B;
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    out->Add<char>((char*)B,rows*cols*elemSize);
-    cout << "DEBUG - cublasGetMatrix Executed"<<endl;
+    out->Add<char>(B,rows*cols*elemSize);
+    delete[] B;
+    GVIRTUS_LOG_DEBUG(logger, "cublasGetMatrix Executed");
     return std::make_shared<Result>(cs,out);
 }
 CUBLAS_ROUTINE_HANDLER(SetStream_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     cudaStream_t streamId = (cudaStream_t) in->Get<long long int>();
     
     cublasStatus_t cs = cublasSetStream_v2(handle,streamId);
-    cout << "DEBUG - cublasSetStream Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasSetStream Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUBLAS_ROUTINE_HANDLER(GetStream_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     cudaStream_t *streamId;
@@ -202,15 +194,15 @@ CUBLAS_ROUTINE_HANDLER(GetStream_v2){
     try {
         out->Add<long long int>((long long int)*streamId);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    cout << "DEBUG - cublasGetStream Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasGetStream Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(GetPointerMode_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetPointerMode_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetPointerMode_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     cublasPointerMode_t mode;
@@ -220,16 +212,16 @@ CUBLAS_ROUTINE_HANDLER(GetPointerMode_v2){
     try{
         out->Add<cublasPointerMode_t>(mode);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    cout << "DEBUG - cublasGetPointerMode_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasGetPointerMode_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(SetPointerMode_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetPointerMode_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetPointerMode_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     cublasPointerMode_t mode = in->Get<cublasPointerMode_t>();
@@ -239,10 +231,10 @@ CUBLAS_ROUTINE_HANDLER(SetPointerMode_v2){
     try{
         out->Add<cublasPointerMode_t>(mode);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    cout << "DEBUG - cublasSetPointerMode_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasSetPointerMode_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
@@ -44,7 +44,7 @@ using namespace std;
 */
 
 CUBLAS_ROUTINE_HANDLER(Sdot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sdot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sdot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -56,13 +56,13 @@ CUBLAS_ROUTINE_HANDLER(Sdot_v2){
     
     cublasStatus_t cs = cublasSdot_v2(handle,n,x,incx,y,incy,result);
     
-    cout << "DEBUG - cublasSdot_v2 Executed"<<endl;    
+    GVIRTUS_LOG_DEBUG(logger, "cublasSdot_v2 Executed");
     return std::make_shared<Result>(cs);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(Ddot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ddot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ddot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -74,13 +74,13 @@ CUBLAS_ROUTINE_HANDLER(Ddot_v2){
     
     cublasStatus_t cs = cublasDdot_v2(handle,n,x,incx,y,incy,result);
     
-    cout << "DEBUG - cublasDdot_v2 Executed"<<endl;    
+    GVIRTUS_LOG_DEBUG(logger, "cublasDdot_v2 Executed");
     return std::make_shared<Result>(cs);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(Cdotu_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cdotu_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cdotu_v2"));
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
     cuComplex * x = in->GetFromMarshal<cuComplex*>();
@@ -91,12 +91,12 @@ CUBLAS_ROUTINE_HANDLER(Cdotu_v2){
     
     cublasStatus_t cs = cublasCdotu_v2(handle,n,x,incx,y,incy,result);
     
-    cout << "DEBUG - cublasCdotu_v2 Executed"<<endl;    
+    GVIRTUS_LOG_DEBUG(logger, "cublasCdotu_v2 Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUBLAS_ROUTINE_HANDLER(Cdotc_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cdotc_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cdotc_v2"));
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
     cuComplex * x = in->GetFromMarshal<cuComplex*>();
@@ -107,12 +107,12 @@ CUBLAS_ROUTINE_HANDLER(Cdotc_v2){
     
     cublasStatus_t cs = cublasCdotc_v2(handle,n,x,incx,y,incy,result);
     
-    cout << "DEBUG - cublasCdotc_v2 Executed"<<endl;    
+    GVIRTUS_LOG_DEBUG(logger, "cublasCdotc_v2 Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUBLAS_ROUTINE_HANDLER(Zdotu_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zdotu_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zdotu_v2"));
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
     cuDoubleComplex * x = in->GetFromMarshal<cuDoubleComplex*>();
@@ -123,12 +123,12 @@ CUBLAS_ROUTINE_HANDLER(Zdotu_v2){
     
     cublasStatus_t cs = cublasZdotu_v2(handle,n,x,incx,y,incy,result);
     
-    cout << "DEBUG - cublasZdotu_v2 Executed"<<endl;    
+    GVIRTUS_LOG_DEBUG(logger, "cublasZdotu_v2 Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUBLAS_ROUTINE_HANDLER(Zdotc_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zdotc_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zdotc_v2"));
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
     cuDoubleComplex * x = in->GetFromMarshal<cuDoubleComplex*>();
@@ -139,7 +139,7 @@ CUBLAS_ROUTINE_HANDLER(Zdotc_v2){
     
     cublasStatus_t cs = cublasZdotc_v2(handle,n,x,incx,y,incy,result);
     
-    cout << "DEBUG - cublasZdotc_v2 Executed"<<endl;    
+    GVIRTUS_LOG_DEBUG(logger, "cublasZdotc_v2 Executed");
     return std::make_shared<Result>(cs);
 }
 
@@ -204,7 +204,7 @@ CUBLAS_ROUTINE_HANDLER(Zdscal_v2) {
 }
 
 CUBLAS_ROUTINE_HANDLER(Saxpy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Saxpy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Saxpy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n=in->Get<int>();
@@ -218,7 +218,7 @@ CUBLAS_ROUTINE_HANDLER(Saxpy_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Daxpy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Daxpy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Daxpy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -232,7 +232,7 @@ CUBLAS_ROUTINE_HANDLER(Daxpy_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Caxpy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zaxpy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zaxpy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -246,7 +246,7 @@ CUBLAS_ROUTINE_HANDLER(Caxpy_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zaxpy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zaxpy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zaxpy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -261,7 +261,7 @@ CUBLAS_ROUTINE_HANDLER(Zaxpy_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Scopy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Scopy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Scopy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -274,7 +274,7 @@ CUBLAS_ROUTINE_HANDLER(Scopy_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dcopy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dcopy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dcopy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -287,7 +287,7 @@ CUBLAS_ROUTINE_HANDLER(Dcopy_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ccopy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ccopy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ccopy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -300,7 +300,7 @@ CUBLAS_ROUTINE_HANDLER(Ccopy_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zcopy_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zcopy_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zcopy_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -313,7 +313,7 @@ CUBLAS_ROUTINE_HANDLER(Zcopy_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Sswap_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sswap_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sswap_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -326,7 +326,7 @@ CUBLAS_ROUTINE_HANDLER(Sswap_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dswap_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dswap_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dswap_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -339,7 +339,7 @@ CUBLAS_ROUTINE_HANDLER(Dswap_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Cswap_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dswap_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dswap_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -352,7 +352,7 @@ CUBLAS_ROUTINE_HANDLER(Cswap_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zswap_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zswap_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zswap_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -365,7 +365,7 @@ CUBLAS_ROUTINE_HANDLER(Zswap_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Isamax_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Isamax_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Isamax_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -381,7 +381,7 @@ CUBLAS_ROUTINE_HANDLER(Isamax_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Idamax_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Idamax_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Idamax_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -397,7 +397,7 @@ CUBLAS_ROUTINE_HANDLER(Idamax_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Icamax_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Icamax_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Icamax_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -413,7 +413,7 @@ CUBLAS_ROUTINE_HANDLER(Icamax_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Izamax_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Izamax_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Izamax_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -429,7 +429,7 @@ CUBLAS_ROUTINE_HANDLER(Izamax_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Isamin_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Isamin_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Isamin_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -445,7 +445,7 @@ CUBLAS_ROUTINE_HANDLER(Isamin_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Idamin_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Idamin_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Idamin_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -461,7 +461,7 @@ CUBLAS_ROUTINE_HANDLER(Idamin_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Icamin_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Icamin_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Icamin_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -477,7 +477,7 @@ CUBLAS_ROUTINE_HANDLER(Icamin_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Izamin_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Izamin_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Izamin_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -493,7 +493,7 @@ CUBLAS_ROUTINE_HANDLER(Izamin_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Sasum_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sasum_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sasum_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -509,7 +509,7 @@ CUBLAS_ROUTINE_HANDLER(Sasum_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dasum_v2){
-   Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dasum_v2"));
+   static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dasum_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -525,7 +525,7 @@ CUBLAS_ROUTINE_HANDLER(Dasum_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Scasum_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Scasum_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Scasum_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -541,7 +541,7 @@ CUBLAS_ROUTINE_HANDLER(Scasum_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dzasum_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dzasum_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dzasum_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -557,7 +557,7 @@ CUBLAS_ROUTINE_HANDLER(Dzasum_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Srot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -573,7 +573,7 @@ CUBLAS_ROUTINE_HANDLER(Srot_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Drot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -589,7 +589,7 @@ CUBLAS_ROUTINE_HANDLER(Drot_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Crot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Crot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Crot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -605,7 +605,7 @@ CUBLAS_ROUTINE_HANDLER(Crot_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Csrot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csrot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csrot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -621,7 +621,7 @@ CUBLAS_ROUTINE_HANDLER(Csrot_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zrot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zrot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zrot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -637,7 +637,7 @@ CUBLAS_ROUTINE_HANDLER(Zrot_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zdrot_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zdrot_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zdrot_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -653,7 +653,7 @@ CUBLAS_ROUTINE_HANDLER(Zdrot_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Srotg_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srotg_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srotg_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     float * a = in->Assign<float>();
@@ -666,7 +666,7 @@ CUBLAS_ROUTINE_HANDLER(Srotg_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Drotg_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotg_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotg_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     double * a = in->Assign<double>();
@@ -680,7 +680,7 @@ CUBLAS_ROUTINE_HANDLER(Drotg_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Crotg_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotg_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotg_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     cuComplex * a = in->Assign<cuComplex>();
@@ -693,7 +693,7 @@ CUBLAS_ROUTINE_HANDLER(Crotg_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zrotg_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotg_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotg_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     cuDoubleComplex * a = in->Assign<cuDoubleComplex>();
@@ -706,7 +706,7 @@ CUBLAS_ROUTINE_HANDLER(Zrotg_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Srotm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srotm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srotm_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -721,7 +721,7 @@ CUBLAS_ROUTINE_HANDLER(Srotm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Drotm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotm_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     int n = in->Get<int>();
@@ -736,7 +736,7 @@ CUBLAS_ROUTINE_HANDLER(Drotm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Srotmg_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srotmg_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Srotmg_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     float * d1 = in->Assign<float>();
@@ -754,7 +754,7 @@ CUBLAS_ROUTINE_HANDLER(Srotmg_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Drotmg_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotmg_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Drotmg_v2"));
     
     cublasHandle_t handle = (cublasHandle_t)in->Get<long long int>();
     double * d1 = in->Assign<double>();
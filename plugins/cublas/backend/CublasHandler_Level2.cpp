@@ -33,7 +33,7 @@ using namespace log4cplus;
 
 
 CUBLAS_ROUTINE_HANDLER(Sgemv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sgemv"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sgemv"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -56,14 +56,14 @@ CUBLAS_ROUTINE_HANDLER(Sgemv_v2){
     try{
         cs = cublasSgemv_v2(handle,trans,m,n,alpha,A,lda,x,incx,beta,y,incy);
         if (cs == CUBLAS_STATUS_INVALID_VALUE)
-            cout<<"invalid value"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "invalid value");
         if (cs == CUBLAS_STATUS_ARCH_MISMATCH)
-            cout<<"arch mismatch"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "arch mismatch");
         if( cs == CUBLAS_STATUS_EXECUTION_FAILED)
-            cout<<"Execution failed"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "Execution failed");
         out->AddMarshal<float *>(y);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
     //cout << "DEBUG - cublasSgemv_v2 Executed"<<endl;
@@ -71,7 +71,7 @@ CUBLAS_ROUTINE_HANDLER(Sgemv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dgemv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dgemv"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dgemv"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -79,7 +79,7 @@ CUBLAS_ROUTINE_HANDLER(Dgemv_v2){
     int m  = in->Get<int>();
     int n  = in->Get<int>();
     const double * alpha = in->Assign<double>();
-    cout << "alpha: "<<*alpha<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "alpha: "<<*alpha);
     double * A = in->GetFromMarshal<double*>();
     int lda = in->Get<int>();
     double * x = in->GetFromMarshal<double*>();
@@ -94,22 +94,22 @@ CUBLAS_ROUTINE_HANDLER(Dgemv_v2){
     try{
         cs = cublasDgemv_v2(handle,trans,m,n,alpha,A,lda,x,incx,beta,y,incy);
         if (cs == CUBLAS_STATUS_INVALID_VALUE)
-            cout<<"invalid value"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "invalid value");
         if (cs == CUBLAS_STATUS_ARCH_MISMATCH)
-            cout<<"arch mismatch"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "arch mismatch");
         if( cs == CUBLAS_STATUS_EXECUTION_FAILED)
-            cout<<"Execution failed"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "Execution failed");
         out->AddMarshal<double *>(y);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasDgemv_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasDgemv_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Cgemv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgemv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgemv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -131,23 +131,23 @@ CUBLAS_ROUTINE_HANDLER(Cgemv_v2){
     try{
         cs = cublasCgemv_v2(handle,trans,m,n,alpha,A,lda,x,incx,beta,y,incy);
         if (cs == CUBLAS_STATUS_INVALID_VALUE)
-            cout<<"invalid value"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "invalid value");
         if (cs == CUBLAS_STATUS_ARCH_MISMATCH)
-            cout<<"arch mismatch"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "arch mismatch");
         if( cs == CUBLAS_STATUS_EXECUTION_FAILED)
-            cout<<"Execution failed"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "Execution failed");
         out->AddMarshal<cuComplex *>(y);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasCgemv_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasCgemv_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(Zgemv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgemv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgemv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -169,22 +169,22 @@ CUBLAS_ROUTINE_HANDLER(Zgemv_v2){
     try{
         cs = cublasZgemv_v2(handle,trans,m,n,alpha,A,lda,x,incx,beta,y,incy);
         if (cs == CUBLAS_STATUS_INVALID_VALUE)
-            cout<<"invalid value"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "invalid value");
         if (cs == CUBLAS_STATUS_ARCH_MISMATCH)
-            cout<<"arch mismatch"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "arch mismatch");
         if( cs == CUBLAS_STATUS_EXECUTION_FAILED)
-            cout<<"Execution failed"<<endl;
+            GVIRTUS_LOG_DEBUG(logger, "Execution failed");
         out->AddMarshal<cuDoubleComplex *>(y);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasZgemv_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasZgemv_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Sgbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sgbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sgbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -207,7 +207,7 @@ CUBLAS_ROUTINE_HANDLER(Sgbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dgbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dgbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dgbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -230,7 +230,7 @@ CUBLAS_ROUTINE_HANDLER(Dgbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Cgbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -253,7 +253,7 @@ CUBLAS_ROUTINE_HANDLER(Cgbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zgbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -276,7 +276,7 @@ CUBLAS_ROUTINE_HANDLER(Zgbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Strmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -294,7 +294,7 @@ CUBLAS_ROUTINE_HANDLER(Strmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtrmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -312,7 +312,7 @@ CUBLAS_ROUTINE_HANDLER(Dtrmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctrmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -330,7 +330,7 @@ CUBLAS_ROUTINE_HANDLER(Ctrmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztrmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -348,7 +348,7 @@ CUBLAS_ROUTINE_HANDLER(Ztrmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Stbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -367,7 +367,7 @@ CUBLAS_ROUTINE_HANDLER(Stbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -386,7 +386,7 @@ CUBLAS_ROUTINE_HANDLER(Dtbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -405,7 +405,7 @@ CUBLAS_ROUTINE_HANDLER(Ctbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -424,7 +424,7 @@ CUBLAS_ROUTINE_HANDLER(Ztbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Stpmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stpmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stpmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -441,7 +441,7 @@ CUBLAS_ROUTINE_HANDLER(Stpmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtpmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtpmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtpmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -458,7 +458,7 @@ CUBLAS_ROUTINE_HANDLER(Dtpmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctpmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctpmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctpmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -475,7 +475,7 @@ CUBLAS_ROUTINE_HANDLER(Ctpmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztpmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztpmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztpmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -492,7 +492,7 @@ CUBLAS_ROUTINE_HANDLER(Ztpmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Strsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -510,7 +510,7 @@ CUBLAS_ROUTINE_HANDLER(Strsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtrsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -528,7 +528,7 @@ CUBLAS_ROUTINE_HANDLER(Dtrsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctrsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -546,7 +546,7 @@ CUBLAS_ROUTINE_HANDLER(Ctrsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztrsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -565,7 +565,7 @@ CUBLAS_ROUTINE_HANDLER(Ztrsv_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Stpsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stpsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stpsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -582,7 +582,7 @@ CUBLAS_ROUTINE_HANDLER(Stpsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtpsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtpsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtpsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -599,7 +599,7 @@ CUBLAS_ROUTINE_HANDLER(Dtpsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctpsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctpsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctpsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -616,7 +616,7 @@ CUBLAS_ROUTINE_HANDLER(Ctpsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztpsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztpsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztpsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -633,7 +633,7 @@ CUBLAS_ROUTINE_HANDLER(Ztpsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Stbsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stbsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Stbsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -652,7 +652,7 @@ CUBLAS_ROUTINE_HANDLER(Stbsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtbsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtbsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtbsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -671,7 +671,7 @@ CUBLAS_ROUTINE_HANDLER(Dtbsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctbsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctbsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctbsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -690,7 +690,7 @@ CUBLAS_ROUTINE_HANDLER(Ctbsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztbsv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztbsv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztbsv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -709,7 +709,7 @@ CUBLAS_ROUTINE_HANDLER(Ztbsv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ssymv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssymv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssymv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -730,7 +730,7 @@ CUBLAS_ROUTINE_HANDLER(Ssymv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dsymv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsymv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsymv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -751,7 +751,7 @@ CUBLAS_ROUTINE_HANDLER(Dsymv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Csymv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csymv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csymv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -772,7 +772,7 @@ CUBLAS_ROUTINE_HANDLER(Csymv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zsymv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsymv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsymv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -793,7 +793,7 @@ CUBLAS_ROUTINE_HANDLER(Zsymv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Chemv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chemv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chemv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -814,7 +814,7 @@ CUBLAS_ROUTINE_HANDLER(Chemv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zhemv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhemv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhemv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -835,7 +835,7 @@ CUBLAS_ROUTINE_HANDLER(Zhemv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ssbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -857,7 +857,7 @@ CUBLAS_ROUTINE_HANDLER(Ssbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dsbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -879,7 +879,7 @@ CUBLAS_ROUTINE_HANDLER(Dsbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Chbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -901,7 +901,7 @@ CUBLAS_ROUTINE_HANDLER(Chbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zhbmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhbmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhbmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -923,7 +923,7 @@ CUBLAS_ROUTINE_HANDLER(Zhbmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Sspmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -943,7 +943,7 @@ CUBLAS_ROUTINE_HANDLER(Sspmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dspmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dspmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dspmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -963,7 +963,7 @@ CUBLAS_ROUTINE_HANDLER(Dspmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Chpmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chpmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chpmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -983,7 +983,7 @@ CUBLAS_ROUTINE_HANDLER(Chpmv_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zhpmv_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhpmv_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhpmv_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1004,7 +1004,7 @@ CUBLAS_ROUTINE_HANDLER(Zhpmv_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Sger_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sger_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sger_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1023,7 +1023,7 @@ CUBLAS_ROUTINE_HANDLER(Sger_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dger_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dger_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dger_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1042,7 +1042,7 @@ CUBLAS_ROUTINE_HANDLER(Dger_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Cgeru_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgeru_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgeru_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1061,7 +1061,7 @@ CUBLAS_ROUTINE_HANDLER(Cgeru_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Cgerc_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgerc_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgerc_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1080,7 +1080,7 @@ CUBLAS_ROUTINE_HANDLER(Cgerc_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zgeru_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgeru_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgeru_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1099,7 +1099,7 @@ CUBLAS_ROUTINE_HANDLER(Zgeru_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zgerc_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgerc_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgerc_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1119,7 +1119,7 @@ CUBLAS_ROUTINE_HANDLER(Zgerc_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Ssyr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1136,7 +1136,7 @@ CUBLAS_ROUTINE_HANDLER(Ssyr_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dsyr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1153,7 +1153,7 @@ CUBLAS_ROUTINE_HANDLER(Dsyr_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Csyr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1170,7 +1170,7 @@ CUBLAS_ROUTINE_HANDLER(Csyr_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zsyr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1187,7 +1187,7 @@ CUBLAS_ROUTINE_HANDLER(Zsyr_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Cher_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cher_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cher_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1204,7 +1204,7 @@ CUBLAS_ROUTINE_HANDLER(Cher_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zher_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zher_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zher_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1222,7 +1222,7 @@ CUBLAS_ROUTINE_HANDLER(Zher_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Sspr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1239,7 +1239,7 @@ CUBLAS_ROUTINE_HANDLER(Sspr_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Dspr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dspr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dspr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1255,7 +1255,7 @@ CUBLAS_ROUTINE_HANDLER(Dspr_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Chpr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chpr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chpr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1271,7 +1271,7 @@ CUBLAS_ROUTINE_HANDLER(Chpr_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zhpr_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhpr_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhpr_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1287,7 +1287,7 @@ CUBLAS_ROUTINE_HANDLER(Zhpr_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ssyr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1306,7 +1306,7 @@ CUBLAS_ROUTINE_HANDLER(Ssyr2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dsyr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1325,7 +1325,7 @@ CUBLAS_ROUTINE_HANDLER(Dsyr2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Csyr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1344,7 +1344,7 @@ CUBLAS_ROUTINE_HANDLER(Csyr2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zsyr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1363,7 +1363,7 @@ CUBLAS_ROUTINE_HANDLER(Zsyr2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Cher2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cher2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cher2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1382,7 +1382,7 @@ CUBLAS_ROUTINE_HANDLER(Cher2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zher2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1402,7 +1402,7 @@ CUBLAS_ROUTINE_HANDLER(Zher2_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Sspr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1420,7 +1420,7 @@ CUBLAS_ROUTINE_HANDLER(Sspr2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dspr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sspr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1438,7 +1438,7 @@ CUBLAS_ROUTINE_HANDLER(Dspr2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Chpr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chpr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chpr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -1456,7 +1456,7 @@ CUBLAS_ROUTINE_HANDLER(Chpr2_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zhpr2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhpr2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhpr2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -7,7 +7,7 @@ using namespace std;
 using namespace log4cplus;
 
 CUBLAS_ROUTINE_HANDLER(Sgemm_v2) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sgemm"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Sgemm"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -33,7 +33,7 @@ CUBLAS_ROUTINE_HANDLER(Sgemm_v2) {
         cs = cublasSgemm(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc);
         out->AddMarshal<float *>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
    // cout << "DEBUG - cublasSgemm_v2 Executed"<<endl;
@@ -41,7 +41,7 @@ CUBLAS_ROUTINE_HANDLER(Sgemm_v2) {
 }
 
 CUBLAS_ROUTINE_HANDLER(SgemmBatched_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SgemmBatched"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SgemmBatched"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -69,15 +69,15 @@ CUBLAS_ROUTINE_HANDLER(SgemmBatched_v2){
         cs = cublasSgemmBatched(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,batchSize);
         out->AddMarshal<float **>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasSgemmBatched_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasSgemmBatched_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Dgemm_v2) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dgemm"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dgemm"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -103,15 +103,15 @@ CUBLAS_ROUTINE_HANDLER(Dgemm_v2) {
         cs = cublasDgemm(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc);
         out->AddMarshal<double *>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasDgemm_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasDgemm_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(DgemmBatched_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("DgemmBatched"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("DgemmBatched"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -139,16 +139,16 @@ CUBLAS_ROUTINE_HANDLER(DgemmBatched_v2){
         cs = cublasDgemmBatched(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,batchSize);
         out->AddMarshal<double **>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasDgemmBatched_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasDgemmBatched_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(Cgemm_v2) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgemm"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cgemm"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -174,15 +174,15 @@ CUBLAS_ROUTINE_HANDLER(Cgemm_v2) {
         cs = cublasCgemm(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc);
         out->AddMarshal<cuComplex *>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasCgemm_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasCgemm_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(CgemmBatched_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("CgemmBatched"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("CgemmBatched"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -210,16 +210,16 @@ CUBLAS_ROUTINE_HANDLER(CgemmBatched_v2){
         cs = cublasCgemmBatched(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,batchSize);
         out->AddMarshal<cuComplex **>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasCgemmBatched_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasCgemmBatched_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(Zgemm_v2) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgemm"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zgemm"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -245,15 +245,15 @@ CUBLAS_ROUTINE_HANDLER(Zgemm_v2) {
         cs = cublasZgemm(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc);
         out->AddMarshal<cuDoubleComplex *>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasZgemm_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasZgemm_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(ZgemmBatched_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ZgemmBatched"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ZgemmBatched"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -281,16 +281,16 @@ CUBLAS_ROUTINE_HANDLER(ZgemmBatched_v2){
         cs = cublasZgemmBatched(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc,batchSize);
         out->AddMarshal<cuDoubleComplex **>(C);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasZgemmBatched_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasZgemmBatched_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 
 CUBLAS_ROUTINE_HANDLER(Snrm2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Snrm2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Snrm2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -305,15 +305,15 @@ CUBLAS_ROUTINE_HANDLER(Snrm2_v2){
     try{
         out->Add<float>(*result);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasSnrm2_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasSnrm2_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Dnrm2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dnrm2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dnrm2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -328,15 +328,15 @@ CUBLAS_ROUTINE_HANDLER(Dnrm2_v2){
     try{
         out->Add<double>(*result);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasDnrm2_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasDnrm2_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Scnrm2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Scnrm2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Scnrm2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -351,15 +351,15 @@ CUBLAS_ROUTINE_HANDLER(Scnrm2_v2){
     try{
         out->Add<float>(*result);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasScnrm2_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasScnrm2_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Dznrm2_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dznrm2_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dznrm2_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -374,15 +374,15 @@ CUBLAS_ROUTINE_HANDLER(Dznrm2_v2){
     try{
         out->Add<double>(*result);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout << "DEBUG - cublasDznrm2_v2 Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cublasDznrm2_v2 Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUBLAS_ROUTINE_HANDLER(Ssyrk_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyrk_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyrk_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -402,7 +402,7 @@ CUBLAS_ROUTINE_HANDLER(Ssyrk_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dsyrk_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyrk_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyrk_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -422,7 +422,7 @@ CUBLAS_ROUTINE_HANDLER(Dsyrk_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Csyrk_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyrk_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyrk_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -442,7 +442,7 @@ CUBLAS_ROUTINE_HANDLER(Csyrk_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zsyrk_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyrk_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyrk_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -463,7 +463,7 @@ CUBLAS_ROUTINE_HANDLER(Zsyrk_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Cherk_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cherk_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cherk_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -483,7 +483,7 @@ CUBLAS_ROUTINE_HANDLER(Cherk_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zherk_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zherk_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zherk_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -503,7 +503,7 @@ CUBLAS_ROUTINE_HANDLER(Zherk_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ssyr2k_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyr2k_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssyr2k_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -529,7 +529,7 @@ CUBLAS_ROUTINE_HANDLER(Ssyr2k_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Dsyr2k_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyr2k_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsyr2k_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -554,7 +554,7 @@ CUBLAS_ROUTINE_HANDLER(Dsyr2k_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Csyr2k_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyr2k_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csyr2k_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -580,7 +580,7 @@ CUBLAS_ROUTINE_HANDLER(Csyr2k_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Zsyr2k_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr2k_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsyr2k_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -605,7 +605,7 @@ CUBLAS_ROUTINE_HANDLER(Zsyr2k_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Cher2k_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cher2k_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Cher2k_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -630,7 +630,7 @@ CUBLAS_ROUTINE_HANDLER(Cher2k_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zher2k_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zher2k_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zher2k_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -656,7 +656,7 @@ CUBLAS_ROUTINE_HANDLER(Zher2k_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Ssymm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssymm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ssymm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -682,7 +682,7 @@ CUBLAS_ROUTINE_HANDLER(Ssymm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dsymm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsymm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dsymm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -709,7 +709,7 @@ CUBLAS_ROUTINE_HANDLER(Dsymm_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Csymm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csymm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Csymm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -735,7 +735,7 @@ CUBLAS_ROUTINE_HANDLER(Csymm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zsymm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsymm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zsymm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -761,7 +761,7 @@ CUBLAS_ROUTINE_HANDLER(Zsymm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Chemm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chemm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Chemm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -787,7 +787,7 @@ CUBLAS_ROUTINE_HANDLER(Chemm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Zhemm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhemm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Zhemm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -814,7 +814,7 @@ CUBLAS_ROUTINE_HANDLER(Zhemm_v2){
 
 
 CUBLAS_ROUTINE_HANDLER(Strsm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strsm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strsm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -837,7 +837,7 @@ CUBLAS_ROUTINE_HANDLER(Strsm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtrsm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrsm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrsm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -860,7 +860,7 @@ CUBLAS_ROUTINE_HANDLER(Dtrsm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctrsm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrsm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrsm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -883,7 +883,7 @@ CUBLAS_ROUTINE_HANDLER(Ctrsm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztrsm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrsm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrsm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -906,7 +906,7 @@ CUBLAS_ROUTINE_HANDLER(Ztrsm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Strmm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strmm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Strmm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -932,7 +932,7 @@ CUBLAS_ROUTINE_HANDLER(Strmm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Dtrmm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrmm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Dtrmm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -958,7 +958,7 @@ CUBLAS_ROUTINE_HANDLER(Dtrmm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ctrmm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrmm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ctrmm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
@@ -984,7 +984,7 @@ CUBLAS_ROUTINE_HANDLER(Ctrmm_v2){
 }
 
 CUBLAS_ROUTINE_HANDLER(Ztrmm_v2){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrsm_v2"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Ztrsm_v2"));
     
     cublasHandle_t handle;
     handle = (cublasHandle_t) in->Get<long long int>();
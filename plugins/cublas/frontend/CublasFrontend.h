@@ -30,6 +30,7 @@
 #include "cublas_v2.h"
 #include <cuda_runtime_api.h>
 
+#include <gvirtus/common/Strided.h>
 #include <gvirtus/frontend/Frontend.h>
 //#include "Cublas.h"
 
@@ -85,6 +86,27 @@ public:
       gvirtus::frontend::Frontend::GetFrontend()->GetInputBuffer()->Add(ptr, n);
     }
 
+    /**
+     * Adds, packed, a strided host region (e.g. a matrix with a leading
+     * dimension) as an input parameter for the next execution request.
+     *
+     * @param ptr the first byte of the region.
+     * @param layout the shape of the region.
+     */
+    static inline void AddStridedForArguments(const void *ptr,
+            const gvirtus::common::StridedLayout &layout) {
+      gvirtus::frontend::Frontend::GetFrontend()->GetInputBuffer()->AddStrided(ptr, layout);
+    }
+
+    /**
+     * Adds, packed, n elements of a host vector with increment inc as an input
+     * parameter for the next execution request.
+     */
+    static inline void AddStridedElementsForArguments(const void *ptr, size_t n,
+            size_t elemSize, long inc) {
+      gvirtus::frontend::Frontend::GetFrontend()->GetInputBuffer()->AddStridedElements(ptr, n, elemSize, inc);
+    }
+
     /**
      * Adds a device pointer as an input parameter for the next execution
      * request.
@@ -25,12 +25,21 @@
 
 #include <iostream>
 #include <cstdio>
+#include <cstdlib>
 #include <string>
 
 #include "CublasFrontend.h"
 
 using namespace std;
 
+/* exported by the cudart frontend: pulls back the managed pages the device
+ * owns, so that they can be read or written here */
+extern "C" void gvirtusManagedPrefetch(const void *ptr, size_t size) __attribute__((weak));
+
+static inline void ManagedPrefetch(const void *ptr, size_t size) {
+    if (gvirtusManagedPrefetch != NULL) gvirtusManagedPrefetch(ptr, size);
+}
+
 extern "C" CUBLASAPI cublasStatus_t CUBLASWINAPI cublasCreate_v2(cublasHandle_t *handle) {
     CublasFrontend::Prepare();
     //CublasFrontend::AddHostPointerForArguments<cublasHandle_t>(handle);
@@ -42,21 +51,23 @@ extern "C" CUBLASAPI cublasStatus_t CUBLASWINAPI cublasCreate_v2(cublasHandle_t
 
 
 extern "C"  CUBLASAPI cublasStatus_t CUBLASWINAPI cublasSetVector(int n, int elemSize, const void *x, int incx, void *y, int incy) {
+    ManagedPrefetch(x, (size_t)n * abs(incx) * elemSize);
     CublasFrontend::Prepare();
     CublasFrontend::AddVariableForArguments<int>(n);
     CublasFrontend::AddVariableForArguments<int>(elemSize);
     //CublasFrontend::AddHostPointerForArguments(x,sizeof(x));
             
-    CublasFrontend::AddVariableForArguments<int>(incx);
+    /* x is packed: the backend reads it with incx == 1 */
+    CublasFrontend::AddVariableForArguments<int>(1);
     CublasFrontend::AddVariableForArguments<int>(incy);
     CublasFrontend::AddDevicePointerForArguments(y);
-    CublasFrontend::AddHostPointerForArguments<char>(static_cast<char *>
-                    (const_cast<void *> (x)), n*elemSize);
+    CublasFrontend::AddStridedElementsForArguments(x, n, elemSize, incx);
     CublasFrontend::Execute("cublasSetVector");
     return CublasFrontend::GetExitCode(); 
 }
 
 extern "C"  CUBLASAPI cublasStatus_t CUBLASWINAPI cublasSetMatrix(int rows, int cols, int elemSize, const void *A, int lda, void *B, int ldb){
+    ManagedPrefetch(A, (size_t)lda * cols * elemSize);
     CublasFrontend::Prepare();
     
     CublasFrontend::AddVariableForArguments<int>(rows);
@@ -64,9 +75,10 @@ extern "C"  CUBLASAPI cublasStatus_t CUBLASWINAPI cublasSetMatrix(int rows, int
     CublasFrontend::AddVariableForArguments<int>(elemSize);
     CublasFrontend::AddDevicePointerForArguments(B);
     CublasFrontend::AddVariableForArguments<int>(ldb);
-    CublasFrontend::AddVariableForArguments<int>(lda);
-    CublasFrontend::AddHostPointerForArguments<char>(static_cast<char *>
-                    (const_cast<void *> (A)), rows*cols*elemSize);
+    /* A is packed: the backend reads it with lda == rows */
+    CublasFrontend::AddVariableForArguments<int>(rows);
+    CublasFrontend::AddStridedForArguments(A,
+            gvirtus::common::Strided::LayoutMatrix(rows, cols, elemSize, lda));
     CublasFrontend::Execute("cublasSetMatrix");
     return CublasFrontend::GetExitCode();
 }
@@ -75,6 +87,7 @@ extern "C"  CUBLASAPI cublasStatus_t CUBLASWINAPI cublasSetMatrix(int rows, int
  * Elements in both vectors are assumed to have a size of elemSize bytes. The storage spacing between consecutive elements is given by incx for the source vector and incy for the destination vector y.
  */
 extern "C" CUBLASAPI cublasStatus_t CUBLASWINAPI cublasGetVector(int n, int elemSize, const void *x, int incx, void *y, int incy){
+    ManagedPrefetch(y, (size_t)n * abs(incy) * elemSize);
     CublasFrontend::Prepare();
     
     CublasFrontend::AddVariableForArguments<int>(n);
@@ -84,17 +97,19 @@ extern "C" CUBLASAPI cublasStatus_t CUBLASWINAPI cublasGetVector(int n, int elem
     
     //void * _x = const_cast<void *>(x);
     CublasFrontend::AddDevicePointerForArguments(x);
-    CublasFrontend::AddHostPointerForArguments<void>(y);
     
     CublasFrontend::Execute("cublasGetVector");
     
+    /* the backend sends y packed, scattered here with incy */
     if (CublasFrontend::Success()){
-        memmove(y,CublasFrontend::GetOutputHostPointer<char>(n*elemSize),n*elemSize);
+        gvirtus::common::Strided::UnpackElements(
+                CublasFrontend::GetOutputHostPointer<char>(n*elemSize), n, elemSize, incy, y);
     }
     return CublasFrontend::GetExitCode();
 }
 
 extern "C" CUBLASAPI cublasStatus_t CUBLASWINAPI cublasGetMatrix(int rows, int cols, int elemSize, const void *A, int lda, void *B, int ldb){
+    ManagedPrefetch(B, (size_t)ldb * cols * elemSize);
     CublasFrontend::Prepare();
     
     CublasFrontend::AddVariableForArguments<int>(rows);
@@ -102,13 +117,14 @@ extern "C" CUBLASAPI cublasStatus_t CUBLASWINAPI cublasGetMatrix(int rows, int c
     CublasFrontend::AddVariableForArguments<int>(elemSize);
     CublasFrontend::AddDevicePointerForArguments(A);
     CublasFrontend::AddVariableForArguments<int>(lda);
-    CublasFrontend::AddHostPointerForArguments<void>(B);
-    CublasFrontend::AddVariableForArguments<int>(ldb);
     
     CublasFrontend::Execute("cublasGetMatrix");
     
+    /* the backend sends B packed, scattered here with ldb */
     if(CublasFrontend::Success()){
-        memmove(B,CublasFrontend::GetOutputHostPointer<char>(rows*cols*elemSize),rows*cols*elemSize);
+        gvirtus::common::Strided::Unpack(
+                CublasFrontend::GetOutputHostPointer<char>(rows*cols*elemSize),
+                gvirtus::common::Strided::LayoutMatrix(rows, cols, elemSize, ldb), B);
     }
     return CublasFrontend::GetExitCode();
 }
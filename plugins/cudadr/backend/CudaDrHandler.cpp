@@ -69,7 +69,7 @@ std::shared_ptr<Result> CudaDrHandler::Execute(std::string routine, std::shared_
 //#ifdef DEBUG
 //    std::cout<<"Called "<<routine<<std::endl;
 //#endif    
-    LOG4CPLUS_DEBUG(logger,"Called " << routine);
+    GVIRTUS_LOG_DEBUG(logger,"Called " << routine);
 
     it = mspHandlers->find(routine);
     if (it == mspHandlers->end())
@@ -86,7 +86,7 @@ void CudaDrHandler::RegisterFatBinary(std::string& handler, void ** fatCubinHand
 //#ifdef DEBUG
 //    cout << "Registered FatBinary " << fatCubinHandle << " with handler " << handler << endl;
 //#endif 
-    LOG4CPLUS_DEBUG(logger, "Registered FatBinary " << fatCubinHandle << " with handler " << handler);
+    GVIRTUS_LOG_DEBUG(logger, "Registered FatBinary " << fatCubinHandle << " with handler " << handler);
 }
 
 void CudaDrHandler::RegisterFatBinary(const char* handler, void ** fatCubinHandle) {
@@ -114,7 +114,7 @@ void CudaDrHandler::UnregisterFatBinary(std::string& handler) {
 //#ifdef DEBUG
 //    cout << "Unregistered FatBinary " << it->second << " with handler "<< handler << endl;
 //#endif
-    LOG4CPLUS_DEBUG(logger, "Unregistered FatBinary " << it->second << " with handler "<< handler);
+    GVIRTUS_LOG_DEBUG(logger, "Unregistered FatBinary " << it->second << " with handler "<< handler);
     mpFatBinary->erase(it);
 }
 
@@ -131,7 +131,7 @@ void CudaDrHandler::RegisterDeviceFunction(std::string & handler, std::string &
 //#ifdef DEBUG
 //    cout << "Registered DeviceFunction " << function << " with handler " << handler << endl;
 //#endif
-    LOG4CPLUS_DEBUG(logger, "Registered DeviceFunction " << function << " with handler " << handler);
+    GVIRTUS_LOG_DEBUG(logger, "Registered DeviceFunction " << function << " with handler " << handler);
 }
 
 void CudaDrHandler::RegisterDeviceFunction(const char * handler, const char * function) {
@@ -157,7 +157,7 @@ void CudaDrHandler::RegisterVar(string & handler, string & symbol) {
 //#ifdef DEBUG
 //    cout << "Registered Var " << symbol << " with handler " << handler << endl;
 //#endif
-    LOG4CPLUS_DEBUG(logger,"Registered Var " << symbol << " with handler " << handler );
+    GVIRTUS_LOG_DEBUG(logger,"Registered Var " << symbol << " with handler " << handler );
 }
 
 void CudaDrHandler::RegisterVar(const char* handler, const char* symbol) {
@@ -183,7 +183,7 @@ void CudaDrHandler::RegisterTexture(string& handler, textureReference* texref) {
 //#ifdef DEBUG
 //    cout << "Registered Texture " << texref << " with handler " << handler<< endl;
 //#endif
-    LOG4CPLUS_DEBUG(logger,"Registered Texture " << texref << " with handler " << handler);
+    GVIRTUS_LOG_DEBUG(logger,"Registered Texture " << texref << " with handler " << handler);
 }
 
 void CudaDrHandler::RegisterTexture(const char* handler,
@@ -46,6 +46,8 @@
 
 #include "log4cplus/logger.h"
 #include "log4cplus/loggingmacros.h"
+
+#include <gvirtus/common/Log.h>
 #include "log4cplus/configurator.h"
 
 class CudaDrHandler : public Handler{
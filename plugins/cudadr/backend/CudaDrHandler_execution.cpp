@@ -161,17 +161,17 @@ CUDA_DRIVER_HANDLER(FuncSetCacheConfig) {
 
 //new functions CUDA 6.5
 CUDA_DRIVER_HANDLER(LaunchKernel){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("LaunchKernel"));
-    LOG4CPLUS_DEBUG(logger,"Start LaunchKernel");
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("LaunchKernel"));
+    GVIRTUS_LOG_DEBUG(logger,"Start LaunchKernel");
     CUfunction f =  input_buffer->Get<CUfunction >();
-    LOG4CPLUS_DEBUG(logger,"LaunchKernel: AAA");
+    GVIRTUS_LOG_DEBUG(logger,"LaunchKernel: AAA");
     unsigned int gridDimX = input_buffer->Get<unsigned int>();
     unsigned int gridDimY = input_buffer->Get<unsigned int>();
     unsigned int gridDimZ = input_buffer->Get<unsigned int>();
     unsigned int blockDimX = input_buffer->Get<unsigned int>();
     unsigned int blockDimY = input_buffer->Get<unsigned int>();
     unsigned int blockDimZ = input_buffer->Get<unsigned int>();
-    LOG4CPLUS_DEBUG(logger,"LaunchKernel: BBB");
+    GVIRTUS_LOG_DEBUG(logger,"LaunchKernel: BBB");
     unsigned int sharedMemBytes = input_buffer->Get<unsigned int>();
     CUstream hstream = input_buffer->Get<CUstream>();
     /*
@@ -182,11 +182,11 @@ CUDA_DRIVER_HANDLER(LaunchKernel){
         *(optionValues + i) =(void *) input_buffer->Assign<char>();
     }
     */
-    LOG4CPLUS_DEBUG(logger,"LaunchKernel: CCC");
+    GVIRTUS_LOG_DEBUG(logger,"LaunchKernel: CCC");
     void *kernelParams = input_buffer->Get<void *>();
-    LOG4CPLUS_DEBUG(logger,"LaunchKernel: DDD");
+    GVIRTUS_LOG_DEBUG(logger,"LaunchKernel: DDD");
     void *extra = input_buffer->Get<void *>();
-    LOG4CPLUS_DEBUG(logger,"LaunchKernel: all parameters read");
+    GVIRTUS_LOG_DEBUG(logger,"LaunchKernel: all parameters read");
     CUresult exit_code = cuLaunchKernel((CUfunction)f,gridDimX,gridDimY,gridDimZ,blockDimX,blockDimY,blockDimZ,sharedMemBytes,hstream,NULL,(void **) &extra);
     /*
     if (config != NULL){
@@ -199,6 +199,6 @@ CUDA_DRIVER_HANDLER(LaunchKernel){
         std::cout<<"cuLaunchKernel back a result!"<<std::endl;
     }
     */
-    LOG4CPLUS_DEBUG(logger,"End LaunchKernel");
+    GVIRTUS_LOG_DEBUG(logger,"End LaunchKernel");
     return std::make_shared<Result>((cudaError_t) exit_code);
 }
@@ -72,9 +72,9 @@ CUDA_DRIVER_HANDLER(ModuleGetGlobal) {
 
 /*Load a module's data with options.*/
 CUDA_DRIVER_HANDLER(ModuleLoadDataEx) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleLoadDataEx"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleLoadDataEx"));
     //std::cout <<"Start CULAUNCHKERNEL"<<std::endl;
-    LOG4CPLUS_DEBUG(logger,"Start ModuleLoadDataEx");
+    GVIRTUS_LOG_DEBUG(logger,"Start ModuleLoadDataEx");
     
     CUmodule module;
     unsigned int numOptions = input_buffer->Get<unsigned int>();
@@ -119,7 +119,7 @@ CUDA_DRIVER_HANDLER(ModuleLoadDataEx) {
         }
            
     }
-    LOG4CPLUS_DEBUG(logger,"End ModuleLoadDataEx");
+    GVIRTUS_LOG_DEBUG(logger,"End ModuleLoadDataEx");
     return std::make_shared<Result>((cudaError_t) exit_code, out);
 }
 
@@ -137,12 +137,12 @@ CUDA_DRIVER_HANDLER(ModuleGetTexRef) {
 /*Load a module's data with options.*/
 CUDA_DRIVER_HANDLER(ModuleLoad) {
     Decoder *decoder=new Decoder();
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleLoad"));
-    LOG4CPLUS_DEBUG(logger,"Start ModuleLoad");
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleLoad"));
+    GVIRTUS_LOG_DEBUG(logger,"Start ModuleLoad");
     char *fname=input_buffer->AssignString();
-    LOG4CPLUS_DEBUG(logger,"Module name:" << fname);
+    GVIRTUS_LOG_DEBUG(logger,"Module name:" << fname);
     char *moduleLoad=input_buffer->AssignString();
-    LOG4CPLUS_DEBUG(logger,"Calling decoder->Decode");
+    GVIRTUS_LOG_DEBUG(logger,"Calling decoder->Decode");
     std::istringstream iss(moduleLoad);
     fstream fout;
     fout.open("/tmp/file.bin", ios::binary | ios::out);
@@ -157,10 +157,10 @@ CUDA_DRIVER_HANDLER(ModuleLoad) {
 
 /*Load a module's data with options.*/
 CUDA_DRIVER_HANDLER(ModuleLoadFatBinary) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleLoadFatBinary"));
-    LOG4CPLUS_DEBUG(logger,"Start ModuleLoadFatBinary");
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleLoadFatBinary"));
+    GVIRTUS_LOG_DEBUG(logger,"Start ModuleLoadFatBinary");
     char *fname=input_buffer->AssignString();
-    LOG4CPLUS_DEBUG(logger,"Module name:" << fname);
+    GVIRTUS_LOG_DEBUG(logger,"Module name:" << fname);
     CUmodule module;
     CUresult exit_code = cuModuleLoadFatBinary(&module,fname);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
@@ -170,8 +170,8 @@ CUDA_DRIVER_HANDLER(ModuleLoadFatBinary) {
 
 /*Load a module's data with options.*/
 CUDA_DRIVER_HANDLER(ModuleUnload) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleUnLoad"));
-    LOG4CPLUS_DEBUG(logger,"Start ModuleUnLoad");
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ModuleUnLoad"));
+    GVIRTUS_LOG_DEBUG(logger,"Start ModuleUnLoad");
     CUmodule module=input_buffer->Get<CUmodule> ();
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     CUresult exit_code = cuModuleUnload(module);
@@ -36,7 +36,9 @@
 #include "CudaRtHandler.h"
 
 #include <cstring>
+#include <sstream>
 
+#include <cuda.h>
 #include <cuda_runtime_api.h>
 
 #include "CudaUtil.h"
@@ -56,19 +58,15 @@ extern "C" std::shared_ptr<CudaRtHandler> create_t() {
 CudaRtHandler::CudaRtHandler() {
   logger = Logger::getInstance(LOG4CPLUS_TEXT("CudaRtHandler"));
   setLogLevel(&logger);
-  mpFatBinary = new map<string, void **>();
-  mpDeviceFunction = new map<string, string>();
-  mpVar = new map<string, string>();
-  mpTexture = new map<string, textureReference *>();
-  mpSurface = new map<string, surfaceReference *>();
-
-  mapHost2DeviceFunc = new map<const void*, std::string>();
-  mapDeviceFunc2InfoFunc = new map<std::string, NvInfoFunction>();
+  mpHostArenas = new map<pointer_t, HostArena>();
   Initialize();
 }
 
 CudaRtHandler::~CudaRtHandler() {}
 
+/* the arenas held by the session served on this thread */
+static thread_local set<pointer_t> tlsHostArenas;
+
 void CudaRtHandler::setLogLevel(Logger *logger) {
   log4cplus::LogLevel logLevel = log4cplus::INFO_LOG_LEVEL;
   char *val = getenv("GVIRTUS_LOGLEVEL");
@@ -94,195 +92,226 @@ std::shared_ptr<Result> CudaRtHandler::Execute(
   //#ifdef DEBUG
   //    cerr << "Requested: " << routine << endl;
   //#endif
-  LOG4CPLUS_DEBUG(logger, "Called: " << routine);
+  GVIRTUS_LOG_DEBUG(logger, "Called: " << routine);
   if (it == mspHandlers->end()) throw "No handler for '" + routine + "' found!";
   return it->second(this, input_buffer);
 }
 
-void CudaRtHandler::RegisterFatBinary(std::string &handler,
-                                      void **fatCubinHandle) {
-  map<string, void **>::iterator it = mpFatBinary->find(handler);
-  if (it != mpFatBinary->end()) {
-    mpFatBinary->erase(it);
+/**
+ * Samples the memory in use on every device. The runtime offers no
+ * utilization counter, so it is left unknown.
+ */
+bool CudaRtHandler::ReportLoad(
+    std::vector<gvirtus::communicators::DeviceLoad> &devices) {
+  int count, current, selected;
+  if (cudaGetDeviceCount(&count) != cudaSuccess ||
+      cudaGetDevice(&current) != cudaSuccess || cuInit(0) != CUDA_SUCCESS)
+    return false;
+  selected = current;
+  /* cudaMemGetInfo() answers for the current device only, and would create
+   * a context on a device nobody uses: a device without one has nothing of
+   * this process in use and only its size is asked. The others are made
+   * current in turn, then the session gets its own device back, without the
+   * errors of the devices that could not be asked */
+  for (int device = 0; device < count; device++) {
+    size_t free = 0, total = 0;
+    CUdevice handle;
+    unsigned int flags;
+    int active = 0;
+    if (cuDeviceGet(&handle, device) != CUDA_SUCCESS ||
+        cuDevicePrimaryCtxGetState(handle, &flags, &active) != CUDA_SUCCESS) {
+      devices.push_back({0, 0, -1});
+      continue;
+    }
+    if (!active) {
+      if (cuDeviceTotalMem(&total, handle) == CUDA_SUCCESS) free = total;
+    } else if (device == selected || cudaSetDevice(device) == cudaSuccess) {
+      selected = device;
+      if (cudaMemGetInfo(&free, &total) != cudaSuccess) free = total = 0;
+    }
+    devices.push_back({total - free, total, -1});
   }
-  mpFatBinary->insert(make_pair(handler, fatCubinHandle));
-  //#ifdef DEBUG
-  //    cout << "Registered FatBinary " << fatCubinHandle << " with handler " <<
-  //    handler << endl;
-  //#endif
-  LOG4CPLUS_DEBUG(logger, "Registered FatBinary "
-                              << fatCubinHandle << " with handler " << handler);
+  if (selected != current && cudaSetDevice(current) != cudaSuccess)
+    GVIRTUS_LOG_ERROR(logger, "ReportLoad: can't restore device " << current);
+  cudaGetLastError();
+  return true;
 }
 
-void CudaRtHandler::RegisterFatBinary(const char *handler,
-                                      void **fatCubinHandle) {
-  string tmp(handler);
-  RegisterFatBinary(tmp, fatCubinHandle);
+static string HandlerString(pointer_t handler) {
+  ostringstream os;
+  os << hex << showbase << handler;
+  return os.str();
 }
 
-void **CudaRtHandler::GetFatBinary(string &handler) {
-  map<string, void **>::iterator it = mpFatBinary->find(handler);
-  if (it == mpFatBinary->end()) throw "Fat Binary '" + handler + "' not found";
-  return it->second;
+void CudaRtHandler::RegisterFatBinary(pointer_t handler,
+                                      void **fatCubinHandle) {
+  mFatBinary.Put(handler, fatCubinHandle);
+  GVIRTUS_LOG_DEBUG(logger, "Registered FatBinary "
+                              << fatCubinHandle << " with handler "
+                              << HandlerString(handler));
 }
 
-void **CudaRtHandler::GetFatBinary(const char *handler) {
-  string tmp(handler);
-  return GetFatBinary(tmp);
+void **CudaRtHandler::GetFatBinary(pointer_t handler) {
+  void **fatCubinHandle;
+  if (!mFatBinary.Find(handler, &fatCubinHandle))
+    throw "Fat Binary '" + HandlerString(handler) + "' not found";
+  return fatCubinHandle;
 }
 
-void CudaRtHandler::UnregisterFatBinary(std::string &handler) {
-  map<string, void **>::iterator it = mpFatBinary->find(handler);
-  if (it == mpFatBinary->end()) return;
+void CudaRtHandler::UnregisterFatBinary(pointer_t handler) {
+  void **fatCubinHandle;
+  if (!mFatBinary.Erase(handler, &fatCubinHandle)) return;
   /* FIXME: think about freeing memory */
-  //#ifdef DEBUG
-  //    cout << "Unregistered FatBinary " << it->second << " with handler "<<
-  //    handler << endl;
-  //#endif
-  LOG4CPLUS_DEBUG(logger, "Unregistered FatBinary "
-                              << it->second << " with handler " << handler);
-  mpFatBinary->erase(it);
-}
-
-void CudaRtHandler::UnregisterFatBinary(const char *handler) {
-  string tmp(handler);
-  UnregisterFatBinary(tmp);
-}
-
-void CudaRtHandler::RegisterDeviceFunction(std::string &handler,
-                                           std::string &function) {
-  map<string, string>::iterator it = mpDeviceFunction->find(handler);
-  if (it != mpDeviceFunction->end()) mpDeviceFunction->erase(it);
-  mpDeviceFunction->insert(make_pair(handler, function));
-  //#ifdef DEBUG
-  //    cout << "Registered DeviceFunction " << function << " with handler " <<
-  //    handler << endl;
-  //#endif
-  LOG4CPLUS_DEBUG(logger, "Registered DeviceFunction "
-                              << function << " with handler " << handler);
+  GVIRTUS_LOG_DEBUG(logger, "Unregistered FatBinary "
+                              << fatCubinHandle << " with handler "
+                              << HandlerString(handler));
 }
 
-void CudaRtHandler::RegisterDeviceFunction(const char *handler,
+void CudaRtHandler::RegisterDeviceFunction(pointer_t handler,
                                            const char *function) {
-  string tmp1(handler);
-  string tmp2(function);
-  RegisterDeviceFunction(tmp1, tmp2);
-}
-
-const char *CudaRtHandler::GetDeviceFunction(std::string &handler) {
-  map<string, string>::iterator it = mpDeviceFunction->find(handler);
-  if (it == mpDeviceFunction->end())
-    throw "Device Function '" + handler + "' not found";
-  return it->second.c_str();
-}
-
-const char *CudaRtHandler::GetDeviceFunction(const char *handler) {
-  string tmp(handler);
-  return GetDeviceFunction(tmp);
+  mDeviceFunction.Put(handler, function);
+  GVIRTUS_LOG_DEBUG(logger, "Registered DeviceFunction "
+                              << function << " with handler "
+                              << HandlerString(handler));
 }
 
-void CudaRtHandler::RegisterVar(string &handler, string &symbol) {
-  mpVar->insert(make_pair(handler, symbol));
-  //#ifdef DEBUG
-  //    cout << "Registered Var " << symbol << " with handler " << handler <<
-  //    endl;
-  //#endif
-  LOG4CPLUS_DEBUG(logger,
-                  "Registered Var " << symbol << " with handler " << handler);
+std::string CudaRtHandler::GetDeviceFunction(pointer_t handler) {
+  std::string function;
+  if (!mDeviceFunction.Find(handler, &function))
+    throw "Device Function '" + HandlerString(handler) + "' not found";
+  return function;
 }
 
-void CudaRtHandler::RegisterVar(const char *handler, const char *symbol) {
-  string tmp1(handler);
-  string tmp2(symbol);
-  RegisterVar(tmp1, tmp2);
-}
-
-const char *CudaRtHandler::GetVar(string &handler) {
-  map<string, string>::iterator it = mpVar->find(handler);
-  if (it == mpVar->end()) return NULL;
-  return it->second.c_str();
+void CudaRtHandler::RegisterTexture(pointer_t handler,
+                                    textureReference *texref) {
+  mTexture.Put(handler, texref);
+  GVIRTUS_LOG_DEBUG(logger, "Registered Texture " << texref << " with handler "
+                                                << HandlerString(handler));
 }
 
-const char *CudaRtHandler::GetVar(const char *handler) {
-  string tmp(handler);
-  return GetVar(tmp);
+void CudaRtHandler::RegisterSurface(pointer_t handler,
+                                    surfaceReference *surfref) {
+  mSurface.Put(handler, surfref);
+  GVIRTUS_LOG_DEBUG(logger, "Registered Surface " << surfref << " with handler "
+                                                << HandlerString(handler));
 }
 
-void CudaRtHandler::RegisterTexture(string &handler, textureReference *texref) {
-  mpTexture->insert(make_pair(handler, texref));
-  //#ifdef DEBUG
-  //    cout << "Registered Texture " << texref << " with handler " << handler<<
-  //    endl;
-  //#endif
-  LOG4CPLUS_DEBUG(
-      logger, "Registered Texture " << texref << " with handler " << handler);
+textureReference *CudaRtHandler::GetTexture(pointer_t handler) {
+  textureReference *texref = NULL;
+  mTexture.Find(handler, &texref);
+  return texref;
 }
 
-void CudaRtHandler::RegisterTexture(const char *handler,
-                                    textureReference *texref) {
-  string tmp(handler);
-  RegisterTexture(tmp, texref);
+pointer_t CudaRtHandler::GetTextureHandler(textureReference *texref) {
+  pointer_t handler = 0;
+  mTexture.FindKey([texref](textureReference *t) { return t == texref; },
+                   &handler);
+  return handler;
 }
 
-void CudaRtHandler::RegisterSurface(string &handler,
-                                    surfaceReference *surfref) {
-  mpSurface->insert(make_pair(handler, surfref));
-  //#ifdef DEBUG
-  //    cout << "Registered Surface " << surfref << " with handler " <<
-  //    handler<< endl;
-  //#endif
-  LOG4CPLUS_DEBUG(
-      logger, "Registered Surface " << surfref << " with handler " << handler);
+surfaceReference *CudaRtHandler::GetSurface(pointer_t handler) {
+  surfaceReference *surfref = NULL;
+  mSurface.Find(handler, &surfref);
+  return surfref;
 }
 
-void CudaRtHandler::RegisterSurface(const char *handler,
-                                    surfaceReference *surfref) {
-  string tmp(handler);
-  RegisterSurface(tmp, surfref);
+pointer_t CudaRtHandler::GetSurfaceHandler(surfaceReference *surfref) {
+  pointer_t handler = 0;
+  mSurface.FindKey([surfref](surfaceReference *s) { return s == surfref; },
+                   &handler);
+  return handler;
 }
 
-textureReference *CudaRtHandler::GetTexture(string &handler) {
-  map<string, textureReference *>::iterator it = mpTexture->find(handler);
-  if (it == mpTexture->end()) return NULL;
-  return it->second;
+const void *CudaRtHandler::GetSymbol(std::shared_ptr<Buffer> in) {
+  return (const void *)in->Get<pointer_t>();
 }
 
-textureReference *CudaRtHandler::GetTexture(const char *handler) {
-  string tmp(handler);
-  return GetTexture(tmp);
+/**
+ * Maps the shared pinned arena of a frontend running on this host. The
+ * cookie written by the frontend in the first page proves that both sides
+ * see the same segment.
+ *
+ * @return the handle of the arena, 0 on failure.
+ */
+pointer_t CudaRtHandler::AttachHostArena(const char *name, size_t size,
+                                         uint64_t cookie) {
+  int fd = shm_open(name, O_RDWR, 0);
+  if (fd < 0) return 0;
+  void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) return 0;
+  if (*(uint64_t *)base != cookie) {
+    munmap(base, size);
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(mHostArenasMutex);
+  HostArena &arena = (*mpHostArenas)[(pointer_t)base];
+  arena.size = size;
+  arena.sessions = 1;
+  tlsHostArenas.insert((pointer_t)base);
+  GVIRTUS_LOG_DEBUG(logger, "Attached host arena " << name << " (" << size
+                                                  << " bytes) at " << base);
+  return (pointer_t)base;
 }
 
-const char *CudaRtHandler::GetTextureHandler(textureReference *texref) {
-  for (map<string, textureReference *>::iterator it = mpTexture->begin();
-       it != mpTexture->end(); it++)
-    if (it->second == texref) return it->first.c_str();
-  return NULL;
+/**
+ * Makes the session served on this thread hold an arena attached by another
+ * session of the same frontend.
+ */
+bool CudaRtHandler::JoinHostArena(pointer_t handle, uint64_t cookie) {
+  std::lock_guard<std::mutex> lock(mHostArenasMutex);
+  auto it = mpHostArenas->find(handle);
+  if (it == mpHostArenas->end() || *(uint64_t *)it->first != cookie)
+    return false;
+  if (tlsHostArenas.insert(handle).second) it->second.sessions++;
+  return true;
 }
 
-surfaceReference *CudaRtHandler::GetSurface(string &handler) {
-  map<string, surfaceReference *>::iterator it = mpSurface->find(handler);
-  if (it == mpSurface->end()) return NULL;
-  return it->second;
+/**
+ * Drops the hold of a session on an arena. The last one unpins what the
+ * frontend did not free and unmaps it.
+ */
+void CudaRtHandler::ReleaseHostArena(pointer_t handle) {
+  std::lock_guard<std::mutex> lock(mHostArenasMutex);
+  auto it = mpHostArenas->find(handle);
+  if (it == mpHostArenas->end() || --it->second.sessions > 0) return;
+  for (size_t offset : it->second.pinned)
+    cudaHostUnregister((char *)it->first + offset);
+  munmap((void *)it->first, it->second.size);
+  GVIRTUS_LOG_DEBUG(logger, "Detached host arena at " << (void *)it->first);
+  mpHostArenas->erase(it);
 }
 
-surfaceReference *CudaRtHandler::GetSurface(const char *handler) {
-  string tmp(handler);
-  return GetSurface(tmp);
+void CudaRtHandler::SessionEnded() {
+  for (pointer_t handle : tlsHostArenas) ReleaseHostArena(handle);
+  tlsHostArenas.clear();
 }
 
-const char *CudaRtHandler::GetSurfaceHandler(surfaceReference *surfref) {
-  for (map<string, surfaceReference *>::iterator it = mpSurface->begin();
-       it != mpSurface->end(); it++)
-    if (it->second == surfref) return it->first.c_str();
-  return NULL;
+/**
+ * Resolves an offset in a host arena, checking that the whole range lies in
+ * the arena.
+ *
+ * @return the backend address or NULL if the range is not valid.
+ */
+void *CudaRtHandler::GetHostArena(pointer_t handle, size_t offset,
+                                  size_t size) {
+  std::lock_guard<std::mutex> lock(mHostArenasMutex);
+  auto it = mpHostArenas->find(handle);
+  if (it == mpHostArenas->end() || offset > it->second.size ||
+      size > it->second.size - offset)
+    return NULL;
+  return (char *)it->first + offset;
 }
 
-const char *CudaRtHandler::GetSymbol(std::shared_ptr<Buffer> in) {
-  char *symbol_handler = in->AssignString();
-  char *symbol = in->AssignString();
-  char *our_symbol = const_cast<char *>(GetVar(symbol_handler));
-  if (our_symbol != NULL) symbol = const_cast<char *>(our_symbol);
-  return symbol;
+void CudaRtHandler::PinHostArena(pointer_t handle, size_t offset,
+                                 bool pinned) {
+  std::lock_guard<std::mutex> lock(mHostArenasMutex);
+  auto it = mpHostArenas->find(handle);
+  if (it == mpHostArenas->end()) return;
+  if (pinned)
+    it->second.pinned.insert(offset);
+  else
+    it->second.pinned.erase(offset);
 }
 
 void CudaRtHandler::Initialize() {
@@ -395,6 +424,14 @@ void CudaRtHandler::Initialize() {
   mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(Memcpy2DToArray));
   mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(Malloc3DArray));
   mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(MemcpyPeerAsync));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(HostArenaAttach));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(HostArenaJoin));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(HostArenaRegister));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(HostArenaUnregister));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(HostArenaGetDevicePointer));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(MemcpyHostArena));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(MemcpyAsyncHostArena));
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(MemcpyGather));
 
   /* CudaRtHandler_opengl */
   mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(GLSetGLDevice));
@@ -443,5 +480,8 @@ void CudaRtHandler::Initialize() {
   mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(DriverGetVersion));
   mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(RuntimeGetVersion));
   mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(FuncSetCacheConfig));
+#if CUDART_VERSION >= 9000
+  mspHandlers->insert(CUDA_ROUTINE_HANDLER_PAIR(FuncSetAttribute));
+#endif
 #endif
 }
@@ -39,6 +39,8 @@
 #include <cstdio>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 
 #include <fcntl.h>
@@ -50,6 +52,9 @@
 #include <cuda_runtime_api.h>
 
 #include <gvirtus/backend/Handler.h>
+#include <gvirtus/common/LiveStats.h>
+#include <gvirtus/common/Log.h>
+#include <gvirtus/common/Registry.h>
 #include <gvirtus/communicators/Result.h>
 #include "CudaUtil.h"
 
@@ -80,6 +85,7 @@ using namespace std;
 using namespace log4cplus;
 
 using gvirtus::common::pointer_t;
+using gvirtus::common::Registry;
 using gvirtus::communicators::Buffer;
 using gvirtus::communicators::Result;
 
@@ -90,56 +96,83 @@ class CudaRtHandler : public gvirtus::backend::Handler {
   bool CanExecute(std::string routine);
   std::shared_ptr<Result> Execute(std::string routine,
                                   std::shared_ptr<Buffer> input_buffer);
-
-  void RegisterFatBinary(std::string &handler, void **fatCubinHandle);
-  void RegisterFatBinary(const char *handler, void **fatCubinHandle);
+  bool ReportLoad(std::vector<gvirtus::communicators::DeviceLoad> &devices);
+  void SessionEnded();
+
+  /*
+   * Fat binaries, functions, textures and surfaces are known by their
+   * handle: the address of the registered object in the frontend. Every
+   * session of the process shares them, as it shares the runtime they are
+   * registered with, so they are safe to use from any session thread.
+   * Variables need no table: they are registered with the runtime under the
+   * handle itself.
+   */
+  void RegisterFatBinary(pointer_t handler, void **fatCubinHandle);
   void RegisterFatBinaryEnd(void **fatCubinHandle);
-  void **GetFatBinary(std::string &handler);
-  void **GetFatBinary(const char *handler);
-  void UnregisterFatBinary(std::string &handler);
-  void UnregisterFatBinary(const char *handler);
-
-  void RegisterDeviceFunction(std::string &handler, std::string &function);
-  void RegisterDeviceFunction(const char *handler, const char *function);
-  const char *GetDeviceFunction(std::string &handler);
-  const char *GetDeviceFunction(const char *handler);
-
-  void RegisterVar(std::string &handler, std::string &deviceName);
-  void RegisterVar(const char *handler, const char *deviceName);
-  const char *GetVar(std::string &handler);
-  const char *GetVar(const char *handler);
-
-  void RegisterTexture(std::string &handler, textureReference *texref);
-  void RegisterTexture(const char *handler, textureReference *texref);
-  void RegisterSurface(std::string &handler, surfaceReference *surref);
-  void RegisterSurface(const char *handler, surfaceReference *surref);
-  textureReference *GetTexture(std::string &handler);
+  void **GetFatBinary(pointer_t handler);
+  void UnregisterFatBinary(pointer_t handler);
+
+  void RegisterDeviceFunction(pointer_t handler, const char *function);
+  std::string GetDeviceFunction(pointer_t handler);
+
+  void RegisterTexture(pointer_t handler, textureReference *texref);
+  void RegisterSurface(pointer_t handler, surfaceReference *surref);
   textureReference *GetTexture(pointer_t handler);
-  textureReference *GetTexture(const char *handler);
-  const char *GetTextureHandler(textureReference *texref);
-  surfaceReference *GetSurface(std::string &handler);
+  pointer_t GetTextureHandler(textureReference *texref);
   surfaceReference *GetSurface(pointer_t handler);
-  surfaceReference *GetSurface(const char *handler);
-  const char *GetSurfaceHandler(surfaceReference *texref);
-
-  const char *GetSymbol(std::shared_ptr<Buffer> in);
+  pointer_t GetSurfaceHandler(surfaceReference *surfref);
+
+  /**
+   * Reads the handle of a symbol: the backend runtime knows each variable by
+   * the frontend address it was registered with.
+   */
+  const void *GetSymbol(std::shared_ptr<Buffer> in);
+
+  /*
+   * Accounts the device memory of the session for gvirtus-top, when the
+   * backend publishes its counters.
+   */
+  inline void AccountMalloc(void *devPtr, size_t size) {
+    if (!gvirtus::common::LiveStats::IsEnabled() || devPtr == NULL) return;
+    mAllocations.Put((pointer_t)devPtr, size);
+    gvirtus::common::LiveStats::AddMemory(size);
+  }
+
+  inline void AccountFree(void *devPtr) {
+    size_t size;
+    if (gvirtus::common::LiveStats::IsEnabled() &&
+        mAllocations.Erase((pointer_t)devPtr, &size))
+      gvirtus::common::LiveStats::AddMemory(-(int64_t)size);
+  }
+
+  pointer_t AttachHostArena(const char *name, size_t size, uint64_t cookie);
+  bool JoinHostArena(pointer_t handle, uint64_t cookie);
+  void *GetHostArena(pointer_t handle, size_t offset, size_t size);
+  void PinHostArena(pointer_t handle, size_t offset, bool pinned);
 
   static void setLogLevel(Logger *logger);
 
      inline void addDeviceFunc2InfoFunc(std::string deviceFunc, NvInfoFunction infoFunction) {
-        mapDeviceFunc2InfoFunc->insert(make_pair(deviceFunc, infoFunction));
+        mDeviceFunc2InfoFunc.Put(
+            deviceFunc, std::make_shared<const NvInfoFunction>(infoFunction));
     }
 
-     inline NvInfoFunction getInfoFunc(std::string deviceFunc) {
-        return mapDeviceFunc2InfoFunc->find(deviceFunc)->second;
+     /* NULL if the function has no parameter information */
+     inline std::shared_ptr<const NvInfoFunction> getInfoFunc(const std::string &deviceFunc) {
+        std::shared_ptr<const NvInfoFunction> infoFunction;
+        mDeviceFunc2InfoFunc.Find(deviceFunc, &infoFunction);
+        return infoFunction;
     };
 
      inline void addHost2DeviceFunc(void* hostFunc, std::string deviceFunc) {
-        mapHost2DeviceFunc->insert(make_pair(hostFunc, deviceFunc));
+        mHost2DeviceFunc.Put(hostFunc, deviceFunc);
     }
 
+     /* empty if the function was not registered */
      inline std::string getDeviceFunc(void *hostFunc) {
-        return mapHost2DeviceFunc->find(hostFunc)->second;
+        std::string deviceFunc;
+        mHost2DeviceFunc.Find(hostFunc, &deviceFunc);
+        return deviceFunc;
     };
 
     static void hexdump(void *ptr, int buflen) {
@@ -165,15 +198,32 @@ class CudaRtHandler : public gvirtus::backend::Handler {
   typedef std::shared_ptr<Result> (*CudaRoutineHandler)(
       CudaRtHandler *, std::shared_ptr<Buffer>);
   static std::map<std::string, CudaRoutineHandler> *mspHandlers;
-  std::map<std::string, void **> *mpFatBinary;
-  std::map<std::string, std::string> *mpDeviceFunction;
-  std::map<std::string, std::string> *mpVar;
-  std::map<std::string, textureReference *> *mpTexture;
-  std::map<std::string, surfaceReference *> *mpSurface;
-  map<std::string, NvInfoFunction>* mapDeviceFunc2InfoFunc;
-  map<const void *,std::string>* mapHost2DeviceFunc;
+  /* shared by the session threads: registration writes, requests read */
+  Registry<pointer_t, void **> mFatBinary;
+  Registry<pointer_t, std::string> mDeviceFunction;
+  Registry<pointer_t, textureReference *> mTexture;
+  Registry<pointer_t, surfaceReference *> mSurface;
+  Registry<std::string, std::shared_ptr<const NvInfoFunction>>
+      mDeviceFunc2InfoFunc;
+  Registry<const void *, std::string> mHost2DeviceFunc;
+  /* the sizes of the allocations, only kept for LiveStats */
+  Registry<pointer_t, size_t> mAllocations;
   void *mpShm;
   int mShmFd;
+  /* a shared pinned arena of a frontend on this host */
+  struct HostArena {
+    size_t size;
+    /* the sessions holding it: it is unmapped when the last one ends */
+    int sessions;
+    /* the offsets registered with cudaHostRegister() */
+    std::set<size_t> pinned;
+  };
+
+  void ReleaseHostArena(pointer_t handle);
+
+  /* base -> arena */
+  std::map<pointer_t, HostArena> *mpHostArenas;
+  std::mutex mHostArenasMutex;
 };
 
 #define CUDA_ROUTINE_HANDLER(name)                           \
@@ -223,6 +273,9 @@ CUDA_ROUTINE_HANDLER(EventSynchronize);
 CUDA_ROUTINE_HANDLER(ConfigureCall);
 CUDA_ROUTINE_HANDLER(FuncGetAttributes);
 CUDA_ROUTINE_HANDLER(FuncSetCacheConfig);
+#if CUDART_VERSION >= 9000
+CUDA_ROUTINE_HANDLER(FuncSetAttribute);
+#endif
 CUDA_ROUTINE_HANDLER(Launch);
 CUDA_ROUTINE_HANDLER(LaunchKernel);
 CUDA_ROUTINE_HANDLER(SetDoubleForDevice);
@@ -271,6 +324,14 @@ CUDA_ROUTINE_HANDLER(Memcpy2DFromArray);
 CUDA_ROUTINE_HANDLER(Memcpy2DToArray);
 CUDA_ROUTINE_HANDLER(Malloc3DArray);
 CUDA_ROUTINE_HANDLER(MemcpyPeerAsync);
+CUDA_ROUTINE_HANDLER(HostArenaAttach);
+CUDA_ROUTINE_HANDLER(HostArenaJoin);
+CUDA_ROUTINE_HANDLER(HostArenaRegister);
+CUDA_ROUTINE_HANDLER(HostArenaUnregister);
+CUDA_ROUTINE_HANDLER(HostArenaGetDevicePointer);
+CUDA_ROUTINE_HANDLER(MemcpyHostArena);
+CUDA_ROUTINE_HANDLER(MemcpyAsyncHostArena);
+CUDA_ROUTINE_HANDLER(MemcpyGather);
 
 /* CudaRtHandler_opengl */
 CUDA_ROUTINE_HANDLER(GLSetGLDevice);
@@ -38,8 +38,7 @@ void setLogLevel(Logger *logger) {
 }
 */
 CUDA_ROUTINE_HANDLER(DeviceSetCacheConfig) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceSetCacheConfig"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceSetCacheConfig"));
 
   try {
     cudaFuncCache cacheConfig = input_buffer->Get<cudaFuncCache>();
@@ -47,14 +46,13 @@ CUDA_ROUTINE_HANDLER(DeviceSetCacheConfig) {
     return std::make_shared<Result>(exit_code);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);  //???
   }
 }
 
 CUDA_ROUTINE_HANDLER(DeviceSetLimit) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceSetLimit"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceSetLimit"));
   try {
     cudaLimit limit = input_buffer->Get<cudaLimit>();
     size_t value = input_buffer->Get<size_t>();
@@ -62,14 +60,13 @@ CUDA_ROUTINE_HANDLER(DeviceSetLimit) {
     return std::make_shared<Result>(exit_code);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);  //???
   }
 }
 
 CUDA_ROUTINE_HANDLER(IpcOpenMemHandle) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcOpenMemHandle"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcOpenMemHandle"));
   void *devPtr = NULL;
   try {
     cudaIpcMemHandle_t handle = input_buffer->Get<cudaIpcMemHandle_t>();
@@ -81,14 +78,13 @@ CUDA_ROUTINE_HANDLER(IpcOpenMemHandle) {
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
 
 CUDA_ROUTINE_HANDLER(DeviceEnablePeerAccess) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceEnablePeerAccess"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceEnablePeerAccess"));
   int peerDevice = input_buffer->Get<int>();
   unsigned int flags = input_buffer->Get<unsigned int>();
   cudaError_t exit_code = cudaDeviceEnablePeerAccess(peerDevice, flags);
@@ -96,17 +92,15 @@ CUDA_ROUTINE_HANDLER(DeviceEnablePeerAccess) {
 }
 
 CUDA_ROUTINE_HANDLER(DeviceDisablePeerAccess) {
-  Logger logger =
+  static Logger logger =
       Logger::getInstance(LOG4CPLUS_TEXT("DeviceDisablePeerAccess"));
-  CudaRtHandler::setLogLevel(&logger);
   int peerDevice = input_buffer->Get<int>();
   cudaError_t exit_code = cudaDeviceDisablePeerAccess(peerDevice);
   return std::make_shared<Result>(exit_code);
 }
 
 CUDA_ROUTINE_HANDLER(DeviceCanAccessPeer) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceCanAccessPeer"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceCanAccessPeer"));
   int *canAccessPeer = input_buffer->Assign<int>();
   int device = input_buffer->Get<int>();
   int peerDevice = input_buffer->Get<int>();
@@ -120,7 +114,7 @@ CUDA_ROUTINE_HANDLER(DeviceCanAccessPeer) {
     out->Add(canAccessPeer);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 
@@ -128,9 +122,8 @@ CUDA_ROUTINE_HANDLER(DeviceCanAccessPeer) {
 }
 
 CUDA_ROUTINE_HANDLER(DeviceGetStreamPriorityRange) {
-  Logger logger =
+  static Logger logger =
       Logger::getInstance(LOG4CPLUS_TEXT("DeviceGetStreamPriorityRange"));
-  CudaRtHandler::setLogLevel(&logger);
 
   int *leastPriority = input_buffer->Assign<int>();
   int *greatestPriority = input_buffer->Assign<int>();
@@ -145,7 +138,7 @@ CUDA_ROUTINE_HANDLER(DeviceGetStreamPriorityRange) {
     out->Add(greatestPriority);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 
@@ -153,8 +146,7 @@ CUDA_ROUTINE_HANDLER(DeviceGetStreamPriorityRange) {
 }
 
 CUDA_ROUTINE_HANDLER(DeviceGetAttribute) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceGetAttribute"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceGetAttribute"));
 
   int *value = input_buffer->Assign<int>();
   cudaDeviceAttr attr = input_buffer->Get<cudaDeviceAttr>();
@@ -166,7 +158,7 @@ CUDA_ROUTINE_HANDLER(DeviceGetAttribute) {
     out->Add(value);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 
@@ -174,8 +166,7 @@ CUDA_ROUTINE_HANDLER(DeviceGetAttribute) {
 }
 
 CUDA_ROUTINE_HANDLER(IpcGetMemHandle) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcGetMemHanlde"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcGetMemHanlde"));
 
   cudaIpcMemHandle_t *handle = input_buffer->Assign<cudaIpcMemHandle_t>();
   void *devPtr = input_buffer->GetFromMarshal<void *>();
@@ -188,7 +179,7 @@ CUDA_ROUTINE_HANDLER(IpcGetMemHandle) {
     out->Add(handle);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 
@@ -196,8 +187,7 @@ CUDA_ROUTINE_HANDLER(IpcGetMemHandle) {
 }
 
 CUDA_ROUTINE_HANDLER(IpcGetEventHandle) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcGetEventHandle"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcGetEventHandle"));
 
   cudaIpcEventHandle_t *handle = input_buffer->Assign<cudaIpcEventHandle_t>();
   cudaEvent_t event = input_buffer->Get<cudaEvent_t>();
@@ -210,7 +200,7 @@ CUDA_ROUTINE_HANDLER(IpcGetEventHandle) {
     out->Add(handle);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 
@@ -218,8 +208,7 @@ CUDA_ROUTINE_HANDLER(IpcGetEventHandle) {
 }
 
 CUDA_ROUTINE_HANDLER(ChooseDevice) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ChooseDevice"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ChooseDevice"));
 
   int *device = input_buffer->Assign<int>();
   const cudaDeviceProp *prop = input_buffer->Assign<cudaDeviceProp>();
@@ -230,7 +219,7 @@ CUDA_ROUTINE_HANDLER(ChooseDevice) {
     out->Add(device);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 
@@ -238,8 +227,7 @@ CUDA_ROUTINE_HANDLER(ChooseDevice) {
 }
 
 CUDA_ROUTINE_HANDLER(GetDevice) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetDevice"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetDevice"));
 
   try {
     int *device = input_buffer->Assign<int>();
@@ -250,14 +238,13 @@ CUDA_ROUTINE_HANDLER(GetDevice) {
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
 
 CUDA_ROUTINE_HANDLER(DeviceReset) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceReset"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeviceReset"));
 
   cudaError_t exit_code = cudaDeviceReset();
   std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
@@ -266,10 +253,9 @@ CUDA_ROUTINE_HANDLER(DeviceReset) {
 }
 
 CUDA_ROUTINE_HANDLER(DeviceSynchronize) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GVirtuS"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GVirtuS"));
 
-  LOG4CPLUS_DEBUG(logger, "DeviceSynchronize");
+  GVIRTUS_LOG_DEBUG(logger, "DeviceSynchronize");
     //printf("Pre\n");
   cudaError_t exit_code = cudaDeviceSynchronize();
     //printf("Post\n");
@@ -277,8 +263,7 @@ CUDA_ROUTINE_HANDLER(DeviceSynchronize) {
 }
 
 CUDA_ROUTINE_HANDLER(GetDeviceCount) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GVirtuS"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GVirtuS"));
 
   try {
     int *count = input_buffer->Assign<int>();
@@ -289,14 +274,13 @@ CUDA_ROUTINE_HANDLER(GetDeviceCount) {
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
 
 CUDA_ROUTINE_HANDLER(GetDeviceProperties) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetDeviceProperties"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetDeviceProperties"));
 
   try {
     struct cudaDeviceProp *prop = input_buffer->Assign<struct cudaDeviceProp>();
@@ -314,14 +298,13 @@ CUDA_ROUTINE_HANDLER(GetDeviceProperties) {
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
 
 CUDA_ROUTINE_HANDLER(SetDevice) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetDevice"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetDevice"));
 
   try {
     int device = input_buffer->Get<int>();
@@ -329,7 +312,7 @@ CUDA_ROUTINE_HANDLER(SetDevice) {
     return std::make_shared<Result>(exit_code);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
@@ -340,8 +323,7 @@ CUDA_ROUTINE_HANDLER(SetDevice) {
 #if CUDART_VERSION >= 2030
 
 CUDA_ROUTINE_HANDLER(SetDeviceFlags) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetDeviceFlags"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetDeviceFlags"));
 
   try {
     int flags = input_buffer->Get<int>();
@@ -349,14 +331,13 @@ CUDA_ROUTINE_HANDLER(SetDeviceFlags) {
     return std::make_shared<Result>(exit_code);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
 
 CUDA_ROUTINE_HANDLER(IpcOpenEventHandle) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcOpenEventHandler"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("IpcOpenEventHandler"));
 
   std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
 
@@ -367,14 +348,13 @@ CUDA_ROUTINE_HANDLER(IpcOpenEventHandle) {
     out->Add(event);
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
 
 CUDA_ROUTINE_HANDLER(SetValidDevices) {
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetValidDevice"));
-  CudaRtHandler::setLogLevel(&logger);
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetValidDevice"));
 
   try {
     int len = input_buffer->BackGet<int>();
@@ -387,7 +367,7 @@ CUDA_ROUTINE_HANDLER(SetValidDevices) {
 
   } catch (string e) {
     // cerr << e << endl;
-    LOG4CPLUS_DEBUG(logger, e);
+    GVIRTUS_LOG_DEBUG(logger, e);
     return std::make_shared<Result>(cudaErrorMemoryAllocation);
   }
 }
@@ -89,9 +89,26 @@ CUDA_ROUTINE_HANDLER(FuncSetCacheConfig) {
   }
 }
 
+#if CUDART_VERSION >= 9000
+CUDA_ROUTINE_HANDLER(FuncSetAttribute) {
+  try {
+    const char *handler = (const char *)(input_buffer->Get<pointer_t>());
+    cudaFuncAttribute attr = input_buffer->Get<cudaFuncAttribute>();
+    int value = input_buffer->Get<int>();
+
+    cudaError_t exit_code = cudaFuncSetAttribute(handler, attr, value);
+    return std::make_shared<Result>(exit_code);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+#endif
+
 void CUDART_CB  manageMemoryStreamCallback(cudaStream_t stream, cudaError_t status, void *data)
 {
-    printf("manageMemoryStreamCallback\n");
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("manageMemoryStreamCallback"));
+    GVIRTUS_LOG_DEBUG(logger, "manageMemoryStreamCallback");
     NvInfoFunctionEx *infoFunctionEx = (NvInfoFunctionEx *)data;
 
     if (infoFunctionEx->adHocStream) {
@@ -100,8 +117,8 @@ void CUDART_CB  manageMemoryStreamCallback(cudaStream_t stream, cudaError_t stat
 }
 
 CUDA_ROUTINE_HANDLER(LaunchKernel) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("LaunchKernel"));
-    LOG4CPLUS_DEBUG(logger, "LaunchKernel");
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("LaunchKernel"));
+    GVIRTUS_LOG_DEBUG(logger, "LaunchKernel");
 
     void *func = input_buffer->GetFromMarshal<void *>();
     dim3 gridDim = input_buffer->Get<dim3>();
@@ -112,7 +129,10 @@ CUDA_ROUTINE_HANDLER(LaunchKernel) {
 
     std::string deviceFunc=pThis->getDeviceFunc(const_cast<void *>(func));
 
-    NvInfoFunction infoFunction = pThis->getInfoFunc(deviceFunc);
+    std::shared_ptr<const NvInfoFunction> pInfoFunction = pThis->getInfoFunc(deviceFunc);
+    if (pInfoFunction == nullptr)
+        return std::make_shared<Result>(cudaErrorInvalidDeviceFunction);
+    const NvInfoFunction &infoFunction = *pInfoFunction;
 
     //printf("cudaLaunchKernel - hostFunc:%x deviceFunc:%s parameters:%d\n",func, deviceFunc.c_str(),infoFunction.params.size());
 
@@ -158,7 +178,7 @@ CUDA_ROUTINE_HANDLER(LaunchKernel) {
 
     cudaError_t exit_code = cudaLaunchKernel(func,gridDim,blockDim,args,sharedMem,stream);
     if (exit_code == cudaSuccess) {
-        printf("Launched OK!\n");
+        GVIRTUS_LOG_DEBUG(logger, "LaunchKernel: launched");
         cudaStreamAddCallback(stream, manageMemoryStreamCallback, &nvInfoFunctionEx, 0);
     }
     //LOG4CPLUS_DEBUG(logger, "LaunchKernel: post");
@@ -177,11 +177,11 @@ const textureReference *getTexture(const textureReference *handler) {
 
 
 CUDA_ROUTINE_HANDLER(RegisterFatBinary) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RegisterFatBinary"));
-    LOG4CPLUS_DEBUG(logger, "Entering in RegisterFatBinary");
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RegisterFatBinary"));
+    GVIRTUS_LOG_DEBUG(logger, "Entering in RegisterFatBinary");
 
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     __fatBinC_Wrapper_t *fatBin =
         CudaUtil::UnmarshalFatCudaBinaryV2(input_buffer.get());
     void **bin = __cudaRegisterFatBinary((void *)fatBin);
@@ -273,7 +273,7 @@ CUDA_ROUTINE_HANDLER(RegisterFatBinary) {
 
 CUDA_ROUTINE_HANDLER(RegisterFatBinaryEnd) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
     __cudaRegisterFatBinaryEnd(fatCubinHandle);
     cudaError_t error = cudaGetLastError();
@@ -287,7 +287,7 @@ CUDA_ROUTINE_HANDLER(RegisterFatBinaryEnd) {
 
 CUDA_ROUTINE_HANDLER(UnregisterFatBinary) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
     __cudaUnregisterFatBinary(fatCubinHandle);
     pThis->UnregisterFatBinary(handler);
@@ -300,7 +300,7 @@ CUDA_ROUTINE_HANDLER(UnregisterFatBinary) {
 
 CUDA_ROUTINE_HANDLER(RegisterFunction) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
     const char *hostfun = (const char *)(input_buffer->Get<pointer_t>());
     char *deviceFun = strdup(input_buffer->AssignString());
@@ -331,6 +331,7 @@ CUDA_ROUTINE_HANDLER(RegisterFunction) {
     output_buffer->Add(gDim);
     output_buffer->Add(wSize);
 
+    pThis->RegisterDeviceFunction((pointer_t)hostfun, deviceFun);
     pThis->addHost2DeviceFunc((void *) hostfun, deviceFun);
 
     return std::make_shared<Result>(cudaSuccess, output_buffer);
@@ -342,18 +343,18 @@ CUDA_ROUTINE_HANDLER(RegisterFunction) {
 
 CUDA_ROUTINE_HANDLER(RegisterVar) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
-    char *hostVar =
-        (char *)CudaUtil::UnmarshalPointer(input_buffer->AssignString());
+    pointer_t hostVar = input_buffer->Get<pointer_t>();
     char *deviceAddress = strdup(input_buffer->AssignString());
     const char *deviceName = strdup(input_buffer->AssignString());
     int ext = input_buffer->Get<int>();
     int size = input_buffer->Get<int>();
     int constant = input_buffer->Get<int>();
     int global = input_buffer->Get<int>();
-    __cudaRegisterVar(fatCubinHandle, hostVar, deviceAddress, deviceName, ext,
-                      size, constant, global);
+    /* the symbol operations pass the same handle as the symbol */
+    __cudaRegisterVar(fatCubinHandle, (char *)hostVar, deviceAddress,
+                      deviceName, ext, size, constant, global);
 #ifdef DEBUG
     cudaError_t error = cudaGetLastError();
     if (error != 0) {
@@ -371,7 +372,7 @@ CUDA_ROUTINE_HANDLER(RegisterVar) {
 
 CUDA_ROUTINE_HANDLER(RegisterSharedVar) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
     void **devicePtr = (void **)input_buffer->AssignString();
     size_t size = input_buffer->Get<size_t>();
@@ -398,7 +399,7 @@ CUDA_ROUTINE_HANDLER(RegisterSharedVar) {
 
 CUDA_ROUTINE_HANDLER(RegisterShared) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
     char *devPtr = strdup(input_buffer->AssignString());
     __cudaRegisterShared(fatCubinHandle, (void **)devPtr);
@@ -423,9 +424,9 @@ CUDA_ROUTINE_HANDLER(RegisterShared) {
 
 CUDA_ROUTINE_HANDLER(RegisterTexture) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
-    char *hostVarPtr = input_buffer->AssignString();
+    pointer_t hostVarPtr = input_buffer->Get<pointer_t>();
     textureReference *texture = new textureReference;
     memmove(texture, input_buffer->Assign<textureReference>(),
             sizeof(textureReference));
@@ -477,9 +478,9 @@ CUDA_ROUTINE_HANDLER(RegisterTexture) {
 
 CUDA_ROUTINE_HANDLER(RegisterSurface) {
   try {
-    char *handler = input_buffer->AssignString();
+    pointer_t handler = input_buffer->Get<pointer_t>();
     void **fatCubinHandle = pThis->GetFatBinary(handler);
-    char *hostVarPtr = input_buffer->AssignString();
+    pointer_t hostVarPtr = input_buffer->Get<pointer_t>();
     surfaceReference *surface = new surfaceReference;
     memmove(surface, input_buffer->Assign<surfaceReference>(),
             sizeof(surfaceReference));
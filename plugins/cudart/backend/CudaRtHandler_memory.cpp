@@ -37,6 +37,7 @@ CUDA_ROUTINE_HANDLER(Free) {
   void *devPtr = input_buffer->GetFromMarshal<void *>();
     //printf("cudaFree: 0x%x\n",devPtr);
   cudaError_t exit_code = cudaFree(devPtr);
+  if (exit_code == cudaSuccess) pThis->AccountFree(devPtr);
 
   return std::make_shared<Result>(exit_code);
 }
@@ -51,7 +52,7 @@ CUDA_ROUTINE_HANDLER(FreeArray) {
 
 CUDA_ROUTINE_HANDLER(GetSymbolAddress) {
   void *devPtr;
-  const char *symbol = pThis->GetSymbol(input_buffer);
+  const void *symbol = pThis->GetSymbol(input_buffer);
 
   cudaError_t exit_code = cudaGetSymbolAddress(&devPtr, symbol);
 
@@ -68,7 +69,7 @@ CUDA_ROUTINE_HANDLER(GetSymbolSize) {
 
     size_t *size = out->Delegate<size_t>();
     *size = *(input_buffer->Assign<size_t>());
-    const char *symbol = pThis->GetSymbol(input_buffer);
+    const void *symbol = pThis->GetSymbol(input_buffer);
     cudaError_t exit_code = cudaGetSymbolSize(size, symbol);
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
@@ -101,10 +102,9 @@ CUDA_ROUTINE_HANDLER(MemcpyPeerAsync) {
 
 
 CUDA_ROUTINE_HANDLER(MallocManaged) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GVirtuS"));
-    CudaRtHandler::setLogLevel(&logger);
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GVirtuS"));
 
-    LOG4CPLUS_DEBUG(logger, "MallocManaged");
+    GVIRTUS_LOG_DEBUG(logger, "MallocManaged");
 
     try {
         void *hostPtr = input_buffer->Get<void *>();
@@ -129,7 +129,7 @@ CUDA_ROUTINE_HANDLER(MallocManaged) {
         //printf("cudaMallocManaged: cudaError: %d devPtr: 0x%x size: %ld\n", exit_code, devPtr, size);
         return std::make_shared<Result>(exit_code, out);
       } catch (string e) {
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
 
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
       }
@@ -175,6 +175,7 @@ CUDA_ROUTINE_HANDLER(Malloc) {
   try {
     size_t size = input_buffer->Get<size_t>();
     cudaError_t exit_code = cudaMalloc(&devPtr, size);
+    if (exit_code == cudaSuccess) pThis->AccountMalloc(devPtr, size);
 #ifdef DEBUG
     std::cout << "Allocated DevicePointer " << devPtr << " with a size of "
               << size << std::endl;
@@ -190,6 +191,7 @@ CUDA_ROUTINE_HANDLER(Malloc) {
 }
 
 CUDA_ROUTINE_HANDLER(MallocArray) {
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MallocArray"));
   cudaArray *arrayPtr = NULL;
   try {
     cudaChannelFormatDesc *desc = input_buffer->Assign<cudaChannelFormatDesc>();
@@ -211,7 +213,7 @@ CUDA_ROUTINE_HANDLER(MallocArray) {
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
 
     out->AddMarshal(arrayPtr);
-    cout << hex << arrayPtr << endl;
+    GVIRTUS_LOG_DEBUG(logger, "MallocArray: " << arrayPtr);
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
     cerr << e << endl;
@@ -455,9 +457,17 @@ CUDA_ROUTINE_HANDLER(Memcpy3D) {
 
   try {
     cudaMemcpy3DParms *p = input_buffer->Assign<cudaMemcpy3DParms>();
-    src = input_buffer->AssignAll<char>();
-    unsigned int width = p->extent.width;
-    p->srcPtr.ptr = src;
+    /* The frontend sends the host side densely packed, pitch == width. */
+    char *dst = NULL;
+    size_t dst_size = 0;
+    if (p->kind == cudaMemcpyHostToDevice) {
+      src = input_buffer->AssignAll<char>();
+      p->srcPtr.ptr = src;
+    } else if (p->kind == cudaMemcpyDeviceToHost) {
+      dst_size = p->dstPtr.pitch * p->dstPtr.ysize * p->extent.depth;
+      dst = new char[dst_size];
+      p->dstPtr.ptr = dst;
+    }
 
 #ifdef DEBUG
     printf("PARAMETRI BACKEND\n");
@@ -491,9 +501,11 @@ CUDA_ROUTINE_HANDLER(Memcpy3D) {
 #endif
 
     cudaError_t exit_code = cudaMemcpy3D(p);
-    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    if (dst == NULL) return std::make_shared<Result>(exit_code);
 
-    out->Add(p, 1);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add<char>(dst, dst_size);
+    delete[] dst;
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
     cerr << e << endl;
@@ -656,22 +668,188 @@ CUDA_ROUTINE_HANDLER(MemcpyAsync) {
   }
 }
 
-CUDA_ROUTINE_HANDLER(MemcpyFromSymbol) {
+CUDA_ROUTINE_HANDLER(HostArenaAttach) {
   try {
-    void *dst = input_buffer->GetFromMarshal<void *>();
-    char *handler = input_buffer->AssignString();
-    char *symbol = input_buffer->AssignString();
-    handler = (char *)CudaUtil::UnmarshalPointer(handler);
-    size_t count = input_buffer->Get<size_t>();
+    char *name = input_buffer->AssignString();
+    size_t size = input_buffer->Get<size_t>();
+    uint64_t cookie = input_buffer->Get<uint64_t>();
+    pointer_t handle = pThis->AttachHostArena(name, size, cookie);
+    if (handle == 0) return std::make_shared<Result>(cudaErrorInvalidValue);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(handle);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+CUDA_ROUTINE_HANDLER(HostArenaJoin) {
+  try {
+    pointer_t handle = input_buffer->Get<pointer_t>();
+    uint64_t cookie = input_buffer->Get<uint64_t>();
+    return std::make_shared<Result>(pThis->JoinHostArena(handle, cookie)
+                                        ? cudaSuccess
+                                        : cudaErrorInvalidValue);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+CUDA_ROUTINE_HANDLER(HostArenaRegister) {
+  try {
+    pointer_t handle = input_buffer->Get<pointer_t>();
+    size_t offset = input_buffer->Get<size_t>();
+    size_t size = input_buffer->Get<size_t>();
+    unsigned int flags = input_buffer->Get<unsigned int>();
+    void *ptr = pThis->GetHostArena(handle, offset, size);
+    if (ptr == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    unsigned int register_flags = cudaHostRegisterDefault;
+    if (flags & cudaHostAllocPortable) register_flags |= cudaHostRegisterPortable;
+    if (flags & cudaHostAllocMapped) register_flags |= cudaHostRegisterMapped;
+    cudaError_t exit_code = cudaHostRegister(ptr, size, register_flags);
+    if (exit_code == cudaSuccess) pThis->PinHostArena(handle, offset, true);
+    return std::make_shared<Result>(exit_code);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+CUDA_ROUTINE_HANDLER(HostArenaUnregister) {
+  try {
+    pointer_t handle = input_buffer->Get<pointer_t>();
+    size_t offset = input_buffer->Get<size_t>();
+    void *ptr = pThis->GetHostArena(handle, offset, 0);
+    if (ptr == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    pThis->PinHostArena(handle, offset, false);
+    return std::make_shared<Result>(cudaHostUnregister(ptr));
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+CUDA_ROUTINE_HANDLER(HostArenaGetDevicePointer) {
+  try {
+    pointer_t handle = input_buffer->Get<pointer_t>();
+    size_t offset = input_buffer->Get<size_t>();
+    unsigned int flags = input_buffer->Get<unsigned int>();
+    void *ptr = pThis->GetHostArena(handle, offset, 0);
+    if (ptr == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    void *device = NULL;
+    cudaError_t exit_code = cudaHostGetDevicePointer(&device, ptr, flags);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->AddMarshal(device);
+    return std::make_shared<Result>(exit_code, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+/* The host side of the copy is the shared arena: no payload on the wire. */
+CUDA_ROUTINE_HANDLER(MemcpyHostArena) {
+  try {
+    void *device = input_buffer->GetFromMarshal<void *>();
+    pointer_t handle = input_buffer->Get<pointer_t>();
     size_t offset = input_buffer->Get<size_t>();
+    size_t count = input_buffer->Get<size_t>();
     cudaMemcpyKind kind = input_buffer->Get<cudaMemcpyKind>();
+    void *host = pThis->GetHostArena(handle, offset, count);
+    if (host == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    cudaError_t exit_code =
+        kind == cudaMemcpyHostToDevice
+            ? cudaMemcpy(device, host, count, kind)
+            : cudaMemcpy(host, device, count, cudaMemcpyDeviceToHost);
+    return std::make_shared<Result>(exit_code);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
 
-    size_t size;
+CUDA_ROUTINE_HANDLER(MemcpyAsyncHostArena) {
+  try {
+    void *device = input_buffer->GetFromMarshal<void *>();
+    pointer_t handle = input_buffer->Get<pointer_t>();
+    size_t offset = input_buffer->Get<size_t>();
+    size_t count = input_buffer->Get<size_t>();
+    cudaMemcpyKind kind = input_buffer->Get<cudaMemcpyKind>();
+    cudaStream_t stream = input_buffer->GetFromMarshal<cudaStream_t>();
+    void *host = pThis->GetHostArena(handle, offset, count);
+    if (host == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    cudaError_t exit_code =
+        kind == cudaMemcpyHostToDevice
+            ? cudaMemcpyAsync(device, host, count, kind, stream)
+            : cudaMemcpyAsync(host, device, count, cudaMemcpyDeviceToHost,
+                              stream);
+    return std::make_shared<Result>(exit_code);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
 
-    if (cudaGetSymbolSize(&size, symbol) != cudaSuccess) {
-      symbol = handler;
-      cudaGetLastError();
+CUDA_ROUTINE_HANDLER(MemcpyGather) {
+  /* small host-to-device copies combined by the frontend, applied in the
+   * order they were issued; the first failure is reported, and the status of
+   * each copy is returned for the thread that issued it */
+  try {
+    size_t entries = input_buffer->BackGet<size_t>();
+    cudaError_t exit_code = cudaSuccess;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    for (size_t i = 0; i < entries; i++) {
+      CudaUtil::GatherOp op = input_buffer->Get<CudaUtil::GatherOp>();
+      cudaError_t entry_code;
+      void *dst;
+      cudaStream_t stream;
+      const void *symbol;
+      size_t offset, count;
+      char *src;
+      switch (op) {
+        case CudaUtil::GatherMemcpy:
+          dst = input_buffer->GetFromMarshal<void *>();
+          /* the length is the prefix Buffer::Add(src, count) wrote */
+          src = input_buffer->AssignAll<char>(&count);
+          entry_code = cudaMemcpy(dst, src, count, cudaMemcpyHostToDevice);
+          break;
+        case CudaUtil::GatherMemcpyAsync:
+          dst = input_buffer->GetFromMarshal<void *>();
+          stream = input_buffer->GetFromMarshal<cudaStream_t>();
+          src = input_buffer->AssignAll<char>(&count);
+          /* pageable source: staged before the call returns */
+          entry_code = cudaMemcpyAsync(dst, src, count, cudaMemcpyHostToDevice,
+                                       stream);
+          break;
+        case CudaUtil::GatherMemcpyToSymbol:
+          symbol = pThis->GetSymbol(input_buffer);
+          offset = input_buffer->Get<size_t>();
+          src = input_buffer->AssignAll<char>(&count);
+          entry_code = cudaMemcpyToSymbol(symbol, src, count, offset,
+                                          cudaMemcpyHostToDevice);
+          break;
+        default:
+          return std::make_shared<Result>(cudaErrorInvalidValue);
+      }
+      out->Add(entry_code);
+      if (exit_code == cudaSuccess) exit_code = entry_code;
     }
+    return std::make_shared<Result>(exit_code, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+CUDA_ROUTINE_HANDLER(MemcpyFromSymbol) {
+  try {
+    void *dst = input_buffer->GetFromMarshal<void *>();
+    const void *symbol = pThis->GetSymbol(input_buffer);
+    size_t count = input_buffer->Get<size_t>();
+    size_t offset = input_buffer->Get<size_t>();
+    cudaMemcpyKind kind = input_buffer->Get<cudaMemcpyKind>();
 
     cudaError_t exit_code;
     std::shared_ptr<Result> result = NULL;
@@ -854,16 +1032,7 @@ CUDA_ROUTINE_HANDLER(MemcpyToSymbol) {
     cudaMemcpyKind kind = input_buffer->BackGet<cudaMemcpyKind>();
     size_t offset = input_buffer->BackGet<size_t>();
     size_t count = input_buffer->BackGet<size_t>();
-    char *handler = input_buffer->AssignString();
-    char *symbol = input_buffer->AssignString();
-
-    handler = (char *)CudaUtil::UnmarshalPointer(handler);
-    size_t size;
-
-    if (cudaGetSymbolSize(&size, symbol) != cudaSuccess) {
-      symbol = handler;
-      cudaGetLastError();
-    }
+    const void *symbol = pThis->GetSymbol(input_buffer);
 
     cudaError_t exit_code;
     std::shared_ptr<Result> result = NULL;
@@ -31,7 +31,7 @@ using namespace std;
 // extern const surfaceReference *getSurface(const surfaceReference *handler);
 
 CUDA_ROUTINE_HANDLER(BindSurfaceToArray) {
-  char *surfrefHandler = input_buffer->AssignString();
+  pointer_t surfrefHandler = input_buffer->Get<pointer_t>();
 
   surfaceReference *guestSurfref = input_buffer->Assign<surfaceReference>();
 
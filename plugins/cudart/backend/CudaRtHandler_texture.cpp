@@ -33,7 +33,7 @@ CUDA_ROUTINE_HANDLER(BindTexture) {
 
     size_t *offset = out->Delegate<size_t>();
     *offset = *(input_buffer->Assign<size_t>());
-    char *texrefHandler = input_buffer->AssignString();
+    pointer_t texrefHandler = input_buffer->Get<pointer_t>();
     textureReference *guestTexref = input_buffer->Assign<textureReference>();
     textureReference *texref = pThis->GetTexture(texrefHandler);
     memmove(texref, guestTexref, sizeof(textureReference));
@@ -64,7 +64,7 @@ CUDA_ROUTINE_HANDLER(BindTexture2D) {
       *offset = *temp;
     else
       *offset = 0;
-    char *texrefHandler = input_buffer->AssignString();
+    pointer_t texrefHandler = input_buffer->Get<pointer_t>();
     textureReference *guestTexref = input_buffer->Assign<textureReference>();
 
     textureReference *texref = pThis->GetTexture(texrefHandler);
@@ -86,7 +86,7 @@ CUDA_ROUTINE_HANDLER(BindTexture2D) {
 
 CUDA_ROUTINE_HANDLER(BindTextureToArray) {
   try {
-    char *texrefHandler = input_buffer->AssignString();
+    pointer_t texrefHandler = input_buffer->Get<pointer_t>();
     textureReference *guestTexref = input_buffer->Assign<textureReference>();
     textureReference *texref = pThis->GetTexture(texrefHandler);
     memmove(texref, guestTexref, sizeof(textureReference));
@@ -123,7 +123,7 @@ CUDA_ROUTINE_HANDLER(GetTextureAlignmentOffset) {
 
     size_t *offset = out->Delegate<size_t>();
     *offset = *(input_buffer->Assign<size_t>());
-    char *texrefHandler = input_buffer->AssignString();
+    pointer_t texrefHandler = input_buffer->Get<pointer_t>();
     textureReference *guestTexref = input_buffer->Assign<textureReference>();
     textureReference *texref = pThis->GetTexture(texrefHandler);
     memmove(texref, guestTexref, sizeof(textureReference));
@@ -138,10 +138,10 @@ CUDA_ROUTINE_HANDLER(GetTextureAlignmentOffset) {
 CUDA_ROUTINE_HANDLER(GetTextureReference) {
   textureReference *texref;
   try {
-    char *symbol_handler = input_buffer->AssignString();
-    char *symbol = input_buffer->AssignString();
-    char *our_symbol = const_cast<char *>(pThis->GetVar(symbol_handler));
-    if (our_symbol != NULL) symbol = const_cast<char *>(our_symbol);
+    pointer_t symbol_handler = input_buffer->Get<pointer_t>();
+    /* textures are registered with the backend copy of their reference */
+    const void *symbol = pThis->GetTexture(symbol_handler);
+    if (symbol == NULL) symbol = (const void *)symbol_handler;
 
     cudaError_t exit_code =
         cudaGetTextureReference((const textureReference **)&texref, symbol);
@@ -149,9 +149,9 @@ CUDA_ROUTINE_HANDLER(GetTextureReference) {
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
 
     if (exit_code == cudaSuccess)
-      out->AddString(pThis->GetTextureHandler(texref));
+      out->Add(pThis->GetTextureHandler(texref));
     else
-      out->AddString("0x0");
+      out->Add((pointer_t)0);
     return std::make_shared<Result>(exit_code, out);
   } catch (string e) {
     cerr << e << endl;
@@ -161,7 +161,7 @@ CUDA_ROUTINE_HANDLER(GetTextureReference) {
 
 CUDA_ROUTINE_HANDLER(UnbindTexture) {
   try {
-    char *texrefHandler = input_buffer->AssignString();
+    pointer_t texrefHandler = input_buffer->Get<pointer_t>();
     textureReference *texref = pThis->GetTexture(texrefHandler);
     cudaError_t exit_code = cudaUnbindTexture(texref);
     return std::make_shared<Result>(exit_code);
@@ -63,22 +63,15 @@ CudaRtFrontend msInstance __attribute_used__;
 // CudaRtFrontend类的静态变量，初始化为null
 
 /**
- * 定义一个静态成员变量 mappedPointers，用于存储映射指针的映射关系
- * 初始化为 NULL，表示尚未分配内存
+ * Device and managed allocations, indexed by address range.
  */
-map<const void*, mappedPointer>* CudaRtFrontend::mappedPointers = NULL;
+PointerRegistry* CudaRtFrontend::pointerRegistry = NULL;
 
 /**
- * 定义一个静态成员变量 devicePointers，用于存储设备指针的集合
- * 初始化为 NULL，表示尚未分配内存
+ * Element sizes of the CUDA arrays, needed to size 3D copies.
  */
-set<const void*>* CudaRtFrontend::devicePointers = NULL;
-
-/**
- * 定义一个静态成员变量 toManage，用于存储线程与栈指针的映射关系
- * 初始化为 NULL，表示尚未分配内存
- */
-map<pthread_t, stack<void*>*>* CudaRtFrontend::toManage = NULL;
+map<const cudaArray*, size_t>* CudaRtFrontend::arrayElementSizes = NULL;
+std::mutex CudaRtFrontend::arrayMutex;
 
 /**
  * 定义一个静态成员变量 mapHost2DeviceFunc，用于存储主机到设备函数的映射关系
@@ -94,13 +87,12 @@ map<std::string, NvInfoFunction>* CudaRtFrontend::mapDeviceFunc2InfoFunc = NULL;
 
 // 定义了构造函数
 CudaRtFrontend::CudaRtFrontend() {
-  if (devicePointers == NULL) devicePointers = new set<const void*>();
-  if (mappedPointers == NULL) mappedPointers = new map<const void*, mappedPointer>();
+  if (pointerRegistry == NULL) pointerRegistry = new PointerRegistry();
+  if (arrayElementSizes == NULL)
+    arrayElementSizes = new map<const cudaArray*, size_t>();
   
   if (mapHost2DeviceFunc == NULL) mapHost2DeviceFunc = new map<const void*, std::string>();
   if (mapDeviceFunc2InfoFunc == NULL) mapDeviceFunc2InfoFunc = new map<std::string, NvInfoFunction>();
-
-  if (toManage == NULL) toManage = new map<pthread_t, stack<void*>*>();
   gvirtus::frontend::Frontend::GetFrontend();
 }
 
@@ -30,15 +30,24 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 #include <set>
 #include <stack>
 
 #include <CudaUtil.h>
 #include <cuda_runtime_api.h>
 #include <CudaRt_internal.h>
+#include <gvirtus/common/Trace.h>
 #include <gvirtus/frontend/Frontend.h>
 
 #include "CudaRt.h"
+#include "DeviceMap.h"
+#include "HostArena.h"
+#include "ManagedMemory.h"
+#include "PointerRegistry.h"
+#include "QueryCache.h"
+#include "RuntimeShadow.h"
+#include "WriteCombiner.h"
 
 using namespace std;
 
@@ -60,6 +69,7 @@ class CudaRtFrontend {
         // 该静态方法返回了一个Frontend类的实例
         // 然后调用了该实例的Execute方法
           gvirtus::frontend::Frontend::GetFrontend()->Execute(routine, input_buffer);
+          RuntimeShadow::MergeError((cudaError_t)GetExitCode());
         
       }
       catch (std::string e) {
@@ -70,6 +80,23 @@ class CudaRtFrontend {
       }
   }
 
+  /**
+   * Requests the execution of a registration every backend must know, see
+   * Frontend::Broadcast().
+   */
+  static inline void Broadcast(const char* routine, const Buffer* input_buffer = NULL) {
+      try {
+          gvirtus::frontend::Frontend::GetFrontend()->Broadcast(routine, input_buffer);
+          RuntimeShadow::MergeError((cudaError_t)GetExitCode());
+      }
+      catch (std::string e) {
+          cerr << "Execution exception: " << e << endl;
+      }
+      catch (const char * e) {
+          cerr << "Execution exception: " << e << endl;
+      }
+  }
+
 // 这个方法是用来准备前端的执行的，必须在任何执行请求之前调用，或者在添加参数的方法之前调用
   /**
    * Prepares the Frontend for the execution. This method _must_ be called
@@ -80,6 +107,16 @@ class CudaRtFrontend {
     gvirtus::frontend::Frontend::GetFrontend()->Prepare();
   }
 
+  /**
+   * Tags the next execution request with the stream it is queued on, for
+   * the trace of the process.
+   *
+   * @param stream the stream of the request.
+   */
+  static inline void SetStreamForTrace(cudaStream_t stream) {
+    gvirtus::common::Trace::SetStream((gvirtus::common::pointer_t)stream);
+  }
+
   static inline Buffer* GetLaunchBuffer() {
     return gvirtus::frontend::Frontend::GetFrontend()->GetLaunchBuffer();
   }
@@ -123,6 +160,20 @@ class CudaRtFrontend {
     gvirtus::frontend::Frontend::GetFrontend()->GetInputBuffer()->Add(ptr, n);
   }
 
+  /**
+   * Adds, packing it, a strided host region as an input parameter for the
+   * next execution request. The backend receives it as a dense array of
+   * PackedSize(layout) bytes.
+   *
+   * @param ptr the first byte of the region.
+   * @param layout the shape of the region.
+   */
+  static inline void AddStridedForArguments(
+      const void* ptr, const gvirtus::common::StridedLayout& layout) {
+    gvirtus::frontend::Frontend::GetFrontend()->GetInputBuffer()->AddStrided(
+        ptr, layout);
+  }
+
 // 为下一个执行请求添加一个设备指针作为输入参数
   /**
    * Adds a device pointer as an input parameter for the next execution
@@ -138,13 +189,12 @@ class CudaRtFrontend {
 // 为下一个执行请求添加一个符号，一个命名变量，作为输入参数
   /**
    * Adds a symbol, a named variable, as an input parameter for the next
-   * execution request.
+   * execution request. The backend knows the variable by its address here.
    *
    * @param symbol the symbol to add as a parameter.
    */
-  static inline void AddSymbolForArguments(const char* symbol) {
-    AddStringForArguments(CudaUtil::MarshalHostPointer((void*)symbol));
-    AddStringForArguments(symbol);
+  static inline void AddSymbolForArguments(const void* symbol) {
+    AddVariableForArguments((gvirtus::common::pointer_t)symbol);
   }
 
 // 获取上一个执行请求的退出代码
@@ -208,92 +258,104 @@ class CudaRtFrontend {
         ->AssignString();
   }
 
-  static inline void addMappedPointer(void* device,
-                                      gvirtus::common::mappedPointer host) {
-    mappedPointers->insert(make_pair(device, host));
-  }
-
-  static void addtoManage(void* manage) {
-    pid_t tid = syscall(SYS_gettid);
-    stack<void*>* toHandle;
-    if (toManage->find(tid) != toManage->end())
-      toHandle = toManage->find(tid)->second;
-    else {
-      toHandle = new stack<void*>();
-      toManage->insert(make_pair(tid, toHandle));
-    }
-    toHandle->push(manage);
-#ifdef DEBUG
-    cerr << "Added: " << std::hex << manage << endl;
-#endif
-  };
-
-  static void manage() {
-    pid_t tid = syscall(SYS_gettid);
-    stack<void*>* toHandle;
-    if (toManage->find(tid) != toManage->end()) {
-      toHandle = toManage->find(tid)->second;
-      while (!toHandle->empty()) {
-        void* p = toHandle->top();
-        toHandle->pop();
-        gvirtus::common::mappedPointer mP = getMappedPointer(p);
-#ifdef DEBUG
-        cerr << "copying " << mP.size << ": " << std::hex << mP.pointer
-             << " to " << std::hex << p << endl;
-#endif
-        cudaMemcpy(p, mP.pointer, mP.size, cudaMemcpyDeviceToHost);
-      }
-    }
-  }
-
-  static void configure() {
-    pid_t tid = syscall(SYS_gettid);
-    stack<void*>* toHandle;
-    if (toManage->find(tid) != toManage->end()) {
-      toHandle = toManage->find(tid)->second;
-      while (!toHandle->empty()) {
-        void* p = toHandle->top();
-        toHandle->pop();
-        gvirtus::common::mappedPointer mP = getMappedPointer(p);
-#ifdef DEBUG
-        cerr << "copying " << mP.size << ": " << std::hex << mP.pointer
-             << " to " << std::hex << p << endl;
-#endif
-        cudaMemcpy(p, mP.pointer, mP.size, cudaMemcpyDeviceToHost);
-      }
-    }
+  static inline void addMappedPointer(void* host,
+                                      gvirtus::common::mappedPointer device) {
+    pointerRegistry->Insert(PointerRegistry::Host, host, device.size,
+                            cudaMemoryTypeManaged, getCurrentDevice(),
+                            device.pointer);
   }
 
   static inline bool isMappedMemory(const void* p) {
-    return (mappedPointers->find(p) == mappedPointers->end() ? false : true);
+    PointerRegistry::Allocation allocation;
+    return pointerRegistry->Find(PointerRegistry::Host, p, &allocation) &&
+           allocation.type == cudaMemoryTypeManaged;
   }
 
-  static inline void addDevicePointer(void* device) {
+  static inline void addDevicePointer(void* device, size_t size) {
 #ifdef DEBUG
     cerr << endl << "Added device pointer: " << hex << device << endl;
 #endif
-    devicePointers->insert(device);
+    pointerRegistry->Insert(getCurrentBackend(), device, size,
+                            cudaMemoryTypeDevice, getCurrentDevice(), device);
   };
 
   static inline void removeDevicePointer(void* device) {
-    devicePointers->erase(device);
+    pointerRegistry->Remove(getCurrentBackend(), device);
   };
 
+  /**
+   * Checks if p points anywhere inside a device allocation.
+   */
   static inline bool isDevicePointer(const void* p) {
 #ifdef DEBUG
     cerr << endl << "Looking for device pointer: " << hex << p << endl;
 #endif
-    return (devicePointers->find(p) == devicePointers->end() ? false : true);
+    PointerRegistry::Allocation allocation;
+    return pointerRegistry->Find(getCurrentBackend(), p, &allocation) &&
+           allocation.type == cudaMemoryTypeDevice;
   }
 
-  static inline gvirtus::common::mappedPointer getMappedPointer(void* device) {
-    return mappedPointers->find(device)->second;
+  /**
+   * Resolves an address inside a managed allocation to the remote address
+   * and the bytes left up to the end of the allocation.
+   */
+  static inline gvirtus::common::mappedPointer getMappedPointer(void* host) {
+    gvirtus::common::mappedPointer mapped = {NULL, 0};
+    PointerRegistry::Allocation allocation;
+    if (pointerRegistry->Find(PointerRegistry::Host, host, &allocation)) {
+      size_t offset = (uintptr_t)host - allocation.base;
+      mapped.pointer = (char*)allocation.devicePointer + offset;
+      mapped.size = allocation.size - offset;
+    }
+    return mapped;
   };
 
-  static inline void removeMappedPointer(void* device) {
-    mappedPointers->erase(device);
+  static inline void removeMappedPointer(void* host) {
+    pointerRegistry->Remove(PointerRegistry::Host, host);
   };
 
+  /**
+   * Looks p up among the device allocations of the backend of the thread,
+   * then among the host ones.
+   */
+  static inline bool findAllocation(const void* p,
+                                    PointerRegistry::Allocation* allocation) {
+    return pointerRegistry->Find(getCurrentBackend(), p, allocation) ||
+           pointerRegistry->Find(PointerRegistry::Host, p, allocation);
+  }
+
+  /* where the device addresses of the thread come from */
+  static inline int getCurrentBackend() {
+    return gvirtus::frontend::Frontend::GetFrontend()->GetBackend();
+  }
+
+  static inline void setCurrentDevice(int device) {
+    RuntimeShadow::SetDevice(device);
+  }
+
+  static inline int getCurrentDevice() { return RuntimeShadow::GetDevice(); }
+
+  static inline void addArray(const cudaArray* array,
+                              const cudaChannelFormatDesc* desc) {
+    std::lock_guard<std::mutex> lock(arrayMutex);
+    (*arrayElementSizes)[array] = (desc->x + desc->y + desc->z + desc->w) / 8;
+  }
+
+  static inline void removeArray(const cudaArray* array) {
+    std::lock_guard<std::mutex> lock(arrayMutex);
+    arrayElementSizes->erase(array);
+  }
+
+  /**
+   * Returns the size in bytes of an element of a CUDA array allocated through
+   * this frontend, 1 if the array is unknown.
+   */
+  static inline size_t getArrayElementSize(const cudaArray* array) {
+    std::lock_guard<std::mutex> lock(arrayMutex);
+    auto it = arrayElementSizes->find(array);
+    return it == arrayElementSizes->end() || it->second == 0 ? 1 : it->second;
+  }
+
   static inline void addConfigureElement() {}
 
   static inline void addDeviceFunc2InfoFunc(std::string deviceFunc, NvInfoFunction infoFunction) {
@@ -333,9 +395,9 @@ class CudaRtFrontend {
   }
 
  private:
-  static map<const void*, gvirtus::common::mappedPointer>* mappedPointers;
-  static set<const void*>* devicePointers;
-  static map<pthread_t, stack<void*>*>* toManage;
+  static PointerRegistry* pointerRegistry;
+  static map<const cudaArray*, size_t>* arrayElementSizes;
+  static std::mutex arrayMutex;
   static list<configureFunction>* setup;
   Buffer* mpInputBuffer;
   bool configured;
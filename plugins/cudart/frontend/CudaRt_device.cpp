@@ -32,6 +32,7 @@ cudaDeviceSetCacheConfig(cudaFuncCache cacheConfig) {
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddVariableForArguments(cacheConfig);
   CudaRtFrontend::Execute("cudaDeviceSetCacheConfig");
+  QueryCache::InvalidateOccupancy(CudaRtFrontend::getCurrentDevice());
 
   return CudaRtFrontend::GetExitCode();
 }
@@ -43,33 +44,54 @@ cudaChooseDevice(int *device, const cudaDeviceProp *prop) {
   CudaRtFrontend::AddHostPointerForArguments(prop);
   CudaRtFrontend::Execute("cudaChooseDevice");
   if (CudaRtFrontend::Success())
-    *device = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    *device = DeviceMap::ToVirtual(*(CudaRtFrontend::GetOutputHostPointer<int>()));
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaGetDevice(int *device) {
+  bool known;
+  int current = RuntimeShadow::GetDevice(&known);
+  if (known) {
+    *device = current;
+    return cudaSuccess;
+  }
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(device);
   CudaRtFrontend::Execute("cudaGetDevice");
-  if (CudaRtFrontend::Success())
-    *device = *(CudaRtFrontend::GetOutputHostPointer<int>());
+  if (CudaRtFrontend::Success()) {
+    *device = DeviceMap::ToVirtual(*(CudaRtFrontend::GetOutputHostPointer<int>()));
+    CudaRtFrontend::setCurrentDevice(*device);
+  }
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaGetDeviceCount(int *count) {
+  if (QueryCache::GetDeviceCount(count)) return cudaSuccess;
+  if (DeviceMap::IsDistributed()) {
+    cudaError_t error = DeviceMap::GetDeviceCount(count);
+    if (error == cudaSuccess) QueryCache::PutDeviceCount(*count);
+    return error;
+  }
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(count);
   CudaRtFrontend::Execute("cudaGetDeviceCount");
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     *count = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    QueryCache::PutDeviceCount(*count);
+  }
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaGetDeviceProperties(cudaDeviceProp *prop, int device) {
+  if (QueryCache::GetDeviceProperties(device, prop)) return cudaSuccess;
+  int local;
+  int backend = DeviceMap::Locate(device, &local);
+  if (backend < 0) return cudaErrorInvalidDevice;
+  DeviceMap::Scope scope(backend);
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(prop);
-  CudaRtFrontend::AddVariableForArguments(device);
+  CudaRtFrontend::AddVariableForArguments(local);
   CudaRtFrontend::Execute("cudaGetDeviceProperties");
   if (CudaRtFrontend::Success()) {
     memmove(prop, CudaRtFrontend::GetOutputHostPointer<cudaDeviceProp>(),
@@ -83,6 +105,7 @@ cudaGetDeviceProperties(cudaDeviceProp *prop, int device) {
 #if CUDA_VERSION >= 2030
     prop->canMapHostMemory = 0;
 #endif
+    QueryCache::PutDeviceProperties(device, prop);
   }
   return CudaRtFrontend::GetExitCode();
 }
@@ -90,21 +113,43 @@ cudaGetDeviceProperties(cudaDeviceProp *prop, int device) {
 extern "C" __host__ cudaError_t cudaDeviceGetAttribute(int *value,
                                                        cudaDeviceAttr attr,
                                                        int device) {
+  if (QueryCache::GetDeviceAttribute(attr, device, value)) return cudaSuccess;
+  int local;
+  int backend = DeviceMap::Locate(device, &local);
+  if (backend < 0) return cudaErrorInvalidDevice;
+  DeviceMap::Scope scope(backend);
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(value);
   CudaRtFrontend::AddVariableForArguments(attr);
-  CudaRtFrontend::AddVariableForArguments(device);
+  CudaRtFrontend::AddVariableForArguments(local);
 
   CudaRtFrontend::Execute("cudaDeviceGetAttribute");
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     *value = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    QueryCache::PutDeviceAttribute(attr, device, *value);
+  }
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaSetDevice(int device) {
+  bool known;
+  if (RuntimeShadow::GetDevice(&known) == device && known) return cudaSuccess;
+  int local;
+  int backend = DeviceMap::Locate(device, &local);
+  if (backend < 0) {
+    RuntimeShadow::MergeError(cudaErrorInvalidDevice);
+    return cudaErrorInvalidDevice;
+  }
+  /* the thread follows its device to the backend owning it */
+  int selected = DeviceMap::Selected();
+  DeviceMap::Select(backend);
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddVariableForArguments(device);
+  CudaRtFrontend::AddVariableForArguments(local);
   CudaRtFrontend::Execute("cudaSetDevice");
+  if (CudaRtFrontend::Success())
+    CudaRtFrontend::setCurrentDevice(device);
+  else
+    DeviceMap::Select(selected);
   return CudaRtFrontend::GetExitCode();
 }
 
@@ -117,12 +162,14 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaSetDeviceFlags(int flags) {
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddVariableForArguments(flags);
   CudaRtFrontend::Execute("cudaSetDeviceFlags");
+  QueryCache::InvalidateDevice(CudaRtFrontend::getCurrentDevice());
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaDeviceReset(void) {
   CudaRtFrontend::Prepare();
   CudaRtFrontend::Execute("cudaDeviceReset");
+  QueryCache::InvalidateDevice(CudaRtFrontend::getCurrentDevice());
   return CudaRtFrontend::GetExitCode();
 }
 
@@ -131,7 +178,12 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaDeviceSynchronize(void) {
     //printf("Execute cudaDeviceSynchronize...\n");
     CudaRtFrontend::Execute("cudaDeviceSynchronize");
     //printf("...done!\n");
-  return CudaRtFrontend::GetExitCode();
+  cudaError_t error = CudaRtFrontend::GetExitCode();
+  /* the copies held back were sent ahead: their failure shows here */
+  if (error == cudaSuccess) error = WriteCombiner::TakeError();
+  /* the device is done with managed memory: the host may touch it */
+  if (error == cudaSuccess) ManagedMemory::Synchronize();
+  return error;
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaSetValidDevices(int *device_arr,
@@ -202,8 +254,11 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaIpcOpenMemHandle(
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaDeviceEnablePeerAccess(int peerDevice, unsigned int flags) {
+  int local;
+  if (DeviceMap::Locate(peerDevice, &local) != DeviceMap::Selected())
+    return cudaErrorInvalidDevice;
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddVariableForArguments(peerDevice);
+  CudaRtFrontend::AddVariableForArguments(local);
   CudaRtFrontend::AddVariableForArguments(flags);
   CudaRtFrontend::Execute("cudaDeviceEnablePeerAccess");
   return CudaRtFrontend::GetExitCode();
@@ -211,10 +266,20 @@ cudaDeviceEnablePeerAccess(int peerDevice, unsigned int flags) {
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaDeviceCanAccessPeer(int *canAccessPeer, int device, int peerDevice) {
+  int local, peerLocal;
+  int backend = DeviceMap::Locate(device, &local);
+  int peerBackend = DeviceMap::Locate(peerDevice, &peerLocal);
+  if (backend < 0 || peerBackend < 0) return cudaErrorInvalidDevice;
+  /* devices of different backends never share memory */
+  if (backend != peerBackend) {
+    *canAccessPeer = 0;
+    return cudaSuccess;
+  }
+  DeviceMap::Scope scope(backend);
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(canAccessPeer);
-  CudaRtFrontend::AddVariableForArguments(device);
-  CudaRtFrontend::AddVariableForArguments(peerDevice);
+  CudaRtFrontend::AddVariableForArguments(local);
+  CudaRtFrontend::AddVariableForArguments(peerLocal);
 
   CudaRtFrontend::Execute("cudaDeviceCanAccessPeer");
   if (CudaRtFrontend::Success())
@@ -236,8 +301,11 @@ cudaDeviceGetStreamPriorityRange(int *leastPriority, int *greatestPriority) {
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaDeviceDisablePeerAccess(int peerDevice) {
+  int local;
+  if (DeviceMap::Locate(peerDevice, &local) != DeviceMap::Selected())
+    return cudaErrorInvalidDevice;
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddVariableForArguments(peerDevice);
+  CudaRtFrontend::AddVariableForArguments(local);
 
   CudaRtFrontend::Execute("cudaDeviceDisablePeerAccess");
   return CudaRtFrontend::GetExitCode();
@@ -40,13 +40,22 @@ cudaGetErrorString(cudaError_t error) {
   return error_string;
 }
 extern "C" __host__ cudaError_t CUDARTAPI cudaPeekAtLastError(void) {
+  /* every reply is merged into the shadow, it knows the answer */
+  if (RuntimeShadow::IsEnabled()) return RuntimeShadow::PeekAtLastError();
   CudaRtFrontend::Prepare();
   CudaRtFrontend::Execute("cudaPeekAtLastError");
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaGetLastError(void) {
+  cudaError_t error;
+  if (RuntimeShadow::GetLastError(&error)) return error;
+  /* the backend has an error to reset too */
+  cudaError_t shadow = RuntimeShadow::PeekAtLastError();
   CudaRtFrontend::Prepare();
   CudaRtFrontend::Execute("cudaGetLastError");
-  return CudaRtFrontend::GetExitCode();
+  error = (cudaError_t)CudaRtFrontend::GetExitCode();
+  RuntimeShadow::ResetLastError();
+  if (!RuntimeShadow::IsEnabled()) return error;
+  return error != cudaSuccess ? error : shadow;
 }
@@ -105,7 +105,9 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaEventQuery(cudaEvent_t event) {
   CudaRtFrontend::AddVariableForArguments(event);
 #endif
   CudaRtFrontend::Execute("cudaEventQuery");
-  return CudaRtFrontend::GetExitCode();
+  cudaError_t error = CudaRtFrontend::GetExitCode();
+  if (error == cudaSuccess) ManagedMemory::Synchronize();
+  return error;
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaEventRecord(cudaEvent_t event,
@@ -118,6 +120,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaEventRecord(cudaEvent_t event,
   CudaRtFrontend::AddVariableForArguments(event);
   CudaRtFrontend::AddVariableForArguments(stream);
 #endif
+  CudaRtFrontend::SetStreamForTrace(stream);
   CudaRtFrontend::Execute("cudaEventRecord");
   return CudaRtFrontend::GetExitCode();
 }
@@ -131,5 +134,8 @@ cudaEventSynchronize(cudaEvent_t event) {
   CudaRtFrontend::AddVariableForArguments(event);
 #endif
   CudaRtFrontend::Execute("cudaEventSynchronize");
-  return CudaRtFrontend::GetExitCode();
+  cudaError_t error = CudaRtFrontend::GetExitCode();
+  /* the device is done with managed memory: the host may touch it */
+  if (error == cudaSuccess) ManagedMemory::Synchronize();
+  return error;
 }
@@ -52,13 +52,30 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaConfigureCall(
 #if CUDA_VERSION >= 2030
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaFuncGetAttributes(struct cudaFuncAttributes *attr, const void *func) {
+  int device = CudaRtFrontend::getCurrentDevice();
+  if (QueryCache::GetFuncAttributes(func, device, attr)) return cudaSuccess;
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(attr);
   CudaRtFrontend::AddVariableForArguments((gvirtus::common::pointer_t)func);
   CudaRtFrontend::Execute("cudaFuncGetAttributes");
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     memmove(attr, CudaRtFrontend::GetOutputHostPointer<cudaFuncAttributes>(),
             sizeof(cudaFuncAttributes));
+    QueryCache::PutFuncAttributes(func, device, attr);
+  }
+  return CudaRtFrontend::GetExitCode();
+}
+#endif
+
+#if CUDART_VERSION >= 9000
+extern "C" __host__ cudaError_t CUDARTAPI
+cudaFuncSetAttribute(const void *func, cudaFuncAttribute attr, int value) {
+  CudaRtFrontend::Prepare();
+  CudaRtFrontend::AddVariableForArguments((gvirtus::common::pointer_t)func);
+  CudaRtFrontend::AddVariableForArguments(attr);
+  CudaRtFrontend::AddVariableForArguments(value);
+  CudaRtFrontend::Execute("cudaFuncSetAttribute");
+  QueryCache::InvalidateFunction(func);
   return CudaRtFrontend::GetExitCode();
 }
 #endif
@@ -69,6 +86,7 @@ cudaFuncSetCacheConfig(const void *func, cudaFuncCache cacheConfig) {
   CudaRtFrontend::AddVariableForArguments((gvirtus::common::pointer_t)func);
   CudaRtFrontend::AddVariableForArguments(cacheConfig);
   CudaRtFrontend::Execute("cudaFuncSetCacheConfig");
+  QueryCache::InvalidateFunction(func);
 
   return CudaRtFrontend::GetExitCode();
 }
@@ -131,10 +149,8 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaSetupArgument(const void *arg,
     gvirtus::common::mappedPointer p =
         CudaRtFrontend::getMappedPointer(*(void **)arg);
     pointer = (const void *)p.pointer;
-    CudaRtFrontend::addtoManage(*(void **)arg);
-    cerr << "Async device: " << p.pointer << " host: " << *(void **)arg << endl;
-    cudaMemcpyAsync(p.pointer, *(void **)arg, p.size, cudaMemcpyHostToDevice,
-                    NULL);
+    cudaError_t error = ManagedMemory::Acquire(*(void **)arg);
+    if (error != cudaSuccess) return error;
   }
 
   launch->Add<int>(0x53544147);
@@ -155,9 +171,6 @@ extern "C" __host__ cudaError_t cudaLaunchKernel ( const void* func,
                                                    size_t sharedMem, cudaStream_t stream ) {
     cudaError_t cudaError = cudaSuccess;
 
-    // A vector with the mapped pointers to be marshalled and unmarshalled
-    vector<gvirtus::common::mappedPointer> mappedPointers;
-
     CudaRtFrontend::Prepare();
     CudaRtFrontend::AddDevicePointerForArguments(func);
     CudaRtFrontend::AddVariableForArguments(gridDim);
@@ -193,22 +206,20 @@ extern "C" __host__ cudaError_t cudaLaunchKernel ( const void* func,
 
         memcpy(p,args[infoKParam.ordinal],((infoKParam.size & 0xf8) >> 2));
 
-        /*
-        if (CudaRtFrontend::isMappedMemory(*(void **)(args[infoKParam.ordinal]))) {
+        // Managed pointers: ship the dirty pages and pass the remote pointer
+        if (((infoKParam.size & 0xf8) >> 2) == sizeof(void *) &&
+            CudaRtFrontend::isMappedMemory(*(void **)(args[infoKParam.ordinal]))) {
 
             void *hostPointer = *(void **)(args[infoKParam.ordinal]);
-
-            //printf("cudaLaunchKernel: 0x%x is a mapped pointer!\n",hostPointer);
             gvirtus::common::mappedPointer mappedPointer = CudaRtFrontend::getMappedPointer(hostPointer);
-            memcpy(p,&(mappedPointer.pointer),((infoKParam.size & 0xf8) >> 2));
+            memcpy(p,&(mappedPointer.pointer),sizeof(void *));
 
-            gvirtus::common::mappedPointer localPointer;
-            localPointer.size = mappedPointer.size;
-            localPointer.pointer = hostPointer;
-            mappedPointers.push_back(localPointer);
+            cudaError = ManagedMemory::Acquire(hostPointer);
+            if (cudaError != cudaSuccess) {
+                free(pArgsPayload);
+                return cudaError;
+            }
         }
-         */
-
     }
 /*
     printf("-------------------\n");
@@ -225,49 +236,13 @@ extern "C" __host__ cudaError_t cudaLaunchKernel ( const void* func,
 
     CudaRtFrontend::AddHostPointerForArguments<byte>(pArgsPayload, argsPayloadSize);
 
-    /*
-    for (gvirtus::common::mappedPointer mappedPointer:mappedPointers) {
-        //printf("cudaLaunchKernel: marshall 0x%x size: %ld\n",mappedPointer.pointer,mappedPointer.size);
-        CudaRtFrontend::AddHostPointerForArguments<byte>((byte *)mappedPointer.pointer, mappedPointer.size);
-    }
-     */
-
     //printf("Execute...\n");
+    CudaRtFrontend::SetStreamForTrace(stream);
     CudaRtFrontend::Execute("cudaLaunchKernel");
     cudaError = CudaRtFrontend::GetExitCode();
     //printf("...done!\n");
     if (cudaError == cudaSuccess) {
         printf("...cudaSuccess!\n");
-        /*
-        bool synchronized = false;
-        for (int idx = 0; idx < infoFunction.params.size(); idx++) {
-            if (CudaRtFrontend::isMappedMemory(*(void **) (args[idx]))) {
-
-                void *hostPointer = *(void **) (args[idx]);
-
-                //printf("cudaLaunchKernel: 0x%x is a mapped pointer!\n", hostPointer);
-
-                gvirtus::common::mappedPointer mappedPointer = CudaRtFrontend::getMappedPointer(hostPointer);
-
-                if (!synchronized) {
-                    //printf("Synchronize\n");
-                    cudaError = cudaDeviceSynchronize();
-                    if (cudaError != cudaSuccess) {
-                        cout << "cudaError:" << cudaError << endl;
-                        break;
-                    }
-                    synchronized = true;
-                }
-                //printf("cudaLaunchKernel: cudaMemcpyAsync 0x%x (device) -> 0x%x (host) size:%ld\n",
-                //       mappedPointer.pointer, hostPointer, mappedPointer.size);
-                cudaError = cudaMemcpy(hostPointer, mappedPointer.pointer, mappedPointer.size,cudaMemcpyDeviceToHost);
-                if (cudaError != cudaSuccess) {
-                    break;
-                }
-
-            }
-        }
-         */
     }
     free(pArgsPayload);
     return cudaError;
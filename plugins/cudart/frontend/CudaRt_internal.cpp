@@ -30,6 +30,8 @@
 
 #include "CudaRt.h"
 
+using gvirtus::common::pointer_t;
+
 /*
  Routines not found in the cuda's header files.
  KEEP THEM WITH CARE
@@ -113,11 +115,11 @@ extern "C" __host__ void **__cudaRegisterFatBinary(void *fatCubin) {
 
 
         Buffer *input_buffer = new Buffer();
-        input_buffer->AddString(CudaUtil::MarshalHostPointer((void **) bin));
+        input_buffer->Add((pointer_t)bin);
         input_buffer = CudaUtil::MarshalFatCudaBinary(bin, input_buffer);
 
         CudaRtFrontend::Prepare();
-        CudaRtFrontend::Execute("cudaRegisterFatBinary", input_buffer);
+        CudaRtFrontend::Broadcast("cudaRegisterFatBinary", input_buffer);
         if (CudaRtFrontend::Success()) return (void **) fatCubin;
     }
   return NULL;
@@ -129,20 +131,19 @@ extern "C" __host__ void **__cudaRegisterFatBinaryEnd(void *fatCubin) {
   char *data = (char *)bin->data;
 
   Buffer *input_buffer = new Buffer();
-  input_buffer->AddString(CudaUtil::MarshalHostPointer((void **)bin));
+  input_buffer->Add((pointer_t)bin);
   input_buffer = CudaUtil::MarshalFatCudaBinary(bin, input_buffer);
 
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::Execute("cudaRegisterFatBinaryEnd", input_buffer);
+  CudaRtFrontend::Broadcast("cudaRegisterFatBinaryEnd", input_buffer);
   if (CudaRtFrontend::Success()) return (void **)fatCubin;
   return NULL;
 }
 
 extern "C" __host__ void __cudaUnregisterFatBinary(void **fatCubinHandle) {
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(
-      CudaUtil::MarshalHostPointer(fatCubinHandle));
-  CudaRtFrontend::Execute("cudaUnregisterFatBinary");
+  CudaRtFrontend::AddVariableForArguments((pointer_t)fatCubinHandle);
+  CudaRtFrontend::Broadcast("cudaUnregisterFatBinary");
 }
 
 extern "C" __host__ void __cudaRegisterFunction(
@@ -152,10 +153,9 @@ extern "C" __host__ void __cudaRegisterFunction(
 
     //printf("__cudaRegisterFunction - hostFun:%x deviceFun:%s\n",hostFun,deviceFun);
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(
-      CudaUtil::MarshalHostPointer(fatCubinHandle));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)fatCubinHandle);
 
-  CudaRtFrontend::AddVariableForArguments((gvirtus::common::pointer_t)hostFun);
+  CudaRtFrontend::AddVariableForArguments((pointer_t)hostFun);
   CudaRtFrontend::AddStringForArguments(deviceFun);
   CudaRtFrontend::AddStringForArguments(deviceName);
   CudaRtFrontend::AddVariableForArguments(thread_limit);
@@ -165,7 +165,7 @@ extern "C" __host__ void __cudaRegisterFunction(
   CudaRtFrontend::AddHostPointerForArguments(gDim);
   CudaRtFrontend::AddHostPointerForArguments(wSize);
 
-  CudaRtFrontend::Execute("cudaRegisterFunction");
+  CudaRtFrontend::Broadcast("cudaRegisterFunction");
 
   deviceFun = CudaRtFrontend::GetOutputString();
   tid = CudaRtFrontend::GetOutputHostPointer<uint3>();
@@ -184,25 +184,23 @@ extern "C" __host__ void __cudaRegisterVar(void **fatCubinHandle, char *hostVar,
                                            const char *deviceName, int ext,
                                            int size, int constant, int global) {
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(
-      CudaUtil::MarshalHostPointer(fatCubinHandle));
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(hostVar));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)fatCubinHandle);
+  CudaRtFrontend::AddVariableForArguments((pointer_t)hostVar);
   CudaRtFrontend::AddStringForArguments(deviceAddress);
   CudaRtFrontend::AddStringForArguments(deviceName);
   CudaRtFrontend::AddVariableForArguments(ext);
   CudaRtFrontend::AddVariableForArguments(size);
   CudaRtFrontend::AddVariableForArguments(constant);
   CudaRtFrontend::AddVariableForArguments(global);
-  CudaRtFrontend::Execute("cudaRegisterVar");
+  CudaRtFrontend::Broadcast("cudaRegisterVar");
 }
 
 extern "C" __host__ void __cudaRegisterShared(void **fatCubinHandle,
                                               void **devicePtr) {
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(
-      CudaUtil::MarshalHostPointer(fatCubinHandle));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)fatCubinHandle);
   CudaRtFrontend::AddStringForArguments((char *)devicePtr);
-  CudaRtFrontend::Execute("cudaRegisterShared");
+  CudaRtFrontend::Broadcast("cudaRegisterShared");
 }
 
 extern "C" __host__ void __cudaRegisterSharedVar(void **fatCubinHandle,
@@ -210,13 +208,12 @@ extern "C" __host__ void __cudaRegisterSharedVar(void **fatCubinHandle,
                                                  size_t alignment,
                                                  int storage) {
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(
-      CudaUtil::MarshalHostPointer(fatCubinHandle));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)fatCubinHandle);
   CudaRtFrontend::AddStringForArguments((char *)devicePtr);
   CudaRtFrontend::AddVariableForArguments(size);
   CudaRtFrontend::AddVariableForArguments(alignment);
   CudaRtFrontend::AddVariableForArguments(storage);
-  CudaRtFrontend::Execute("cudaRegisterSharedVar");
+  CudaRtFrontend::Broadcast("cudaRegisterSharedVar");
 }
 
 extern "C" __host__ void __cudaRegisterTexture(void **fatCubinHandle,
@@ -225,9 +222,8 @@ extern "C" __host__ void __cudaRegisterTexture(void **fatCubinHandle,
                                                char *deviceName, int dim,
                                                int norm, int ext) {
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(
-      CudaUtil::MarshalHostPointer(fatCubinHandle));
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(hostVar));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)fatCubinHandle);
+  CudaRtFrontend::AddVariableForArguments((pointer_t)hostVar);
   // Achtung: passing the address and the content of the textureReference
   CudaRtFrontend::AddHostPointerForArguments(hostVar);
   CudaRtFrontend::AddStringForArguments((char *)deviceAddress);
@@ -235,7 +231,7 @@ extern "C" __host__ void __cudaRegisterTexture(void **fatCubinHandle,
   CudaRtFrontend::AddVariableForArguments(dim);
   CudaRtFrontend::AddVariableForArguments(norm);
   CudaRtFrontend::AddVariableForArguments(ext);
-  CudaRtFrontend::Execute("cudaRegisterTexture");
+  CudaRtFrontend::Broadcast("cudaRegisterTexture");
 }
 
 extern "C" __host__ void __cudaRegisterSurface(void **fatCubinHandle,
@@ -244,16 +240,15 @@ extern "C" __host__ void __cudaRegisterSurface(void **fatCubinHandle,
                                                char *deviceName, int dim,
                                                int ext) {
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(
-      CudaUtil::MarshalHostPointer(fatCubinHandle));
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(hostVar));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)fatCubinHandle);
+  CudaRtFrontend::AddVariableForArguments((pointer_t)hostVar);
   // Achtung: passing the address and the content of the textureReference
   CudaRtFrontend::AddHostPointerForArguments(hostVar);
   CudaRtFrontend::AddStringForArguments((char *)deviceAddress);
   CudaRtFrontend::AddStringForArguments(deviceName);
   CudaRtFrontend::AddVariableForArguments(dim);
   CudaRtFrontend::AddVariableForArguments(ext);
-  CudaRtFrontend::Execute("cudaRegisterSurface");
+  CudaRtFrontend::Broadcast("cudaRegisterSurface");
 }
 
 /* */
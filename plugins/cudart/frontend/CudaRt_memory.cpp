@@ -26,6 +26,7 @@
 #include <string.h>
 #include <algorithm>
 #include <cstdio>
+#include <vector>
 #include <log4cplus/tchar.h>
 #include "CudaRt.h"
 
@@ -54,8 +55,11 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaFree(void *devPtr) {
 
     //printf("cudaFree: 0x%x -> 0x%x!\n",devPtr,remotePointer.pointer);
 
-    free (devPtr);
+    CudaRtFrontend::removeMappedPointer(devPtr);
+    ManagedMemory::Release(devPtr);
     devPtr=remotePointer.pointer;
+  } else {
+    CudaRtFrontend::removeDevicePointer(devPtr);
   }
 
   CudaRtFrontend::Prepare();
@@ -65,6 +69,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaFree(void *devPtr) {
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaFreeArray(cudaArray *array) {
+  CudaRtFrontend::removeArray(array);
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddDevicePointerForArguments((void *)array);
   CudaRtFrontend::Execute("cudaFreeArray");
@@ -75,7 +80,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaFreeHost(void *ptr) {
 #ifdef DEBUG
   printf("Requesting cudaFreeHost\n");
 #endif
-  free(ptr);
+  if (!HostArena::Free(ptr)) free(ptr);
   return cudaSuccess;
 }
 
@@ -83,10 +88,10 @@ extern "C" __host__ cudaError_t CUDARTAPI
 cudaGetSymbolAddress(void **devPtr, const void *symbol) {
   CudaRtFrontend::Prepare();
   // Achtung: skip adding devPtr
-  CudaRtFrontend::AddSymbolForArguments((char *)symbol);
+  CudaRtFrontend::AddSymbolForArguments(symbol);
   CudaRtFrontend::Execute("cudaGetSymbolAddress");
   if (CudaRtFrontend::Success())
-    *devPtr = CudaUtil::UnmarshalPointer(CudaRtFrontend::GetOutputString());
+    *devPtr = CudaRtFrontend::GetOutputDevicePointer();
   return CudaRtFrontend::GetExitCode();
 }
 
@@ -94,7 +99,7 @@ extern "C" __host__ cudaError_t CUDARTAPI
 cudaGetSymbolSize(size_t *size, const void *symbol) {
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(size);
-  CudaRtFrontend::AddSymbolForArguments((char *)symbol);
+  CudaRtFrontend::AddSymbolForArguments(symbol);
   CudaRtFrontend::Execute("cudaGetSymbolSize");
   if (CudaRtFrontend::Success())
     *size = *(CudaRtFrontend::GetOutputHostPointer<size_t>());
@@ -106,8 +111,9 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaHostAlloc(void **ptr, size_t size,
 #ifdef DEBUG
   printf("Requesting cudaHostAlloc\n");
 #endif
-  // Achtung: we can't use host page-locked memory, so we use simple pageable
-  // memory here.
+  // Page-locked memory shared with a backend on the same host, otherwise
+  // simple pageable memory.
+  if ((*ptr = HostArena::Allocate(size, flags)) != NULL) return cudaSuccess;
   if ((*ptr = malloc(size)) == NULL) return cudaErrorMemoryAllocation;
   return cudaSuccess;
 }
@@ -117,8 +123,20 @@ cudaHostGetDevicePointer(void **pDevice, void *pHost, unsigned int flags) {
 #ifdef DEBUG
   printf("Requesting cudaHostGetDevicePointer\n");
 #endif
-  // Achtung: we can't use mapped memory
-  return cudaErrorMemoryAllocation;
+  size_t offset;
+  pointer_t arena;
+  // Achtung: only the shared arena can be mapped
+  if (!HostArena::Contains(pHost, 1, &offset) ||
+      (arena = HostArena::GetHandle()) == 0)
+    return cudaErrorMemoryAllocation;
+  CudaRtFrontend::Prepare();
+  CudaRtFrontend::AddVariableForArguments(arena);
+  CudaRtFrontend::AddVariableForArguments(offset);
+  CudaRtFrontend::AddVariableForArguments(flags);
+  CudaRtFrontend::Execute("cudaHostArenaGetDevicePointer");
+  if (CudaRtFrontend::Success())
+    *pDevice = CudaRtFrontend::GetOutputDevicePointer();
+  return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaHostGetFlags(unsigned int *pFlags,
@@ -131,7 +149,8 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaHostGetFlags(unsigned int *pFlags,
 #error CUDA_VERSION not defined
 #endif
 #if CUDA_VERSION >= 2030
-  *pFlags = cudaHostAllocDefault;
+  *pFlags = HostArena::Contains(pHost, 1) ? HostArena::GetFlags(pHost)
+                                          : cudaHostAllocDefault;
 #endif
   return cudaSuccess;
 }
@@ -147,7 +166,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMalloc(void **devPtr,
 #ifdef DEBUG
     cout << "Adding Pointer" << endl;
 #endif
-    CudaRtFrontend::addDevicePointer(*devPtr);
+    CudaRtFrontend::addDevicePointer(*devPtr, size);
   }
 
   return CudaRtFrontend::GetExitCode();
@@ -195,8 +214,10 @@ cudaMalloc3DArray(cudaArray_t *array, const cudaChannelFormatDesc *desc,
 #endif
 
   CudaRtFrontend::Execute("cudaMalloc3DArray");
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     *array = *(CudaRtFrontend::GetOutputHostPointer<cudaArray_t>());
+    CudaRtFrontend::addArray(*array, desc);
+  }
   //*array = (cudaArray_t) CudaRtFrontend::GetOutputDevicePointer();
 
   //    printf("%x\n", *array);
@@ -233,8 +254,10 @@ cudaMallocArray(cudaArray **arrayPtr, const cudaChannelFormatDesc *desc,
 #endif
 
   CudaRtFrontend::Execute("cudaMallocArray");
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     *arrayPtr = (cudaArray *)CudaRtFrontend::GetOutputDevicePointer();
+    CudaRtFrontend::addArray(*arrayPtr, desc);
+  }
 
   //    printf("%x\n", *arrayPtr);
   return CudaRtFrontend::GetExitCode();
@@ -242,8 +265,10 @@ cudaMallocArray(cudaArray **arrayPtr, const cudaChannelFormatDesc *desc,
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaMallocHost(void **ptr,
                                                          size_t size) {
-  // Achtung: we can't use host page-locked memory, so we use simple pageable
-  // memory here.
+  // Page-locked memory shared with a backend on the same host, otherwise
+  // simple pageable memory.
+  if ((*ptr = HostArena::Allocate(size, cudaHostAllocDefault)) != NULL)
+    return cudaSuccess;
   if ((*ptr = malloc(size)) == NULL) return cudaErrorMemoryAllocation;
   return cudaSuccess;
 }
@@ -262,18 +287,64 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMallocPitch(void **devPtr,
   if (CudaRtFrontend::Success()) {
     *devPtr = CudaRtFrontend::GetOutputDevicePointer();
     *pitch = CudaRtFrontend::GetOutputVariable<size_t>();
+    CudaRtFrontend::addDevicePointer(*devPtr, *pitch * height);
   }
   return CudaRtFrontend::GetExitCode();
 }
 
+/* Answered locally from the pointer registry: no round-trip is needed for
+ * memory allocated through this frontend. */
+extern "C" __host__ cudaError_t CUDARTAPI
+cudaPointerGetAttributes(cudaPointerAttributes *attributes, const void *ptr) {
+  if (attributes == NULL) return cudaErrorInvalidValue;
+  PointerRegistry::Allocation allocation;
+  if (!CudaRtFrontend::findAllocation(ptr, &allocation)) {
+#if CUDART_VERSION >= 11000
+    attributes->type = cudaMemoryTypeUnregistered;
+    attributes->device = -1;
+    attributes->devicePointer = NULL;
+    attributes->hostPointer = const_cast<void *>(ptr);
+    return cudaSuccess;
+#else
+    return cudaErrorInvalidValue;
+#endif
+  }
+
+  size_t offset = (uintptr_t)ptr - allocation.base;
+#if CUDART_VERSION >= 10000
+  attributes->type = allocation.type;
+#else
+  attributes->memoryType = allocation.type == cudaMemoryTypeDevice
+                               ? cudaMemoryTypeDevice
+                               : cudaMemoryTypeHost;
+  attributes->isManaged = allocation.type == cudaMemoryTypeManaged;
+#endif
+  attributes->device = allocation.device;
+  if (allocation.type == cudaMemoryTypeManaged) {
+    /* the host shadow is what kernel launches translate */
+    attributes->devicePointer = const_cast<void *>(ptr);
+    attributes->hostPointer = const_cast<void *>(ptr);
+  } else {
+    attributes->devicePointer = (char *)allocation.devicePointer + offset;
+    attributes->hostPointer = NULL;
+  }
+  return cudaSuccess;
+}
+
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaMemcpyPeerAsync(void *dst, int dstDevice, const void *src, int srcDevice,
                     size_t count, cudaStream_t stream) {
+  int dstLocal, srcLocal;
+  int backend = DeviceMap::Locate(dstDevice, &dstLocal);
+  /* no copy engine spans two backends */
+  if (backend != DeviceMap::Selected() ||
+      DeviceMap::Locate(srcDevice, &srcLocal) != backend)
+    return cudaErrorInvalidDevice;
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddDevicePointerForArguments(dst);
-  CudaRtFrontend::AddVariableForArguments(dstDevice);
+  CudaRtFrontend::AddVariableForArguments(dstLocal);
   CudaRtFrontend::AddDevicePointerForArguments(src);
-  CudaRtFrontend::AddVariableForArguments(srcDevice);
+  CudaRtFrontend::AddVariableForArguments(srcLocal);
   CudaRtFrontend::AddVariableForArguments(count);
   CudaRtFrontend::AddDevicePointerForArguments(stream);
 
@@ -294,7 +365,8 @@ extern "C" __host__ CUDARTAPI cudaError_t cudaMallocManaged(void **devPtr,
                                                             unsigned flags) {
 
     //printf("MallocManaged: devPtr:%x size: %ld flags:%d\n",devPtr,size,flags);
-    *devPtr = malloc(size);
+    if ((*devPtr = ManagedMemory::Allocate(size)) == NULL)
+        return cudaErrorMemoryAllocation;
 
     CudaRtFrontend::Prepare();
     CudaRtFrontend::AddHostPointerForArguments(devPtr);
@@ -317,8 +389,9 @@ extern "C" __host__ CUDARTAPI cudaError_t cudaMallocManaged(void **devPtr,
 #endif
         //printf("MallocManaged: *devPtr: 0x%x (local) -> hostPointer: 0x%x size: %ld flags:%d\n",devPtr, host.pointer,size);
         CudaRtFrontend::addMappedPointer(*devPtr, host);
+        ManagedMemory::Register(*devPtr, remotePointer);
     } else {
-        free(*devPtr);
+        ManagedMemory::Release(*devPtr);
     }
 
     return CudaRtFrontend::GetExitCode();
@@ -357,28 +430,96 @@ extern "C" __host__ CUDARTAPI cudaError_t cudaMallocManaged(void **devPtr,
 }
 */
 
+/* Locates the first byte of a 3D copy inside a pitched host allocation. */
+static inline const char *PitchedStart(const cudaPitchedPtr &ptr,
+                                       const cudaPos &pos) {
+  return static_cast<const char *>(ptr.ptr) + pos.z * ptr.pitch * ptr.ysize +
+         pos.y * ptr.pitch + pos.x;
+}
+
+/* Describes the host side as the backend sees it once packed. */
+static inline void DensePitchedPtr(cudaPitchedPtr &ptr, cudaPos &pos,
+                                   size_t width, size_t height) {
+  ptr.ptr = NULL;
+  ptr.pitch = width;
+  ptr.xsize = width;
+  ptr.ysize = height;
+  pos.x = pos.y = pos.z = 0;
+}
+
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaMemcpy3D(const cudaMemcpy3DParms *p) {
+  cudaMemcpy3DParms parms = *p;
+  /* extent.width counts elements when an array is involved, bytes otherwise */
+  size_t width = p->extent.width;
+  if (p->srcArray != NULL)
+    width *= CudaRtFrontend::getArrayElementSize(p->srcArray);
+  else if (p->dstArray != NULL)
+    width *= CudaRtFrontend::getArrayElementSize(p->dstArray);
+  size_t height = p->extent.height;
+  size_t depth = p->extent.depth;
+
+  cudaMemcpyKind kind = p->kind;
+  if (kind == cudaMemcpyDefault) {
+    bool src_device = p->srcArray != NULL ||
+                      CudaRtFrontend::isDevicePointer(p->srcPtr.ptr);
+    bool dst_device = p->dstArray != NULL ||
+                      CudaRtFrontend::isDevicePointer(p->dstPtr.ptr);
+    kind = src_device ? (dst_device ? cudaMemcpyDeviceToDevice
+                                    : cudaMemcpyDeviceToHost)
+                      : (dst_device ? cudaMemcpyHostToDevice
+                                    : cudaMemcpyHostToHost);
+  }
+  parms.kind = kind;
+
+  gvirtus::common::StridedLayout src_layout = gvirtus::common::Strided::Layout3D(
+      width, height, depth, p->srcPtr.pitch, p->srcPtr.ysize);
+  gvirtus::common::StridedLayout dst_layout = gvirtus::common::Strided::Layout3D(
+      width, height, depth, p->dstPtr.pitch, p->dstPtr.ysize);
+
+  /* managed pages the device owns are pulled back before touching them */
+  if (p->srcArray == NULL)
+    ManagedMemory::Prefetch(PitchedStart(p->srcPtr, p->srcPos),
+                            p->srcPtr.pitch * p->srcPtr.ysize * depth);
+  if (p->dstArray == NULL)
+    ManagedMemory::Prefetch(PitchedStart(p->dstPtr, p->dstPos),
+                            p->dstPtr.pitch * p->dstPtr.ysize * depth);
+
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddHostPointerForArguments(p);
-
-  unsigned int width = p->extent.width;
-  unsigned int num_faces = p->extent.depth;
-  unsigned int num_layers = 1;
-  unsigned int cubemap_size = width * width * num_faces;
-  unsigned int size =
-      cubemap_size * num_layers * (p->srcPtr.pitch / p->extent.width);
-  //    unsigned int size = cubemap_size * num_layers * sizeof(float);
-  // float *h_data = (float *) malloc(size);
-
-  CudaRtFrontend::AddHostPointerForArguments<char>(
-      static_cast<char *>(const_cast<void *>(p->srcPtr.ptr)), size);
-  CudaRtFrontend::Execute("cudaMemcpy3D");
-  if (CudaRtFrontend::Success()) {
-    // memmove(p, CudaRtFrontend::GetOutputHostPointer<cudaMemcpy3DParms>(),
-    //         sizeof(cudaMemcpy3DParms));
-    //*p = *(CudaRtFrontend::GetOutputHostPointer<cudaMemcpy3DParms>());
-    return CudaRtFrontend::GetExitCode();
+  switch (kind) {
+    case cudaMemcpyHostToHost: {
+      /* NOTE: no communication is performed, because it's just overhead
+       * here */
+      std::vector<char> packed(gvirtus::common::Strided::PackedSize(src_layout));
+      gvirtus::common::Strided::Pack(PitchedStart(p->srcPtr, p->srcPos),
+                                     src_layout, packed.data());
+      gvirtus::common::Strided::Unpack(
+          packed.data(), dst_layout,
+          const_cast<char *>(PitchedStart(p->dstPtr, p->dstPos)));
+      return cudaSuccess;
+    }
+    case cudaMemcpyHostToDevice:
+      DensePitchedPtr(parms.srcPtr, parms.srcPos, width, height);
+      CudaRtFrontend::AddHostPointerForArguments(&parms);
+      CudaRtFrontend::AddStridedForArguments(
+          PitchedStart(p->srcPtr, p->srcPos), src_layout);
+      CudaRtFrontend::Execute("cudaMemcpy3D");
+      break;
+    case cudaMemcpyDeviceToHost:
+      DensePitchedPtr(parms.dstPtr, parms.dstPos, width, height);
+      CudaRtFrontend::AddHostPointerForArguments(&parms);
+      CudaRtFrontend::Execute("cudaMemcpy3D");
+      if (CudaRtFrontend::Success())
+        gvirtus::common::Strided::Unpack(
+            CudaRtFrontend::GetOutputHostPointer<char>(
+                gvirtus::common::Strided::PackedSize(dst_layout)),
+            dst_layout,
+            const_cast<char *>(PitchedStart(p->dstPtr, p->dstPos)));
+      break;
+    default:
+      CudaRtFrontend::AddHostPointerForArguments(&parms);
+      CudaRtFrontend::Execute("cudaMemcpy3D");
+      break;
   }
   return CudaRtFrontend::GetExitCode();
 }
@@ -386,6 +527,32 @@ cudaMemcpy3D(const cudaMemcpy3DParms *p) {
 extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src,
                                                      size_t count,
                                                      cudaMemcpyKind kind) {
+  /* managed pages the device owns are pulled back before touching them */
+  if (kind == cudaMemcpyDeviceToHost || kind == cudaMemcpyHostToHost)
+    ManagedMemory::Prefetch(dst, count);
+  if (kind == cudaMemcpyHostToDevice || kind == cudaMemcpyHostToHost)
+    ManagedMemory::Prefetch(src, count);
+  /* small uploads go with the ones held back before them */
+  if (kind == cudaMemcpyHostToDevice && WriteCombiner::Memcpy(dst, src, count))
+    return WriteCombiner::TakeError();
+  size_t offset;
+  pointer_t arena;
+  if (((kind == cudaMemcpyHostToDevice &&
+        HostArena::Contains(src, count, &offset)) ||
+       (kind == cudaMemcpyDeviceToHost &&
+        HostArena::Contains(dst, count, &offset))) &&
+      (arena = HostArena::GetHandle()) != 0) {
+    /* the backend copies straight from/to the shared arena */
+    CudaRtFrontend::Prepare();
+    CudaRtFrontend::AddDevicePointerForArguments(
+        kind == cudaMemcpyHostToDevice ? dst : src);
+    CudaRtFrontend::AddVariableForArguments(arena);
+    CudaRtFrontend::AddVariableForArguments(offset);
+    CudaRtFrontend::AddVariableForArguments(count);
+    CudaRtFrontend::AddVariableForArguments(kind);
+    CudaRtFrontend::Execute("cudaMemcpyHostArena");
+    return CudaRtFrontend::GetExitCode();
+  }
   CudaRtFrontend::Prepare();
   switch (kind) {
     case cudaMemcpyDefault:
@@ -442,6 +609,8 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src,
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaMemcpy2D(void *dst, size_t dpitch, const void *src, size_t spitch,
              size_t width, size_t height, cudaMemcpyKind kind) {
+  ManagedMemory::Prefetch(dst, dpitch * height);
+  ManagedMemory::Prefetch(src, spitch * height);
   CudaRtFrontend::Prepare();
   switch (kind) {
     case cudaMemcpyDefault:
@@ -461,11 +630,12 @@ cudaMemcpy2D(void *dst, size_t dpitch, const void *src, size_t spitch,
       return cudaSuccess;
       break;
     case cudaMemcpyHostToDevice:
+      /* only the rows go on the wire: the backend sees a dense source */
       CudaRtFrontend::AddDevicePointerForArguments(dst);
-      CudaRtFrontend::AddHostPointerForArguments<char>(
-          static_cast<char *>(const_cast<void *>(src)), spitch * height);
+      CudaRtFrontend::AddStridedForArguments(
+          src, gvirtus::common::Strided::Layout2D(width, height, spitch));
       CudaRtFrontend::AddVariableForArguments(dpitch);
-      CudaRtFrontend::AddVariableForArguments(spitch);
+      CudaRtFrontend::AddVariableForArguments(width);
       CudaRtFrontend::AddVariableForArguments(width);
       CudaRtFrontend::AddVariableForArguments(height);
       CudaRtFrontend::AddVariableForArguments(kind);
@@ -475,16 +645,17 @@ cudaMemcpy2D(void *dst, size_t dpitch, const void *src, size_t spitch,
       /* NOTE: adding a fake host pointer */
       CudaRtFrontend::AddHostPointerForArguments("");
       CudaRtFrontend::AddDevicePointerForArguments(src);
-      CudaRtFrontend::AddVariableForArguments(dpitch);
+      /* the backend packs into a dense destination, unpacked here */
+      CudaRtFrontend::AddVariableForArguments(width);
       CudaRtFrontend::AddVariableForArguments(spitch);
       CudaRtFrontend::AddVariableForArguments(width);
       CudaRtFrontend::AddVariableForArguments(height);
       CudaRtFrontend::AddVariableForArguments(kind);
       CudaRtFrontend::Execute("cudaMemcpy2D");
       if (CudaRtFrontend::Success())
-        memmove(dst,
-                CudaRtFrontend::GetOutputHostPointer<char>(dpitch * height),
-                dpitch * height);
+        gvirtus::common::Strided::Unpack(
+            CudaRtFrontend::GetOutputHostPointer<char>(width * height),
+            gvirtus::common::Strided::Layout2D(width, height, dpitch), dst);
       break;
     case cudaMemcpyDeviceToDevice:
       CudaRtFrontend::AddDevicePointerForArguments(dst);
@@ -521,6 +692,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpy2DAsync(
 extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpy2DFromArray(
     void *dst, size_t dpitch, const cudaArray *src, size_t wOffset,
     size_t hOffset, size_t width, size_t height, cudaMemcpyKind kind) {
+  ManagedMemory::Prefetch(dst, dpitch * height);
   CudaRtFrontend::Prepare();
 
   switch (kind) {
@@ -576,6 +748,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpy2DFromArrayAsync(
 extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpy2DToArray(
     cudaArray *dst, size_t wOffset, size_t hOffset, const void *src,
     size_t spitch, size_t width, size_t height, cudaMemcpyKind kind) {
+  ManagedMemory::Prefetch(src, spitch * height);
   CudaRtFrontend::Prepare();
 
   switch (kind) {
@@ -633,6 +806,31 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyAsync(void *dst,
                                                           size_t count,
                                                           cudaMemcpyKind kind,
                                                           cudaStream_t stream) {
+  ManagedMemory::Prefetch(dst, count);
+  ManagedMemory::Prefetch(src, count);
+  if (kind == cudaMemcpyHostToDevice &&
+      WriteCombiner::MemcpyAsync(dst, src, count, stream))
+    return WriteCombiner::TakeError();
+  size_t offset;
+  pointer_t arena;
+  if (((kind == cudaMemcpyHostToDevice &&
+        HostArena::Contains(src, count, &offset)) ||
+       (kind == cudaMemcpyDeviceToHost &&
+        HostArena::Contains(dst, count, &offset))) &&
+      (arena = HostArena::GetHandle()) != 0) {
+    /* truly asynchronous: the arena is page-locked on the backend */
+    CudaRtFrontend::Prepare();
+    CudaRtFrontend::AddDevicePointerForArguments(
+        kind == cudaMemcpyHostToDevice ? dst : src);
+    CudaRtFrontend::AddVariableForArguments(arena);
+    CudaRtFrontend::AddVariableForArguments(offset);
+    CudaRtFrontend::AddVariableForArguments(count);
+    CudaRtFrontend::AddVariableForArguments(kind);
+    CudaRtFrontend::AddDevicePointerForArguments(stream);
+    CudaRtFrontend::SetStreamForTrace(stream);
+    CudaRtFrontend::Execute("cudaMemcpyAsyncHostArena");
+    return CudaRtFrontend::GetExitCode();
+  }
   CudaRtFrontend::Prepare();
   switch (kind) {
     case cudaMemcpyDefault:
@@ -647,6 +845,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyAsync(void *dst,
 #else
       CudaRtFrontend::AddVariableForArguments(stream);
 #endif
+      CudaRtFrontend::SetStreamForTrace(stream);
       CudaRtFrontend::Execute("cudaMemcpyAsync");
       if (memmove(dst, src, count) == NULL) return cudaErrorInvalidValue;
       return cudaSuccess;
@@ -662,6 +861,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyAsync(void *dst,
 #else
       CudaRtFrontend::AddVariableForArguments(stream);
 #endif
+      CudaRtFrontend::SetStreamForTrace(stream);
       CudaRtFrontend::Execute("cudaMemcpyAsync");
       break;
     case cudaMemcpyDeviceToHost:
@@ -675,6 +875,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyAsync(void *dst,
 #else
       CudaRtFrontend::AddVariableForArguments(stream);
 #endif
+      CudaRtFrontend::SetStreamForTrace(stream);
       CudaRtFrontend::Execute("cudaMemcpyAsync");
       if (CudaRtFrontend::Success())
         memmove(dst, CudaRtFrontend::GetOutputHostPointer<char>(count), count);
@@ -689,6 +890,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyAsync(void *dst,
 #else
       CudaRtFrontend::AddVariableForArguments(stream);
 #endif
+      CudaRtFrontend::SetStreamForTrace(stream);
       CudaRtFrontend::Execute("cudaMemcpyAsync");
       break;
   }
@@ -699,6 +901,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyAsync(void *dst,
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaMemcpyFromArray(void *dst, const cudaArray *src, size_t wOffset,
                     size_t hOffset, size_t count, cudaMemcpyKind kind) {
+  ManagedMemory::Prefetch(dst, count);
   CudaRtFrontend::Prepare();
 
   switch (kind) {
@@ -776,6 +979,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyFromArrayAsync(
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaMemcpyFromSymbol(void *dst, const void *symbol, size_t count, size_t offset,
                      cudaMemcpyKind kind) {
+  ManagedMemory::Prefetch(dst, count);
   CudaRtFrontend::Prepare();
   switch (kind) {
     case cudaMemcpyDefault:
@@ -790,10 +994,7 @@ cudaMemcpyFromSymbol(void *dst, const void *symbol, size_t count, size_t offset,
     case cudaMemcpyDeviceToHost:
       // Achtung: adding a fake host pointer
       CudaRtFrontend::AddDevicePointerForArguments((void *)0x666);
-      // Achtung: passing the address and the content of symbol
-      CudaRtFrontend::AddStringForArguments(
-          CudaUtil::MarshalHostPointer(symbol));
-      CudaRtFrontend::AddStringForArguments((char *)symbol);
+      CudaRtFrontend::AddSymbolForArguments(symbol);
       CudaRtFrontend::AddVariableForArguments(count);
       CudaRtFrontend::AddVariableForArguments(offset);
       CudaRtFrontend::AddVariableForArguments(kind);
@@ -803,10 +1004,7 @@ cudaMemcpyFromSymbol(void *dst, const void *symbol, size_t count, size_t offset,
       break;
     case cudaMemcpyDeviceToDevice:
       CudaRtFrontend::AddDevicePointerForArguments(dst);
-      // Achtung: passing the address and the content of symbol
-      CudaRtFrontend::AddStringForArguments(
-          CudaUtil::MarshalHostPointer(symbol));
-      CudaRtFrontend::AddStringForArguments((char *)symbol);
+      CudaRtFrontend::AddSymbolForArguments(symbol);
       CudaRtFrontend::AddVariableForArguments(count);
       CudaRtFrontend::AddVariableForArguments(offset);
       CudaRtFrontend::AddVariableForArguments(kind);
@@ -828,6 +1026,7 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyFromSymbolAsync(
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaMemcpyToArray(cudaArray *dst, size_t wOffset, size_t hOffset,
                   const void *src, size_t count, cudaMemcpyKind kind) {
+  ManagedMemory::Prefetch(src, count);
   CudaRtFrontend::Prepare();
   switch (kind) {
     case cudaMemcpyDefault:
@@ -871,6 +1070,10 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaMemcpyToArrayAsync(
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaMemcpyToSymbol(const void *symbol, const void *src, size_t count,
                    size_t offset, cudaMemcpyKind kind) {
+  ManagedMemory::Prefetch(src, count);
+  if (kind == cudaMemcpyHostToDevice &&
+      WriteCombiner::MemcpyToSymbol(symbol, src, count, offset))
+    return WriteCombiner::TakeError();
   CudaRtFrontend::Prepare();
   switch (kind) {
     case cudaMemcpyDefault:
@@ -879,28 +1082,25 @@ cudaMemcpyToSymbol(const void *symbol, const void *src, size_t count,
       return cudaErrorInvalidMemcpyDirection;
       break;
     case cudaMemcpyHostToDevice:
-      // Achtung: passing the address and the content of symbol
-      CudaRtFrontend::AddStringForArguments(
-          CudaUtil::MarshalHostPointer(symbol));
-      CudaRtFrontend::AddStringForArguments((char *)symbol);
+      CudaRtFrontend::AddSymbolForArguments(symbol);
       CudaRtFrontend::AddHostPointerForArguments<char>(
           static_cast<char *>(const_cast<void *>(src)), count);
       CudaRtFrontend::AddVariableForArguments(count);
       CudaRtFrontend::AddVariableForArguments(offset);
       CudaRtFrontend::AddVariableForArguments(kind);
       CudaRtFrontend::Execute("cudaMemcpyToSymbol");
+      /* the symbol exists: later writes to it can be combined */
+      if (CudaRtFrontend::Success()) WriteCombiner::AddSymbol(symbol);
       break;
     case cudaMemcpyDeviceToHost:
       /* This should never happen. */
       return cudaErrorInvalidMemcpyDirection;
       break;
     case cudaMemcpyDeviceToDevice:
-      // Achtung: passing the address and the content of symbol
-      CudaRtFrontend::AddStringForArguments(
-          CudaUtil::MarshalHostPointer(symbol));
-      CudaRtFrontend::AddStringForArguments((char *)symbol);
+      CudaRtFrontend::AddSymbolForArguments(symbol);
       CudaRtFrontend::AddDevicePointerForArguments(src);
       CudaRtFrontend::AddVariableForArguments(count);
+      CudaRtFrontend::AddVariableForArguments(offset);
       CudaRtFrontend::AddVariableForArguments(kind);
       CudaRtFrontend::Execute("cudaMemcpyToSymbol");
       break;
@@ -31,6 +31,10 @@ using gvirtus::common::pointer_t;
 /* cudaOccupancyMaxActiveBlocksPerMultiprocessor */
 extern "C" __host__ cudaError_t cudaOccupancyMaxActiveBlocksPerMultiprocessor(
     int* numBlocks, const void* func, int blockSize, size_t dynamicSMemSize) {
+  int device = CudaRtFrontend::getCurrentDevice();
+  if (QueryCache::GetOccupancy(func, device, blockSize, dynamicSMemSize, 0,
+                               numBlocks))
+    return cudaSuccess;
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(numBlocks);
   CudaRtFrontend::AddVariableForArguments((pointer_t)func);
@@ -38,8 +42,11 @@ extern "C" __host__ cudaError_t cudaOccupancyMaxActiveBlocksPerMultiprocessor(
   CudaRtFrontend::AddVariableForArguments(dynamicSMemSize);
   CudaRtFrontend::Execute("cudaOccupancyMaxActiveBlocksPerMultiprocessor");
 
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     *numBlocks = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    QueryCache::PutOccupancy(func, device, blockSize, dynamicSMemSize, 0,
+                             *numBlocks);
+  }
   return CudaRtFrontend::GetExitCode();
 }
 
@@ -51,6 +58,10 @@ cudaOccupancyMaxActiveBlocksPerMultiprocessorWithFlags(int* numBlocks,
                                                        int blockSize,
                                                        size_t dynamicSMemSize,
                                                        unsigned int flags) {
+  int device = CudaRtFrontend::getCurrentDevice();
+  if (QueryCache::GetOccupancy(func, device, blockSize, dynamicSMemSize, flags,
+                               numBlocks))
+    return cudaSuccess;
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(numBlocks);
   CudaRtFrontend::AddVariableForArguments((pointer_t)func);
@@ -60,8 +71,11 @@ cudaOccupancyMaxActiveBlocksPerMultiprocessorWithFlags(int* numBlocks,
   CudaRtFrontend::Execute(
       "cudaOccupancyMaxActiveBlocksPerMultiprocessorWithFlags");
 
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     *numBlocks = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    QueryCache::PutOccupancy(func, device, blockSize, dynamicSMemSize, flags,
+                             *numBlocks);
+  }
   return CudaRtFrontend::GetExitCode();
 }
 #endif
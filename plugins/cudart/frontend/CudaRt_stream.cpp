@@ -80,6 +80,7 @@ cudaStreamDestroy(cudaStream_t stream) {
   CudaRtFrontend::AddVariableForArguments(stream);
 #endif
   CudaRtFrontend::Execute("cudaStreamDestroy");
+  RuntimeShadow::ForgetStream(stream);
   return CudaRtFrontend::GetExitCode();
 }
 
@@ -93,11 +94,18 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaStreamWaitEvent(
   CudaRtFrontend::AddDevicePointerForArguments(stream);
   CudaRtFrontend::AddDevicePointerForArguments(event);
   CudaRtFrontend::AddVariableForArguments(flags);
+  CudaRtFrontend::SetStreamForTrace(stream);
   CudaRtFrontend::Execute("cudaStreamWaitEvent");
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaStreamQuery(cudaStream_t stream) {
+  /* held back copies are work the backend has not seen yet */
+  if (!WriteCombiner::IsPending() && RuntimeShadow::IsStreamIdle(stream)) {
+    ManagedMemory::Synchronize();
+    return cudaSuccess;
+  }
+  uint64_t epoch = RuntimeShadow::GetEpoch();
   CudaRtFrontend::Prepare();
 #if CUDART_VERSION >= 3010
   CudaRtFrontend::AddDevicePointerForArguments(stream);
@@ -105,7 +113,13 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaStreamQuery(cudaStream_t stream) {
   CudaRtFrontend::AddVariableForArguments(stream);
 #endif
   CudaRtFrontend::Execute("cudaStreamQuery");
-  return CudaRtFrontend::GetExitCode();
+  cudaError_t error = CudaRtFrontend::GetExitCode();
+  if (error == cudaSuccess) {
+    RuntimeShadow::SetStreamIdle(stream, epoch);
+    /* the device is done with managed memory: the host may touch it */
+    ManagedMemory::Synchronize();
+  }
+  return error;
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaStreamCreateWithPriority(
@@ -121,12 +135,27 @@ extern "C" __host__ cudaError_t CUDARTAPI cudaStreamCreateWithPriority(
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaStreamSynchronize(cudaStream_t stream) {
+  /* held back copies are work the backend has not seen yet */
+  if (!WriteCombiner::IsPending() && RuntimeShadow::IsStreamIdle(stream)) {
+    ManagedMemory::Synchronize();
+    return cudaSuccess;
+  }
+  uint64_t epoch = RuntimeShadow::GetEpoch();
   CudaRtFrontend::Prepare();
 #if CUDART_VERSION >= 3010
   CudaRtFrontend::AddDevicePointerForArguments(stream);
 #else
   CudaRtFrontend::AddVariableForArguments(stream);
 #endif
+  CudaRtFrontend::SetStreamForTrace(stream);
   CudaRtFrontend::Execute("cudaStreamSynchronize");
-  return CudaRtFrontend::GetExitCode();
+  cudaError_t error = CudaRtFrontend::GetExitCode();
+  /* the copies held back were sent ahead: their failure shows here */
+  if (error == cudaSuccess) error = WriteCombiner::TakeError();
+  if (error == cudaSuccess) {
+    RuntimeShadow::SetStreamIdle(stream, epoch);
+    /* the device is done with managed memory: the host may touch it */
+    ManagedMemory::Synchronize();
+  }
+  return error;
 }
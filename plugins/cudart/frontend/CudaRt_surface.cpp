@@ -30,6 +30,8 @@
 
 using namespace std;
 
+using gvirtus::common::pointer_t;
+
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaBindSurfaceToArray(const surfaceReference *surfref, const cudaArray *array,
                        const cudaChannelFormatDesc *desc) {
@@ -39,7 +41,7 @@ cudaBindSurfaceToArray(const surfaceReference *surfref, const cudaArray *array,
   //    endl;
 
   // Achtung: passing the address and the content of the textureReference
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(surfref));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)surfref);
   CudaRtFrontend::AddHostPointerForArguments(surfref);
   CudaRtFrontend::AddDevicePointerForArguments((void *)array);
   CudaRtFrontend::AddHostPointerForArguments(desc);
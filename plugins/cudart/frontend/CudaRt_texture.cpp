@@ -27,13 +27,15 @@
 
 using namespace std;
 
+using gvirtus::common::pointer_t;
+
 extern "C" __host__ cudaError_t CUDARTAPI cudaBindTexture(
     size_t *offset, const textureReference *texref, const void *devPtr,
     const cudaChannelFormatDesc *desc, size_t size) {
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(offset);
   // Achtung: passing the address and the content of the textureReference
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(texref));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)texref);
   CudaRtFrontend::AddHostPointerForArguments(texref);
   CudaRtFrontend::AddDevicePointerForArguments(devPtr);
   CudaRtFrontend::AddHostPointerForArguments(desc);
@@ -51,7 +53,7 @@ cudaBindTexture2D(size_t *offset, const textureReference *texref,
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(offset);
   // Achtung: passing the address and the content of the textureReference
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(texref));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)texref);
   CudaRtFrontend::AddHostPointerForArguments(texref);
   CudaRtFrontend::AddDevicePointerForArguments(devPtr);
   CudaRtFrontend::AddHostPointerForArguments(desc);
@@ -76,7 +78,7 @@ cudaBindTextureToArray(const textureReference *texref, const cudaArray *array,
                        const cudaChannelFormatDesc *desc) {
   CudaRtFrontend::Prepare();
   // Achtung: passing the address and the content of the textureReference
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(texref));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)texref);
   CudaRtFrontend::AddHostPointerForArguments(texref);
   CudaRtFrontend::AddDevicePointerForArguments((void *)array);
   CudaRtFrontend::AddHostPointerForArguments(desc);
@@ -111,7 +113,8 @@ extern "C" __host__ cudaError_t CUDARTAPI
 cudaGetTextureAlignmentOffset(size_t *offset, const textureReference *texref) {
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(offset);
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(texref));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)texref);
+  CudaRtFrontend::AddHostPointerForArguments(texref);
   CudaRtFrontend::Execute("cudaGetTextureAlignmentOffset");
   if (CudaRtFrontend::Success())
     *offset = *(CudaRtFrontend::GetOutputHostPointer<size_t>());
@@ -122,21 +125,18 @@ extern "C" __host__ cudaError_t CUDARTAPI
 cudaGetTextureReference(const textureReference **texref, const void *symbol) {
   CudaRtFrontend::Prepare();
   // Achtung: skipping to add texref
-  // Achtung: passing the address and the content of symbol
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(symbol));
-  CudaRtFrontend::AddStringForArguments((char *)symbol);
+  CudaRtFrontend::AddSymbolForArguments(symbol);
   CudaRtFrontend::Execute("cudaGetTextureReference");
-  if (CudaRtFrontend::Success()) {
-    char *texrefHandler = CudaRtFrontend::GetOutputString();
-    *texref = (textureReference *)strtoul(texrefHandler, NULL, 16);
-  }
+  if (CudaRtFrontend::Success())
+    *texref =
+        (textureReference *)CudaRtFrontend::GetOutputVariable<pointer_t>();
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaUnbindTexture(const textureReference *texref) {
   CudaRtFrontend::Prepare();
-  CudaRtFrontend::AddStringForArguments(CudaUtil::MarshalHostPointer(texref));
+  CudaRtFrontend::AddVariableForArguments((pointer_t)texref);
   CudaRtFrontend::Execute("cudaUnbindTexture");
   return CudaRtFrontend::GetExitCode();
 }
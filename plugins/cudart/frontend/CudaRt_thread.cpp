@@ -30,7 +30,10 @@ using namespace std;
 extern "C" __host__ cudaError_t CUDARTAPI cudaThreadSynchronize() {
   CudaRtFrontend::Prepare();
   CudaRtFrontend::Execute("cudaThreadSynchronize");
-  return CudaRtFrontend::GetExitCode();
+  cudaError_t error = CudaRtFrontend::GetExitCode();
+  /* the device is done with managed memory: the host may touch it */
+  if (error == cudaSuccess) ManagedMemory::Synchronize();
+  return error;
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI cudaThreadExit() {
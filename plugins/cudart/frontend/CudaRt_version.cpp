@@ -29,20 +29,26 @@ using namespace std;
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaDriverGetVersion(int *driverVersion) {
+  if (QueryCache::GetDriverVersion(driverVersion)) return cudaSuccess;
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(driverVersion);
   CudaRtFrontend::Execute("cudaDriverGetVersion");
-  if (CudaRtFrontend::Success())
+  if (CudaRtFrontend::Success()) {
     *driverVersion = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    QueryCache::PutDriverVersion(*driverVersion);
+  }
   return CudaRtFrontend::GetExitCode();
 }
 
 extern "C" __host__ cudaError_t CUDARTAPI
 cudaRuntimeGetVersion(int *runtimeVersion) {
+  if (QueryCache::GetRuntimeVersion(runtimeVersion)) return cudaSuccess;
   CudaRtFrontend::Prepare();
   CudaRtFrontend::AddHostPointerForArguments(runtimeVersion);
-  CudaRtFrontend::Execute("cudaDriverGetVersion");
-  if (CudaRtFrontend::Success())
+  CudaRtFrontend::Execute("cudaRuntimeGetVersion");
+  if (CudaRtFrontend::Success()) {
     *runtimeVersion = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    QueryCache::PutRuntimeVersion(*runtimeVersion);
+  }
   return CudaRtFrontend::GetExitCode();
 }
@@ -0,0 +1,98 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include "DeviceMap.h"
+
+#include "CudaRtFrontend.h"
+
+using gvirtus::frontend::Frontend;
+
+std::mutex DeviceMap::mMutex;
+std::vector<int> *DeviceMap::mpFirst = new std::vector<int>();
+
+DeviceMap::Scope::Scope(int backend) {
+  mSelected = Selected();
+  Select(backend);
+}
+
+DeviceMap::Scope::~Scope() { Select(mSelected); }
+
+bool DeviceMap::IsDistributed() { return Frontend::GetBackendCount() > 1; }
+
+cudaError_t DeviceMap::GetDeviceCount(int *count) {
+  cudaError_t error = Build();
+  if (error != cudaSuccess) return error;
+  std::lock_guard<std::mutex> lock(mMutex);
+  *count = mpFirst->back();
+  return cudaSuccess;
+}
+
+int DeviceMap::Locate(int device, int *local) {
+  if (!IsDistributed()) {
+    *local = device;
+    return 0;
+  }
+  if (device < 0 || Build() != cudaSuccess) return -1;
+  std::lock_guard<std::mutex> lock(mMutex);
+  for (size_t backend = 0; backend + 1 < mpFirst->size(); backend++)
+    if (device < (*mpFirst)[backend + 1]) {
+      *local = device - (*mpFirst)[backend];
+      return backend;
+    }
+  return -1;
+}
+
+int DeviceMap::ToVirtual(int local) {
+  if (!IsDistributed() || Build() != cudaSuccess) return local;
+  std::lock_guard<std::mutex> lock(mMutex);
+  return (*mpFirst)[Selected()] + local;
+}
+
+int DeviceMap::Selected() { return Frontend::GetFrontend()->GetBackend(); }
+
+void DeviceMap::Select(int backend) {
+  Frontend::GetFrontend()->SelectBackend(backend);
+}
+
+/**
+ * Asks every backend for its device count, once. A failure is returned and
+ * asked again next time.
+ */
+cudaError_t DeviceMap::Build() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (!mpFirst->empty()) return cudaSuccess;
+  std::vector<int> first(1, 0);
+  for (int backend = 0; backend < Frontend::GetBackendCount(); backend++) {
+    Scope scope(backend);
+    int count;
+    CudaRtFrontend::Prepare();
+    CudaRtFrontend::AddHostPointerForArguments(&count);
+    CudaRtFrontend::Execute("cudaGetDeviceCount");
+    if (!CudaRtFrontend::Success())
+      return (cudaError_t)CudaRtFrontend::GetExitCode();
+    count = *(CudaRtFrontend::GetOutputHostPointer<int>());
+    first.push_back(first.back() + count);
+  }
+  *mpFirst = first;
+  return cudaSuccess;
+}
@@ -0,0 +1,97 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef DEVICEMAP_H
+#define DEVICEMAP_H
+
+#include <mutex>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+
+/**
+ * DeviceMap numbers the devices of every backend listed in the frontend
+ * configuration as one contiguous range: the devices of the first backend
+ * come first, then those of the second, and so on. The application only
+ * sees these virtual ordinals; each request carries the ordinal local to
+ * the backend it is sent to.
+ *
+ * cudaSetDevice() also selects the backend the requests of the thread go
+ * to, so everything the thread does next happens on the backend owning its
+ * current device, as it would on the device itself. The device counts are
+ * asked once, the first time an ordinal has to be mapped.
+ *
+ * With a single backend the ordinals are the backend ones and nothing is
+ * asked.
+ */
+class DeviceMap {
+ public:
+  /**
+   * Sends the requests of the calling thread to another backend while in
+   * scope, for the queries naming a device other than the current one.
+   */
+  class Scope {
+   public:
+    explicit Scope(int backend);
+    ~Scope();
+
+   private:
+    int mSelected;
+  };
+
+  static bool IsDistributed();
+
+  /**
+   * Answers cudaGetDeviceCount() with the devices of every backend.
+   */
+  static cudaError_t GetDeviceCount(int *count);
+
+  /**
+   * Finds the backend owning a device.
+   *
+   * @param local set to the ordinal of the device on its backend.
+   * @return the backend, or -1 if device is not a valid ordinal.
+   */
+  static int Locate(int device, int *local);
+
+  /**
+   * Returns the virtual ordinal of a device of the selected backend.
+   */
+  static int ToVirtual(int local);
+
+  /**
+   * Returns the backend the requests of the calling thread go to.
+   */
+  static int Selected();
+
+  static void Select(int backend);
+
+ private:
+  static cudaError_t Build();
+
+  static std::mutex mMutex;
+  /* the first ordinal of each backend, then the device count */
+  static std::vector<int> *mpFirst;
+};
+
+#endif /* DEVICEMAP_H */
@@ -0,0 +1,248 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "HostArena.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <iterator>
+#include <random>
+#include <string>
+
+#include "CudaRtFrontend.h"
+
+using gvirtus::common::pointer_t;
+using gvirtus::frontend::Frontend;
+
+std::mutex HostArena::mMutex;
+char *HostArena::mpBase = NULL;
+size_t HostArena::mSize = 0;
+bool HostArena::mTried = false;
+uint64_t HostArena::mCookie = 0;
+std::vector<pointer_t> *HostArena::mpHandles = NULL;
+std::map<size_t, size_t> *HostArena::mpFree = NULL;
+std::map<size_t, std::pair<size_t, unsigned int> > *HostArena::mpUsed = NULL;
+
+/* per backend: 0 not asked yet, 1 joined, 2 refused */
+static thread_local std::vector<char> tlsJoined;
+
+/**
+ * Pins [offset, offset + size) on every backend the arena is attached to, or
+ * on none.
+ */
+static bool Register(const std::vector<pointer_t> &handles, size_t offset,
+                     size_t size, unsigned int flags) {
+  for (int backend = 0; backend < (int)handles.size(); backend++) {
+    if (handles[backend] == 0) continue;
+    DeviceMap::Scope scope(backend);
+    CudaRtFrontend::Prepare();
+    CudaRtFrontend::AddVariableForArguments(handles[backend]);
+    CudaRtFrontend::AddVariableForArguments(offset);
+    CudaRtFrontend::AddVariableForArguments(size);
+    CudaRtFrontend::AddVariableForArguments(flags);
+    CudaRtFrontend::Execute("cudaHostArenaRegister");
+    if (CudaRtFrontend::Success()) continue;
+    while (--backend >= 0) {
+      if (handles[backend] == 0) continue;
+      DeviceMap::Scope scope(backend);
+      CudaRtFrontend::Prepare();
+      CudaRtFrontend::AddVariableForArguments(handles[backend]);
+      CudaRtFrontend::AddVariableForArguments(offset);
+      CudaRtFrontend::Execute("cudaHostArenaUnregister");
+    }
+    return false;
+  }
+  return true;
+}
+
+void *HostArena::Allocate(size_t size, unsigned int flags) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (!Attach()) return NULL;
+  for (int backend = 0; backend < (int)mpHandles->size(); backend++)
+    if ((*mpHandles)[backend] != 0) Join(backend);
+
+  size_t page = sysconf(_SC_PAGESIZE);
+  size_t needed = ((size > 0 ? size : 1) + page - 1) & ~(page - 1);
+  for (auto it = mpFree->begin(); it != mpFree->end(); it++) {
+    if (it->second < needed) continue;
+    size_t offset = it->first;
+    size_t left = it->second - needed;
+    mpFree->erase(it);
+    if (left > 0) mpFree->insert(std::make_pair(offset + needed, left));
+
+    if (!Register(*mpHandles, offset, needed, flags)) {
+      (*mpFree)[offset] = needed;
+      return NULL;
+    }
+    mpUsed->insert(std::make_pair(offset, std::make_pair(needed, flags)));
+    return mpBase + offset;
+  }
+  return NULL;
+}
+
+bool HostArena::Free(void *ptr) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mpBase == NULL || ptr < mpBase || ptr >= mpBase + mSize) return false;
+  auto used = mpUsed->find((char *)ptr - mpBase);
+  if (used == mpUsed->end()) return true;
+
+  for (int backend = 0; backend < (int)mpHandles->size(); backend++) {
+    if ((*mpHandles)[backend] == 0 || !Join(backend)) continue;
+    DeviceMap::Scope scope(backend);
+    CudaRtFrontend::Prepare();
+    CudaRtFrontend::AddVariableForArguments((*mpHandles)[backend]);
+    CudaRtFrontend::AddVariableForArguments(used->first);
+    CudaRtFrontend::Execute("cudaHostArenaUnregister");
+  }
+
+  /* give the pages back and merge with the free neighbours */
+  size_t offset = used->first;
+  size_t size = used->second.first;
+  mpUsed->erase(used);
+  madvise(mpBase + offset, size, MADV_DONTNEED);
+  auto next = mpFree->lower_bound(offset);
+  if (next != mpFree->end() && offset + size == next->first) {
+    size += next->second;
+    next = mpFree->erase(next);
+  }
+  if (next != mpFree->begin()) {
+    auto prev = std::prev(next);
+    if (prev->first + prev->second == offset) {
+      prev->second += size;
+      return true;
+    }
+  }
+  mpFree->insert(std::make_pair(offset, size));
+  return true;
+}
+
+bool HostArena::Contains(const void *ptr, size_t size, size_t *offset) {
+  if (mpBase == NULL || ptr < mpBase) return false;
+  size_t start = (const char *)ptr - mpBase;
+  if (start >= mSize || size > mSize - start) return false;
+  if (offset != NULL) *offset = start;
+  return true;
+}
+
+unsigned int HostArena::GetFlags(const void *ptr) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (!Contains(ptr, 1)) return 0;
+  auto it = mpUsed->upper_bound((const char *)ptr - mpBase);
+  if (it == mpUsed->begin()) return 0;
+  return std::prev(it)->second.second;
+}
+
+pointer_t HostArena::GetHandle() {
+  if (mpBase == NULL) return 0;
+  int backend = DeviceMap::Selected();
+  if ((*mpHandles)[backend] == 0 || !Join(backend)) return 0;
+  return (*mpHandles)[backend];
+}
+
+/**
+ * Creates the segment and asks every backend to map it. Runs once: if no
+ * backend can, every later allocation falls back to malloc(). The caller
+ * holds mMutex.
+ */
+bool HostArena::Attach() {
+  if (mTried) return mpBase != NULL;
+  mTried = true;
+
+  char *val = getenv("GVIRTUS_HOST_ARENA_SIZE");
+  size_t size = (size_t)(val == NULL ? 256 : atol(val)) << 20;
+  if (size == 0) return false;
+
+  std::random_device random;
+  uint64_t cookie = ((uint64_t)random() << 32) | random();
+  std::string name = "/gvirtus-arena-" + std::to_string(getpid()) + "-" +
+                     std::to_string(cookie & 0xffffffff);
+  int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) return false;
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    shm_unlink(name.c_str());
+    return false;
+  }
+  void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return false;
+  }
+  *(uint64_t *)base = cookie;
+
+  std::vector<pointer_t> handles(Frontend::GetBackendCount(), 0);
+  tlsJoined.assign(handles.size(), 2);
+  bool attached = false;
+  for (int backend = 0; backend < (int)handles.size(); backend++) {
+    DeviceMap::Scope scope(backend);
+    CudaRtFrontend::Prepare();
+    CudaRtFrontend::AddStringForArguments(name.c_str());
+    CudaRtFrontend::AddVariableForArguments(size);
+    CudaRtFrontend::AddVariableForArguments(cookie);
+    CudaRtFrontend::Execute("cudaHostArenaAttach");
+    if (!CudaRtFrontend::Success()) continue;
+    /* the session attaching holds the arena */
+    handles[backend] = CudaRtFrontend::GetOutputVariable<pointer_t>();
+    tlsJoined[backend] = 1;
+    attached = true;
+  }
+  /* the backends hold a mapping now, or never will: the name is not needed */
+  shm_unlink(name.c_str());
+  if (!attached) {
+    munmap(base, size);
+    return false;
+  }
+
+  mCookie = cookie;
+  mpHandles = new std::vector<pointer_t>(handles);
+  mpFree = new std::map<size_t, size_t>();
+  mpUsed = new std::map<size_t, std::pair<size_t, unsigned int> >();
+  /* the first page holds the cookie */
+  size_t page = sysconf(_SC_PAGESIZE);
+  mpFree->insert(std::make_pair(page, size - page));
+  mSize = size;
+  mpBase = (char *)base;
+  return true;
+}
+
+/**
+ * Makes the session of the calling thread on backend hold the arena, so that
+ * the backend keeps it mapped while this thread may name it. Asked once per
+ * thread and backend.
+ */
+bool HostArena::Join(int backend) {
+  if (tlsJoined.size() < mpHandles->size())
+    tlsJoined.resize(mpHandles->size(), 0);
+  if (tlsJoined[backend] == 0) {
+    DeviceMap::Scope scope(backend);
+    CudaRtFrontend::Prepare();
+    CudaRtFrontend::AddVariableForArguments((*mpHandles)[backend]);
+    CudaRtFrontend::AddVariableForArguments(mCookie);
+    CudaRtFrontend::Execute("cudaHostArenaJoin");
+    tlsJoined[backend] = CudaRtFrontend::Success() ? 1 : 2;
+  }
+  return tlsJoined[backend] == 1;
+}
@@ -0,0 +1,110 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef HOSTARENA_H
+#define HOSTARENA_H
+
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <gvirtus/common/gvirtus-type.h>
+
+/**
+ * HostArena serves cudaHostAlloc() and cudaMallocHost() from a POSIX shared
+ * memory segment that the backend maps and page-locks, when frontend and
+ * backend run on the same host.
+ *
+ * The arena is created on the first pinned allocation and attached to every
+ * backend in the configuration. A backend proves it can see the segment by
+ * reading back a random cookie from its first page; a remote backend fails
+ * this check and transfers with it carry the data as usual. If no backend
+ * sees the arena the frontend falls back to malloc() for the rest of its
+ * life. Transfers from or to the arena carry only an offset.
+ *
+ * A backend keeps the arena mapped while a session of this process holds it:
+ * each thread joins it the first time it names the arena, and the backend
+ * lets go of it, unpinning what is left, when the last of these connections
+ * closes, even if the process died.
+ *
+ * The size of the arena is read in MiB from GVIRTUS_HOST_ARENA_SIZE (default
+ * 256, 0 disables it). The segment is sparse: only touched pages cost memory.
+ */
+class HostArena {
+ public:
+  /**
+   * Allocates size bytes of backend page-locked memory.
+   *
+   * @param size the number of bytes.
+   * @param flags the cudaHostAlloc() flags.
+   *
+   * @return the host address or NULL if the arena cannot serve the request.
+   */
+  static void *Allocate(size_t size, unsigned int flags);
+
+  /**
+   * Releases an allocation made by Allocate().
+   *
+   * @return false if ptr does not belong to the arena.
+   */
+  static bool Free(void *ptr);
+
+  /**
+   * Checks if [ptr, ptr + size) lies inside the arena.
+   *
+   * @param offset filled with the offset of ptr in the arena.
+   */
+  static bool Contains(const void *ptr, size_t size, size_t *offset = NULL);
+
+  /**
+   * Returns the flags ptr was allocated with.
+   */
+  static unsigned int GetFlags(const void *ptr);
+
+  /**
+   * Returns the handle of the arena on the backend the calling thread is
+   * using, to be sent with the offsets. Call it before preparing the request:
+   * the first time, it joins the session of the thread to the arena.
+   *
+   * @return the handle or 0 if that backend cannot see the arena.
+   */
+  static gvirtus::common::pointer_t GetHandle();
+
+ private:
+  static bool Attach();
+  static bool Join(int backend);
+
+  static std::mutex mMutex;
+  static char *mpBase;
+  static size_t mSize;
+  static bool mTried;
+  static uint64_t mCookie;
+  /* the handle on each backend, 0 where the arena is not attached */
+  static std::vector<gvirtus::common::pointer_t> *mpHandles;
+  /* offset -> size of the free and allocated ranges */
+  static std::map<size_t, size_t> *mpFree;
+  static std::map<size_t, std::pair<size_t, unsigned int> > *mpUsed;
+};
+
+#endif /* HOSTARENA_H */
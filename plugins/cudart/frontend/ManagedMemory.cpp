@@ -0,0 +1,342 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "ManagedMemory.h"
+
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iostream>
+
+#include <gvirtus/frontend/Frontend.h>
+
+using gvirtus::common::pointer_t;
+using gvirtus::communicators::Buffer;
+using gvirtus::frontend::Frontend;
+
+std::map<uintptr_t, ManagedMemory::Region *> *ManagedMemory::mpRegions = NULL;
+std::mutex ManagedMemory::mMutex;
+std::atomic<ManagedMemory::Region *>
+    ManagedMemory::mSlots[ManagedMemory::MaxRegions];
+std::atomic<size_t> ManagedMemory::mSlotsUsed(0);
+std::bitset<ManagedMemory::MaxRegions> ManagedMemory::mTaken;
+struct sigaction ManagedMemory::mPreviousAction;
+size_t ManagedMemory::mPageSize = 0;
+
+void *ManagedMemory::Allocate(size_t size) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  InstallHandler();
+  size_t slot = 0;
+  while (slot < MaxRegions && mTaken[slot]) slot++;
+  if (slot == MaxRegions) return NULL;
+  size_t mapped = ((size > 0 ? size : 1) + mPageSize - 1) & ~(mPageSize - 1);
+  void *host = mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (host == MAP_FAILED) return NULL;
+  Region *region = new Region();
+  region->host = static_cast<char *>(host);
+  region->device = NULL;
+  region->size = size;
+  region->mapped = mapped;
+  region->count = mapped / mPageSize;
+  region->pages.reset(new std::atomic<uint8_t>[region->count]);
+  region->slot = slot;
+  region->released = false;
+  mTaken[slot] = true;
+  mpRegions->insert(std::make_pair((uintptr_t)host, region));
+  return host;
+}
+
+void ManagedMemory::Register(void *host, void *device) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  Region *region = Find(host);
+  if (region == NULL) return;
+  region->device = static_cast<char *>(device);
+  /* The device copy is as uninitialized as the host one: start Clean. */
+  for (size_t i = 0; i < region->count; i++) region->pages[i].store(Clean);
+  Protect(region, 0, region->count, PROT_READ);
+  mSlots[region->slot].store(region, std::memory_order_release);
+  if (mSlotsUsed.load() <= region->slot) mSlotsUsed.store(region->slot + 1);
+}
+
+void ManagedMemory::Release(void *host) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mpRegions == NULL) return;
+  auto it = mpRegions->find((uintptr_t)host);
+  if (it == mpRegions->end()) return;
+  mSlots[it->second->slot].store(NULL, std::memory_order_release);
+  mTaken[it->second->slot] = false;
+  munmap(it->second->host, it->second->mapped);
+  delete it->second;
+  mpRegions->erase(it);
+}
+
+cudaError_t ManagedMemory::Acquire(void *host) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  Region *region = Find(host);
+  if (region == NULL || region->device == NULL) return cudaSuccess;
+
+  size_t n = region->count;
+  for (size_t first = 0; first < n;) {
+    if (region->pages[first].load() != Dirty) {
+      first++;
+      continue;
+    }
+    size_t last = first;
+    while (last < n && region->pages[last].load() == Dirty) last++;
+    cudaError_t error = Push(region, first, last);
+    if (error != cudaSuccess) return error;
+    first = last;
+  }
+
+  region->released.store(false);
+  for (size_t i = 0; i < n; i++) region->pages[i].store(Device);
+  Protect(region, 0, n, PROT_NONE);
+  return cudaSuccess;
+}
+
+void ManagedMemory::Prefetch(const void *ptr, size_t size) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (size == 0 || mpRegions == NULL) return;
+  /* every region the range overlaps, from the one holding its start */
+  uintptr_t begin = (uintptr_t)ptr, end = begin + size;
+  auto it = mpRegions->upper_bound(begin);
+  if (it != mpRegions->begin()) --it;
+  for (; it != mpRegions->end() && it->first < end; ++it) {
+    Region *region = it->second;
+    uintptr_t host = (uintptr_t)region->host;
+    if (host + region->mapped <= begin || region->device == NULL) continue;
+    /* the pages of the range only */
+    size_t first = begin > host ? (begin - host) / mPageSize : 0;
+    size_t last =
+        std::min(region->count, (end - host + mPageSize - 1) / mPageSize);
+    Pull(region, first, last);
+  }
+}
+
+void ManagedMemory::Synchronize() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mpRegions == NULL) return;
+  for (auto &it : *mpRegions)
+    if (it.second->device != NULL) it.second->released.store(true);
+}
+
+/*
+ * For the frontends of the other libraries, which write host memory too: they
+ * look it up weakly, as the cudart frontend may not be loaded.
+ */
+extern "C" void gvirtusManagedPrefetch(const void *ptr, size_t size) {
+  ManagedMemory::Prefetch(ptr, size);
+}
+
+/**
+ * Returns the region containing ptr. The caller must hold mMutex.
+ */
+ManagedMemory::Region *ManagedMemory::Find(const void *ptr) {
+  if (mpRegions == NULL || mpRegions->empty()) return NULL;
+  auto it = mpRegions->upper_bound((uintptr_t)ptr);
+  if (it == mpRegions->begin()) return NULL;
+  --it;
+  Region *region = it->second;
+  if ((uintptr_t)ptr >= (uintptr_t)region->host + region->mapped) return NULL;
+  return region;
+}
+
+void ManagedMemory::Protect(Region *region, size_t first, size_t last,
+                            int prot) {
+  if (mprotect(region->host + first * mPageSize, (last - first) * mPageSize,
+               prot) != 0)
+    std::cerr << "ManagedMemory: mprotect failed: " << strerror(errno)
+              << std::endl;
+}
+
+/**
+ * Ships the pages [first, last) to the device with a cudaMemcpy marshalled in
+ * a private buffer, so that the input buffer of the calling wrapper is left
+ * alone. The caller must hold mMutex.
+ */
+cudaError_t ManagedMemory::Push(Region *region, size_t first, size_t last) {
+  size_t offset = first * mPageSize;
+  if (offset >= region->size) return cudaSuccess;
+  size_t count = std::min(last * mPageSize, region->size) - offset;
+  Buffer in;
+  in.Add((pointer_t)(region->device + offset));
+  in.Add<char>(region->host + offset, count);
+  in.Add(count);
+  in.Add(cudaMemcpyHostToDevice);
+  Frontend *frontend = Frontend::GetFrontend();
+  frontend->Execute("cudaMemcpy", &in);
+  if (!frontend->Success(cudaSuccess))
+    return (cudaError_t)frontend->GetExitCode();
+  /* marked first: a write racing the protection flips the page back */
+  for (size_t i = first; i < last; i++) region->pages[i].store(Clean);
+  Protect(region, first, last, PROT_READ);
+  return cudaSuccess;
+}
+
+/**
+ * Turns a Device page into Pulling, for the caller to pull back.
+ */
+bool ManagedMemory::Claim(Region *region, size_t page) {
+  uint8_t state = Device;
+  return region->pages[page].compare_exchange_strong(state, Pulling);
+}
+
+/**
+ * Pulls back the Device pages of the region in [first, last), coalescing
+ * adjacent pages in a single transfer, and waits for those another thread is
+ * pulling. The caller must hold mMutex.
+ */
+cudaError_t ManagedMemory::Pull(Region *region, size_t first, size_t last) {
+  while (first < last) {
+    if (!Claim(region, first)) {
+      /* the fault handler of another thread has it: it may fail */
+      if (region->pages[first].load() == Pulling) {
+        while (region->pages[first].load() == Pulling) sched_yield();
+        continue;
+      }
+      first++;
+      continue;
+    }
+    size_t end = first + 1;
+    while (end < last && Claim(region, end)) end++;
+    cudaError_t error = Fetch(region, first, end);
+    if (error != cudaSuccess) return error;
+    first = end;
+  }
+  return cudaSuccess;
+}
+
+/**
+ * Copies back the pages [first, last), which the caller turned from Device to
+ * Pulling, and leaves them Clean, or Device if the copy fails. It takes no
+ * lock and leaves the reply the thread may be reading alone: the fault
+ * handler calls it.
+ */
+cudaError_t ManagedMemory::Fetch(Region *region, size_t first, size_t last) {
+  size_t offset = first * mPageSize;
+  size_t count =
+      offset < region->size ? std::min(last * mPageSize, region->size) - offset
+                            : 0;
+  Protect(region, first, last, PROT_READ | PROT_WRITE);
+  if (count > 0) {
+    Buffer in;
+    /* NOTE: adding a fake host pointer, as cudaMemcpy does */
+    in.Add<char>(const_cast<char *>(""), 1);
+    in.Add((pointer_t)(region->device + offset));
+    in.Add(count);
+    in.Add(cudaMemcpyDeviceToHost);
+    int exitCode;
+    std::shared_ptr<Buffer> out = Frontend::GetFrontend()->ExecuteAside(
+        "cudaMemcpy", &in, &exitCode);
+    if (exitCode != cudaSuccess) {
+      Protect(region, first, last, PROT_NONE);
+      for (size_t i = first; i < last; i++) region->pages[i].store(Device);
+      return (cudaError_t)exitCode;
+    }
+    memmove(region->host + offset, out->Assign<char>(count), count);
+  }
+  /* marked last: a thread waiting on Pulling then finds the data there */
+  Protect(region, first, last, PROT_READ);
+  for (size_t i = first; i < last; i++) region->pages[i].store(Clean);
+  return cudaSuccess;
+}
+
+/**
+ * Installs the SIGSEGV handler once. The caller must hold mMutex.
+ */
+void ManagedMemory::InstallHandler() {
+  if (mpRegions != NULL) return;
+  mpRegions = new std::map<uintptr_t, Region *>();
+  mPageSize = sysconf(_SC_PAGESIZE);
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_sigaction = FaultHandler;
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGSEGV, &action, &mPreviousAction);
+}
+
+/**
+ * Turns a write to a Clean page into a Dirty page, and pulls back a Device
+ * page of an allocation handed back to the host. No lock is taken: the
+ * interrupted thread may hold any, including mMutex; and the pull leaves the
+ * output buffer of the frontend, which it may be reading, alone.
+ */
+void ManagedMemory::FaultHandler(int sig, siginfo_t *info, void *context) {
+  static const char msDevice[] =
+      "ManagedMemory: managed memory accessed while the device owns it, "
+      "synchronize first\n";
+  static const char msPull[] =
+      "ManagedMemory: can't pull managed memory back from the device\n";
+  uintptr_t address = (uintptr_t)info->si_addr;
+  size_t used = mSlotsUsed.load(std::memory_order_acquire);
+  for (size_t slot = 0; slot < used; slot++) {
+    Region *region = mSlots[slot].load(std::memory_order_acquire);
+    if (region == NULL || address < (uintptr_t)region->host ||
+        address >= (uintptr_t)region->host + region->mapped)
+      continue;
+    size_t page = (address - (uintptr_t)region->host) / mPageSize;
+    uint8_t state = Clean;
+    /* Dirty: another thread flipped it and has not unprotected it yet */
+    if (region->pages[page].compare_exchange_strong(state, Dirty) ||
+        state == Dirty) {
+      if (mprotect(region->host + page * mPageSize, mPageSize,
+                   PROT_READ | PROT_WRITE) == 0)
+        return;
+    } else if (state == Pulling) {
+      /* another thread is pulling it: the access is retried once it is */
+      while (region->pages[page].load() == Pulling) sched_yield();
+      return;
+    } else if (!region->released.load()) {
+      ssize_t written = write(STDERR_FILENO, msDevice, sizeof(msDevice) - 1);
+      (void)written;
+    } else if (Claim(region, page)) {
+      size_t last = page + 1;
+      while (last < region->count && last < page + PullAhead &&
+             Claim(region, last))
+        last++;
+      /* a write is retried on the Clean page, and makes it Dirty */
+      if (Fetch(region, page, last) == cudaSuccess) return;
+      ssize_t written = write(STDERR_FILENO, msPull, sizeof(msPull) - 1);
+      (void)written;
+    } else {
+      /* it changed meanwhile: retry the access */
+      return;
+    }
+    break;
+  }
+
+  /* Not ours: hand the fault to whoever was there before. */
+  if (mPreviousAction.sa_flags & SA_SIGINFO) {
+    mPreviousAction.sa_sigaction(sig, info, context);
+  } else if (mPreviousAction.sa_handler != SIG_DFL &&
+             mPreviousAction.sa_handler != SIG_IGN) {
+    mPreviousAction.sa_handler(sig);
+  } else {
+    signal(SIGSEGV, SIG_DFL);
+  }
+}
@@ -0,0 +1,166 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef MANAGEDMEMORY_H
+#define MANAGEDMEMORY_H
+
+#include <signal.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <bitset>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <cuda_runtime_api.h>
+
+/**
+ * ManagedMemory emulates cudaMallocManaged on the frontend with page granular
+ * dirty tracking.
+ *
+ * Every managed allocation is backed by an anonymous mapping whose pages are
+ * in one of three states, enforced with mprotect():
+ * - Clean: host and device copies match, the page is read-only.
+ * - Dirty: the host wrote the page, it is read-write and must be shipped
+ *   before the device uses the allocation again.
+ * - Device: the device may hold a newer copy, the page is not accessible.
+ * - Pulling: a Device page being copied back, by the thread that claimed it.
+ *
+ * A write to a Clean page raises SIGSEGV; the handler flips the page to
+ * Dirty. It takes no lock and sends nothing, so it is safe wherever the
+ * write happens. Only dirty pages are shipped before a launch.
+ *
+ * The synchronizing calls (Synchronize()) copy nothing back: they hand the
+ * allocations back to the host, as a device without concurrent managed
+ * access requires before the host touches them again, and their pages stay
+ * Device until the host touches them. Then the handler pulls back the page
+ * touched and the Device pages following it, up to PullAhead, with a
+ * request that leaves the reply of any interrupted one alone
+ * (Frontend::ExecuteAside()). It takes none of the locks of this class, and
+ * the wrappers that read or write host memory pull back the pages of their
+ * range before marshalling (Prefetch()), so the handler never interrupts the
+ * frontend holding its own. An access to a Device page before the allocation
+ * is handed back is an error, reported as the device would, with SIGSEGV.
+ *
+ * System calls do not fault: one writing to a Clean page, or touching a
+ * Device page, fails with EFAULT. Read into an unmanaged buffer, or write the
+ * pages once, before handing managed memory to the kernel.
+ */
+class ManagedMemory {
+ public:
+  /* the allocations the fault handler can find */
+  static const size_t MaxRegions = 4096;
+  /* the pages a fault pulls back at most */
+  static const size_t PullAhead = 16;
+
+  /**
+   * Reserves a page aligned host shadow for a managed allocation. The shadow
+   * is not tracked until Register() binds it to the remote allocation.
+   *
+   * @param size the size requested by the application.
+   *
+   * @return the host address, NULL on failure.
+   */
+  static void *Allocate(size_t size);
+
+  /**
+   * Binds a host shadow returned by Allocate() to the remote allocation and
+   * starts tracking its pages.
+   *
+   * @param host the host address handed to the application.
+   * @param device the remote managed pointer.
+   */
+  static void Register(void *host, void *device);
+
+  /**
+   * Stops tracking and unmaps a host shadow returned by Allocate().
+   *
+   * @param host the host address returned by Allocate().
+   */
+  static void Release(void *host);
+
+  /**
+   * Ships the dirty pages of an allocation to the device and hands the whole
+   * allocation over to it. Must be called before launching a kernel that
+   * receives the pointer.
+   *
+   * @param host the host address of the allocation.
+   *
+   * @return cudaSuccess or the error of the first failed transfer.
+   */
+  static cudaError_t Acquire(void *host);
+
+  /**
+   * Pulls back the device owned pages overlapping [ptr, ptr + size). Must be
+   * called by the wrappers that read or write host memory, before they
+   * prepare their own request.
+   *
+   * @param ptr any host address.
+   * @param size the length of the range.
+   */
+  static void Prefetch(const void *ptr, size_t size);
+
+  /**
+   * Hands every allocation back to the host, whose accesses then pull back
+   * the pages they touch. Called once the device is known to be done with
+   * them, after the request that said so was read.
+   */
+  static void Synchronize();
+
+ private:
+  enum PageState : uint8_t { Clean, Dirty, Device, Pulling };
+
+  typedef struct __region {
+    char *host;
+    char *device;
+    size_t size;
+    size_t mapped;
+    size_t count;
+    std::unique_ptr<std::atomic<uint8_t>[]> pages;
+    /* the host may touch its Device pages, which pulls them back */
+    std::atomic<bool> released;
+    /* where it is published to the fault handler */
+    size_t slot;
+  } Region;
+
+  static Region *Find(const void *ptr);
+  static void Protect(Region *region, size_t first, size_t last, int prot);
+  static cudaError_t Push(Region *region, size_t first, size_t last);
+  static bool Claim(Region *region, size_t page);
+  static cudaError_t Pull(Region *region, size_t first, size_t last);
+  static cudaError_t Fetch(Region *region, size_t first, size_t last);
+  static void InstallHandler();
+  static void FaultHandler(int sig, siginfo_t *info, void *context);
+
+  static std::map<uintptr_t, Region *> *mpRegions;
+  static std::mutex mMutex;
+  /* read by the fault handler, without locking */
+  static std::atomic<Region *> mSlots[MaxRegions];
+  static std::atomic<size_t> mSlotsUsed;
+  /* slots of the allocations, registered or not */
+  static std::bitset<MaxRegions> mTaken;
+  static struct sigaction mPreviousAction;
+  static size_t mPageSize;
+};
+
+#endif /* MANAGEDMEMORY_H */
@@ -0,0 +1,60 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "PointerRegistry.h"
+
+#include <mutex>
+
+void PointerRegistry::Insert(int backend, const void *base, size_t size,
+                             cudaMemoryType type, int device,
+                             void *devicePointer) {
+  Allocation allocation;
+  allocation.base = (uintptr_t)base;
+  /* a zero sized allocation still owns its base address */
+  allocation.size = size > 0 ? size : 1;
+  allocation.type = type;
+  allocation.device = device;
+  allocation.devicePointer = devicePointer;
+
+  std::unique_lock<std::shared_mutex> lock(mMutex);
+  mAllocations[{backend, allocation.base}] = allocation;
+}
+
+void PointerRegistry::Remove(int backend, const void *base) {
+  std::unique_lock<std::shared_mutex> lock(mMutex);
+  mAllocations.erase({backend, (uintptr_t)base});
+}
+
+bool PointerRegistry::Find(int backend, const void *ptr,
+                           Allocation *allocation) const {
+  uintptr_t address = (uintptr_t)ptr;
+  std::shared_lock<std::shared_mutex> lock(mMutex);
+  auto it = mAllocations.upper_bound({backend, address});
+  if (it == mAllocations.begin()) return false;
+  --it;
+  /* the last allocation of backend at or below address */
+  if (it->first.first != backend ||
+      address - it->second.base >= it->second.size)
+    return false;
+  if (allocation != NULL) *allocation = it->second;
+  return true;
+}
@@ -0,0 +1,89 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef POINTERREGISTRY_H
+#define POINTERREGISTRY_H
+
+#include <stdint.h>
+
+#include <map>
+#include <shared_mutex>
+#include <utility>
+
+#include <cuda_runtime_api.h>
+
+/**
+ * PointerRegistry indexes the allocations known to the frontend by address
+ * range, so that any address, not only a base pointer, can be resolved to the
+ * allocation containing it in O(log n).
+ *
+ * Allocations are kept per backend, as two backends may hand out the same
+ * device address; the allocations of host memory, whose addresses are the
+ * frontend's own, are kept under Host.
+ *
+ * Lookups vastly outnumber allocations, so readers share the lock and only
+ * Insert() and Remove() take it exclusively.
+ */
+class PointerRegistry {
+ public:
+  static const int Host = -1;
+
+  typedef struct __allocation {
+    uintptr_t base;
+    size_t size;
+    cudaMemoryType type;
+    int device;
+    /* the remote address backing base, equal to base for device memory */
+    void *devicePointer;
+  } Allocation;
+
+  /**
+   * Records the allocation [base, base + size) of backend, replacing any
+   * allocation of backend starting at the same address.
+   */
+  void Insert(int backend, const void *base, size_t size, cudaMemoryType type,
+              int device, void *devicePointer);
+
+  /**
+   * Forgets the allocation of backend starting at base.
+   */
+  void Remove(int backend, const void *base);
+
+  /**
+   * Looks up the allocation of backend containing ptr.
+   *
+   * @param backend the backend, or Host.
+   * @param ptr any address.
+   * @param allocation filled with the allocation found, may be NULL.
+   *
+   * @return true if ptr belongs to a known allocation.
+   */
+  bool Find(int backend, const void *ptr,
+            Allocation *allocation = NULL) const;
+
+ private:
+  mutable std::shared_mutex mMutex;
+  /* by backend, then by base address */
+  std::map<std::pair<int, uintptr_t>, Allocation> mAllocations;
+};
+
+#endif /* POINTERREGISTRY_H */
@@ -0,0 +1,204 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "QueryCache.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <iostream>
+#include <iterator>
+
+static bool EnvEnabled(const char *name, bool value) {
+  char *val = getenv(name);
+  if (val == NULL) return value;
+  return strcasecmp(val, "on") == 0 || strcasecmp(val, "true") == 0 ||
+         strcmp(val, "1") == 0;
+}
+
+bool QueryCache::mEnabled = EnvEnabled("GVIRTUS_QUERY_CACHE", true);
+std::mutex QueryCache::mMutex;
+int QueryCache::mDeviceCount = -1;
+int QueryCache::mDriverVersion = -1;
+int QueryCache::mRuntimeVersion = -1;
+std::map<int, cudaDeviceProp> *QueryCache::mpProperties =
+    new std::map<int, cudaDeviceProp>();
+std::map<std::pair<int, int>, int> *QueryCache::mpAttributes =
+    new std::map<std::pair<int, int>, int>();
+std::map<std::pair<const void *, int>, cudaFuncAttributes>
+    *QueryCache::mpFuncAttributes =
+        new std::map<std::pair<const void *, int>, cudaFuncAttributes>();
+std::map<QueryCache::OccupancyKey, int> *QueryCache::mpOccupancy =
+    new std::map<QueryCache::OccupancyKey, int>();
+std::atomic<uint64_t> QueryCache::mHits(0);
+std::atomic<uint64_t> QueryCache::mMisses(0);
+
+bool QueryCache::mDumping =
+    EnvEnabled("GVIRTUS_DUMP_STATS", false) && atexit(Dump) == 0;
+
+bool QueryCache::GetDeviceCount(int *count) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mDeviceCount < 0) return Count(false);
+  *count = mDeviceCount;
+  return Count(true);
+}
+
+void QueryCache::PutDeviceCount(int count) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mDeviceCount = count;
+}
+
+bool QueryCache::GetDriverVersion(int *version) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mDriverVersion < 0) return Count(false);
+  *version = mDriverVersion;
+  return Count(true);
+}
+
+void QueryCache::PutDriverVersion(int version) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mDriverVersion = version;
+}
+
+bool QueryCache::GetRuntimeVersion(int *version) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mRuntimeVersion < 0) return Count(false);
+  *version = mRuntimeVersion;
+  return Count(true);
+}
+
+void QueryCache::PutRuntimeVersion(int version) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mRuntimeVersion = version;
+}
+
+bool QueryCache::GetDeviceProperties(int device, cudaDeviceProp *prop) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mpProperties->find(device);
+  if (it == mpProperties->end()) return Count(false);
+  memmove(prop, &it->second, sizeof(cudaDeviceProp));
+  return Count(true);
+}
+
+void QueryCache::PutDeviceProperties(int device, const cudaDeviceProp *prop) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  (*mpProperties)[device] = *prop;
+}
+
+bool QueryCache::GetDeviceAttribute(cudaDeviceAttr attr, int device,
+                                    int *value) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mpAttributes->find(std::make_pair((int)attr, device));
+  if (it == mpAttributes->end()) return Count(false);
+  *value = it->second;
+  return Count(true);
+}
+
+void QueryCache::PutDeviceAttribute(cudaDeviceAttr attr, int device,
+                                    int value) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  (*mpAttributes)[std::make_pair((int)attr, device)] = value;
+}
+
+bool QueryCache::GetFuncAttributes(const void *func, int device,
+                                   cudaFuncAttributes *attr) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mpFuncAttributes->find(std::make_pair(func, device));
+  if (it == mpFuncAttributes->end()) return Count(false);
+  memmove(attr, &it->second, sizeof(cudaFuncAttributes));
+  return Count(true);
+}
+
+void QueryCache::PutFuncAttributes(const void *func, int device,
+                                   const cudaFuncAttributes *attr) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  (*mpFuncAttributes)[std::make_pair(func, device)] = *attr;
+}
+
+bool QueryCache::GetOccupancy(const void *func, int device, int blockSize,
+                              size_t dynamicSMemSize, unsigned int flags,
+                              int *numBlocks) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mpOccupancy->find(
+      OccupancyKey(func, device, blockSize, dynamicSMemSize, flags));
+  if (it == mpOccupancy->end()) return Count(false);
+  *numBlocks = it->second;
+  return Count(true);
+}
+
+void QueryCache::PutOccupancy(const void *func, int device, int blockSize,
+                              size_t dynamicSMemSize, unsigned int flags,
+                              int numBlocks) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  (*mpOccupancy)[OccupancyKey(func, device, blockSize, dynamicSMemSize,
+                              flags)] = numBlocks;
+}
+
+void QueryCache::InvalidateDevice(int device) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mpProperties->erase(device);
+  for (auto it = mpAttributes->begin(); it != mpAttributes->end();)
+    it = it->first.second == device ? mpAttributes->erase(it) : std::next(it);
+  for (auto it = mpFuncAttributes->begin(); it != mpFuncAttributes->end();)
+    it = it->first.second == device ? mpFuncAttributes->erase(it)
+                                    : std::next(it);
+  for (auto it = mpOccupancy->begin(); it != mpOccupancy->end();)
+    it = std::get<1>(it->first) == device ? mpOccupancy->erase(it)
+                                          : std::next(it);
+}
+
+void QueryCache::InvalidateFunction(const void *func) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  for (auto it = mpFuncAttributes->begin(); it != mpFuncAttributes->end();)
+    it = it->first.first == func ? mpFuncAttributes->erase(it) : std::next(it);
+  for (auto it = mpOccupancy->begin(); it != mpOccupancy->end();)
+    it = std::get<0>(it->first) == func ? mpOccupancy->erase(it)
+                                        : std::next(it);
+}
+
+void QueryCache::InvalidateOccupancy(int device) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  for (auto it = mpOccupancy->begin(); it != mpOccupancy->end();)
+    it = std::get<1>(it->first) == device ? mpOccupancy->erase(it)
+                                          : std::next(it);
+}
+
+/**
+ * Counts a lookup. A disabled cache always misses.
+ *
+ * @return hit, so that lookups can return through it.
+ */
+bool QueryCache::Count(bool hit) {
+  if (!mEnabled) hit = false;
+  (hit ? mHits : mMisses)++;
+  return hit;
+}
+
+void QueryCache::Dump() {
+  uint64_t hits = mHits, misses = mMisses;
+  if (hits + misses == 0) return;
+  std::cerr << "[GVIRTUS_STATS] Query cache: " << hits << " hit(s) out of "
+            << hits + misses << " quer(ies), "
+            << (100.0 * hits / (hits + misses)) << "% hit rate, " << hits
+            << " round-trip(s) avoided\n";
+}
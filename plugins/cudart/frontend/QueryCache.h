@@ -0,0 +1,112 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include <cuda_runtime_api.h>
+
+/**
+ * QueryCache keeps the answers of the device, version, function attribute
+ * and occupancy queries, which do not change for the life of a device
+ * context unless the application changes a setting they depend on.
+ *
+ * Entries are filled lazily from successful replies. A setting that can
+ * change an answer drops only the entries depending on it: device flags and
+ * resets drop the entries of the device, function settings the entries of
+ * the function, device-wide cache configuration the occupancy entries.
+ *
+ * Lookups are counted; with GVIRTUS_DUMP_STATS set the hit rate is printed
+ * at exit next to the frontend statistics. GVIRTUS_QUERY_CACHE=0 disables
+ * the cache.
+ */
+class QueryCache {
+ public:
+  static bool GetDeviceCount(int *count);
+  static void PutDeviceCount(int count);
+
+  static bool GetDriverVersion(int *version);
+  static void PutDriverVersion(int version);
+  static bool GetRuntimeVersion(int *version);
+  static void PutRuntimeVersion(int version);
+
+  static bool GetDeviceProperties(int device, cudaDeviceProp *prop);
+  static void PutDeviceProperties(int device, const cudaDeviceProp *prop);
+
+  static bool GetDeviceAttribute(cudaDeviceAttr attr, int device, int *value);
+  static void PutDeviceAttribute(cudaDeviceAttr attr, int device, int value);
+
+  static bool GetFuncAttributes(const void *func, int device,
+                                cudaFuncAttributes *attr);
+  static void PutFuncAttributes(const void *func, int device,
+                                const cudaFuncAttributes *attr);
+
+  static bool GetOccupancy(const void *func, int device, int blockSize,
+                           size_t dynamicSMemSize, unsigned int flags,
+                           int *numBlocks);
+  static void PutOccupancy(const void *func, int device, int blockSize,
+                           size_t dynamicSMemSize, unsigned int flags,
+                           int numBlocks);
+
+  /**
+   * Drops everything known about device.
+   */
+  static void InvalidateDevice(int device);
+
+  /**
+   * Drops the attributes and occupancy of func.
+   */
+  static void InvalidateFunction(const void *func);
+
+  /**
+   * Drops the occupancy of every function on device.
+   */
+  static void InvalidateOccupancy(int device);
+
+ private:
+  typedef std::tuple<const void *, int, int, size_t, unsigned int>
+      OccupancyKey;
+
+  static bool Count(bool hit);
+  static void Dump();
+
+  static bool mEnabled;
+  static bool mDumping;
+  static std::mutex mMutex;
+  static int mDeviceCount;
+  static int mDriverVersion;
+  static int mRuntimeVersion;
+  static std::map<int, cudaDeviceProp> *mpProperties;
+  static std::map<std::pair<int, int>, int> *mpAttributes;
+  static std::map<std::pair<const void *, int>, cudaFuncAttributes>
+      *mpFuncAttributes;
+  static std::map<OccupancyKey, int> *mpOccupancy;
+  static std::atomic<uint64_t> mHits;
+  static std::atomic<uint64_t> mMisses;
+};
+
+#endif /* QUERYCACHE_H */
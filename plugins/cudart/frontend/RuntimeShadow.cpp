@@ -0,0 +1,153 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "RuntimeShadow.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <gvirtus/frontend/Frontend.h>
+
+using gvirtus::frontend::Frontend;
+
+thread_local int RuntimeShadow::mDevice = 0;
+thread_local bool RuntimeShadow::mDeviceKnown = false;
+thread_local cudaError_t RuntimeShadow::mLastError = cudaSuccess;
+
+std::atomic<uint64_t> RuntimeShadow::mEpoch(0);
+std::atomic<bool> RuntimeShadow::mStickySeen(false);
+std::mutex RuntimeShadow::mStreamsMutex;
+std::map<cudaStream_t, uint64_t> *RuntimeShadow::mpIdleStreams =
+    new std::map<cudaStream_t, uint64_t>();
+bool RuntimeShadow::mHooked =
+    (Frontend::AddPostExecuteHook(RuntimeShadow::AfterExecute), true);
+
+static bool EnvEnabled() {
+  char *val = getenv("GVIRTUS_RUNTIME_SHADOW");
+  return val == NULL || strcmp(val, "off") != 0;
+}
+
+bool RuntimeShadow::mEnabled = EnvEnabled();
+
+/* requests that never leave work behind on a stream */
+static const char *msNoWork[] = {"cudaStreamQuery",
+                                 "cudaStreamSynchronize",
+                                 "cudaEventQuery",
+                                 "cudaEventSynchronize",
+                                 "cudaDeviceSynchronize",
+                                 "cudaGetLastError",
+                                 "cudaPeekAtLastError",
+                                 "cudaGetErrorString",
+                                 "cudaGetDevice",
+                                 "cudaSetDevice",
+                                 "cudaGetDeviceCount",
+                                 "cudaGetDeviceProperties",
+                                 "cudaDeviceGetAttribute",
+                                 "cudaFuncGetAttributes",
+                                 "cudaPointerGetAttributes",
+                                 "cudaDriverGetVersion",
+                                 "cudaRuntimeGetVersion",
+                                 NULL};
+
+int RuntimeShadow::GetDevice(bool *known) {
+  if (known != NULL) *known = mEnabled && mDeviceKnown;
+  return mDevice;
+}
+
+void RuntimeShadow::SetDevice(int device) {
+  mDevice = device;
+  mDeviceKnown = true;
+}
+
+void RuntimeShadow::MergeError(cudaError_t error) {
+  /* not an error: the runtime does not record it either */
+  if (error == cudaSuccess || error == cudaErrorNotReady) return;
+  if (IsSticky(error)) mStickySeen = true;
+  if (IsSticky(mLastError)) return;
+  mLastError = error;
+}
+
+cudaError_t RuntimeShadow::PeekAtLastError() { return mLastError; }
+
+bool RuntimeShadow::GetLastError(cudaError_t *error) {
+  if (!mEnabled) return false;
+  /* nothing to reset, or nothing that can be reset */
+  if (mLastError != cudaSuccess && !IsSticky(mLastError)) return false;
+  *error = mLastError;
+  return true;
+}
+
+void RuntimeShadow::ResetLastError() {
+  if (!IsSticky(mLastError)) mLastError = cudaSuccess;
+}
+
+uint64_t RuntimeShadow::GetEpoch() { return mEpoch; }
+
+bool RuntimeShadow::IsStreamIdle(cudaStream_t stream) {
+  /* a sticky error is returned by every call: the backend answers with it */
+  if (!mEnabled || mStickySeen) return false;
+  std::lock_guard<std::mutex> lock(mStreamsMutex);
+  auto it = mpIdleStreams->find(stream);
+  return it != mpIdleStreams->end() && it->second == mEpoch;
+}
+
+void RuntimeShadow::SetStreamIdle(cudaStream_t stream, uint64_t epoch) {
+  std::lock_guard<std::mutex> lock(mStreamsMutex);
+  (*mpIdleStreams)[stream] = epoch;
+}
+
+void RuntimeShadow::ForgetStream(cudaStream_t stream) {
+  std::lock_guard<std::mutex> lock(mStreamsMutex);
+  mpIdleStreams->erase(stream);
+}
+
+/**
+ * Errors that corrupt the context: every later call returns them and
+ * cudaGetLastError() does not reset them.
+ */
+bool RuntimeShadow::IsSticky(cudaError_t error) {
+  switch (error) {
+    case cudaErrorLaunchFailure:
+#if CUDART_VERSION >= 7000
+    case cudaErrorIllegalAddress:
+    case cudaErrorHardwareStackError:
+    case cudaErrorIllegalInstruction:
+    case cudaErrorMisalignedAddress:
+    case cudaErrorInvalidAddressSpace:
+    case cudaErrorInvalidPc:
+#endif
+    case cudaErrorAssert:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Runs after every request of every plugin: anything but a known query may
+ * have enqueued work, which makes every stream possibly busy.
+ */
+void RuntimeShadow::AfterExecute(const char *routine) {
+  for (const char **name = msNoWork; *name != NULL; name++)
+    if (strcmp(routine, *name) == 0) return;
+  mEpoch++;
+}
@@ -0,0 +1,117 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef RUNTIMESHADOW_H
+#define RUNTIMESHADOW_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include <cuda_runtime_api.h>
+
+/**
+ * RuntimeShadow mirrors the part of the CUDA runtime state that the frontend
+ * can follow from its own requests and their replies, so that the queries
+ * about it need no round trip.
+ *
+ * The current device and the last error are per thread, as in the runtime
+ * (each frontend thread also has its own backend channel). The last error is
+ * merged from the exit code of every reply.
+ *
+ * Streams are shared by every thread, so their state is process wide: a
+ * stream is idle when a synchronization or query on it has succeeded and no
+ * request that could enqueue work, from any thread or plugin, has completed
+ * since. Completed requests are counted by an epoch, read before the request
+ * observing the stream is sent. Once any thread has been answered with a
+ * sticky error no stream is idle: every call returns it, and the backend
+ * does.
+ *
+ * GVIRTUS_RUNTIME_SHADOW=off makes every query ask the backend again, as
+ * before the shadow, e.g. to check that both give the same answers.
+ */
+class RuntimeShadow {
+ public:
+  static bool IsEnabled() { return mEnabled; }
+
+  /**
+   * Returns the current device of the calling thread.
+   *
+   * @param known set to whether the backend confirmed it.
+   */
+  static int GetDevice(bool *known = NULL);
+
+  static void SetDevice(int device);
+
+  /**
+   * Records the exit code of a reply as the last error of the thread.
+   */
+  static void MergeError(cudaError_t error);
+
+  /**
+   * Answers cudaPeekAtLastError().
+   */
+  static cudaError_t PeekAtLastError();
+
+  /**
+   * Answers cudaGetLastError() when the backend has no error to be reset.
+   *
+   * @return false if the backend must be asked.
+   */
+  static bool GetLastError(cudaError_t *error);
+
+  /**
+   * Resets the last error after the backend did so.
+   */
+  static void ResetLastError();
+
+  /**
+   * Returns the epoch to pass to SetStreamIdle(), read before the request
+   * observing the stream is sent.
+   */
+  static uint64_t GetEpoch();
+
+  static bool IsStreamIdle(cudaStream_t stream);
+
+  static void SetStreamIdle(cudaStream_t stream, uint64_t epoch);
+
+  static void ForgetStream(cudaStream_t stream);
+
+ private:
+  static bool IsSticky(cudaError_t error);
+  static void AfterExecute(const char *routine);
+
+  static thread_local int mDevice;
+  static thread_local bool mDeviceKnown;
+  static thread_local cudaError_t mLastError;
+
+  static std::atomic<uint64_t> mEpoch;
+  static std::atomic<bool> mStickySeen;
+  static std::mutex mStreamsMutex;
+  static std::map<cudaStream_t, uint64_t> *mpIdleStreams;
+  static bool mHooked;
+  static bool mEnabled;
+};
+
+#endif /* RUNTIMESHADOW_H */
@@ -0,0 +1,207 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "WriteCombiner.h"
+
+#include <stdlib.h>
+
+#include "CudaRtFrontend.h"
+
+using gvirtus::common::pointer_t;
+using gvirtus::communicators::Buffer;
+using gvirtus::frontend::Frontend;
+using std::chrono::steady_clock;
+
+static size_t EnvSize(const char *name, size_t value) {
+  char *val = getenv(name);
+  return val == NULL ? value : (size_t)atol(val);
+}
+
+size_t WriteCombiner::mMaxCopy =
+    EnvSize("GVIRTUS_WRITE_COMBINE_MAX_COPY", 4096);
+size_t WriteCombiner::mMaxFrame =
+    EnvSize("GVIRTUS_WRITE_COMBINE_MAX_FRAME", 65536);
+std::chrono::microseconds WriteCombiner::mMaxAge(
+    EnvSize("GVIRTUS_WRITE_COMBINE_MAX_AGE", 1000));
+
+std::mutex WriteCombiner::mSymbolsMutex;
+std::set<const void *> *WriteCombiner::mpSymbols =
+    new std::set<const void *>();
+
+std::mutex WriteCombiner::mMutex;
+Buffer *WriteCombiner::mpFrame = NULL;
+std::atomic<size_t> WriteCombiner::mEntries(0);
+std::vector<std::shared_ptr<std::atomic<int>>> *WriteCombiner::mpIssuers =
+    new std::vector<std::shared_ptr<std::atomic<int>>>();
+int WriteCombiner::mBackend = 0;
+steady_clock::time_point WriteCombiner::mOldest;
+
+/* set while the thread sends the frame: its own requests must not wait */
+static thread_local bool tlsSending = false;
+/* the first error of the copies the thread issued: the frame keeps it alive
+ * for a copy sent after the thread ends */
+static thread_local std::shared_ptr<std::atomic<int>> tlsError =
+    std::make_shared<std::atomic<int>>(cudaSuccess);
+
+bool WriteCombiner::mHooked =
+    (Frontend::AddPreExecuteHook(WriteCombiner::BeforeExecute), true);
+
+bool WriteCombiner::Memcpy(void *dst, const void *src, size_t count) {
+  if (count == 0 || count > mMaxCopy) return false;
+  PointerRegistry::Allocation allocation;
+  if (!CudaRtFrontend::findAllocation(dst, &allocation) ||
+      allocation.type != cudaMemoryTypeDevice ||
+      count > allocation.size - ((uintptr_t)dst - allocation.base))
+    return false;
+  std::lock_guard<std::mutex> lock(mMutex);
+  Admit(src, count);
+  mpFrame->Add(CudaUtil::GatherMemcpy);
+  mpFrame->Add((pointer_t)dst);
+  mpFrame->Add(static_cast<const char *>(src), count);
+  mpIssuers->push_back(tlsError);
+  mEntries++;
+  /* the caller is owed the status of the copy before it returns */
+  Send();
+  return true;
+}
+
+bool WriteCombiner::MemcpyAsync(void *dst, const void *src, size_t count,
+                                cudaStream_t stream) {
+  if (count == 0 || count > mMaxCopy) return false;
+  PointerRegistry::Allocation allocation;
+  if (!CudaRtFrontend::findAllocation(dst, &allocation) ||
+      allocation.type != cudaMemoryTypeDevice ||
+      count > allocation.size - ((uintptr_t)dst - allocation.base))
+    return false;
+  std::lock_guard<std::mutex> lock(mMutex);
+  Admit(src, count);
+  mpFrame->Add(CudaUtil::GatherMemcpyAsync);
+  mpFrame->Add((pointer_t)dst);
+  mpFrame->Add((pointer_t)stream);
+  mpFrame->Add(static_cast<const char *>(src), count);
+  mpIssuers->push_back(tlsError);
+  mEntries++;
+  return true;
+}
+
+bool WriteCombiner::MemcpyToSymbol(const void *symbol, const void *src,
+                                   size_t count, size_t offset) {
+  if (count == 0 || count > mMaxCopy) return false;
+  {
+    std::lock_guard<std::mutex> lock(mSymbolsMutex);
+    if (mpSymbols->find(symbol) == mpSymbols->end()) return false;
+  }
+  std::lock_guard<std::mutex> lock(mMutex);
+  Admit(src, count);
+  mpFrame->Add(CudaUtil::GatherMemcpyToSymbol);
+  mpFrame->Add((pointer_t)symbol);
+  mpFrame->Add(offset);
+  mpFrame->Add(static_cast<const char *>(src), count);
+  mpIssuers->push_back(tlsError);
+  mEntries++;
+  return true;
+}
+
+void WriteCombiner::AddSymbol(const void *symbol) {
+  if (mMaxCopy == 0) return;
+  std::lock_guard<std::mutex> lock(mSymbolsMutex);
+  mpSymbols->insert(symbol);
+}
+
+cudaError_t WriteCombiner::Flush() {
+  BeforeExecute(NULL);
+  return TakeError();
+}
+
+cudaError_t WriteCombiner::TakeError() {
+  if (*tlsError == cudaSuccess) return cudaSuccess;
+  return (cudaError_t)tlsError->exchange(cudaSuccess);
+}
+
+/**
+ * Sends the frame to the backend it is for, over the channel of the calling
+ * thread, and hands the status of each copy to the thread that issued it.
+ * The caller holds mMutex: the backend is not selected, so no other lock of
+ * the frontend is taken.
+ */
+void WriteCombiner::Send() {
+  if (mEntries == 0) return;
+  tlsSending = true;
+  size_t entries = mEntries;
+  mpFrame->Add(entries);
+  Frontend *frontend = Frontend::GetFrontend();
+  frontend->ExecuteOn(mBackend, "cudaMemcpyGather", mpFrame);
+  cudaError_t error = (cudaError_t)frontend->GetExitCode();
+  /* the status of each copy, or, if the request failed as a whole, its own */
+  Buffer *out = frontend->GetOutputBuffer();
+  bool each = out->GetBufferSize() == entries * sizeof(cudaError_t);
+  for (size_t i = 0; i < entries; i++) {
+    cudaError_t code = each ? out->Get<cudaError_t>() : error;
+    /* the first failure is kept until returned */
+    int expected = cudaSuccess;
+    if (code != cudaSuccess)
+      (*mpIssuers)[i]->compare_exchange_strong(expected, code);
+  }
+  mpFrame->Reset();
+  mpIssuers->clear();
+  mEntries = 0;
+  tlsSending = false;
+}
+
+/**
+ * Runs before every request, of any plugin and thread: the pending copies go
+ * ahead of it. The status of each copy is kept for the thread that issued it.
+ */
+void WriteCombiner::BeforeExecute(const char *routine) {
+  if (mEntries == 0 || tlsSending) return;
+  std::lock_guard<std::mutex> lock(mMutex);
+  Send();
+}
+
+void WriteCombiner::FlushAtExit() {
+  try {
+    BeforeExecute(NULL);
+  } catch (...) {
+  }
+}
+
+/**
+ * Makes room in the frame for a copy of count bytes from src, sending the
+ * frame first if it is full, too old or for another backend. The caller
+ * holds mMutex, and has pulled back the managed pages of src: that may send
+ * requests.
+ */
+void WriteCombiner::Admit(const void *src, size_t count) {
+  int backend = DeviceMap::Selected();
+  if (mEntries > 0 && (mpFrame->GetBufferSize() + count > mMaxFrame ||
+                       steady_clock::now() - mOldest > mMaxAge ||
+                       backend != mBackend))
+    Send();
+  if (mpFrame == NULL) {
+    mpFrame = new Buffer();
+    atexit(FlushAtExit);
+  }
+  if (mEntries == 0) {
+    mOldest = steady_clock::now();
+    mBackend = backend;
+  }
+}
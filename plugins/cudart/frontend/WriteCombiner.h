@@ -0,0 +1,137 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef WRITECOMBINER_H
+#define WRITECOMBINER_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+
+#include <gvirtus/communicators/Buffer.h>
+
+/**
+ * WriteCombiner holds back small host-to-device copies and sends a run of
+ * them as a single cudaMemcpyGather request, which the backend applies in
+ * issue order.
+ *
+ * The source bytes are captured when the copy is issued. There is one frame
+ * for the whole process, and it is sent before any other request of any
+ * thread leaves the frontend, and at exit: no call can observe the device
+ * before the copies land, wherever it is made, and none is lost when the
+ * thread that issued it ends. The thread that sends the frame holds it until
+ * the backend has applied it, so the requests of the other threads wait. The
+ * frame goes to its backend with Frontend::ExecuteOn(), never selecting one:
+ * nothing that takes the broadcast lock runs under the frame's, and the
+ * broadcast path, which reaches the frame through the hook, takes them in
+ * that order.
+ *
+ * Only copies that cannot fail on the backend for a reason the caller could
+ * see are held back: the destination must be a known device allocation, and
+ * a symbol must have been written once before. A synchronous copy is not
+ * held back for long: it goes with the frame at once and returns its own
+ * status. The backend answers with the status of each copy, and a failed
+ * asynchronous one is returned, like an asynchronous error, by the next copy
+ * or synchronization of the thread that issued it. The limits are read from
+ * the environment:
+ * GVIRTUS_WRITE_COMBINE_MAX_COPY, the largest copy held back in bytes
+ * (default 4096, 0 disables combining); GVIRTUS_WRITE_COMBINE_MAX_FRAME, the
+ * bytes a frame may grow to (default 65536); GVIRTUS_WRITE_COMBINE_MAX_AGE,
+ * the microseconds the oldest copy may wait (default 1000).
+ */
+class WriteCombiner {
+ public:
+  /**
+   * Adds a cudaMemcpy() from the host to dst to the frame and sends the
+   * frame; TakeError() returns the status of the copy.
+   *
+   * @return false if the copy must be sent on its own.
+   */
+  static bool Memcpy(void *dst, const void *src, size_t count);
+
+  /**
+   * Holds back a cudaMemcpyAsync() from the host to dst on stream.
+   */
+  static bool MemcpyAsync(void *dst, const void *src, size_t count,
+                          cudaStream_t stream);
+
+  /**
+   * Holds back a cudaMemcpyToSymbol() from the host.
+   */
+  static bool MemcpyToSymbol(const void *symbol, const void *src, size_t count,
+                             size_t offset);
+
+  /**
+   * Records that symbol has been written successfully, so that later writes
+   * to it may be combined.
+   */
+  static void AddSymbol(const void *symbol);
+
+  /**
+   * Checks if copies are held back.
+   */
+  static bool IsPending() { return mEntries > 0; }
+
+  /**
+   * Sends the pending frame, if any.
+   *
+   * @return the first error of the copies the calling thread issued not
+   * returned yet.
+   */
+  static cudaError_t Flush();
+
+  /**
+   * Returns the first error of the copies the calling thread issued, once.
+   */
+  static cudaError_t TakeError();
+
+ private:
+  static void Admit(const void *src, size_t count);
+  static void Send();
+  static void BeforeExecute(const char *routine);
+  static void FlushAtExit();
+
+  static size_t mMaxCopy;
+  static size_t mMaxFrame;
+  static std::chrono::microseconds mMaxAge;
+
+  static std::mutex mSymbolsMutex;
+  static std::set<const void *> *mpSymbols;
+
+  /* guards the frame until it has been applied */
+  static std::mutex mMutex;
+  static gvirtus::communicators::Buffer *mpFrame;
+  static std::atomic<size_t> mEntries;
+  /* the error slot of the thread that issued each copy of the frame */
+  static std::vector<std::shared_ptr<std::atomic<int>>> *mpIssuers;
+  /* the backend the frame is for */
+  static int mBackend;
+  static std::chrono::steady_clock::time_point mOldest;
+  static bool mHooked;
+};
+
+#endif /* WRITECOMBINER_H */
@@ -89,6 +89,16 @@ class CudaUtil {
                                                 Buffer *marshal);
   static cudaTextureDesc *UnmarshalTextureDesc(Buffer *marshal);
 
+  /**
+   * The copies carried by a cudaMemcpyGather request, each entry of the
+   * request starts with one of these.
+   */
+  typedef enum __gatherOp {
+    GatherMemcpy,
+    GatherMemcpyAsync,
+    GatherMemcpyToSymbol
+  } GatherOp;
+
   /**
    * CudaVar is a data structure used for storing information about shared
    * variables.
@@ -0,0 +1,282 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "AutotuneCache.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <iostream>
+
+#include <cuda_runtime_api.h>
+
+static bool EnvEnabled() {
+  char *val = getenv("GVIRTUS_CUDNN_AUTOTUNE_CACHE");
+  return val == NULL || strcmp(val, "off") != 0;
+}
+
+/* empty if there is nowhere private to the user */
+static std::string Path() {
+  char *val = getenv("GVIRTUS_CUDNN_AUTOTUNE_CACHE");
+  if (val != NULL && *val != 0) return val;
+  std::string cache;
+  if ((val = getenv("XDG_CACHE_HOME")) != NULL && *val != 0)
+    cache = val;
+  else if ((val = getenv("HOME")) != NULL && *val != 0)
+    cache = std::string(val) + "/.cache";
+  if (!cache.empty()) {
+    mkdir(cache.c_str(), 0700);
+    cache += "/gvirtus";
+    if (mkdir(cache.c_str(), 0700) == 0 || errno == EEXIST)
+      return cache + "/cudnn-autotune.cache";
+  }
+  val = getenv("GVIRTUS_HOME");
+  if (val != NULL && *val != 0)
+    return std::string(val) + "/cudnn-autotune.cache";
+  return "";
+}
+
+static size_t Padded(size_t size) { return (size + 7) & ~(size_t)7; }
+
+bool AutotuneCache::mEnabled = EnvEnabled();
+std::mutex AutotuneCache::mMutex;
+std::unordered_map<cudnnHandle_t, std::string> *AutotuneCache::mpModels =
+    new std::unordered_map<cudnnHandle_t, std::string>();
+std::unordered_map<std::string, std::string> *AutotuneCache::mpEntries =
+    new std::unordered_map<std::string, std::string>();
+bool AutotuneCache::mOpened = false;
+int AutotuneCache::mFd = -1;
+AutotuneCache::Header *AutotuneCache::mpHeader = nullptr;
+uint64_t AutotuneCache::mSynced = 0;
+
+AutotuneCache::Key::Key(const char *routine, cudnnHandle_t handle)
+    : mBytes(routine, strlen(routine) + 1), mValid(mEnabled) {
+  if (!mValid) return;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mpModels->find(handle);
+    /* a handle this backend did not make */
+    if (it == mpModels->end()) {
+      mValid = false;
+      return;
+    }
+    mBytes.append(it->second);
+  }
+  Value(cudnnGetVersion());
+}
+
+void AutotuneCache::Created(cudnnHandle_t handle) {
+  int device;
+  cudaDeviceProp prop;
+  if (!mEnabled || cudaGetDevice(&device) != cudaSuccess ||
+      cudaGetDeviceProperties(&prop, device) != cudaSuccess)
+    return;
+  /* the model, not the ordinal: alike devices share results */
+  std::string model(prop.name, strnlen(prop.name, sizeof(prop.name)) + 1);
+  model.append((const char *)&prop.major, sizeof(prop.major));
+  model.append((const char *)&prop.minor, sizeof(prop.minor));
+  model.append((const char *)&prop.multiProcessorCount,
+               sizeof(prop.multiProcessorCount));
+  std::lock_guard<std::mutex> lock(mMutex);
+  (*mpModels)[handle] = model;
+}
+
+void AutotuneCache::Destroyed(cudnnHandle_t handle) {
+  if (!mEnabled) return;
+  std::lock_guard<std::mutex> lock(mMutex);
+  mpModels->erase(handle);
+}
+
+AutotuneCache::Key &AutotuneCache::Key::Tensor(
+    cudnnTensorDescriptor_t descriptor) {
+  cudnnDataType_t dataType;
+  int nbDims = 0, dimA[CUDNN_DIM_MAX], strideA[CUDNN_DIM_MAX];
+  if (!mValid ||
+      cudnnGetTensorNdDescriptor(descriptor, CUDNN_DIM_MAX, &dataType, &nbDims,
+                                 dimA, strideA) != CUDNN_STATUS_SUCCESS) {
+    mValid = false;
+    return *this;
+  }
+  Value(dataType);
+  Value(nbDims);
+  mBytes.append((const char *)dimA, nbDims * sizeof(int));
+  mBytes.append((const char *)strideA, nbDims * sizeof(int));
+  return *this;
+}
+
+AutotuneCache::Key &AutotuneCache::Key::Filter(
+    cudnnFilterDescriptor_t descriptor) {
+  cudnnDataType_t dataType;
+  cudnnTensorFormat_t format;
+  int nbDims = 0, filterDimA[CUDNN_DIM_MAX];
+  if (!mValid ||
+      cudnnGetFilterNdDescriptor(descriptor, CUDNN_DIM_MAX, &dataType, &format,
+                                 &nbDims, filterDimA) != CUDNN_STATUS_SUCCESS) {
+    mValid = false;
+    return *this;
+  }
+  Value(dataType);
+  Value(format);
+  Value(nbDims);
+  mBytes.append((const char *)filterDimA, nbDims * sizeof(int));
+  return *this;
+}
+
+AutotuneCache::Key &AutotuneCache::Key::Convolution(
+    cudnnConvolutionDescriptor_t descriptor) {
+  int arrayLength = 0, padA[CUDNN_DIM_MAX], strideA[CUDNN_DIM_MAX],
+      dilationA[CUDNN_DIM_MAX];
+  cudnnConvolutionMode_t mode;
+  cudnnDataType_t computeType;
+  if (!mValid || cudnnGetConvolutionNdDescriptor(
+                     descriptor, CUDNN_DIM_MAX - 2, &arrayLength, padA,
+                     strideA, dilationA, &mode,
+                     &computeType) != CUDNN_STATUS_SUCCESS) {
+    mValid = false;
+    return *this;
+  }
+  Value(arrayLength);
+  mBytes.append((const char *)padA, arrayLength * sizeof(int));
+  mBytes.append((const char *)strideA, arrayLength * sizeof(int));
+  mBytes.append((const char *)dilationA, arrayLength * sizeof(int));
+  Value(mode);
+  Value(computeType);
+#if CUDNN_VERSION >= 7000
+  cudnnMathType_t mathType;
+  int groupCount;
+  if (cudnnGetConvolutionMathType(descriptor, &mathType) !=
+          CUDNN_STATUS_SUCCESS ||
+      cudnnGetConvolutionGroupCount(descriptor, &groupCount) !=
+          CUDNN_STATUS_SUCCESS) {
+    mValid = false;
+    return *this;
+  }
+  Value(mathType);
+  Value(groupCount);
+#endif
+  return *this;
+}
+
+bool AutotuneCache::Find(const Key &key, std::string *value) {
+  if (!key.mValid) return false;
+  std::lock_guard<std::mutex> lock(mMutex);
+  Open();
+  Sync();
+  auto it = mpEntries->find(key.mBytes);
+  if (it == mpEntries->end()) return false;
+  *value = it->second;
+  return true;
+}
+
+void AutotuneCache::Store(const Key &key, const void *value, size_t size) {
+  if (!key.mValid) return;
+  std::lock_guard<std::mutex> lock(mMutex);
+  Open();
+  (*mpEntries)[key.mBytes] = std::string((const char *)value, size);
+  if (mpHeader == nullptr) return;
+
+  /* other backends append to the file too */
+  flock(mFd, LOCK_EX);
+  uint64_t end = mpHeader->end.load(std::memory_order_acquire);
+  size_t length = sizeof(Record) + Padded(key.mBytes.size() + size);
+  if (end <= Capacity && length <= Capacity - end) {
+    char *record = (char *)mpHeader + end;
+    ((Record *)record)->keySize = key.mBytes.size();
+    ((Record *)record)->valueSize = size;
+    memcpy(record + sizeof(Record), key.mBytes.data(), key.mBytes.size());
+    memcpy(record + sizeof(Record) + key.mBytes.size(), value, size);
+    /* readers take the record once end covers it */
+    mpHeader->end.store(end + length, std::memory_order_release);
+  }
+  flock(mFd, LOCK_UN);
+  Sync();
+}
+
+void AutotuneCache::Open() {
+  if (mOpened) return;
+  mOpened = true;
+
+  std::string path = Path();
+  if (path.empty()) return;
+  mFd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, 0600);
+  if (mFd < 0) {
+    std::cerr << "GVIRTUS_CUDNN_AUTOTUNE_CACHE: can't open " << path << ": "
+              << strerror(errno) << std::endl;
+    return;
+  }
+  /* what another user wrote could make the backend read out of bounds */
+  struct stat st;
+  if (fstat(mFd, &st) != 0 || !S_ISREG(st.st_mode) ||
+      st.st_uid != geteuid() || (st.st_mode & 077) != 0) {
+    std::cerr << "GVIRTUS_CUDNN_AUTOTUNE_CACHE: " << path
+              << " is not a file only this user may access" << std::endl;
+    close(mFd);
+    mFd = -1;
+    return;
+  }
+  flock(mFd, LOCK_EX);
+  void *mapping = MAP_FAILED;
+  if ((uint64_t)st.st_size >= Capacity || ftruncate(mFd, Capacity) == 0)
+    mapping =
+        mmap(NULL, Capacity, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+  if (mapping == MAP_FAILED) {
+    std::cerr << "GVIRTUS_CUDNN_AUTOTUNE_CACHE: can't map " << path << ": "
+              << strerror(errno) << std::endl;
+    flock(mFd, LOCK_UN);
+    close(mFd);
+    mFd = -1;
+    return;
+  }
+
+  /* a new file, or one written by another layout, starts over */
+  Header *header = (Header *)mapping;
+  uint64_t end = header->end.load(std::memory_order_relaxed);
+  if (header->magic != Magic || end < sizeof(Header) || end > Capacity) {
+    header->magic = Magic;
+    header->end.store(sizeof(Header), std::memory_order_release);
+  }
+  flock(mFd, LOCK_UN);
+  mpHeader = header;
+  mSynced = sizeof(Header);
+}
+
+void AutotuneCache::Sync() {
+  if (mpHeader == nullptr) return;
+  uint64_t end = mpHeader->end.load(std::memory_order_acquire);
+  /* the file is shared: nothing in it is read past the mapping */
+  if (end > Capacity) end = Capacity;
+  while (mSynced + sizeof(Record) <= end) {
+    const char *record = (const char *)mpHeader + mSynced;
+    uint32_t keySize = ((const Record *)record)->keySize;
+    uint32_t valueSize = ((const Record *)record)->valueSize;
+    size_t length = sizeof(Record) + Padded((size_t)keySize + valueSize);
+    if (length > end - mSynced) break;
+    (*mpEntries)[std::string(record + sizeof(Record), keySize)] =
+        std::string(record + sizeof(Record) + keySize, valueSize);
+    mSynced += length;
+  }
+}
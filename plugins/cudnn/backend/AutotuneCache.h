@@ -0,0 +1,144 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef AUTOTUNECACHE_H
+#define AUTOTUNECACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cudnn.h>
+
+/**
+ * AutotuneCache keeps the results of the cudnnFindConvolution*Algorithm
+ * routines, which benchmark every candidate algorithm on the device, for all
+ * the clients of the backend.
+ *
+ * Results are keyed by the routine, the model of the device of the cuDNN
+ * handle, the cuDNN version, the settings of every descriptor, read back from
+ * cuDNN, and the other arguments that change the outcome. Failed searches are
+ * not kept.
+ *
+ * The results are also appended to a file, mapped in memory, and read back
+ * by the next backend started, or by another backend of the same user
+ * sharing the file: GVIRTUS_CUDNN_AUTOTUNE_CACHE names it, by default
+ * $XDG_CACHE_HOME/gvirtus/cudnn-autotune.cache ($HOME/.cache if
+ * XDG_CACHE_HOME is not set), else $GVIRTUS_HOME/cudnn-autotune.cache; with
+ * none of them, results are kept in memory only. A file that is a symbolic
+ * link, or another user's, or that others may access, is not used. The file
+ * grows up to Capacity bytes, past which results are kept in memory only; it
+ * can be removed to start over when the backend is stopped.
+ * GVIRTUS_CUDNN_AUTOTUNE_CACHE=off disables the cache.
+ */
+class AutotuneCache {
+ public:
+  static const uint64_t Magic = 0x6776637564746e31ull;
+  static const uint64_t Capacity = 16 << 20;
+
+  class Key {
+   public:
+    /**
+     * Keys on routine and on the device of handle, as Created() recorded it.
+     */
+    Key(const char *routine, cudnnHandle_t handle);
+
+    Key &Tensor(cudnnTensorDescriptor_t descriptor);
+    Key &Filter(cudnnFilterDescriptor_t descriptor);
+    Key &Convolution(cudnnConvolutionDescriptor_t descriptor);
+
+    template <class T>
+    Key &Value(T value) {
+      mBytes.append((const char *)&value, sizeof(value));
+      return *this;
+    }
+
+   private:
+    friend class AutotuneCache;
+
+    std::string mBytes;
+    bool mValid;
+  };
+
+  /**
+   * Copies the results kept for key to results, which has room for
+   * capacity of them.
+   */
+  template <class T>
+  static bool Get(const Key &key, int *count, T *results, int capacity) {
+    std::string value;
+    if (!Find(key, &value) || value.size() % sizeof(T) != 0 ||
+        value.size() / sizeof(T) > (size_t)capacity)
+      return false;
+    *count = (int)(value.size() / sizeof(T));
+    memcpy(results, value.data(), value.size());
+    return true;
+  }
+
+  template <class T>
+  static void Put(const Key &key, int count, const T *results) {
+    Store(key, results, count * sizeof(T));
+  }
+
+  /**
+   * Records the device current to the thread as the one of handle, which
+   * cudnnCreate just made on it.
+   */
+  static void Created(cudnnHandle_t handle);
+
+  static void Destroyed(cudnnHandle_t handle);
+
+ private:
+  struct Header {
+    uint64_t magic;
+    /* where the next record goes */
+    std::atomic<uint64_t> end;
+  };
+
+  /* followed by the key, then the value, padded to 8 bytes */
+  struct Record {
+    uint32_t keySize;
+    uint32_t valueSize;
+  };
+
+  static bool Find(const Key &key, std::string *value);
+  static void Store(const Key &key, const void *value, size_t size);
+
+  static void Open();
+  static void Sync();
+
+  static bool mEnabled;
+  static std::mutex mMutex;
+  /* the model of the device of each handle */
+  static std::unordered_map<cudnnHandle_t, std::string> *mpModels;
+  static std::unordered_map<std::string, std::string> *mpEntries;
+  static bool mOpened;
+  static int mFd;
+  static Header *mpHeader;
+  /* of the records already in mpEntries */
+  static uint64_t mSynced;
+};
+
+#endif /* AUTOTUNECACHE_H */
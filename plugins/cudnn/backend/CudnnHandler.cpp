@@ -22,12 +22,15 @@
  *
 */
 
+#include <algorithm>
 #include <cstring>
 #include <map>
+#include <vector>
 #include <errno.h>
 #include <cuda_runtime_api.h>
 #include <cudnn.h>
 #include "CudnnHandler.h"
+#include "AutotuneCache.h"
 
 using namespace std;
 using namespace log4cplus;
@@ -69,7 +72,7 @@ bool CudnnHandler::CanExecute(std::string routine) {
 }
 
 std::shared_ptr<Result> CudnnHandler::Execute(std::string routine, std::shared_ptr<Buffer> input_buffer) {
-    LOG4CPLUS_DEBUG(logger,"Called " << routine);
+    GVIRTUS_LOG_DEBUG(logger,"Called " << routine);
     map<string, CudnnHandler::CudnnRoutineHandler>::iterator it;
     it = mspHandlers->find(routine);
     if (it == mspHandlers->end())
@@ -77,8 +80,8 @@ std::shared_ptr<Result> CudnnHandler::Execute(std::string routine, std::shared_p
     try {
         return it->second(this, input_buffer);
     } catch (const char *ex) {
-        LOG4CPLUS_DEBUG(logger,ex);
-        LOG4CPLUS_DEBUG(logger,strerror(errno));
+        GVIRTUS_LOG_DEBUG(logger,ex);
+        GVIRTUS_LOG_DEBUG(logger,strerror(errno));
     }
     return NULL;
 }
@@ -349,12 +352,13 @@ void CudnnHandler::Initialize(){
     mspHandlers->insert(CUDNN_ROUTINE_HANDLER_PAIR(DestroyFusedOpsPlan));
     mspHandlers->insert(CUDNN_ROUTINE_HANDLER_PAIR(MakeFusedOpsPlan));
     mspHandlers->insert(CUDNN_ROUTINE_HANDLER_PAIR(FusedOpsExecute));
+    mspHandlers->insert(CUDNN_ROUTINE_HANDLER_PAIR(ShadowBatch));
 }
 
 
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionMathType){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionMathType"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionMathType"));
 
      cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
      cudnnMathType_t mathType;
@@ -365,29 +369,29 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionMathType){
      try{
          out->Add<cudnnMathType_t>(mathType);
      } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
      }
-     LOG4CPLUS_DEBUG(logger, "cudnnGetConvolutionMathType Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetConvolutionMathType Executed");
      //cout << " DEBUG - cudnnGetConvolutionMathType Executed"<<endl;
      return std::make_shared<Result>(cs, out);
  }
 
 CUDNN_ROUTINE_HANDLER(SetConvolutionReorderType){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionReorderType"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionReorderType"));
 
      cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
      cudnnReorderType_t reorderType = in->Get<cudnnReorderType_t>();
 
      cudnnStatus_t cs = cudnnSetConvolutionReorderType(convDesc, reorderType);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnSetConvolutionReorderType Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetConvolutionReorderType Executed");
      //cout << " DEBUG - cudnnSetConvolutionReorderType Executed"<<endl;
      return std::make_shared<Result>(cs); 
  }
 
 CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardFilterAlgorithm){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardFilterAlgorithm"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardFilterAlgorithm"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -395,27 +399,35 @@ CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardFilterAlgorithm){
     cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
     cudnnFilterDescriptor_t dwDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     int requestedAlgoCount = in->Get<int>();
-    int returnedAlgoCount;
-    cudnnConvolutionBwdFilterAlgoPerf_t perfResults;
-    
-    cudnnStatus_t cs = cudnnFindConvolutionBackwardFilterAlgorithm(handle, xDesc, DyDesc, convDesc, dwDesc, requestedAlgoCount, &returnedAlgoCount, &perfResults);
+    int returnedAlgoCount = 0;
+    /* cuDNN writes up to requestedAlgoCount results */
+    std::vector<cudnnConvolutionBwdFilterAlgoPerf_t> perfResults(std::max(requestedAlgoCount, 1));
+
+    AutotuneCache::Key key("cudnnFindConvolutionBackwardFilterAlgorithm", handle);
+    key.Tensor(xDesc).Tensor(DyDesc).Convolution(convDesc).Filter(dwDesc).Value(requestedAlgoCount);
+    cudnnStatus_t cs = CUDNN_STATUS_SUCCESS;
+    if (!AutotuneCache::Get(key, &returnedAlgoCount, perfResults.data(), (int)perfResults.size())) {
+        cs = cudnnFindConvolutionBackwardFilterAlgorithm(handle, xDesc, DyDesc, convDesc, dwDesc, requestedAlgoCount, &returnedAlgoCount, perfResults.data());
+        if (cs == CUDNN_STATUS_SUCCESS)
+            AutotuneCache::Put(key, returnedAlgoCount, perfResults.data());
+    }
 
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
         out->Add<int>(returnedAlgoCount);
-        out->Add<cudnnConvolutionBwdFilterAlgoPerf_t>(perfResults);
+        out->Add<cudnnConvolutionBwdFilterAlgoPerf_t>(perfResults[0]);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger, "cudnnFindConvolutionBackwardFilterAlgorithm Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnFindConvolutionBackwardFilterAlgorithm Executed");
     //cout << " DEBUG - cudnnFindConvolutionBackwardFilterAlgorithm Executed"<<endl;
     return std::make_shared<Result>(cs, out);  
  }
 
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithmMaxCount){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithmMaxCount"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithmMaxCount"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      int count;
@@ -426,10 +438,10 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithmMaxCount){
      try{
          out->Add<int>(count);
      } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
      }
-     LOG4CPLUS_DEBUG(logger, "cudnnGetConvolutionForwardAlgorithmMaxCount Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetConvolutionForwardAlgorithmMaxCount Executed");
      //cout << " DEBUG - cudnnGetConvolutionForwardAlgorithmMaxCount Executed"<<endl;
      return std::make_shared<Result>(cs, out);
  }
@@ -437,7 +449,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithmMaxCount){
 
 
 CUDNN_ROUTINE_HANDLER(SetConvolutionNdDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionNdDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionNdDescriptor"));
 
      cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
      int arrayLength = in->Get<int>();
@@ -449,7 +461,7 @@ CUDNN_ROUTINE_HANDLER(SetConvolutionNdDescriptor){
 
      cudnnStatus_t cs = cudnnSetConvolutionNdDescriptor(convDesc, arrayLength, padA, filterStrideA, dilationA, mode, computeType);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnSetConvolutionNdDescriptor Executed");   
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetConvolutionNdDescriptor Executed");   
      //cout << " DEBUG - cudnnSetConvolutionNdDescriptor Executed"<<endl;
      return std::make_shared<Result>(cs);
  }
@@ -457,7 +469,7 @@ CUDNN_ROUTINE_HANDLER(SetConvolutionNdDescriptor){
 
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionNdForwardOutputDim){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionNdForwardOutputDim"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionNdForwardOutputDim"));
 
      cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
      cudnnTensorDescriptor_t inputTensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -471,16 +483,16 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionNdForwardOutputDim){
      try{
          out->Add<int>(tensorOutputDimA);
      } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
      }
-     LOG4CPLUS_DEBUG(logger, "cudnnGetConvolutionNdForwardOutputDim Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetConvolutionNdForwardOutputDim Executed");
      //cout << " DEBUG - cudnnGetConvolutionNdForwardOutputDim Executed"<<endl;
      return std::make_shared<Result>(cs, out);
  }
 
 CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardFilterAlgorithmEx){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardFilterAlgorithmEx"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardFilterAlgorithmEx"));
     
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>(); //INPUT
     cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>(); //INPUT
@@ -491,29 +503,37 @@ CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardFilterAlgorithmEx){
     cudnnFilterDescriptor_t dwDesc = (cudnnFilterDescriptor_t)in->Get<long long int>(); //INPUT
     void *dw = in->Assign<void>(); //INPUT/OUTPUT
     int requestedAlgoCount = in->Get<int>(); //INPUT
-    int *returnedAlgoCount; //OUTPUT
-    cudnnConvolutionBwdFilterAlgoPerf_t perfResults; //OUTPUT
+    int returnedAlgoCount = 0; //OUTPUT
+    std::vector<cudnnConvolutionBwdFilterAlgoPerf_t> perfResults(std::max(requestedAlgoCount, 1)); //OUTPUT
     void *workSpace = in->Assign<void>(); //INPUT
     size_t workSpaceSizeInBytes = in->Get<size_t>(); //INPUT
-   
-    cudnnStatus_t cs = cudnnFindConvolutionBackwardFilterAlgorithmEx(handle, xDesc, x, dyDesc, y, convDesc, dwDesc, dw, requestedAlgoCount, returnedAlgoCount, &perfResults, workSpace, workSpaceSizeInBytes);
+
+    /* a known result skips the benchmark: dw is left as it is */
+    AutotuneCache::Key key("cudnnFindConvolutionBackwardFilterAlgorithmEx", handle);
+    key.Tensor(xDesc).Tensor(dyDesc).Convolution(convDesc).Filter(dwDesc).Value(workSpaceSizeInBytes).Value(requestedAlgoCount);
+    cudnnStatus_t cs = CUDNN_STATUS_SUCCESS;
+    if (!AutotuneCache::Get(key, &returnedAlgoCount, perfResults.data(), (int)perfResults.size())) {
+        cs = cudnnFindConvolutionBackwardFilterAlgorithmEx(handle, xDesc, x, dyDesc, y, convDesc, dwDesc, dw, requestedAlgoCount, &returnedAlgoCount, perfResults.data(), workSpace, workSpaceSizeInBytes);
+        if (cs == CUDNN_STATUS_SUCCESS)
+            AutotuneCache::Put(key, returnedAlgoCount, perfResults.data());
+    }
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
         out->Add<void>(dw);
         out->Add<int>(returnedAlgoCount);
-        out->Add<cudnnConvolutionBwdFilterAlgoPerf_t>(perfResults); 
+        out->Add<cudnnConvolutionBwdFilterAlgoPerf_t>(perfResults[0]); 
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger, "cudnnFindConvolutionBackwardFilterAlgorithmEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnFindConvolutionBackwardFilterAlgorithmEx Executed");
     return std::make_shared<Result>(cs, out);
 }
 
 
 
 CUDNN_ROUTINE_HANDLER(GetConvolution2dDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolution2dDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolution2dDescriptor"));
 
      cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
      int padh,padw,u,v,upscalex,upscaley;
@@ -532,10 +552,10 @@ CUDNN_ROUTINE_HANDLER(GetConvolution2dDescriptor){
          out->Add(upscalex);
          out->Add(upscaley);
      } catch(string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
      }
-     LOG4CPLUS_DEBUG(logger, "cudnnGetConvolution2dDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetConvolution2dDescriptor Executed");
      //cout << "DEBUG - cudnnGetConvolution2dDescriptor Executed"<<endl;
      return std::make_shared<Result>(cs,out);
  }
@@ -544,20 +564,20 @@ CUDNN_ROUTINE_HANDLER(GetConvolution2dDescriptor){
 
 
 CUDNN_ROUTINE_HANDLER(SetConvolutionGroupCount){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionGroupCount"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionGroupCount"));
 
      cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
      int groupCount = in->Get<int>();
 
      cudnnStatus_t cs = cudnnSetConvolutionGroupCount(convDesc, groupCount);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnSetConvolutionGroupCount Executed");   
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetConvolutionGroupCount Executed");   
      //cout << " DEBUG - cudnnSetConvolutionGroupCount Executed"<<endl;
      return std::make_shared<Result>(cs);
  }
 
 CUDNN_ROUTINE_HANDLER(FindConvolutionForwardAlgorithmEx){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionForwardAlgorithmEx"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionForwardAlgorithmEx"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -568,28 +588,36 @@ CUDNN_ROUTINE_HANDLER(FindConvolutionForwardAlgorithmEx){
      cudnnTensorDescriptor_t yDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
      void *y = in->GetFromMarshal<void *>();
      int requestedAlgoCount = in->Get<int>();
-     int returnedAlgoCount;
-     cudnnConvolutionFwdAlgoPerf_t perfResults;
+     int returnedAlgoCount = 0;
+     std::vector<cudnnConvolutionFwdAlgoPerf_t> perfResults(std::max(requestedAlgoCount, 1));
      void *workSpace = in->GetFromMarshal<void *>();
      size_t workSpaceSizeInBytes = in->Get<size_t>();
 
-     cudnnStatus_t cs = cudnnFindConvolutionForwardAlgorithmEx(handle, xDesc, x, wDesc, w, convDesc, yDesc, y, requestedAlgoCount, &returnedAlgoCount, &perfResults, workSpace, workSpaceSizeInBytes);
+     /* a known result skips the benchmark: y is left as it is */
+     AutotuneCache::Key key("cudnnFindConvolutionForwardAlgorithmEx", handle);
+     key.Tensor(xDesc).Filter(wDesc).Convolution(convDesc).Tensor(yDesc).Value(workSpaceSizeInBytes).Value(requestedAlgoCount);
+     cudnnStatus_t cs = CUDNN_STATUS_SUCCESS;
+     if (!AutotuneCache::Get(key, &returnedAlgoCount, perfResults.data(), (int)perfResults.size())) {
+         cs = cudnnFindConvolutionForwardAlgorithmEx(handle, xDesc, x, wDesc, w, convDesc, yDesc, y, requestedAlgoCount, &returnedAlgoCount, perfResults.data(), workSpace, workSpaceSizeInBytes);
+         if (cs == CUDNN_STATUS_SUCCESS)
+             AutotuneCache::Put(key, returnedAlgoCount, perfResults.data());
+     }
 
      std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
          out->AddMarshal<void *>(y);
          out->Add<int>(returnedAlgoCount);
-         out->Add<cudnnConvolutionFwdAlgoPerf_t>(perfResults);
+         out->Add<cudnnConvolutionFwdAlgoPerf_t>(perfResults[0]);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cudnnFindConvolutionForwardAlgorithmEx Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnFindConvolutionForwardAlgorithmEx Executed");
     return std::make_shared<Result>(cs,out);  
 }
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionNdDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionNdDescriptor"));
     
     cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
     int arrayLengthRequested = in->Get<int>();
@@ -612,16 +640,16 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionNdDescriptor){
          out->Add<cudnnConvolutionMode_t>(mode);
          out->Add<cudnnDataType_t>(dataType);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionNdDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnGetConvolutionNdDescriptor Executed");
     return std::make_shared<Result>(cs,out);   
 }
 
 #if CUDNN_VERSION < 8000
 CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithm){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithm"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithm"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -641,17 +669,17 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithm){
     try{
          out->Add<cudnnConvolutionFwdAlgo_t>(algo);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionForwardAlgorithm  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnGetConvolutionForwardAlgorithm  Executed");
     return std::make_shared<Result>(cs,out);
 }
 #endif
 
 #if CUDNN_VERSION >= 7000
 CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithm_v7){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithm_v7"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithm_v7"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -669,16 +697,16 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithm_v7){
          out->Add<int>(returnedAlgoCount);
          out->Add<cudnnConvolutionFwdAlgoPerf_t>(perfResults);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionForwardAlgorithm_v7  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnGetConvolutionForwardAlgorithm_v7  Executed");
     return std::make_shared<Result>(cs,out);
 }
 #endif
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionReorderType){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionReorderType"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionReorderType"));
  
   cudnnConvolutionDescriptor_t convDesc= (cudnnConvolutionDescriptor_t)in->Get<long long int>();
   cudnnReorderType_t reorderType;
@@ -689,27 +717,27 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionReorderType){
     try{
          out->Add<cudnnReorderType_t>(reorderType);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionReorderType  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnGetConvolutionReorderType  Executed");
     return std::make_shared<Result>(cs,out); 
 }
 
 CUDNN_ROUTINE_HANDLER(SetConvolutionMathType){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionMathType"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolutionMathType"));
 
    cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
    cudnnMathType_t mathType = in->Get<cudnnMathType_t>();
 
    cudnnStatus_t cs = cudnnSetConvolutionMathType(convDesc, mathType);
 
-    LOG4CPLUS_DEBUG(logger,"cudnnSetConvolutionMathType  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnSetConvolutionMathType  Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(ConvolutionBiasActivationForward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBiasActivationForward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBiasActivationForward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    void *alpha1 = in->Assign<void>();
@@ -736,15 +764,15 @@ CUDNN_ROUTINE_HANDLER(ConvolutionBiasActivationForward){
     try{
          out->AddMarshal<void *>(y);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cudnnConvolutionBiasActivationForward  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnConvolutionBiasActivationForward  Executed");
     return std::make_shared<Result>(cs,out);  
 }
 
 CUDNN_ROUTINE_HANDLER(onvolutionBiasActivationForward){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBiasActivationForward"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBiasActivationForward"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   void *alpha1 = in->Assign<void>();
@@ -771,15 +799,15 @@ CUDNN_ROUTINE_HANDLER(onvolutionBiasActivationForward){
     try{
          out->AddMarshal<void *>(y);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"onvolutionBiasActivationForward  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"onvolutionBiasActivationForward  Executed");
     return std::make_shared<Result>(cs,out);  
 }
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithmMaxCount){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithmMaxCount"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithmMaxCount"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    int count;
@@ -790,7 +818,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithmMaxCount){
     try{
          out->Add<int>(count);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"GetConvolutionBackwardFilterAlgorithmMaxCount  Executed");
@@ -799,7 +827,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithmMaxCount){
 
 #if CUDNN_VERSION < 8000
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithm){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithm"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithm"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -817,17 +845,17 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithm){
          out->Add<int>(returnedAlgoCount);
          out->Add<cudnnConvolutionBwdFilterAlgoPerf_t>(perfResults);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"GetConvolutionBackwardFilterAlgorithm  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"GetConvolutionBackwardFilterAlgorithm  Executed");
     return std::make_shared<Result>(cs,out);
 }
 #endif
 
 #if CUDNN_VERSION >= 7000
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithm_v7){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithm_v7"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithm_v7"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -845,16 +873,16 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithm_v7){
          out->Add<int>(returnedAlgoCount);
          out->Add<cudnnConvolutionBwdFilterAlgoPerf_t>(perfResults);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"GetConvolutionBackwardFilterAlgorithm_v7  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"GetConvolutionBackwardFilterAlgorithm_v7  Executed");
     return std::make_shared<Result>(cs,out);   
 }
 #endif
 
 CUDNN_ROUTINE_HANDLER(FindConvolutionForwardAlgorithm){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionForwardAlgorithm"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionForwardAlgorithm"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -862,25 +890,33 @@ CUDNN_ROUTINE_HANDLER(FindConvolutionForwardAlgorithm){
   cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
   cudnnTensorDescriptor_t yDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
   int requestedAlgoCount = in->Get<int>();
-  int returnedAlgoCount;
-  cudnnConvolutionFwdAlgoPerf_t perfResults;
-
-  cudnnStatus_t cs = cudnnFindConvolutionForwardAlgorithm(handle, xDesc, wDesc, convDesc, yDesc, requestedAlgoCount, &returnedAlgoCount, &perfResults);
+  int returnedAlgoCount = 0;
+  /* cuDNN writes up to requestedAlgoCount results */
+  std::vector<cudnnConvolutionFwdAlgoPerf_t> perfResults(std::max(requestedAlgoCount, 1));
+
+  AutotuneCache::Key key("cudnnFindConvolutionForwardAlgorithm", handle);
+  key.Tensor(xDesc).Filter(wDesc).Convolution(convDesc).Tensor(yDesc).Value(requestedAlgoCount);
+  cudnnStatus_t cs = CUDNN_STATUS_SUCCESS;
+  if (!AutotuneCache::Get(key, &returnedAlgoCount, perfResults.data(), (int)perfResults.size())) {
+      cs = cudnnFindConvolutionForwardAlgorithm(handle, xDesc, wDesc, convDesc, yDesc, requestedAlgoCount, &returnedAlgoCount, perfResults.data());
+      if (cs == CUDNN_STATUS_SUCCESS)
+          AutotuneCache::Put(key, returnedAlgoCount, perfResults.data());
+  }
 
   std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
          out->Add<int>(returnedAlgoCount);
-         out->Add<cudnnConvolutionFwdAlgoPerf_t>(perfResults);
+         out->Add<cudnnConvolutionFwdAlgoPerf_t>(perfResults[0]);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"FindConvolutionForwardAlgorithm  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"FindConvolutionForwardAlgorithm  Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionGroupCount){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionGroupCount"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionGroupCount"));
 
    cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
    int groupCount;
@@ -891,16 +927,16 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionGroupCount){
     try{
          out->Add<int>(groupCount);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionGroupCount  Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnGetConvolutionGroupCount  Executed");
     return std::make_shared<Result>(cs,out); 
 }
 
 
 CUDNN_ROUTINE_HANDLER(DestroyConvolutionDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardBias"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardBias"));
     cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
 
     cudnnStatus_t cs = cudnnDestroyConvolutionDescriptor(convDesc);
@@ -910,7 +946,7 @@ CUDNN_ROUTINE_HANDLER(DestroyConvolutionDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(ConvolutionBackwardBias){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardBias"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardBias"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     float alpha = in->Get<float>();
@@ -928,7 +964,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionBackwardBias){
     try{
          out->AddMarshal<void *>(db);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnConvolutionBackwardBias  Executed");
@@ -937,7 +973,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionBackwardBias){
 
 
 CUDNN_ROUTINE_HANDLER(ConvolutionForward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionForward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionForward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    //const void *alpha = in->GetFromMarshal<void *>();
@@ -964,7 +1000,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionForward){
     try{
          out->AddMarshal<void *>(y);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnConvolutionForward  Executed");
@@ -973,7 +1009,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionForward){
 
 
 CUDNN_ROUTINE_HANDLER(ConvolutionBackwardFilter){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardFilter"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardFilter"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   //const void *alpha = in->Assign<void>();
@@ -997,7 +1033,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionBackwardFilter){
     try{
          out->AddMarshal<void *>(dw);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnConvolutionBackwardFilter  Executed");
@@ -1006,7 +1042,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionBackwardFilter){
 
 
 CUDNN_ROUTINE_HANDLER(GetConvolution2dForwardOutputDim){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolution2dForwardOutputDim"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolution2dForwardOutputDim"));
    
    const cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
    const cudnnTensorDescriptor_t inputTensor = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -1025,7 +1061,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolution2dForwardOutputDim){
          out->Add<int>(h);
          out->Add<int>(w);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnGetConvolution2dForwardOutputDim  Executed");
@@ -1034,7 +1070,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolution2dForwardOutputDim){
 
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterWorkspaceSize){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterWorkspaceSize"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterWorkspaceSize"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   const cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -1050,7 +1086,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterWorkspaceSize){
     try{
         out->Add<size_t>(sizeInBytes);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionBackwardFilterWorkspaceSize  Executed");
@@ -1058,7 +1094,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterWorkspaceSize){
 }
 
 CUDNN_ROUTINE_HANDLER(CreateConvolutionDescriptor){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateConvolutionDescriptor"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateConvolutionDescriptor"));
 
   cudnnConvolutionDescriptor_t convDesc;
 
@@ -1068,7 +1104,7 @@ CUDNN_ROUTINE_HANDLER(CreateConvolutionDescriptor){
     try{
         out->Add<cudnnConvolutionDescriptor_t>(convDesc);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnCreateConvolutionDescriptor  Executed");
@@ -1077,7 +1113,7 @@ CUDNN_ROUTINE_HANDLER(CreateConvolutionDescriptor){
 
 #if CUDNN_VERSION < 8204
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithm){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithm"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardFilterAlgorithm"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    const cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -1094,7 +1130,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithm){
     try{
         out->Add<cudnnConvolutionBwdFilterAlgo_t>(algo);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionBackwardFilterAlgorithm  Executed");
@@ -1103,7 +1139,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardFilterAlgorithm){
 #endif
  
 CUDNN_ROUTINE_HANDLER(SetConvolution2dDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolution2dDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetConvolution2dDescriptor"));
 
     cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
     int pad_h = in->Get<int>();
@@ -1121,7 +1157,7 @@ CUDNN_ROUTINE_HANDLER(SetConvolution2dDescriptor){
     try{
         out->Add<cudnnConvolutionDescriptor_t>(convDesc);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnSetConvolution2dDescriptor  Executed");
@@ -1130,7 +1166,7 @@ CUDNN_ROUTINE_HANDLER(SetConvolution2dDescriptor){
 
 #if CUDNN_VERSION < 8204
 CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithm){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithm"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardAlgorithm"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    const cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -1147,7 +1183,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithm){
     try{
         out->Add<cudnnConvolutionFwdAlgo_t>(algo);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionForwardAlgorithm  Executed");
@@ -1156,7 +1192,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardAlgorithm){
 #endif
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionForwardWorkspaceSize){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardWorkspaceSize"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionForwardWorkspaceSize"));
    
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     const cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -1172,7 +1208,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardWorkspaceSize){
     try{
         out->Add<size_t>(sizeInBytes);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnGetConvolutionForwardWorkspaceSize  Executed");
@@ -1180,22 +1216,22 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionForwardWorkspaceSize){
 }
 
 CUDNN_ROUTINE_HANDLER(GetVersion){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
 
     size_t version = cudnnGetVersion();
-    LOG4CPLUS_DEBUG(logger,"cudnnGetVersion Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cudnnGetVersion Executed");
     return std::make_shared<Result>(version);
 }
 
 CUDNN_ROUTINE_HANDLER(GetErrorString){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetErrorString"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetErrorString"));
     cudnnStatus_t cs = in->Get<cudnnStatus_t>();
     const char * s = cudnnGetErrorString(cs);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
         out->Add((char *)s);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(CUDNN_STATUS_EXECUTION_FAILED);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnGetErrorString Executed");
@@ -1204,14 +1240,17 @@ CUDNN_ROUTINE_HANDLER(GetErrorString){
 
 CUDNN_ROUTINE_HANDLER(Create){
 
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Create"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Create"));
     cudnnHandle_t handle;
     cudnnStatus_t cs = cudnnCreate(&handle);
+    /* its device keys the results of the autotuning */
+    if (cs == CUDNN_STATUS_SUCCESS)
+        AutotuneCache::Created(handle);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
          out->Add<cudnnHandle_t>(handle);
     } catch (string e){
-                        LOG4CPLUS_DEBUG(logger,e);
+                        GVIRTUS_LOG_DEBUG(logger,e);
                         return std::make_shared<Result>(CUDNN_STATUS_EXECUTION_FAILED);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnCreate Executed");
@@ -1220,10 +1259,12 @@ CUDNN_ROUTINE_HANDLER(Create){
 }
 
 CUDNN_ROUTINE_HANDLER(Destroy){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Destroy"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Destroy"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnStatus_t cs = cudnnDestroy(handle);
+    if (cs == CUDNN_STATUS_SUCCESS)
+        AutotuneCache::Destroyed(handle);
     
     //LOG4CPLUS_DEBUG(logger,"cudnnDestroy Executed");
     //cout << "DEBUG - cudnnDestroy Executed"<<endl;
@@ -1231,19 +1272,19 @@ CUDNN_ROUTINE_HANDLER(Destroy){
 }
 
 CUDNN_ROUTINE_HANDLER(SetStream){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudaStream_t streamId = (cudaStream_t) in->Get<long long int>();
 
     cudnnStatus_t cs = cudnnSetStream(handle,streamId);
     
-     LOG4CPLUS_DEBUG(logger," cudnnSetStream Executed");
+     GVIRTUS_LOG_DEBUG(logger," cudnnSetStream Executed");
    //cout << "DEBUG - cudnnSetStream Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetStream){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetStream"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetStream"));
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudaStream_t *streamId;
     cudnnStatus_t cs = cudnnGetStream(handle,streamId);
@@ -1251,24 +1292,24 @@ CUDNN_ROUTINE_HANDLER(GetStream){
     try {
          out->Add<long long int>((long long int)*streamId);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetStream Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetStream Executed");
     //cout << "DEBUG - cudnnGetStream Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateTensorDescriptor"));
     cudnnTensorDescriptor_t tensorDesc;
     cudnnStatus_t cs = cudnnCreateTensorDescriptor(&tensorDesc);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try {
          out->Add<cudnnTensorDescriptor_t>(tensorDesc);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger,"cudnnCreateTensorDescriptor Executed");
@@ -1276,7 +1317,7 @@ CUDNN_ROUTINE_HANDLER(CreateTensorDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(SetTensor4dDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensor4dDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensor4dDescriptor"));
     cudnnTensorDescriptor_t tensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
     cudnnTensorFormat_t format = in->Get<cudnnTensorFormat_t>();
     cudnnDataType_t dataType = in->Get<cudnnDataType_t>();                                                                                          
@@ -1293,7 +1334,7 @@ CUDNN_ROUTINE_HANDLER(SetTensor4dDescriptor){
     try {
          out->Add<cudnnTensorDescriptor_t>(tensorDesc);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }                      
     //LOG4CPLUS_DEBUG(logger,"cudnnSetTensor4dDescriptor Executed");
@@ -1301,7 +1342,7 @@ CUDNN_ROUTINE_HANDLER(SetTensor4dDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(SetTensor4dDescriptorEx){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensor4dDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensor4dDescriptor"));
 
     cudnnTensorDescriptor_t tensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType = in->Get<cudnnDataType_t>();
@@ -1322,17 +1363,17 @@ CUDNN_ROUTINE_HANDLER(SetTensor4dDescriptorEx){
     try {
          out->Add<cudnnTensorDescriptor_t>(tensorDesc);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetTensor4dDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetTensor4dDescriptor Executed");
     //cout << "DEBUG - cudnnSetTensor4dDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetTensor4dDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensor4dDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensor4dDescriptor"));
     cudnnTensorDescriptor_t tensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
 
     cudnnDataType_t dataType;
@@ -1353,17 +1394,17 @@ CUDNN_ROUTINE_HANDLER(GetTensor4dDescriptor){
         out->Add<int>(hStride);
         out->Add<int>(wStride);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetTensor4dDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetTensor4dDescriptor Executed");
     //cout << "DEBUG - cudnnGetTensor4dDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetTensorNdDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensorNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensorNdDescriptor"));
 
     cudnnTensorDescriptor_t tensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType = in->Get<cudnnDataType_t>();
@@ -1377,17 +1418,17 @@ CUDNN_ROUTINE_HANDLER(SetTensorNdDescriptor){
     try {
          out->Add<cudnnTensorDescriptor_t>(tensorDesc);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetTensorNdDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetTensorNdDescriptor Executed");
     //cout << "DEBUG - cudnnSetTensorNdDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetTensorNdDescriptorEx){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensorNdDescriptorEx"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensorNdDescriptorEx"));
 
     cudnnTensorDescriptor_t tensorDesc;
     cudnnTensorFormat_t format = in->Get<cudnnTensorFormat_t>();
@@ -1400,17 +1441,17 @@ CUDNN_ROUTINE_HANDLER(SetTensorNdDescriptorEx){
     try {
          out->Add<cudnnTensorDescriptor_t>(tensorDesc);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetTensorNdDescriptorEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetTensorNdDescriptorEx Executed");
     //cout << "DEBUG - cudnnSetTensorNdDescriptorEx Executed"<<endl;
     return std::make_shared<Result>(cs);  
 }
 
 CUDNN_ROUTINE_HANDLER(GetTensorNdDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensorNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensorNdDescriptor"));
 
     cudnnTensorDescriptor_t tensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
     int nbDimsRequested = in->Get<int>();
@@ -1427,17 +1468,17 @@ CUDNN_ROUTINE_HANDLER(GetTensorNdDescriptor){
         out->Add<int>(nbDims);
         out->Add<int>(dimA);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetTensorNdDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetTensorNdDescriptor Executed");
     //cout << "DEBUG - cudnnGetTensorNdDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetTensorSizeInBytes){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensorSizeInBytes"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensorSizeInBytes"));
 
    cudnnTensorDescriptor_t tensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
    size_t size = in->Get<size_t>();
@@ -1448,17 +1489,17 @@ CUDNN_ROUTINE_HANDLER(GetTensorSizeInBytes){
    try{
         out->Add<size_t>(size);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnGetTensorSizeInBytes Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnGetTensorSizeInBytes Executed");
    //cout << "DEBUG - cudnnGetTensorSizeInBytes Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyTensorDescriptor"));
 
     cudnnTensorDescriptor_t tensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
     cudnnStatus_t cs = cudnnDestroyTensorDescriptor(tensorDesc);
@@ -1469,7 +1510,7 @@ CUDNN_ROUTINE_HANDLER(DestroyTensorDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(InitTransformDest){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("InitTransformDest"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("InitTransformDest"));
     
     cudnnTensorTransformDescriptor_t transformDesc = (cudnnTensorTransformDescriptor_t)in->Get<long long int >();
     cudnnTensorDescriptor_t srcDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -1483,17 +1524,17 @@ CUDNN_ROUTINE_HANDLER(InitTransformDest){
         out->Add<cudnnTensorDescriptor_t>(destDesc);
         out->Add<size_t>(destSizeInBytes);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnInitTransformDest Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnInitTransformDest Executed");
     //cout << " DEBUG - cudnnInitTransformDest Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateTensorTransformDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateTensorTransformDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateTensorTransformDescriptor"));
 
     cudnnTensorTransformDescriptor_t transformDesc;
     
@@ -1503,17 +1544,17 @@ CUDNN_ROUTINE_HANDLER(CreateTensorTransformDescriptor){
     try{
         out->Add<cudnnTensorTransformDescriptor_t>(transformDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, " cudnnCreateTensorTransformDescriptor Execute");
+    GVIRTUS_LOG_DEBUG(logger, " cudnnCreateTensorTransformDescriptor Execute");
     //cout << " DEBUG - cudnnCreateTensorTransformDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetTensorTransformDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensorTransformDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensorTransformDescriptor"));
     
     cudnnTensorTransformDescriptor_t transformDesc;
     uint32_t nbDims = in->Get<uint32_t>();
@@ -1529,17 +1570,17 @@ CUDNN_ROUTINE_HANDLER(SetTensorTransformDescriptor){
     try{
         out->Add<cudnnTensorTransformDescriptor_t>(transformDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger,  "cudnnSetTensorTransformDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger,  "cudnnSetTensorTransformDescriptor Executed");
     //cout << "DEBUG - cudnnSetTensorTransformDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetTensorTransformDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensorTransformDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetTensorTransformDescriptor"));
 
     cudnnTensorTransformDescriptor_t transformDesc = (cudnnTensorTransformDescriptor_t)in->Get<long long int >();
     uint32_t nbDimsRequested = in->Get<uint32_t>();
@@ -1558,17 +1599,17 @@ CUDNN_ROUTINE_HANDLER(GetTensorTransformDescriptor){
         out->Add<uint32_t>(foldA);
         out->Add<cudnnFoldingDirection_t>(direction);   
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetTensorTransformDescriptor Executed"); 
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetTensorTransformDescriptor Executed"); 
     //cout << "DEBUG - cudnnGetTensorTransformDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyTensorTransformDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyTensorTransformDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyTensorTransformDescriptor"));
     
     cudnnTensorTransformDescriptor_t transformDesc = (cudnnTensorTransformDescriptor_t)in->Get<long long int>();
     
@@ -1580,7 +1621,7 @@ CUDNN_ROUTINE_HANDLER(DestroyTensorTransformDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(TransformTensor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("TransformTensor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("TransformTensor"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     void * alpha = in->Assign<void>();
@@ -1596,17 +1637,17 @@ CUDNN_ROUTINE_HANDLER(TransformTensor){
     try{
         out->Add<void>(y);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnTransformTensor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnTransformTensor Executed");
     //cout << "DEBUG - cudnnTransformTensor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(TransformTensorEx){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("TransformTensorEx"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("TransformTensorEx"));
    
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnTensorTransformDescriptor_t transDesc = (cudnnTensorTransformDescriptor_t)in->Get<long long int>();
@@ -1620,14 +1661,14 @@ CUDNN_ROUTINE_HANDLER(TransformTensorEx){
    cudnnStatus_t cs = cudnnTransformTensorEx(handle, transDesc, alpha, srcDesc, srcData, beta, destDesc, destData);
    
    
-   LOG4CPLUS_DEBUG(logger, "cuddTransformTensorEx Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cuddTransformTensorEx Executed");
    //cout << "DEBUG - cuddTransformTensorEx Executed"<<endl;
    return std::make_shared<Result>(cs);
 }
 
 // NON SONO SICURO DI QUESTA FUNZIONE DA FAR VEDERE A MONTELLA!!! 
 CUDNN_ROUTINE_HANDLER(GetFoldedConvBackwardDataDescriptors){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFoldedConvBackwardDataDescriptors"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFoldedConvBackwardDataDescriptors"));
    
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnFilterDescriptor_t filterDesc;
@@ -1663,18 +1704,18 @@ CUDNN_ROUTINE_HANDLER(GetFoldedConvBackwardDataDescriptors){
         out->Add<cudnnTensorTransformDescriptor_t>(gradFoldTransDesc);
         out->Add<cudnnTensorTransformDescriptor_t>(gradUnfoldTransDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFoldedConvBackwardDataDescriptors Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFoldedConvBackwardDataDescriptors Executed");
     //cout << " DEBUG - cudnnGetFoldedConvBackwardDataDescriptors Executed"<<endl;
     return std::make_shared<Result>(cs, out);
     
 }
 
 CUDNN_ROUTINE_HANDLER(AddTensor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("AddTensor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("AddTensor"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     float alpha = in->Get<float>();
@@ -1690,7 +1731,7 @@ CUDNN_ROUTINE_HANDLER(AddTensor){
     try{
         out->AddMarshal<void *>(C);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger, "cudnnAddTensor Executed");
@@ -1698,7 +1739,7 @@ CUDNN_ROUTINE_HANDLER(AddTensor){
 }
 
 CUDNN_ROUTINE_HANDLER(CreateOpTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateOpTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateOpTensorDescriptor"));
    
     cudnnOpTensorDescriptor_t opTensorDesc;
     
@@ -1708,17 +1749,17 @@ CUDNN_ROUTINE_HANDLER(CreateOpTensorDescriptor){
     try{
         out->Add<cudnnOpTensorDescriptor_t>(opTensorDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnCreateOpTensorDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCreateOpTensorDescriptor Executed");
     //cout << " DEBUG - cudnnCreateOpTensorDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetOpTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetOpTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetOpTensorDescriptor"));
 
     cudnnOpTensorDescriptor_t opTensorDesc;
     cudnnOpTensorOp_t opTensorOp = in->Get<cudnnOpTensorOp_t>();
@@ -1731,18 +1772,18 @@ CUDNN_ROUTINE_HANDLER(SetOpTensorDescriptor){
    try{
        out->Add<cudnnOpTensorDescriptor_t>(opTensorDesc);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
 
-   LOG4CPLUS_DEBUG(logger, "cudnnSetOpTensorDescriptor Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnSetOpTensorDescriptor Executed");
    //cout << " DEBUG - cudnnSetOpTensorDescriptor Executed"<<endl;
    return std::make_shared<Result>(cs, out); 
 }
 
 CUDNN_ROUTINE_HANDLER(GetOpTensorDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetOpTensorDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetOpTensorDescriptor"));
    
    cudnnOpTensorDescriptor_t opTensorDesc = (cudnnOpTensorDescriptor_t)in->Get<long long int>();
    cudnnOpTensorOp_t opTensorOp;
@@ -1757,29 +1798,29 @@ CUDNN_ROUTINE_HANDLER(GetOpTensorDescriptor){
        out->Add<cudnnDataType_t>(opTensorCompType);
        out->Add<cudnnNanPropagation_t>(opTensorNanOpt);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnGetOpTensorDescriptor");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnGetOpTensorDescriptor");
    //cout << " DEBUG - cudnnGetOpTensorDescriptor"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyOpTensorDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyOpTensorDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyOpTensorDescriptor"));
 
    cudnnOpTensorDescriptor_t opTensorDesc = (cudnnOpTensorDescriptor_t)in->Get<long long int>();
    
    cudnnStatus_t cs = cudnnDestroyOpTensorDescriptor(opTensorDesc);
    
-   LOG4CPLUS_DEBUG(logger, "cudnnDestroyOpTensorDescriptor Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyOpTensorDescriptor Executed");
    //cout << "DEBUG - cudnnDestroyOpTensorDescriptor Executed"<<endl;
    return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(OpTensor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("OpTensor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("OpTensor"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnOpTensorDescriptor_t opTensorDesc = (cudnnOpTensorDescriptor_t)in->Get<long long int>();
@@ -1799,19 +1840,19 @@ CUDNN_ROUTINE_HANDLER(OpTensor){
     try{
         out->Add<void>(C);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
    
 
 
-    LOG4CPLUS_DEBUG(logger, "cudnnOpTensor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnOpTensor Executed");
     //cout << "DEBUG - cudnnOpTensor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateReduceTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateReduceTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateReduceTensorDescriptor"));
 
     cudnnReduceTensorDescriptor_t reduceTensorDesc;
    
@@ -1821,17 +1862,17 @@ CUDNN_ROUTINE_HANDLER(CreateReduceTensorDescriptor){
     try{
         out->Add<cudnnReduceTensorDescriptor_t>(reduceTensorDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnCreateReduceTensorDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCreateReduceTensorDescriptor Executed");
     //cout << " DEBUG - cudnnCreateReduceTensorDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
  
 CUDNN_ROUTINE_HANDLER(SetReduceTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetReduceTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetReduceTensorDescriptor"));
 
     cudnnReduceTensorDescriptor_t reduceTensorDesc = (cudnnReduceTensorDescriptor_t)in->Get<long long int>();
     cudnnReduceTensorOp_t reduceTensorOp = in->Get<cudnnReduceTensorOp_t>();
@@ -1846,17 +1887,17 @@ CUDNN_ROUTINE_HANDLER(SetReduceTensorDescriptor){
     try{
         out->Add<cudnnReduceTensorDescriptor_t>(reduceTensorDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetReduceTensorDescriptor");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetReduceTensorDescriptor");
     //cout << " DEBUG - cudnnSetReduceTensorDescriptor"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetReduceTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetReduceTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetReduceTensorDescriptor"));
  
     cudnnReduceTensorDescriptor_t reduceTensorDesc = (cudnnReduceTensorDescriptor_t)in->Get<long long int>(); //INPUT
     cudnnReduceTensorOp_t reduceTensorOp; //OUTPUT
@@ -1873,28 +1914,28 @@ CUDNN_ROUTINE_HANDLER(GetReduceTensorDescriptor){
         out->Add<cudnnReduceTensorIndices_t>(reduceTensorIndices);
         out->Add<cudnnIndicesType_t>(reduceTensorIndicesType);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
  
-    LOG4CPLUS_DEBUG(logger, "cudnnGetReduceTensorDescriptor Executed");   
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetReduceTensorDescriptor Executed");   
     //cout << " DEBUG - cudnnGetReduceTensorDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyReduceTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyReduceTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyReduceTensorDescriptor"));
 
     cudnnReduceTensorDescriptor_t reduceTensorDesc = (cudnnReduceTensorDescriptor_t)in->Get<long long int>();
     cudnnStatus_t cs = cudnnDestroyReduceTensorDescriptor(reduceTensorDesc);
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDestroyReduceTensorDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyReduceTensorDescriptor Executed");
     //cout << "DEBUG - cudnnDestroyReduceTensorDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetReductionIndicesSize){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetReductionIndicesSize"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetReductionIndicesSize"));
     
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnReduceTensorDescriptor_t reduceTensorDesc = (cudnnReduceTensorDescriptor_t)in->Get<long long int>();
@@ -1908,17 +1949,17 @@ CUDNN_ROUTINE_HANDLER(GetReductionIndicesSize){
     try{
         out->Add<size_t>(sizeInBytes);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    
-    LOG4CPLUS_DEBUG(logger, "cuddGetReductionIndicesSize Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cuddGetReductionIndicesSize Executed");
    //cout << " DEBUG - cuddGetReductionIndicesSize Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetReductionWorkspaceSize){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetReductionWorkspaceSize"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetReductionWorkspaceSize"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnReduceTensorDescriptor_t reduceTensorDesc = (cudnnReduceTensorDescriptor_t)in->Get<long long int>();
@@ -1932,16 +1973,16 @@ CUDNN_ROUTINE_HANDLER(GetReductionWorkspaceSize){
    try{
        out->Add<size_t>(sizeInBytes);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
-    LOG4CPLUS_DEBUG(logger, "cudnnGetReductionWorkspaceSize Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetReductionWorkspaceSize Executed");
    //cout << " DEBUG - cudnnGetReductionWorkspaceSize Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(ReduceTensor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ReduceTensor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ReduceTensor"));
  
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>(); //INPUT
    cudnnReduceTensorDescriptor_t reduceTensorDesc = (cudnnReduceTensorDescriptor_t)in->Get<long long int>(); //INPUT
@@ -1963,17 +2004,17 @@ CUDNN_ROUTINE_HANDLER(ReduceTensor){
        out->Add<void>(indices);
        out->Add<void>(C);
    } catch(string e){
-      LOG4CPLUS_DEBUG(logger, e);
+      GVIRTUS_LOG_DEBUG(logger, e);
       return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnReduceTensor Execute");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnReduceTensor Execute");
    //cout << " DEBUG - cudnnReduceTensor Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetTensor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetTensor"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnTensorDescriptor_t yDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -1986,17 +2027,17 @@ CUDNN_ROUTINE_HANDLER(SetTensor){
     try{
         out->Add<void>(y);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnSetTensor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetTensor Executed");
     //cout << "DEBUG - cudnnSetTensor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(ScaleTensor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ScaleTensor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ScaleTensor"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     const cudnnTensorDescriptor_t yDesc = (const cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -2009,17 +2050,17 @@ CUDNN_ROUTINE_HANDLER(ScaleTensor){
     try{
         out->Add<void>(y);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnScaleTensor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnScaleTensor Executed");
     //cout << "DEBUG - cudnnScaleTensor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateFilterDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFilterDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFilterDescriptor"));
     
     cudnnFilterDescriptor_t filterDesc;
 
@@ -2029,7 +2070,7 @@ CUDNN_ROUTINE_HANDLER(CreateFilterDescriptor){
     try{
         out->Add<cudnnFilterDescriptor_t>(filterDesc);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger,"cudnnCreateFilterDescriptor Executed");
@@ -2037,7 +2078,7 @@ CUDNN_ROUTINE_HANDLER(CreateFilterDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(SetFilter4dDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilter4dDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilter4dDescriptor"));
    
    cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
    cudnnDataType_t dataType = in->Get<cudnnDataType_t>();
@@ -2053,7 +2094,7 @@ CUDNN_ROUTINE_HANDLER(SetFilter4dDescriptor){
     try{
         out->Add<cudnnFilterDescriptor_t>(filterDesc);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }   
    //LOG4CPLUS_DEBUG(logger,"cudnnSetFilter4dDescriptor Executed");
@@ -2061,7 +2102,7 @@ CUDNN_ROUTINE_HANDLER(SetFilter4dDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(GetFilter4dDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilter4dDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilter4dDescriptor"));
 
    cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
    cudnnDataType_t dataType;
@@ -2082,18 +2123,18 @@ CUDNN_ROUTINE_HANDLER(GetFilter4dDescriptor){
        out->Add<int>(h);
        out->Add<int>(w);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnGetFilter4dDescriptor Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnGetFilter4dDescriptor Executed");
    //cout << " DEBUG - cudnnGetFilter4dDescriptor Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 #if CUDNN_VERSION < 6000
 CUDNN_ROUTINE_HANDLER(SetFilter4dDescriptor_v3){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilter4dDescriptor_v3"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilter4dDescriptor_v3"));
 
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType = (cudnnDataType_t) in->Get<long long int>();
@@ -2105,13 +2146,13 @@ etConvolution2dDescriptor
 
     cudnnStatus_t cs = cudnnSetFilter4dDescriptor_v3(filterDesc,dataType,k,c,h,w);
    
-     LOG4CPLUS_DEBUG(logger, "cudnnSetFilter4dDescriptor_v3 Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetFilter4dDescriptor_v3 Executed");
      //cout << "DEBUG - cudnnSetFilter4dDescriptor_v3 Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetFilter4dDescriptor_v3){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilter4dDescriptor_v3"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilter4dDescriptor_v3"));
 
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType;
@@ -2129,17 +2170,17 @@ CUDNN_ROUTINE_HANDLER(GetFilter4dDescriptor_v3){
         out->Add<int>(h);
         out->Add<int>(w);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFilter4dDescriptor_v3 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFilter4dDescriptor_v3 Executed");
     //cout << "DEBUG - cudnnGetFilter4dDescriptor_v3 Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetFilter4dDescriptor_v4){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilter4dDescriptor_v4"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilter4dDescriptor_v4"));
 
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType = (cudnnDataType_t) in->Get<long long int>();
@@ -2152,13 +2193,13 @@ CUDNN_ROUTINE_HANDLER(SetFilter4dDescriptor_v4){
 
     cudnnStatus_t cs = cudnnSetFilter4dDescriptor_v4(filterDesc,dataType,format,k,c,h,w);
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetFilter4dDescriptor_v4 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetFilter4dDescriptor_v4 Executed");
     //cout << "DEBUG - cudnnSetFilter4dDescriptor_v4 Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetFilter4dDescriptor_v4){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilter4dDescriptor_v4"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilter4dDescriptor_v4"));
 
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType;
@@ -2178,18 +2219,18 @@ CUDNN_ROUTINE_HANDLER(GetFilter4dDescriptor_v4){
         out->Add<int>(h);
         out->Add<int>(w);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFilter4dDescriptor_v4 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFilter4dDescriptor_v4 Executed");
     //cout << "DEBUG - cudnnGetFilter4dDescriptor_v4 Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 #endif
 
 CUDNN_ROUTINE_HANDLER(SetFilterNdDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilterNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilterNdDescriptor"));
     
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType = in->Get<cudnnDataType_t>();
@@ -2199,13 +2240,13 @@ CUDNN_ROUTINE_HANDLER(SetFilterNdDescriptor){
     
     cudnnStatus_t cs = cudnnSetFilterNdDescriptor(filterDesc, dataType, format, nbDims, filterDimA);
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetFilterNdDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetFilterNdDescriptor Executed");
     //cout << " DEBUG - cudnnSetFilterNdDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetFilterNdDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterNdDescriptor"));
 
     cudnnFilterDescriptor_t wDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     int nbDimsRequested = in->Get<int>();
@@ -2222,18 +2263,18 @@ CUDNN_ROUTINE_HANDLER(GetFilterNdDescriptor){
     try{
         out->Add<long long int>(format);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFilterNdDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFilterNdDescriptor Executed");
     //cout << "DEBUG - cudnnGetFilterNdDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 #if CUDNN_VERSION < 6000
 CUDNN_ROUTINE_HANDLER(SetFilterNdDescriptor_v3){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilterNdDescriptor_v3"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilterNdDescriptor_v3"));
 
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType = (cudnnDataType_t) in->Get<long long int>();
@@ -2248,17 +2289,17 @@ CUDNN_ROUTINE_HANDLER(SetFilterNdDescriptor_v3){
     try {
         out->Add<long long int>((long long int)filterDesc);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetFilterNdDescriptor_v3 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetFilterNdDescriptor_v3 Executed");
     //cout << "DEBUG - cudnnSetFilterNdDescriptor_v3 Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetFilterNdDescriptor_v3){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterNdDescriptor"));
 
     cudnnFilterDescriptor_t wDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     int nbDimsRequested = in->Get<int>();
@@ -2269,13 +2310,13 @@ CUDNN_ROUTINE_HANDLER(GetFilterNdDescriptor_v3){
 
     cudnnStatus_t cs = cudnnGetFilterNdDescriptor_v3(wDesc,nbDimsRequested,dataType,nbDims,filterDimA);
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFilterNdDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFilterNdDescriptor Executed");
     //cout << "DEBUG - cudnnGetFilterNdDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetFilterNdDescriptor_v4){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilterNdDescriptor_v4"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFilterNdDescriptor_v4"));
 
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType = (cudnnDataType_t) in->Get<long long int>();
@@ -2291,17 +2332,17 @@ CUDNN_ROUTINE_HANDLER(SetFilterNdDescriptor_v4){
     try {
         out->Add<long long int>((long long int)filterDesc);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetFilterDescriptor_v4 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetFilterDescriptor_v4 Executed");
     //cout << "DEBUG - cudnnSetFilterDescriptor_v4 Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetFilterNdDescriptor_v4){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterNdDescriptor_v4"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterNdDescriptor_v4"));
 
     cudnnFilterDescriptor_t wDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
     int nbDimsRequested = in->Get<int>();
@@ -2318,18 +2359,18 @@ CUDNN_ROUTINE_HANDLER(GetFilterNdDescriptor_v4){
     try{
         out->Add<long long int>(format);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFilterDescriptor_v4 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFilterDescriptor_v4 Executed");
     //cout << "DEBUG - cudnnGetFilterDescriptor_v4 Executed"<<endl;
     return std::make_shared<Result>(cs,out);
 }
 #endif
 
 CUDNN_ROUTINE_HANDLER(GetFilterSizeInBytes){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterSizeInBytes"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFilterSizeInBytes"));
     
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
 
@@ -2341,17 +2382,17 @@ CUDNN_ROUTINE_HANDLER(GetFilterSizeInBytes){
     try{
         out->Add<size_t>(size);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger,  "cudnnGetFilterSizeInBytes Executed");
+    GVIRTUS_LOG_DEBUG(logger,  "cudnnGetFilterSizeInBytes Executed");
     //cout << " DEBUG - cudnnGetFilterSizeInBytes Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyFilterDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestoryFilterDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestoryFilterDescriptor"));
 
     cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
 
@@ -2363,7 +2404,7 @@ CUDNN_ROUTINE_HANDLER(DestroyFilterDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(TransformFilter){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("TransformFilter"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("TransformFilter"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>(); //INPUT
    cudnnTensorTransformDescriptor_t transDesc = (cudnnTensorTransformDescriptor_t)in->Get<long long int>(); //INPUT
@@ -2380,17 +2421,17 @@ CUDNN_ROUTINE_HANDLER(TransformFilter){
    try{
        out->Add<void>(destData);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-    LOG4CPLUS_DEBUG(logger, "cudnnTransformFilter Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnTransformFilter Executed");
    //cout << " DEBUG - cudnnTransformFilter Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(ReorderFilterAndBias){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ReorderFilterAndBias"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ReorderFilterAndBias"));
    
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
@@ -2404,7 +2445,7 @@ CUDNN_ROUTINE_HANDLER(ReorderFilterAndBias){
    cudnnStatus_t cs = cudnnReorderFilterAndBias(handle, filterDesc, reorderType, filterData, reorderedFilterData, reorderBias, biasData, reorderedBiasData);
 
    
-  LOG4CPLUS_DEBUG(logger, "cudnnReorderFilterAndBias Executed");
+  GVIRTUS_LOG_DEBUG(logger, "cudnnReorderFilterAndBias Executed");
   //cout << " DEBUG - cudnnReorderFilterAndBias Executed"<<endl;
   return std::make_shared<Result>(cs);
 }  
@@ -2412,7 +2453,7 @@ CUDNN_ROUTINE_HANDLER(ReorderFilterAndBias){
 
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithmMaxCount){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetonvolutionBackwardData"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetonvolutionBackwardData"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   int count;
@@ -2423,7 +2464,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithmMaxCount){
   try{
       out->Add<int>(count);
   }  catch(string e){
-      LOG4CPLUS_DEBUG(logger, e);
+      GVIRTUS_LOG_DEBUG(logger, e);
       return std::make_shared<Result>(cs);
   }
   
@@ -2433,7 +2474,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithmMaxCount){
 }  
 
 CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardDataAlgorithm){
-  Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardDataAlgorithm"));
+  static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardDataAlgorithm"));
 
   cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
   cudnnFilterDescriptor_t wDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
@@ -2441,27 +2482,35 @@ CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardDataAlgorithm){
   cudnnConvolutionDescriptor_t convDesc = (cudnnConvolutionDescriptor_t)in->Get<long long int>();
   cudnnTensorDescriptor_t dxDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
   int requestedAlgoCount = in->Get<int>();
-  int returnedAlgoCount;
-  cudnnConvolutionBwdDataAlgoPerf_t perfResults;
-
-  cudnnStatus_t cs = cudnnFindConvolutionBackwardDataAlgorithm(handle, wDesc, dyDesc, convDesc, dxDesc, requestedAlgoCount, &returnedAlgoCount, &perfResults);
+  int returnedAlgoCount = 0;
+  /* cuDNN writes up to requestedAlgoCount results */
+  std::vector<cudnnConvolutionBwdDataAlgoPerf_t> perfResults(std::max(requestedAlgoCount, 1));
+
+  AutotuneCache::Key key("cudnnFindConvolutionBackwardDataAlgorithm", handle);
+  key.Filter(wDesc).Tensor(dyDesc).Convolution(convDesc).Tensor(dxDesc).Value(requestedAlgoCount);
+  cudnnStatus_t cs = CUDNN_STATUS_SUCCESS;
+  if (!AutotuneCache::Get(key, &returnedAlgoCount, perfResults.data(), (int)perfResults.size())) {
+      cs = cudnnFindConvolutionBackwardDataAlgorithm(handle, wDesc, dyDesc, convDesc, dxDesc, requestedAlgoCount, &returnedAlgoCount, perfResults.data());
+      if (cs == CUDNN_STATUS_SUCCESS)
+          AutotuneCache::Put(key, returnedAlgoCount, perfResults.data());
+  }
 
   std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
   try{
       out->Add<int>(returnedAlgoCount);
-      out->Add<cudnnConvolutionBwdDataAlgoPerf_t>(perfResults);
+      out->Add<cudnnConvolutionBwdDataAlgoPerf_t>(perfResults[0]);
   } catch(string e){
-      LOG4CPLUS_DEBUG(logger, e);
+      GVIRTUS_LOG_DEBUG(logger, e);
       return std::make_shared<Result>(cs);
   }
  
-  LOG4CPLUS_DEBUG(logger, "cudnnFindConvolutionBackwardDataAlgorithm Executed");
+  GVIRTUS_LOG_DEBUG(logger, "cudnnFindConvolutionBackwardDataAlgorithm Executed");
   //cout << " DEBUG - cudnnFindConvolutionBackwardDataAlgorithm Executed"<<endl;
   return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardDataAlgorithmEx){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardDataAlgorithmEx"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindConvolutionBackwardDataAlgorithmEx"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>(); //INPUT
    cudnnFilterDescriptor_t wDesc = (cudnnFilterDescriptor_t)in->Get<long long int>(); //INPUT
@@ -2472,31 +2521,39 @@ CUDNN_ROUTINE_HANDLER(FindConvolutionBackwardDataAlgorithmEx){
    cudnnTensorDescriptor_t dxDesc = (cudnnTensorDescriptor_t)in->Get<long long int>(); //INPUT
    void *dx = in->Assign<void>(); //INPUT/OUTPUT
    int requestedAlgoCount = in->Get<int>(); //INPUT
-   int returnedAlgoCount; //OUTPUT
-   cudnnConvolutionBwdDataAlgoPerf_t perfResults; //OUTPUT
+   int returnedAlgoCount = 0; //OUTPUT
+   std::vector<cudnnConvolutionBwdDataAlgoPerf_t> perfResults(std::max(requestedAlgoCount, 1)); //OUTPUT
    void *workSpace = in->Assign<void>(); //INPUT
    size_t workSpaceSizeInBytes = in->Get<size_t>(); //INPUT
 
-   cudnnStatus_t cs = cudnnFindConvolutionBackwardDataAlgorithmEx(handle, wDesc, w, dyDesc, dy, convDesc, dxDesc, dx, requestedAlgoCount, &returnedAlgoCount, &perfResults, workSpace, workSpaceSizeInBytes);
+   /* a known result skips the benchmark: dx is left as it is */
+   AutotuneCache::Key key("cudnnFindConvolutionBackwardDataAlgorithmEx", handle);
+   key.Filter(wDesc).Tensor(dyDesc).Convolution(convDesc).Tensor(dxDesc).Value(workSpaceSizeInBytes).Value(requestedAlgoCount);
+   cudnnStatus_t cs = CUDNN_STATUS_SUCCESS;
+   if (!AutotuneCache::Get(key, &returnedAlgoCount, perfResults.data(), (int)perfResults.size())) {
+       cs = cudnnFindConvolutionBackwardDataAlgorithmEx(handle, wDesc, w, dyDesc, dy, convDesc, dxDesc, dx, requestedAlgoCount, &returnedAlgoCount, perfResults.data(), workSpace, workSpaceSizeInBytes);
+       if (cs == CUDNN_STATUS_SUCCESS)
+           AutotuneCache::Put(key, returnedAlgoCount, perfResults.data());
+   }
 
    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
    try{
        out->Add<void>(dx);
        out->Add<int>(returnedAlgoCount);
-       out->Add<cudnnConvolutionBwdDataAlgoPerf_t>(perfResults);
+       out->Add<cudnnConvolutionBwdDataAlgoPerf_t>(perfResults[0]);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnFindConvolutionBackwardDataAlgorithmEx Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnFindConvolutionBackwardDataAlgorithmEx Executed");
    //cout << " DEBUG - cudnnFindConvolutionBackwardDataAlgorithmEx Executed"<<endl;
    return std::make_shared<Result>(cs, out);  
 }
 
 #if CUDNN_VERSION < 8000
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithm){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardDataAlgorithm"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardDataAlgorithm"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    const cudnnFilterDescriptor_t wDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
@@ -2513,7 +2570,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithm){
    try{
        out->Add<cudnnConvolutionBwdDataAlgo_t>(algo);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger, "cudnnGetConvolutionBackwardDataAlgorithm Executed");
@@ -2523,7 +2580,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithm){
 
 #if CUDNN_VERSION >= 7000
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithm_v7){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardDataAlgorithm_v7"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardDataAlgorithm_v7"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnFilterDescriptor_t filterDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
@@ -2541,18 +2598,18 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataAlgorithm_v7){
        out->Add<int>(returnedAlgoCount);
        out->Add<cudnnConvolutionBwdDataAlgoPerf_t>(perfResults);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnGetConvolutionBackwardDataAlgorithm_v7 Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnGetConvolutionBackwardDataAlgorithm_v7 Executed");
    //cout << " DEBUG - cudnnGetConvolutionBackwardDataAlgorithm_v7 Executed"<<endl;
    return std::make_shared<Result>(cs, out);   
 }
 #endif
 
 CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataWorkspaceSize){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardDataWorkspaceSize"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetConvolutionBackwardDataWorkspaceSize"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    const cudnnFilterDescriptor_t wDesc = (cudnnFilterDescriptor_t)in->Get<long long int>();
@@ -2568,7 +2625,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataWorkspaceSize){
    try{
        out->Add<size_t>(sizeInBytes);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger, "cudnnGetConvolutionBackwardDataWorkspaceSize Executed");
@@ -2576,7 +2633,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolutionBackwardDataWorkspaceSize){
 }
 
 CUDNN_ROUTINE_HANDLER(ConvolutionBackwardData){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardData"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ConvolutionBackwardData"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    float alpha = in->Get<float>();
@@ -2600,7 +2657,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionBackwardData){
    try{
        out->AddMarshal<void *>(dx);
    } catch(string e){
-      LOG4CPLUS_DEBUG(logger, e);
+      GVIRTUS_LOG_DEBUG(logger, e);
       return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger, "cudnnConvolutionBackwardData Executed");
@@ -2608,7 +2665,7 @@ CUDNN_ROUTINE_HANDLER(ConvolutionBackwardData){
 }
 
 CUDNN_ROUTINE_HANDLER(Im2Col){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Im2Col"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Im2Col"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -2623,17 +2680,17 @@ CUDNN_ROUTINE_HANDLER(Im2Col){
    try{
         out->Add<void>(colBuffer);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnIm2Col Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnIm2Col Executed");
    //cout << " DEBUG - cudnnIm2Col Executed"<<endl;
    return std::make_shared<Result>(cs, out);     
 }
 
 CUDNN_ROUTINE_HANDLER(SoftmaxForward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SoftmaxForward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SoftmaxForward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnSoftmaxAlgorithm_t algo = in->Get<cudnnSoftmaxAlgorithm_t>();
@@ -2653,7 +2710,7 @@ CUDNN_ROUTINE_HANDLER(SoftmaxForward){
    try{
         out->AddMarshal<void *>(y);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    
@@ -2663,7 +2720,7 @@ CUDNN_ROUTINE_HANDLER(SoftmaxForward){
 }
 
 CUDNN_ROUTINE_HANDLER(SoftmaxBackward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SoftmaxBackward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SoftmaxBackward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnSoftmaxAlgorithm_t algo = in->Get<cudnnSoftmaxAlgorithm_t>();
@@ -2683,17 +2740,17 @@ CUDNN_ROUTINE_HANDLER(SoftmaxBackward){
    try{
        out->Add<void>(dx);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnSoftmaxBackward Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnSoftmaxBackward Executed");
    //cout << " DEBUG - cudnnSoftmaxBackward Executed"<<endl;
    return std::make_shared<Result>(cs, out);     
 }
 
 CUDNN_ROUTINE_HANDLER(CreatePoolingDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreatePoolingDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreatePoolingDescriptor"));
 
    cudnnPoolingDescriptor_t poolingDesc;
 
@@ -2703,7 +2760,7 @@ CUDNN_ROUTINE_HANDLER(CreatePoolingDescriptor){
    try{
         out->Add<cudnnPoolingDescriptor_t>(poolingDesc);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger, "cudnnCreatePoolingDescriptor Executed");
@@ -2711,7 +2768,7 @@ CUDNN_ROUTINE_HANDLER(CreatePoolingDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(SetPooling2dDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetPooling2dDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetPooling2dDescriptor"));
 
    cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
    cudnnPoolingMode_t mode = in->Get<cudnnPoolingMode_t>();
@@ -2729,7 +2786,7 @@ CUDNN_ROUTINE_HANDLER(SetPooling2dDescriptor){
    try{
         out->Add<cudnnPoolingDescriptor_t>(poolingDesc);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger, "cudnnSetPooling2dDescriptor Executed");
@@ -2737,7 +2794,7 @@ CUDNN_ROUTINE_HANDLER(SetPooling2dDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(GetPooling2dDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPooling2dDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPooling2dDescriptor"));
 
    cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
    cudnnPoolingMode_t mode;
@@ -2762,17 +2819,17 @@ CUDNN_ROUTINE_HANDLER(GetPooling2dDescriptor){
        out->Add<int>(verticalStride);
        out->Add<int>(horizontalStride);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-    LOG4CPLUS_DEBUG(logger, "cudnnGetPooling2dDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetPooling2dDescriptor Executed");
    //cout << " DEBUG - cudnnGetPooling2dDescriptor Executed"<<endl;
    return std::make_shared<Result>(cs, out);     
 }
 
 CUDNN_ROUTINE_HANDLER(SetPoolingNdDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetPoolingNdDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetPoolingNdDescriptor"));
    
    cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
    cudnnPoolingMode_t mode = in->Get<cudnnPoolingMode_t>();
@@ -2785,13 +2842,13 @@ CUDNN_ROUTINE_HANDLER(SetPoolingNdDescriptor){
    cudnnStatus_t cs = cudnnSetPoolingNdDescriptor(poolingDesc, mode, maxpoolingNanOpt, nbDims, windowDimA, paddingA, strideA);
 
    
-   LOG4CPLUS_DEBUG(logger, "cudnnSetPoolingNdDescriptor Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnSetPoolingNdDescriptor Executed");
    //cout << " DEBUG - cudnnSetPoolingNdDescriptor Executed"<<endl;
    return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetPoolingNdDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPoolingNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPoolingNdDescriptor"));
 
     cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
     int nbDimsRequested = in->Get<int>();
@@ -2812,17 +2869,17 @@ CUDNN_ROUTINE_HANDLER(GetPoolingNdDescriptor){
         out->Add<int>(paddingA);
         out->Add<int>(strideA);
     } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetPoolingNdDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetPoolingNdDescriptor Executed");
     //cout << " DEBUG - cudnnGetPoolingNdDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(GetPoolingNdForwardOutputDim){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPoolingNdForwardOutputDim"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPoolingNdForwardOutputDim"));
     
     cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
     cudnnTensorDescriptor_t inputTensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -2835,17 +2892,17 @@ CUDNN_ROUTINE_HANDLER(GetPoolingNdForwardOutputDim){
     try{
         out->Add<int>(outputTensorDimA);
     }catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetPoolingNdForwardOutputDim Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetPoolingNdForwardOutputDim Executed");
     //cout << " DEBUG - cudnnGetPoolingNdForwardOutputDim Executed"<<endl;
     return std::make_shared<Result>(cs, out);           
 }
 
 CUDNN_ROUTINE_HANDLER(GetPooling2dForwardOutputDim){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPooling2dForwardOutputDim"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetPooling2dForwardOutputDim"));
 
    cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
    cudnnTensorDescriptor_t inputTensorDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -2863,17 +2920,17 @@ CUDNN_ROUTINE_HANDLER(GetPooling2dForwardOutputDim){
        out->Add<int>(h);
        out->Add<int>(w);
    } catch(string e){  
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnGetPooling2dForwardOutputDim Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnGetPooling2dForwardOutputDim Executed");
    //cout << " DEBUG - cudnnGetPooling2dForwardOutputDim Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyPoolingDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyPoolingDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyPoolingDescriptor"));
    
    cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
 
@@ -2885,7 +2942,7 @@ CUDNN_ROUTINE_HANDLER(DestroyPoolingDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(PoolingForward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("PoolingForward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("PoolingForward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    const cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
@@ -2904,7 +2961,7 @@ CUDNN_ROUTINE_HANDLER(PoolingForward){
    try{
         out->AddMarshal<void *>(y);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }  
    //LOG4CPLUS_DEBUG(logger, "cudnnPoolingForward Executed");
@@ -2912,7 +2969,7 @@ CUDNN_ROUTINE_HANDLER(PoolingForward){
 }
 
 CUDNN_ROUTINE_HANDLER(PoolingBackward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("PoolingBackward"));   
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("PoolingBackward"));   
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    const cudnnPoolingDescriptor_t poolingDesc = (cudnnPoolingDescriptor_t)in->Get<long long int>();
@@ -2936,7 +2993,7 @@ CUDNN_ROUTINE_HANDLER(PoolingBackward){
    try{
        out->AddMarshal<void *>(dx);  
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger, "cudnnPoolingBackward Executed");
@@ -2944,7 +3001,7 @@ CUDNN_ROUTINE_HANDLER(PoolingBackward){
 }
 
 CUDNN_ROUTINE_HANDLER(CreateActivationDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateActivationDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateActivationDescriptor"));
 
    cudnnActivationDescriptor_t activationDesc;
  
@@ -2954,7 +3011,7 @@ CUDNN_ROUTINE_HANDLER(CreateActivationDescriptor){
    try{
        out->Add<cudnnActivationDescriptor_t>(activationDesc);
    } catch(string e){
-       LOG4CPLUS_DEBUG(logger, e);
+       GVIRTUS_LOG_DEBUG(logger, e);
        return std::make_shared<Result>(cs);
    }
     //LOG4CPLUS_DEBUG(logger, "cudnnCreateActivationDescriptor Executed");
@@ -2963,7 +3020,7 @@ CUDNN_ROUTINE_HANDLER(CreateActivationDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(SetActivationDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetActivationDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetActivationDescriptor"));
 
    cudnnActivationDescriptor_t activationDesc = (cudnnActivationDescriptor_t)in->Get<long long int>();
    cudnnActivationMode_t mode = in->Get<cudnnActivationMode_t>();
@@ -2976,7 +3033,7 @@ CUDNN_ROUTINE_HANDLER(SetActivationDescriptor){
    try{
         out->Add<cudnnActivationDescriptor_t>(activationDesc);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    //LOG4CPLUS_DEBUG(logger, "cudnnSetActivationDescriptor Executed");
@@ -2984,7 +3041,7 @@ CUDNN_ROUTINE_HANDLER(SetActivationDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(GetActivationDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetActivationDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetActivationDescriptor"));
 
    cudnnActivationDescriptor_t activationDesc = (cudnnActivationDescriptor_t)in->Get<long long int>();
    cudnnActivationMode_t mode;
@@ -2999,17 +3056,17 @@ CUDNN_ROUTINE_HANDLER(GetActivationDescriptor){
         out->Add<cudnnNanPropagation_t>(reluNanOpt);
         out->Add<double>(coef);
    } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
    }
    
-   LOG4CPLUS_DEBUG(logger, "cudnnGetActivationDescriptor Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnGetActivationDescriptor Executed");
    //cout << " DEBUG - cudnnGetActivationDescriptor Executed"<<endl;
    return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyActivationDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyActivationDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyActivationDescriptor"));
    
    cudnnActivationDescriptor_t activationDesc = (cudnnActivationDescriptor_t)in->Get<long long int>();
    
@@ -3021,7 +3078,7 @@ CUDNN_ROUTINE_HANDLER(DestroyActivationDescriptor){
 }
 
 CUDNN_ROUTINE_HANDLER(ActivationForward){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ActivationForward"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ActivationForward"));
     
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnActivationDescriptor_t activationDesc = (cudnnActivationDescriptor_t)in->Get<long long int>();
@@ -3039,7 +3096,7 @@ CUDNN_ROUTINE_HANDLER(ActivationForward){
     try{
         out->AddMarshal<void *>(y);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
     //LOG4CPLUS_DEBUG(logger, "cudnnActivationForward Executed");
@@ -3047,7 +3104,7 @@ CUDNN_ROUTINE_HANDLER(ActivationForward){
 }
 
 CUDNN_ROUTINE_HANDLER(ActivationBackward) {
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ActivationBackward"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ActivationBackward"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnActivationDescriptor_t activationDesc = (cudnnActivationDescriptor_t)in->Get<long long int>();
@@ -3070,7 +3127,7 @@ CUDNN_ROUTINE_HANDLER(ActivationBackward) {
      try{
          out->AddMarshal<void *>(dx);
      } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
      }
      //LOG4CPLUS_DEBUG(logger, "cudnnActivationBackward Executed"); 
@@ -3079,7 +3136,7 @@ CUDNN_ROUTINE_HANDLER(ActivationBackward) {
 }
 
 CUDNN_ROUTINE_HANDLER(CreateLRNDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateLRNDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateLRNDescriptor"));
 
      cudnnLRNDescriptor_t normDesc;
      
@@ -3089,17 +3146,17 @@ CUDNN_ROUTINE_HANDLER(CreateLRNDescriptor){
      try{
           out->Add<cudnnLRNDescriptor_t>(normDesc);
      } catch(string e){
-          LOG4CPLUS_DEBUG(logger, e);
+          GVIRTUS_LOG_DEBUG(logger, e);
           return std::make_shared<Result>(cs);
      }
      
-     LOG4CPLUS_DEBUG(logger, "cudnnCreateLRNDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreateLRNDescriptor Executed");
      //cout << " DEBUG - cudnnCreateLRNDescriptor Executed"<<endl;
      return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetLRNDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetLRNDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetLRNDescriptor"));
 
     cudnnLRNDescriptor_t normDesc = (cudnnLRNDescriptor_t)in->Get<long long int>();
     unsigned lrnN = in->Get<unsigned>();
@@ -3109,13 +3166,13 @@ CUDNN_ROUTINE_HANDLER(SetLRNDescriptor){
 
     cudnnStatus_t cs = cudnnSetLRNDescriptor(normDesc, lrnN, lrnAlpha, lrnBeta, lrnK);
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetLRNDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetLRNDescriptor Executed");
     //cout << " DEBUG - cudnnSetLRNDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetLRNDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetLRNDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetLRNDescriptor"));
 
     cudnnLRNDescriptor_t normDesc = (cudnnLRNDescriptor_t)in->Get<long long int>();
     unsigned lrnN;
@@ -3132,30 +3189,30 @@ CUDNN_ROUTINE_HANDLER(GetLRNDescriptor){
          out->Add<double>(lrnBeta);
          out->Add<double>(lrnK);
     }catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetLRNDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetLRNDescriptor Executed");
     //cout << " DEBUG - cudnnGetLRNDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyLRNDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyLRNDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyLRNDescriptor"));
 
     cudnnLRNDescriptor_t lrnDesc = (cudnnLRNDescriptor_t)in->Get<long long int>();
 
     cudnnStatus_t cs = cudnnDestroyLRNDescriptor(lrnDesc);
 
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDestroyLRNDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyLRNDescriptor Executed");
     //cout << " DEBUG - cudnnDestroyLRNDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(LRNCrossChannelForward){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("LRNCrossChannelForward"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("LRNCrossChannelForward"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnLRNDescriptor_t normDesc = (cudnnLRNDescriptor_t)in->Get<long long int>();
@@ -3173,17 +3230,17 @@ CUDNN_ROUTINE_HANDLER(LRNCrossChannelForward){
     try{
          out->Add<void>(y);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
  
-    LOG4CPLUS_DEBUG(logger, "cudnnLRNCrossChannelForward Executed");   
+    GVIRTUS_LOG_DEBUG(logger, "cudnnLRNCrossChannelForward Executed");   
     //cout << " DEBUG - cudnnLRNCrossChannelForward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(LRNCrossChannelBackward){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("LRNCrossChannelBackward"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("LRNCrossChannelBackward"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnLRNDescriptor_t normDesc = (cudnnLRNDescriptor_t)in->Get<long long int>();
@@ -3206,17 +3263,17 @@ CUDNN_ROUTINE_HANDLER(LRNCrossChannelBackward){
          out->Add<cudnnTensorDescriptor_t>(dxDesc);
          out->Add<void>(dx);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnLRNCrossChannelBackward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnLRNCrossChannelBackward Executed");
     //cout << " DEBUG - cudnnLRNCrossChannelBackward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DivisiveNormalizationForward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DivisiveNormalizationForward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DivisiveNormalizationForward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnLRNDescriptor_t normDesc = (cudnnLRNDescriptor_t)in->Get<long long int>();
@@ -3237,17 +3294,17 @@ CUDNN_ROUTINE_HANDLER(DivisiveNormalizationForward){
       try{
          out->Add<void>(y);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDivisiveNormalizationForward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDivisiveNormalizationForward Executed");
     //cout << " DEBUG - cudnnDivisiveNormalizationForward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DivisiveNormalizationBackward){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DivisiveNormalizationBackward"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DivisiveNormalizationBackward"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnLRNDescriptor_t normDesc = (cudnnLRNDescriptor_t)in->Get<long long int>();
@@ -3271,17 +3328,17 @@ CUDNN_ROUTINE_HANDLER(DivisiveNormalizationBackward){
          out->Add<void>(dx);
          out->Add<void>(dMeans);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
       
-    LOG4CPLUS_DEBUG(logger, "cudnnDivisiveNormalizationBackward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDivisiveNormalizationBackward Executed");
     //cout << " DEBUG - cudnnDivisiveNormalizationBackward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DeriveBNTensorDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeriveBNTensorDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DeriveBNTensorDescriptor"));
 
     cudnnTensorDescriptor_t derivedBnDesc;
     cudnnTensorDescriptor_t xDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -3293,17 +3350,17 @@ CUDNN_ROUTINE_HANDLER(DeriveBNTensorDescriptor){
       try{
          out->Add<cudnnTensorDescriptor_t>(derivedBnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDeriveBNTensorDescriptor");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDeriveBNTensorDescriptor");
     //cout << " DEBUG - cudnnDeriveBNTensorDescriptor"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(GetBatchNormalizationForwardTrainingExWorkspaceSize){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetBatchNormalizationForwardTrainingExWorkspaceSize"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetBatchNormalizationForwardTrainingExWorkspaceSize"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3321,17 +3378,17 @@ CUDNN_ROUTINE_HANDLER(GetBatchNormalizationForwardTrainingExWorkspaceSize){
       try{
          out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDeriveBNTensorDescriptor");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDeriveBNTensorDescriptor");
     //cout << " DEBUG - cudnnDeriveBNTensorDescriptor"<<endl;
     return std::make_shared<Result>(cs, out); 
 }
 
 CUDNN_ROUTINE_HANDLER(GetBatchNormalizationBackwardExWorkspaceSize){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetBatchNormalizationBackwardExWorkspaceSize"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetBatchNormalizationBackwardExWorkspaceSize"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3351,17 +3408,17 @@ CUDNN_ROUTINE_HANDLER(GetBatchNormalizationBackwardExWorkspaceSize){
       try{
          out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
    
-    LOG4CPLUS_DEBUG(logger, "cudnnDeriveBNTensorDescriptor");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDeriveBNTensorDescriptor");
     //cout << " DEBUG - cudnnDeriveBNTensorDescriptor"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetBatchNormalizationTrainingExReserveSpaceSize){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetBatchNormalizationTrainingExReserveSpaceSize"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetBatchNormalizationTrainingExReserveSpaceSize"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3376,17 +3433,17 @@ CUDNN_ROUTINE_HANDLER(GetBatchNormalizationTrainingExReserveSpaceSize){
       try{
          out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetBatchNormalizationTrainingExReserveSpaceSize");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetBatchNormalizationTrainingExReserveSpaceSize");
     //cout << " DEBUG - cudnnGetBatchNormalizationTrainingExReserveSpaceSize"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(BatchNormalizationForwardTraining){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationForwardTraining"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationForwardTraining"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3416,17 +3473,17 @@ CUDNN_ROUTINE_HANDLER(BatchNormalizationForwardTraining){
           out->Add<void>(resultSaveMean);
           out->Add<void>(resultSaveInvVariance);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetBatchNormalizationTrainingExReserveSpaceSize");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetBatchNormalizationTrainingExReserveSpaceSize");
     //cout << " DEBUG - cudnnGetBatchNormalizationTrainingExReserveSpaceSize"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(BatchNormalizationForwardTrainingEx){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationForwardTrainingEx"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationForwardTrainingEx"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3464,17 +3521,17 @@ CUDNN_ROUTINE_HANDLER(BatchNormalizationForwardTrainingEx){
           out->Add<void>(resultSaveMean);
           out->Add<void>(resultSaveInvVariance);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnBatchNormalizationForwardTrainingEx");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnBatchNormalizationForwardTrainingEx");
     //cout << " DEBUG - cudnnBatchNormalizationForwardTrainingEx"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(BatchNormalizationForwardInference){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationForwardInference"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationForwardInference"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3494,13 +3551,13 @@ CUDNN_ROUTINE_HANDLER(BatchNormalizationForwardInference){
     cudnnStatus_t cs = cudnnBatchNormalizationForwardInference(handle, mode, alpha, beta, xDesc, x, yDesc, y, bnScaleBiasMeanVarDesc, bnScale, bnBias, estimatedMean, estimatedVariance, epsilon);
     
     
-    LOG4CPLUS_DEBUG(logger, "cudnnBatchNormalizationForwardInference Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnBatchNormalizationForwardInference Executed");
     //cout << " DEBUG - cudnnBatchNormalizationForwardInference Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(BatchNormalizationBackward){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationBackward"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationBackward"));
      
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3529,18 +3586,18 @@ CUDNN_ROUTINE_HANDLER(BatchNormalizationBackward){
           out->Add<void>(dBnScaleResult);
           out->Add<void>(dBnBiasResult);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
 
-    LOG4CPLUS_DEBUG(logger, "cudnnBatchNormalizationBackward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnBatchNormalizationBackward Executed");
     //cout << " DEBUG - cudnnBatchNormalizationBackward Executed"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(BatchNormalizationBackwardEx){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationBackwardEx"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("BatchNormalizationBackwardEx"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnBatchNormMode_t mode = in->Get<cudnnBatchNormMode_t>();
@@ -3582,17 +3639,17 @@ CUDNN_ROUTINE_HANDLER(BatchNormalizationBackwardEx){
           out->Add<cudnnTensorDescriptor_t>(dxDesc);
           out->Add<void>(dxData);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnBatchNormalizationBackwardEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnBatchNormalizationBackwardEx Executed");
     //cout << " DEBUG - cudnnBatchNormalizationBackwardEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateSpatialTransformerDescriptor){
-      Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateSpatialTransformerDescriptor"));
+      static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateSpatialTransformerDescriptor"));
 
       cudnnSpatialTransformerDescriptor_t stDesc;
     
@@ -3602,17 +3659,17 @@ CUDNN_ROUTINE_HANDLER(CreateSpatialTransformerDescriptor){
       try{
           out->Add<cudnnSpatialTransformerDescriptor_t>(stDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnCreateSpatialTransformerDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCreateSpatialTransformerDescriptor Executed");
     //cout << " DEBUG - cudnnCreateSpatialTransformerDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetSpatialTransformerNdDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetSpatialTransformerNdDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetSpatialTransformerNdDescriptor"));
     
     cudnnSpatialTransformerDescriptor_t stDesc = (cudnnSpatialTransformerDescriptor_t)in->Get<long long int>();
     cudnnSamplerType_t samplerType = in->Get<cudnnSamplerType_t>();
@@ -3627,31 +3684,31 @@ CUDNN_ROUTINE_HANDLER(SetSpatialTransformerNdDescriptor){
       try{
           out->Add<cudnnSpatialTransformerDescriptor_t>(stDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
 
-     LOG4CPLUS_DEBUG(logger, "cudnnSetSpatialTransformerNdDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetSpatialTransformerNdDescriptor Executed");
      //cout << " DEBUG - cudnnSetSpatialTransformerNdDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);  
 }
 
 CUDNN_ROUTINE_HANDLER(DestroySpatialTransformerDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroySpatialTransformerDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroySpatialTransformerDescriptor"));
 
     cudnnSpatialTransformerDescriptor_t stDesc = (cudnnSpatialTransformerDescriptor_t)in->Get<long long int>();
 
     cudnnStatus_t cs = cudnnDestroySpatialTransformerDescriptor(stDesc);
 
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDestroySpatialTransformerDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDestroySpatialTransformerDescriptor Executed");
     //cout << " DEBUG - cudnnDestroySpatialTransformerDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs); 
 }
 
 CUDNN_ROUTINE_HANDLER(SpatialTfGridGeneratorForward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfGridGeneratorForward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfGridGeneratorForward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnSpatialTransformerDescriptor_t stDesc = (cudnnSpatialTransformerDescriptor_t)in->Get<long long int>();
@@ -3664,11 +3721,11 @@ CUDNN_ROUTINE_HANDLER(SpatialTfGridGeneratorForward){
       try{
           out->Add<void>(grid);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSpatialTfGridGeneratorForward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSpatialTfGridGeneratorForward Executed");
     //cout << " DEBUG - cudnnSpatialTfGridGeneratorForward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
@@ -3676,7 +3733,7 @@ CUDNN_ROUTINE_HANDLER(SpatialTfGridGeneratorForward){
 
 
 CUDNN_ROUTINE_HANDLER(SpatialTfGridGeneratorBackward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfGridGeneratorBackward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfGridGeneratorBackward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnSpatialTransformerDescriptor_t stDesc = (cudnnSpatialTransformerDescriptor_t)in->Get<long long int>();
@@ -3689,17 +3746,17 @@ CUDNN_ROUTINE_HANDLER(SpatialTfGridGeneratorBackward){
       try{
           out->Add<void>(dtheta);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSpatialTfGridGeneratorBackward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSpatialTfGridGeneratorBackward Executed");
     //cout << " DEBUG - cudnnSpatialTfGridGeneratorBackward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SpatialTfSamplerForward){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfSamplerForward"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfSamplerForward"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnSpatialTransformerDescriptor_t stDesc = (cudnnSpatialTransformerDescriptor_t)in->Get<long long int>();
@@ -3717,17 +3774,17 @@ CUDNN_ROUTINE_HANDLER(SpatialTfSamplerForward){
       try{
           out->Add<void>(y);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSpatialTfSamplerForward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSpatialTfSamplerForward Executed");
     //cout << " DEBUG - cudnnSpatialTfSamplerForward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SpatialTfSamplerBackward){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfSamplerBackward"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SpatialTfSamplerBackward"));
   
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnSpatialTransformerDescriptor_t stDesc = (cudnnSpatialTransformerDescriptor_t)in->Get<long long int>();
@@ -3751,17 +3808,17 @@ CUDNN_ROUTINE_HANDLER(SpatialTfSamplerBackward){
           out->Add<void>(dx);
           out->Add<void>(dgrid);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSpatialTfSamplerBackward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSpatialTfSamplerBackward Executed");
     //cout << " DEBUG - cudnnSpatialTfSamplerBackward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateDropoutDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateDropoutDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateDropoutDescriptor"));
 
     cudnnDropoutDescriptor_t dropoutDesc;
 
@@ -3771,30 +3828,30 @@ CUDNN_ROUTINE_HANDLER(CreateDropoutDescriptor){
       try{
           out->Add<cudnnDropoutDescriptor_t>(dropoutDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnCreateDropoutDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCreateDropoutDescriptor Executed");
     //cout << " DEBUG - cudnnCreateDropoutDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyDropoutDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyDropoutDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyDropoutDescriptor"));
 
    cudnnDropoutDescriptor_t dropoutDesc = (cudnnDropoutDescriptor_t)in->Get<long long int>();
    
    cudnnStatus_t cs = cudnnDestroyDropoutDescriptor(dropoutDesc);
 
-    LOG4CPLUS_DEBUG(logger, "cudnnDestroyDropoutDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyDropoutDescriptor Executed");
     //cout << " DEBUG - cudnnDestroyDropoutDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
   
 }
 
 CUDNN_ROUTINE_HANDLER(DropoutGetStatesSize){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutGetStatesSize"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutGetStatesSize"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     size_t sizeInBytes;
@@ -3805,16 +3862,16 @@ CUDNN_ROUTINE_HANDLER(DropoutGetStatesSize){
       try{
           out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger, "cudnnDropoutGetStatesSize Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDropoutGetStatesSize Executed");
     //cout << " DEBUG - cudnnDropoutGetStatesSize Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(DropoutGetReserveSpaceSize){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutGetReserveSpaceSize"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutGetReserveSpaceSize"));
 
      cudnnTensorDescriptor_t xdesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
      size_t sizeInBytes;
@@ -3825,16 +3882,16 @@ CUDNN_ROUTINE_HANDLER(DropoutGetReserveSpaceSize){
       try{
           out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger, "cudnnDropoutGetReserveSpaceSize Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDropoutGetReserveSpaceSize Executed");
     //cout << " DEBUG - cudnnDropoutGetReserveSpaceSize Executed"<<endl;
     return std::make_shared<Result>(cs, out);  
 }
 
 CUDNN_ROUTINE_HANDLER(SetDropoutDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetDropoutDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetDropoutDescriptor"));
 
    cudnnDropoutDescriptor_t dropoutDesc = (cudnnDropoutDescriptor_t)in->Get<long long int>(); //INPUT/OUTPUT
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
@@ -3850,17 +3907,17 @@ CUDNN_ROUTINE_HANDLER(SetDropoutDescriptor){
           out->Add<cudnnDropoutDescriptor_t>(dropoutDesc);
           out->Add<void>(states);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetDropoutDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetDropoutDescriptor Executed");
     //cout << " DEBUG - cudnnSetDropoutDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(RestoreDropoutDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RestoreDropoutDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RestoreDropoutDescriptor"));
 
     cudnnDropoutDescriptor_t dropoutDesc = (cudnnDropoutDescriptor_t)in->Get<long long int>();
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
@@ -3875,18 +3932,18 @@ CUDNN_ROUTINE_HANDLER(RestoreDropoutDescriptor){
       try{
           out->Add<cudnnDropoutDescriptor_t>(dropoutDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnRestoreDropoutDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnRestoreDropoutDescriptor Executed");
     //cout << " DEBUG - cudnnRestoreDropoutDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 
 CUDNN_ROUTINE_HANDLER(GetDropoutDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetDropoutDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetDropoutDescriptor"));
 
     cudnnDropoutDescriptor_t dropoutDesc = (cudnnDropoutDescriptor_t)in->Get<long long int>();
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
@@ -3902,17 +3959,17 @@ CUDNN_ROUTINE_HANDLER(GetDropoutDescriptor){
           out->Add<void>(states);
           out->Add<unsigned long long>(seed);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetDropoutDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetDropoutDescriptor Executed");
     //cout << " DEBUG - cudnnGetDropoutDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DropoutForward){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutForward"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutForward"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnDropoutDescriptor_t dropoutDesc = (cudnnDropoutDescriptor_t)in->Get<long long int>();
@@ -3930,17 +3987,17 @@ CUDNN_ROUTINE_HANDLER(DropoutForward){
           out->Add<void>(y);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnDropoutForward Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnDropoutForward Executed");
     //cout << " DEBUG - cudnnDropoutForward Executed"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(DropoutBackward){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutBackward"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DropoutBackward"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnDropoutDescriptor_t dropoutDesc = (cudnnDropoutDescriptor_t)in->Get<long long int>();
@@ -3957,17 +4014,17 @@ CUDNN_ROUTINE_HANDLER(DropoutBackward){
       try{
           out->Add<void>(dx);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDropoutBackward Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDropoutBackward Executed");
     //cout << " DEBUG - cudnnDropoutBackward Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateRNNDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateRNNDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateRNNDescriptor"));
 
    cudnnRNNDescriptor_t rnnDesc;
 
@@ -3977,31 +4034,31 @@ CUDNN_ROUTINE_HANDLER(CreateRNNDescriptor){
       try{
           out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
    
-    LOG4CPLUS_DEBUG(logger, "cudnnCreateRNNDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCreateRNNDescriptor Executed");
     //cout << " DEBUG - cudnnCreateRNNDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);  
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyRNNDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyRNNDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyRNNDescriptor"));
 
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
 
     cudnnStatus_t cs = cudnnDestroyRNNDescriptor(rnnDesc);
 
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDestroyRNNDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyRNNDescriptor Executed");
     //cout << " DEBUG - cudnnDestroyRNNDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 #if CUDNN_VERSION < 8000
     CUDNN_ROUTINE_HANDLER(SetRNNDescriptor_v5){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v5"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v5"));
 
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
     int hiddenSize = in->Get<int>();
@@ -4018,18 +4075,18 @@ CUDNN_ROUTINE_HANDLER(DestroyRNNDescriptor){
     try{
         out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
 
-    LOG4CPLUS_DEBUG(logger, "cudnnSetRNNDescriptor_v5 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNDescriptor_v5 Executed");
     //cout << " DEBUG - cudnnSetRNNDescriptor_v5 Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 #endif
 #if CUDNN_VERSION >= 6000
 CUDNN_ROUTINE_HANDLER(SetRNNDescriptor_v6){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v6"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v6"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4048,17 +4105,17 @@ CUDNN_ROUTINE_HANDLER(SetRNNDescriptor_v6){
       try{
           out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetRNNDescriptor_v6 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNDescriptor_v6 Executed");
     //cout << " DEBUG - cudnnSetRNNDescriptor_v6 Executed"<<endl;
     return std::make_shared<Result>(cs, out);         
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNDescriptor_v6){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNDescriptor_v6"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNDescriptor_v6"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4084,11 +4141,11 @@ CUDNN_ROUTINE_HANDLER(GetRNNDescriptor_v6){
         out->Add<cudnnRNNAlgo_t>(algo);
         out->Add<cudnnDataType_t>(mathPrec);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
 
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNDescriptor_v6 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNDescriptor_v6 Executed");
     //cout << " DEBUG - cudnnGetRNNDescriptor_v6 Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
@@ -4096,7 +4153,7 @@ CUDNN_ROUTINE_HANDLER(GetRNNDescriptor_v6){
 
 #if CUDNN_VERSION >= 8000
 CUDNN_ROUTINE_HANDLER(SetRNNDescriptor_v8){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v8"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v8"));
 
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
 
@@ -4134,17 +4191,17 @@ CUDNN_ROUTINE_HANDLER(SetRNNDescriptor_v8){
     try{
         out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
 
-    LOG4CPLUS_DEBUG(logger, "cudnnSetRNNDescriptor_v8 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNDescriptor_v8 Executed");
     //cout << " DEBUG - cudnnSetRNNDescriptor_v8 Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNDescriptor_v8) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNDescriptor_v8"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNDescriptor_v8"));
 
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t) in->Get<long long int>();
 
@@ -4188,18 +4245,18 @@ CUDNN_ROUTINE_HANDLER(GetRNNDescriptor_v8) {
         out->Add<int>(auxFlags);
 
     } catch (string e) {
-        LOG4CPLUS_DEBUG(logger, e);
+        GVIRTUS_LOG_DEBUG(logger, e);
         return std::make_shared<Result>(cs);
     }
 
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNDescriptor_v8 Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNDescriptor_v8 Executed");
     //cout << " DEBUG - cudnnGetRNNDescriptor_v8 Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 #endif
 
 CUDNN_ROUTINE_HANDLER(SetRNNMatrixMathType){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNMatrixMathType"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNMatrixMathType"));
    
    cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
    cudnnMathType_t mType = in->Get<cudnnMathType_t>();
@@ -4207,13 +4264,13 @@ CUDNN_ROUTINE_HANDLER(SetRNNMatrixMathType){
    cudnnStatus_t cs = cudnnSetRNNMatrixMathType(rnnDesc, mType);
 
    
-   LOG4CPLUS_DEBUG(logger, "cudnnSetRNNMatrixMathType Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNMatrixMathType Executed");
    //cout << " DEBUG - cudnnSetRNNMatrixMathType Executed"<<endl;
    return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNMatrixMathType){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNMatrixMathType"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNMatrixMathType"));
 
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
     cudnnMathType_t mType;
@@ -4224,17 +4281,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNMatrixMathType){
       try{
           out->Add<cudnnMathType_t>(mType);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNMatrixMathType Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNMatrixMathType Executed");
     //cout << " DEBUG - cudnnGetRNNMatrixMathType Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetRNNBiasMode){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNBiasMode"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNBiasMode"));
 
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>(); 
      cudnnRNNBiasMode_t biasMode = in->Get<cudnnRNNBiasMode_t>();
@@ -4245,17 +4302,17 @@ CUDNN_ROUTINE_HANDLER(SetRNNBiasMode){
       try{
           out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetRNNBiasMode Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNBiasMode Executed");
     //cout << " DEBUG - cudnnSetRNNBiasMode Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNBiasMode){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNBiasMode"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNBiasMode"));
 
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
     cudnnRNNBiasMode_t biasMode;
@@ -4266,17 +4323,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNBiasMode){
       try{
           out->Add<cudnnRNNBiasMode_t>(biasMode);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetRNNBiasMode Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNBiasMode Executed");
     //cout << " DEBUG - cudnnGetRNNBiasMode Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(RNNSetClip){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNSetClip"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNSetClip"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4291,17 +4348,17 @@ CUDNN_ROUTINE_HANDLER(RNNSetClip){
       try{
           out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnRNNSetClip Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnRNNSetClip Executed");
     //cout << " DEBUG - cudnnRNNSetClip Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(RNNGetClip){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNGetClip"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNGetClip"));
    
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4319,17 +4376,17 @@ CUDNN_ROUTINE_HANDLER(RNNGetClip){
           out->Add<double>(lclip);
           out->Add<double>(rclip);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnRNNGetClip Execute");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnRNNGetClip Execute");
     //cout << " DEBUG - cudnnRNNGetClip Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetRNNProjectionLayers){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNProjectionLayers"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNProjectionLayers"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4340,13 +4397,13 @@ CUDNN_ROUTINE_HANDLER(SetRNNProjectionLayers){
 
     
 
-    LOG4CPLUS_DEBUG(logger, "cudnnSetRNNProjectionLayers Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNProjectionLayers Executed");
     //cout << " DEBUG - cudnnSetRNNProjectionLayers Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNProjectionLayers){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNProjectionLayers"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNProjectionLayers"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4360,17 +4417,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNProjectionLayers){
           out->Add<int>(recProjSize);
           out->Add<int>(outProjSize);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetRNNProjectionLayers Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNProjectionLayers Executed");
     //cout << " DEBUG - cudnnGetRNNProjectionLayers Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreatePersistentRNNPlan){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreatePersistentRNNPlan"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreatePersistentRNNPlan"));
 
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
     int minibatch = in->Get<int>();
@@ -4383,30 +4440,30 @@ CUDNN_ROUTINE_HANDLER(CreatePersistentRNNPlan){
       try{
           out->Add<cudnnPersistentRNNPlan_t>(plan);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnCreatePersistentRNNPlan Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreatePersistentRNNPlan Executed");
     //cout << " DEBUG - cudnnCreatePersistentRNNPlan Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyPersistentRNNPlan){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyPersistentRNNPlan"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyPersistentRNNPlan"));
 
     cudnnPersistentRNNPlan_t plan;
     
     cudnnStatus_t cs = cudnnDestroyPersistentRNNPlan(plan);
 
     
-    LOG4CPLUS_DEBUG(logger, "cudnnDestroyPersistentRNNPlan Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyPersistentRNNPlan Executed");
     //cout << " DEBUG - cudnnDestroyPersistentRNNPlan Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetPersistentRNNPlan){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetPersistentRNNPlan"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetPersistentRNNPlan"));
   
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
     cudnnPersistentRNNPlan_t plan = in->Get<cudnnPersistentRNNPlan_t>();
@@ -4414,13 +4471,13 @@ CUDNN_ROUTINE_HANDLER(SetPersistentRNNPlan){
     cudnnStatus_t cs = cudnnSetPersistentRNNPlan(rnnDesc, plan);
 
     
-     LOG4CPLUS_DEBUG(logger, "cudnnSetPersistentRNNPlan Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetPersistentRNNPlan Executed");
     //cout << " DEBUG - cudnnSetPersistentRNNPlan Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNWorkspaceSize){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNWorkspaceSize"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNWorkspaceSize"));
      
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4434,17 +4491,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNWorkspaceSize){
       try{
           out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNWorkspaceSize Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNWorkspaceSize Executed");
     //cout << " DEBUG - cudnnGetRNNWorkspaceSize Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNTrainingReserveSize){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNTrainingReserveSize"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNTrainingReserveSize"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4458,17 +4515,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNTrainingReserveSize){
       try{
           out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetRNNTrainingReserveSize Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNTrainingReserveSize Executed");
     //cout << " DEBUG - cudnnGetRNNTrainingReserveSize Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNParamsSize){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNParamsSize"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNParamsSize"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4482,17 +4539,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNParamsSize){
       try{
           out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetRNNParamsSize Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNParamsSize Executed");
     //cout << " DEBUG - cudnnGetRNNParamsSize Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNLinLayerMatrixParams){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNLinLayerMatrixParams"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNLinLayerMatrixParams"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4511,17 +4568,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNLinLayerMatrixParams){
           out->Add<cudnnFilterDescriptor_t>(linLayerMatDesc);
           out->Add<void>(linLayerMat);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNLinLayerMatrixParams Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNLinLayerMatrixParams Executed");
     //cout << " DEBUG - cudnnGetRNNLinLayerMatrixParams Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNLinLayerBiasParams){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNLinLayerBiasParams")); 
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNLinLayerBiasParams")); 
      
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4540,17 +4597,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNLinLayerBiasParams){
           out->Add<cudnnFilterDescriptor_t>(linLayerBiasDesc);
           out->Add<void>(linLayerBias);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNLinLayerBiasParams Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNLinLayerBiasParams Executed");
     //cout << " DEBUG - cudnnGetRNNLinLayerBiasParams Executed"<<endl;
     return std::make_shared<Result>(cs, out);  
 }
 
 CUDNN_ROUTINE_HANDLER(RNNForwardInference){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardInference"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardInference"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4580,17 +4637,17 @@ CUDNN_ROUTINE_HANDLER(RNNForwardInference){
           out->Add<void>(hy);
           out->Add<void>(cy);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, " cudnnRNNForwardInference Executed");
+    GVIRTUS_LOG_DEBUG(logger, " cudnnRNNForwardInference Executed");
     //cout << " DEBUG - cudnnRNNForwardInference Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(RNNForwardTraining){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardTraining"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardTraining"));
     
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4623,17 +4680,17 @@ CUDNN_ROUTINE_HANDLER(RNNForwardTraining){
           out->Add<void>(cy);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnRNNForwardTraining Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnRNNForwardTraining Executed");
     //cout << " DEBUG - cudnnRNNForwardTraining Executed"<<endl;
     return std::make_shared<Result>(cs, out);         
 }
 
 CUDNN_ROUTINE_HANDLER(RNNBackwardData){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardData"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardData"));
     
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4672,17 +4729,17 @@ CUDNN_ROUTINE_HANDLER(RNNBackwardData){
           out->Add<void>(dcx);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnRNNBackwardData Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnRNNBackwardData Executed");
     //cout << " DEBUG - cudnnRNNBackwardData Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(RNNBackwardWeights){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardWeights"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardWeights"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4706,17 +4763,17 @@ CUDNN_ROUTINE_HANDLER(RNNBackwardWeights){
       try{
           out->Add<void>(dw);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnRNNBackwardWeights Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnRNNBackwardWeights Executed");
     //cout << " DEBUG - cudnnRNNBackwardWeights Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetRNNPaddingMode){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNPaddingMode"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNPaddingMode"));
 
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
      cudnnRNNPaddingMode_t paddingMode = in->Get<cudnnRNNPaddingMode_t>();
@@ -4727,17 +4784,17 @@ CUDNN_ROUTINE_HANDLER(SetRNNPaddingMode){
       try{
           out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnSetRNNPaddingMode Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNPaddingMode Executed");
     //cout << " DEBUG - cudnnSetRNNPaddingMode Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNPaddingMode){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNPaddingMode"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNPaddingMode"));
 
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
      cudnnRNNPaddingMode_t paddingMode = in->Get<cudnnRNNPaddingMode_t>();
@@ -4748,16 +4805,16 @@ CUDNN_ROUTINE_HANDLER(GetRNNPaddingMode){
       try{
           out->Add<cudnnRNNDescriptor_t>(rnnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNPaddingMode Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNPaddingMode Executed");
     //cout << " DEBUG - cudnnGetRNNPaddingMode Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateRNNDataDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateRNNDataDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateRNNDataDescriptor"));
 
      cudnnRNNDataDescriptor_t rnnDataDesc;
 
@@ -4767,30 +4824,30 @@ CUDNN_ROUTINE_HANDLER(CreateRNNDataDescriptor){
       try{
           out->Add<cudnnRNNDataDescriptor_t>(rnnDataDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnCreateRNNDataDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreateRNNDataDescriptor Executed");
     //cout << " DEBUG - cudnnCreateRNNDataDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyRNNDataDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyRNNDataDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyRNNDataDescriptor"));
 
      cudnnRNNDataDescriptor_t rnnDataDesc = (cudnnRNNDataDescriptor_t)in->Get<long long int>();
      
      cudnnStatus_t cs = cudnnDestroyRNNDataDescriptor(rnnDataDesc);
      
      
-     LOG4CPLUS_DEBUG(logger, "cudnnDestroyRNNDataDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyRNNDataDescriptor Executed");
      //cout << " DEBUG - cudnnDestroyRNNDataDescriptor Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetRNNDataDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDataDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDataDescriptor"));
 
      cudnnRNNDataDescriptor_t rnnDataDesc = (cudnnRNNDataDescriptor_t)in->Get<long long int>();
      cudnnDataType_t dataType = in->Get<cudnnDataType_t>();
@@ -4807,17 +4864,17 @@ CUDNN_ROUTINE_HANDLER(SetRNNDataDescriptor){
       try{
           out->Add<cudnnRNNDataDescriptor_t>(rnnDataDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetRNNDataDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNDataDescriptor Executed");
     //cout << " DEBUG - cudnnSetRNNDataDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNDataDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNDataDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNDataDescriptor"));
 
      cudnnRNNDataDescriptor_t rnnDataDesc = (cudnnRNNDataDescriptor_t)in->Get<long long int>();
      cudnnDataType_t dataType;
@@ -4841,18 +4898,18 @@ CUDNN_ROUTINE_HANDLER(GetRNNDataDescriptor){
           out->Add<int>(seqLengthArray);
           out->Add<void>(paddingFill);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
 
-     LOG4CPLUS_DEBUG(logger, "cudnnGetRNNDataDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNDataDescriptor Executed");
      //cout << " DEBUG - cudnnGetRNNDataDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(RNNForwardTrainingEx){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardTrainingEx"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardTrainingEx"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4892,17 +4949,17 @@ CUDNN_ROUTINE_HANDLER(RNNForwardTrainingEx){
           out->Add<void>(cy);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, " cudnnRNNForwardTrainingEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, " cudnnRNNForwardTrainingEx Executed");
     //cout << " DEBUG - cudnnRNNForwardTrainingEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(RNNForwardInferenceEx){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardInferenceEx"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNForwardInferenceEx"));
     
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4939,17 +4996,17 @@ CUDNN_ROUTINE_HANDLER(RNNForwardInferenceEx){
           out->Add<void>(hy);
           out->Add<void>(cy);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnRNNForwardInferenceEx Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnRNNForwardInferenceEx Executed");
     //cout << " DEBUG - cudnnRNNForwardInferenceEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(RNNBackwardDataEx){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardDataEx"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardDataEx"));
    
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -4991,17 +5048,17 @@ CUDNN_ROUTINE_HANDLER(RNNBackwardDataEx){
           out->Add<void>(dcx);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnRNNBackwardDataEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnRNNBackwardDataEx Executed");
     //cout << " DEBUG - cudnnRNNBackwardDataEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
  
 CUDNN_ROUTINE_HANDLER(RNNBackwardWeightsEx){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardWeightsEx"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RNNBackwardWeightsEx"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5024,17 +5081,17 @@ CUDNN_ROUTINE_HANDLER(RNNBackwardWeightsEx){
       try{
           out->Add<void>(dw);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnRNNBackwardWeightsEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnRNNBackwardWeightsEx Executed");
     //cout << " DEBUG - cudnnRNNBackwardWeightsEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetRNNAlgorithmDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNAlgorithmDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNAlgorithmDescriptor"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5046,17 +5103,17 @@ CUDNN_ROUTINE_HANDLER(SetRNNAlgorithmDescriptor){
       try{
           out->Add<cudnnAlgorithmDescriptor_t>(algoDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetRNNAlgorithmDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetRNNAlgorithmDescriptor Executed");
     //cout << " DEBUG - cudnnSetRNNAlgorithmDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNForwardInferenceAlgorithmMaxCount){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNForwardInferenceAlgorithmMaxCount"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNForwardInferenceAlgorithmMaxCount"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5068,17 +5125,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNForwardInferenceAlgorithmMaxCount){
       try{
           out->Add<int>(count);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNForwardInferenceAlgorithmMaxCount Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNForwardInferenceAlgorithmMaxCount Executed");
     //cout << " DEBUG - cudnnGetRNNForwardInferenceAlgorithmMaxCount Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(FindRNNForwardInferenceAlgorithmEx){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNForwardInferenceAlgorithmEx"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNForwardInferenceAlgorithmEx"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5114,17 +5171,17 @@ CUDNN_ROUTINE_HANDLER(FindRNNForwardInferenceAlgorithmEx){
           out->Add<int>(returnedAlgoCount);
           out->Add<cudnnAlgorithmPerformance_t>(perfResults);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
       
-     LOG4CPLUS_DEBUG(logger, "cudnnFindRNNForwardInferenceAlgorithmEx Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnFindRNNForwardInferenceAlgorithmEx Executed");
     //cout << " DEBUG - cudnnFindRNNForwardInferenceAlgorithmEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNForwardTrainingAlgorithmMaxCount){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNForwardTrainingAlgorithmMaxCount"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNForwardTrainingAlgorithmMaxCount"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5136,17 +5193,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNForwardTrainingAlgorithmMaxCount){
       try{
           out->Add<int>(count);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNForwardTrainingAlgorithmMaxCount Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNForwardTrainingAlgorithmMaxCount Executed");
     //cout << " DEBUG - cudnnGetRNNForwardTrainingAlgorithmMaxCount Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(FindRNNForwardTrainingAlgorithmEx){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNForwardTrainingAlgorithmEx"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNForwardTrainingAlgorithmEx"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5185,17 +5242,17 @@ CUDNN_ROUTINE_HANDLER(FindRNNForwardTrainingAlgorithmEx){
           out->Add<cudnnAlgorithmPerformance_t>(perfResults);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnFindRNNForwardTrainingAlgorithmEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnFindRNNForwardTrainingAlgorithmEx Executed");
     //cout << " DEBUG - cudnnFindRNNForwardTrainingAlgorithmEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(GetRNNBackwardDataAlgorithmMaxCount){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNBackwardDataAlgorithmMaxCount"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNBackwardDataAlgorithmMaxCount"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5207,17 +5264,17 @@ CUDNN_ROUTINE_HANDLER(GetRNNBackwardDataAlgorithmMaxCount){
       try{
           out->Add<int>(count);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetRNNBackwardDataAlgorithmMaxCount Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNBackwardDataAlgorithmMaxCount Executed");
     //cout << " DEBUG - cudnnGetRNNBackwardDataAlgorithmMaxCount Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(FindRNNBackwardDataAlgorithmEx){
-      Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNBackwardDataAlgorithmEx"));
+      static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNBackwardDataAlgorithmEx"));
 
        cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
        cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5262,18 +5319,18 @@ CUDNN_ROUTINE_HANDLER(FindRNNBackwardDataAlgorithmEx){
           out->Add<cudnnAlgorithmPerformance_t>(perfResults);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnFindRNNBackwardDataAlgorithmEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnFindRNNBackwardDataAlgorithmEx Executed");
     //cout << " DEBUG - cudnnFindRNNBackwardDataAlgorithmEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 
 CUDNN_ROUTINE_HANDLER(GetRNNBackwardWeightsAlgorithmMaxCount){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNBackwardWeightsAlgorithmMaxCount"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetRNNBackwardWeightsAlgorithmMaxCount"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5285,16 +5342,16 @@ CUDNN_ROUTINE_HANDLER(GetRNNBackwardWeightsAlgorithmMaxCount){
       try{
           out->Add<int>(count);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger, "cudnnGetRNNBackwardWeightsAlgorithmMaxCount Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetRNNBackwardWeightsAlgorithmMaxCount Executed");
     //cout << " DEBUG - cudnnGetRNNBackwardWeightsAlgorithmMaxCount Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(FindRNNBackwardWeightsAlgorithmEx){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNBackwardWeightsAlgorithmEx"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FindRNNBackwardWeightsAlgorithmEx"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>();
@@ -5324,16 +5381,16 @@ CUDNN_ROUTINE_HANDLER(FindRNNBackwardWeightsAlgorithmEx){
           out->Add<cudnnAlgorithmPerformance_t>(perfResults);
           out->Add<void>(dw);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger, "cudnnFindRNNBackwardWeightsAlgorithmEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnFindRNNBackwardWeightsAlgorithmEx Executed");
     //cout << " DEBUG - cudnnFindRNNBackwardWeightsAlgorithmEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);  
 }
 
 CUDNN_ROUTINE_HANDLER(CreateSeqDataDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateSeqDataDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateSeqDataDescriptor"));
 
     cudnnSeqDataDescriptor_t seqDataDesc;
 
@@ -5343,30 +5400,30 @@ CUDNN_ROUTINE_HANDLER(CreateSeqDataDescriptor){
       try{
           out->Add<cudnnSeqDataDescriptor_t>(seqDataDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnCreateSeqDataDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreateSeqDataDescriptor Executed");
     //cout << " DEBUG - cudnnCreateSeqDataDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(DestroySeqDataDescriptor){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroySeqDataDescriptor"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroySeqDataDescriptor"));
 
    cudnnSeqDataDescriptor_t seqDataDesc = (cudnnSeqDataDescriptor_t)in->Get<long long int>();
 
    cudnnStatus_t cs = cudnnDestroySeqDataDescriptor(seqDataDesc);
 
    
-   LOG4CPLUS_DEBUG(logger, "cudnnDestroySeqDataDescriptor Executed");
+   GVIRTUS_LOG_DEBUG(logger, "cudnnDestroySeqDataDescriptor Executed");
    //cout << " DEBUG - cudnnDestroySeqDataDescriptor Executed"<<endl;
    return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetSeqDataDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetSeqDataDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetSeqDataDescriptor"));
 
     cudnnSeqDataDescriptor_t seqDataDesc;
     cudnnDataType_t dataType = in->Get<cudnnDataType_t>();
@@ -5383,17 +5440,17 @@ CUDNN_ROUTINE_HANDLER(SetSeqDataDescriptor){
       try{
           out->Add<cudnnSeqDataDescriptor_t>(seqDataDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetSeqDataDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetSeqDataDescriptor Executed");
     //cout << " DEBUG - cudnnSetSeqDataDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetSeqDataDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetSeqDataDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetSeqDataDescriptor"));
 
     cudnnSeqDataDescriptor_t seqDataDesc = (cudnnSeqDataDescriptor_t)in->Get<long long int>();
     cudnnDataType_t dataType; //OUTPUT
@@ -5418,17 +5475,17 @@ CUDNN_ROUTINE_HANDLER(GetSeqDataDescriptor){
           out->Add<int>(seqLengthArray);
           out->Add<void>(paddingFill);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetSeqDataDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetSeqDataDescriptor Executed");
     //cout << " DEBUG - cudnnGetSeqDataDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateAttnDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateAttnDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateAttnDescriptor"));
 
      cudnnAttnDescriptor_t attnDesc;
 
@@ -5438,31 +5495,31 @@ CUDNN_ROUTINE_HANDLER(CreateAttnDescriptor){
       try{
           out->Add<cudnnAttnDescriptor_t>(attnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnCreateAttnDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreateAttnDescriptor Executed");
     //cout << " DEBUG - cudnnCreateAttnDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyAttnDescriptor){
 
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyAttnDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyAttnDescriptor"));
    
      cudnnAttnDescriptor_t attnDesc = (cudnnAttnDescriptor_t)in->Get<long long int>();
      
      cudnnStatus_t cs = cudnnDestroyAttnDescriptor(attnDesc); 
 
      
-      LOG4CPLUS_DEBUG(logger, "cudnnDestroyAttnDescriptor Executed");
+      GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyAttnDescriptor Executed");
      //cout << " DEBUG - cudnnDestroyAttnDescriptor Executed"<<endl;
      return std::make_shared<Result>(cs); 
 }
 
 CUDNN_ROUTINE_HANDLER(SetAttnDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetAttnDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetAttnDescriptor"));
 
      cudnnAttnDescriptor_t attnDesc; //OUTPUT
      unsigned attnMode = in->Get<unsigned>();
@@ -5491,17 +5548,17 @@ CUDNN_ROUTINE_HANDLER(SetAttnDescriptor){
       try{
           out->Add<cudnnAttnDescriptor_t>(attnDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnSetAttnDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetAttnDescriptor Executed");
     //cout << " DEBUG - cudnnSetAttnDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetAttnDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAttnDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAttnDescriptor"));
 
      cudnnAttnDescriptor_t attnDesc = (cudnnAttnDescriptor_t)in->Get<long long int>();
      unsigned attnMode;
@@ -5548,17 +5605,17 @@ CUDNN_ROUTINE_HANDLER(GetAttnDescriptor){
           out->Add<int>(maxBatchSize);
           out->Add<int>(maxBeamSize);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetAttnDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetAttnDescriptor Executed");
     //cout << " DEBUG - cudnnGetAttnDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetMultiHeadAttnBuffers){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetMultiHeadAttnBuffers"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetMultiHeadAttnBuffers"));
      
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnAttnDescriptor_t attnDesc = (cudnnAttnDescriptor_t)in->Get<long long int>();
@@ -5574,17 +5631,17 @@ CUDNN_ROUTINE_HANDLER(GetMultiHeadAttnBuffers){
           out->Add<size_t>(workSpaceSizeInBytes);
           out->Add<size_t>(reserveSpaceSizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetMultiHeadAttnBuffers Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetMultiHeadAttnBuffers Executed");
     //cout << " DEBUG - cudnnGetMultiHeadAttnBuffers Executed"<<endl;
     return std::make_shared<Result>(cs, out); 
 }
 
 CUDNN_ROUTINE_HANDLER(GetMultiHeadAttnWeights){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetMultiHeadAttnWeights"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetMultiHeadAttnWeights"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnAttnDescriptor_t attnDesc = (cudnnAttnDescriptor_t)in->Get<long long int>();
@@ -5601,17 +5658,17 @@ CUDNN_ROUTINE_HANDLER(GetMultiHeadAttnWeights){
           out->Add<cudnnTensorDescriptor_t>(wDesc);
           out->Add<void>(wAddr);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetMultiHeadAttnWeights Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetMultiHeadAttnWeights Executed");
     //cout << " DEBUG - cudnnGetMultiHeadAttnWeights Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(MultiHeadAttnForward){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MultiHeadAttnForward"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MultiHeadAttnForward"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnAttnDescriptor_t attnDesc = (cudnnAttnDescriptor_t)in->Get<long long int>();
@@ -5644,17 +5701,17 @@ CUDNN_ROUTINE_HANDLER(MultiHeadAttnForward){
           out->Add<void>(workSpace);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnMultiHeadAttnForward Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnMultiHeadAttnForward Executed");
     //cout << " DEBUG - cudnnMultiHeadAttnForward Executed"<<endl;
     return std::make_shared<Result>(cs, out);     
 }
 
 CUDNN_ROUTINE_HANDLER(MultiHeadAttnBackwardData){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MultiHeadAttnBackwardData"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MultiHeadAttnBackwardData"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnAttnDescriptor_t attnDesc = (cudnnAttnDescriptor_t)in->Get<long long int>();
@@ -5690,17 +5747,17 @@ CUDNN_ROUTINE_HANDLER(MultiHeadAttnBackwardData){
           out->Add<void>(workSpace);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnMultiHeadAttnBackwardData Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnMultiHeadAttnBackwardData Executed");
     //cout << " DEBUG - cudnnMultiHeadAttnBackwardData Executed"<<endl;
     return std::make_shared<Result>(cs, out);        
 }
 
 CUDNN_ROUTINE_HANDLER(MultiHeadAttnBackwardWeights){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MultiHeadAttnBackwardWeights"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MultiHeadAttnBackwardWeights"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnAttnDescriptor_t attnDesc = (cudnnAttnDescriptor_t)in->Get<long long int>();
@@ -5729,17 +5786,17 @@ CUDNN_ROUTINE_HANDLER(MultiHeadAttnBackwardWeights){
           out->Add<void>(workSpace);
           out->Add<void>(reserveSpace);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
       
-    LOG4CPLUS_DEBUG(logger, "cudnnMultiHeadAttnBackwardWeights Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnMultiHeadAttnBackwardWeights Executed");
     //cout << " DEBUG - cudnnMultiHeadAttnBackwardWeights Executed"<<endl;
     return std::make_shared<Result>(cs, out);  
 }
 
 CUDNN_ROUTINE_HANDLER(CreateCTCLossDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateCTCLossDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateCTCLossDescriptor"));
 
     cudnnCTCLossDescriptor_t ctcLossDesc;
     
@@ -5749,17 +5806,17 @@ CUDNN_ROUTINE_HANDLER(CreateCTCLossDescriptor){
       try{
           out->Add<cudnnCTCLossDescriptor_t>(ctcLossDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnCreateCTCLossDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCreateCTCLossDescriptor Executed");
     //cout << " DEBUG - cudnnCreateCTCLossDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetCTCLossDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetCTCLossDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetCTCLossDescriptor"));
 
     cudnnCTCLossDescriptor_t ctcLossDesc;
     cudnnDataType_t compType = (cudnnDataType_t)in->Get<long long int>();
@@ -5770,17 +5827,17 @@ CUDNN_ROUTINE_HANDLER(SetCTCLossDescriptor){
       try{
           out->Add<cudnnCTCLossDescriptor_t>(ctcLossDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, " cudnnSetCTCLossDescriptor Executed");
+    GVIRTUS_LOG_DEBUG(logger, " cudnnSetCTCLossDescriptor Executed");
     //cout << " DEBUG - cudnnSetCTCLossDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SetCTCLossDescriptorEx){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetCTCLossDescriptorEx"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetCTCLossDescriptorEx"));
 
     cudnnCTCLossDescriptor_t ctcLossDesc;
     cudnnDataType_t compType = in->Get<cudnnDataType_t>();
@@ -5793,17 +5850,17 @@ CUDNN_ROUTINE_HANDLER(SetCTCLossDescriptorEx){
       try{
           out->Add<cudnnCTCLossDescriptor_t>(ctcLossDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetCTCLossDescriptorEx Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetCTCLossDescriptorEx Executed");
     //cout << " DEBUG - cudnnSetCTCLossDescriptorEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetCTCLossDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCTCLossDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCTCLossDescriptor"));
 
      cudnnCTCLossDescriptor_t ctcLossDesc = (cudnnCTCLossDescriptor_t)in->Get<long long int>();
      cudnnDataType_t compType;
@@ -5814,17 +5871,17 @@ CUDNN_ROUTINE_HANDLER(GetCTCLossDescriptor){
       try{
           out->Add<cudnnDataType_t>(compType);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnGetCTCLossDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetCTCLossDescriptor Executed");
     //cout << " DEBUG - cudnnGetCTCLossDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetCTCLossDescriptorEx){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCTCLossDescriptorEx"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCTCLossDescriptorEx"));
 
      cudnnCTCLossDescriptor_t ctcLossDesc = (cudnnCTCLossDescriptor_t)in->Get<long long int>();
      cudnnDataType_t compType;
@@ -5839,31 +5896,31 @@ CUDNN_ROUTINE_HANDLER(GetCTCLossDescriptorEx){
           out->Add<cudnnLossNormalizationMode_t>(normMode);
           out->Add<cudnnNanPropagation_t>(gradMode);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
 
-     LOG4CPLUS_DEBUG(logger, "cudnnGetCTCLossDescriptorEx Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetCTCLossDescriptorEx Executed");
      //cout << " DEBUG - cudnnGetCTCLossDescriptorEx Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyCTCLossDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyCTCLossDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyCTCLossDescriptor"));
 
      cudnnCTCLossDescriptor_t ctcLossDesc = in->Get<cudnnCTCLossDescriptor_t>();
 
      cudnnStatus_t cs = cudnnDestroyCTCLossDescriptor(ctcLossDesc);
 
      
-     LOG4CPLUS_DEBUG(logger, "cudnnGetCTCLossDescriptorEx Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetCTCLossDescriptorEx Executed");
      //cout << " DEBUG - cudnnDestroyCTCLossDescriptor Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(CTCLoss){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CTCLoss"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CTCLoss"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnTensorDescriptor_t probsDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -5886,17 +5943,17 @@ CUDNN_ROUTINE_HANDLER(CTCLoss){
           out->Add<void>(costs);
           out->Add<void>(gradients);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
      
-    LOG4CPLUS_DEBUG(logger, "cudnnCTCLoss Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCTCLoss Executed");
     //cout << " DEBUG - cudnnCTCLoss Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetCTCLossWorkspaceSize){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCTCLossWorkspaceSize"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCTCLossWorkspaceSize"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnTensorDescriptor_t probsDesc = (cudnnTensorDescriptor_t)in->Get<long long int>();
@@ -5914,17 +5971,17 @@ CUDNN_ROUTINE_HANDLER(GetCTCLossWorkspaceSize){
       try{
           out->Add<size_t>(sizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
      
-     LOG4CPLUS_DEBUG(logger, "cudnnGetCTCLossWorkspaceSize Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetCTCLossWorkspaceSize Executed");
     //cout << " DEBUG - cudnnGetCTCLossWorkspaceSize Executed"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(CreateAlgorithmDescriptor){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateAlgorithmDescriptor"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateAlgorithmDescriptor"));
 
     cudnnAlgorithmDescriptor_t algoDesc;
 
@@ -5934,17 +5991,17 @@ CUDNN_ROUTINE_HANDLER(CreateAlgorithmDescriptor){
       try{
           out->Add<cudnnAlgorithmDescriptor_t>(algoDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
      
-     LOG4CPLUS_DEBUG(logger, "cudnnCreateAlgorithmDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreateAlgorithmDescriptor Executed");
     //cout << " DEBUG - cudnnCreateAlgorithmDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(	SetAlgorithmDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetAlgorithmDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetAlgorithmDescriptor"));
 
      cudnnAlgorithmDescriptor_t algoDesc = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
      cudnnAlgorithm_t algorithm = in->Get<cudnnAlgorithm_t>();
@@ -5955,30 +6012,30 @@ CUDNN_ROUTINE_HANDLER(	SetAlgorithmDescriptor){
       try{
           out->Add<cudnnAlgorithmDescriptor_t>(algoDesc);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetAlgorithmDescriptor Executed"); 
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetAlgorithmDescriptor Executed"); 
     //cout << " DEBUG - cudnnSetAlgorithmDescriptor Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(GetAlgorithmDescriptor){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAlgorithmDescriptor"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAlgorithmDescriptor"));
 
      cudnnAlgorithmDescriptor_t algoDesc = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
      cudnnAlgorithm_t algorithm = in->Get<cudnnAlgorithm_t>();
      
      cudnnStatus_t cs = cudnnGetAlgorithmDescriptor(algoDesc, &algorithm);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnGetAlgorithmDescriptor Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnGetAlgorithmDescriptor Executed");
      //cout << " DEBUG - cudnnGetAlgorithmDescriptor Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(CopyAlgorithmDescriptor){
-      Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CopyAlgorithmDescriptor"));
+      static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CopyAlgorithmDescriptor"));
 
       cudnnAlgorithmDescriptor_t src = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
       cudnnAlgorithmDescriptor_t dest = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
@@ -5986,26 +6043,26 @@ CUDNN_ROUTINE_HANDLER(CopyAlgorithmDescriptor){
       cudnnStatus_t cs = cudnnCopyAlgorithmDescriptor(src, dest);
 
       
-      LOG4CPLUS_DEBUG(logger, "cudnnCopyAlgorithmDescriptor Executed");
+      GVIRTUS_LOG_DEBUG(logger, "cudnnCopyAlgorithmDescriptor Executed");
       //cout << " DEBUG - cudnnCopyAlgorithmDescriptor Executed"<<endl;
       return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(	DestroyAlgorithmDescriptor){
-      Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyAlgorithmDescriptor"));
+      static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyAlgorithmDescriptor"));
 
       cudnnAlgorithmDescriptor_t algoDesc = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
       
       cudnnStatus_t cs = cudnnDestroyAlgorithmDescriptor(algoDesc);
 
       
-       LOG4CPLUS_DEBUG(logger, "cudnnDestroyAlgorithmDescriptor Executed");
+       GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyAlgorithmDescriptor Executed");
       //cout << " DEBUG - cudnnDestroyAlgorithmDescriptor Executed"<<endl;
       return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateAlgorithmPerformance){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateAlgorithmPerformance"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateAlgorithmPerformance"));
 
      cudnnAlgorithmPerformance_t algoPerf;
      int numberToCreate = in->Get<int>();
@@ -6013,13 +6070,13 @@ CUDNN_ROUTINE_HANDLER(CreateAlgorithmPerformance){
      cudnnStatus_t cs = cudnnCreateAlgorithmPerformance(&algoPerf, numberToCreate);
     
      
-      LOG4CPLUS_DEBUG(logger, "cudnnCreateAlgorithmPerformance Executed");
+      GVIRTUS_LOG_DEBUG(logger, "cudnnCreateAlgorithmPerformance Executed");
      //cout << " DEBUG - cudnnCreateAlgorithmPerformance Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetAlgorithmPerformance){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetAlgorithmPerformance"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetAlgorithmPerformance"));
 
      cudnnAlgorithmPerformance_t algoPerf = (cudnnAlgorithmPerformance_t)in->Get<long long int>();
      cudnnAlgorithmDescriptor_t algoDesc = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
@@ -6033,17 +6090,17 @@ CUDNN_ROUTINE_HANDLER(SetAlgorithmPerformance){
       try{
           out->Add<cudnnAlgorithmPerformance_t>(algoPerf);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
      
-     LOG4CPLUS_DEBUG(logger, "cudnnSetAlgorithmPerformance Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetAlgorithmPerformance Executed");
     //cout << " DEBUG - cudnnSetAlgorithmPerformance Executed"<<endl;
     return std::make_shared<Result>(cs, out);    
 }
 
 CUDNN_ROUTINE_HANDLER(GetAlgorithmPerformance){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAlgorithmPerformance"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAlgorithmPerformance"));
 
     cudnnAlgorithmPerformance_t algoPerf = (cudnnAlgorithmPerformance_t)in->Get<long long int>();
     cudnnAlgorithmDescriptor_t algoDesc;
@@ -6061,17 +6118,17 @@ CUDNN_ROUTINE_HANDLER(GetAlgorithmPerformance){
           out->Add<float>(time);
           out->Add<size_t>(memory);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetAlgorithmPerformance Executed"); 
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetAlgorithmPerformance Executed"); 
     //cout << " DEBUG - cudnnGetAlgorithmPerformance Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyAlgorithmPerformance){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyAlgorithmPerformance"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyAlgorithmPerformance"));
 
      cudnnAlgorithmPerformance_t algoPerf = (cudnnAlgorithmPerformance_t)in->Get<long long int>();
      int numberToDestroy = in->Get<int>();
@@ -6079,13 +6136,13 @@ CUDNN_ROUTINE_HANDLER(DestroyAlgorithmPerformance){
       cudnnStatus_t cs = cudnnDestroyAlgorithmPerformance(&algoPerf, numberToDestroy);
 
       
-      LOG4CPLUS_DEBUG(logger, "cudnnDestroyAlgorithmPerformance Executed");
+      GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyAlgorithmPerformance Executed");
       //cout << " DEBUG - cudnnDestroyAlgorithmPerformance Executed"<<endl;
       return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetAlgorithmSpaceSize){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAlgorithmSpaceSize"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetAlgorithmSpaceSize"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnAlgorithmDescriptor_t algoDesc = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
@@ -6097,17 +6154,17 @@ CUDNN_ROUTINE_HANDLER(GetAlgorithmSpaceSize){
       try{
           out->Add<size_t>(algoSpaceSizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
      
-    LOG4CPLUS_DEBUG(logger, "cudnnGetAlgorithmSpaceSize Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetAlgorithmSpaceSize Executed");
     //cout << " DEBUG - cudnnGetAlgorithmSpaceSize Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(SaveAlgorithm){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SaveAlgorithm"));  
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SaveAlgorithm"));  
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnAlgorithmDescriptor_t algoDesc = (cudnnAlgorithmDescriptor_t)in->Get<long long int>();
@@ -6116,13 +6173,13 @@ CUDNN_ROUTINE_HANDLER(SaveAlgorithm){
 
     cudnnStatus_t cs = cudnnSaveAlgorithm(handle, algoDesc, algoSpace, algoSpaceSizeInBytes);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnSaveAlgorithm Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSaveAlgorithm Executed");
     //cout << " DEBUG - cudnnSaveAlgorithm Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(RestoreAlgorithm){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RestoreAlgorithm"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("RestoreAlgorithm"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     void *algoSpace = in->Assign<void>();
@@ -6132,13 +6189,13 @@ CUDNN_ROUTINE_HANDLER(RestoreAlgorithm){
     cudnnStatus_t cs = cudnnRestoreAlgorithm(handle, algoSpace, algoSpaceSizeInBytes, algoDesc);
 
     
-     LOG4CPLUS_DEBUG(logger, "cudnnRestoreAlgorithm Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnRestoreAlgorithm Executed");
     //cout << " DEBUG - cudnnRestoreAlgorithm Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetCallback){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetCallback"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetCallback"));
 
      unsigned mask = in->Get<unsigned>();
      void *udata = in->Assign<void>();
@@ -6147,13 +6204,13 @@ CUDNN_ROUTINE_HANDLER(SetCallback){
      cudnnStatus_t cs = cudnnSetCallback(mask, udata, fptr);
 
     
-    LOG4CPLUS_DEBUG(logger, "cudnnSetCallback Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnSetCallback Executed");
     //cout << " DEBUG - cudnnSetCallback Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetCallback){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCallback"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetCallback"));
 
      unsigned mask;
      void *udata;
@@ -6167,17 +6224,17 @@ CUDNN_ROUTINE_HANDLER(GetCallback){
           out->Add<void>(udata);
           out->Add<cudnnCallback_t>(fptr);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetCallback Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetCallback Executed");
     //cout << " DEBUG - cudnnGetCallback Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateFusedOpsConstParamPack){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFusedOpsConstParamPack"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFusedOpsConstParamPack"));
 
      cudnnFusedOpsConstParamPack_t constPack = in->Get<cudnnFusedOpsConstParamPack_t>();
      cudnnFusedOps_t ops = in->Get<cudnnFusedOps_t>();
@@ -6185,25 +6242,25 @@ CUDNN_ROUTINE_HANDLER(CreateFusedOpsConstParamPack){
      cudnnStatus_t cs = cudnnCreateFusedOpsConstParamPack(&constPack, ops);
 
      
-     LOG4CPLUS_DEBUG(logger, "cudnnCreateFusedOpsConstParamPack Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreateFusedOpsConstParamPack Executed");
      //cout << " DEBUG - cudnnCreateFusedOpsConstParamPack Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyFusedOpsConstParamPack){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyFusedOpsConstParamPack"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyFusedOpsConstParamPack"));
 
      cudnnFusedOpsConstParamPack_t constPack = in->Get<cudnnFusedOpsConstParamPack_t>();
     
      cudnnStatus_t cs = cudnnDestroyFusedOpsConstParamPack(constPack);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnDestroyFusedOpsConstParamPack Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyFusedOpsConstParamPack Executed");
      //cout << " DEBUG - cudnnDestroyFusedOpsConstParamPack Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetFusedOpsConstParamPackAttribute){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFusedOpsConstParamPackAttribute"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFusedOpsConstParamPackAttribute"));
 
     cudnnFusedOpsConstParamPack_t constPack = in->Get<cudnnFusedOpsConstParamPack_t>();
     cudnnFusedOpsConstParamLabel_t paramLabel = in->Get<cudnnFusedOpsConstParamLabel_t>();
@@ -6212,13 +6269,13 @@ CUDNN_ROUTINE_HANDLER(SetFusedOpsConstParamPackAttribute){
     cudnnStatus_t cs = cudnnSetFusedOpsConstParamPackAttribute(constPack, paramLabel, param);
 
     
-     LOG4CPLUS_DEBUG(logger, "cudnnSetFusedOpsConstParamPackAttribute Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetFusedOpsConstParamPackAttribute Executed");
     //cout << " DEBUG - cudnnSetFusedOpsConstParamPackAttribute Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetFusedOpsConstParamPackAttribute){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFusedOpsConstParamPackAttribute"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFusedOpsConstParamPackAttribute"));
 
      cudnnFusedOpsConstParamPack_t constPack = in->Get<cudnnFusedOpsConstParamPack_t>();
      cudnnFusedOpsConstParamLabel_t paramLabel = in->Get<cudnnFusedOpsConstParamLabel_t>();
@@ -6231,17 +6288,17 @@ CUDNN_ROUTINE_HANDLER(GetFusedOpsConstParamPackAttribute){
       try{
           out->Add<int>(isNULL);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFusedOpsConstParamPackAttribute Executed");
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFusedOpsConstParamPackAttribute Executed");
     //cout << " DEBUG - cudnnGetFusedOpsConstParamPackAttribute Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateFusedOpsVariantParamPack){
-      Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFusedOpsVariantParamPack"));
+      static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFusedOpsVariantParamPack"));
 
       cudnnFusedOpsVariantParamPack_t varPack = in->Get<cudnnFusedOpsVariantParamPack_t>();
       cudnnFusedOps_t ops = in->Get<cudnnFusedOps_t>();
@@ -6249,26 +6306,26 @@ CUDNN_ROUTINE_HANDLER(CreateFusedOpsVariantParamPack){
       cudnnStatus_t cs = cudnnCreateFusedOpsVariantParamPack(&varPack, ops);
 
       
-       LOG4CPLUS_DEBUG(logger, "cudnnCreateFusedOpsVariantParamPack Executed");
+       GVIRTUS_LOG_DEBUG(logger, "cudnnCreateFusedOpsVariantParamPack Executed");
       //cout << " DEBUG - cudnnCreateFusedOpsVariantParamPack Executed"<<endl;
       return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(DestroyFusedOpsVariantParamPack){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyFusedOpsVariantParamPack"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyFusedOpsVariantParamPack"));
 
      cudnnFusedOpsVariantParamPack_t varPack = in->Get<cudnnFusedOpsVariantParamPack_t>();
 
      cudnnStatus_t cs = cudnnDestroyFusedOpsVariantParamPack(varPack);
 
      
-     LOG4CPLUS_DEBUG(logger, "cudnnDestroyFusedOpsVariantParamPack Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnDestroyFusedOpsVariantParamPack Executed");
      //cout << " DEBUG - cudnnDestroyFusedOpsVariantParamPack Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(SetFusedOpsVariantParamPackAttribute){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFusedOpsVariantParamPackAttribute"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetFusedOpsVariantParamPackAttribute"));
 
     cudnnFusedOpsVariantParamPack_t varPack = in->Get<cudnnFusedOpsVariantParamPack_t>();
     cudnnFusedOpsVariantParamLabel_t paramLabel = in->Get<cudnnFusedOpsVariantParamLabel_t>();
@@ -6276,13 +6333,13 @@ CUDNN_ROUTINE_HANDLER(SetFusedOpsVariantParamPackAttribute){
 
     cudnnStatus_t cs = cudnnSetFusedOpsVariantParamPackAttribute(varPack, paramLabel, ptr);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnSetFusedOpsVariantParamPackAttribute Executed");   
+     GVIRTUS_LOG_DEBUG(logger, "cudnnSetFusedOpsVariantParamPackAttribute Executed");   
     //cout << " DEBUG - cudnnSetFusedOpsVariantParamPackAttribute Executed"<<endl;
     return std::make_shared<Result>(cs);
 }
 
 CUDNN_ROUTINE_HANDLER(GetFusedOpsVariantParamPackAttribute){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFusedOpsVariantParamPackAttribute"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetFusedOpsVariantParamPackAttribute"));
 
     cudnnFusedOpsVariantParamPack_t varPack = in->Get<cudnnFusedOpsVariantParamPack_t>();
     cudnnFusedOpsVariantParamLabel_t paramLabel = in->Get<cudnnFusedOpsVariantParamLabel_t>();
@@ -6294,44 +6351,44 @@ CUDNN_ROUTINE_HANDLER(GetFusedOpsVariantParamPackAttribute){
       try{
           out->Add<void>(ptr);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-    LOG4CPLUS_DEBUG(logger, "cudnnGetFusedOpsVariantParamPackAttribute Executed");   
+    GVIRTUS_LOG_DEBUG(logger, "cudnnGetFusedOpsVariantParamPackAttribute Executed");   
     //cout << " DEBUG - cudnnGetFusedOpsVariantParamPackAttribute Executed"<<endl;
     return std::make_shared<Result>(cs, out);
 }
 
 CUDNN_ROUTINE_HANDLER(CreateFusedOpsPlan){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFusedOpsPlan"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateFusedOpsPlan"));
 
      cudnnFusedOpsPlan_t plan = in->Get<cudnnFusedOpsPlan_t>();
      cudnnFusedOps_t ops = in->Get<cudnnFusedOps_t>();
 
      cudnnStatus_t cs = cudnnCreateFusedOpsPlan(&plan, ops);
 
-     LOG4CPLUS_DEBUG(logger, "cudnnCreateFusedOpsPlan Executed");    
+     GVIRTUS_LOG_DEBUG(logger, "cudnnCreateFusedOpsPlan Executed");    
      //cout << " DEBUG - cudnnCreateFusedOpsPlan Executed"<<endl;
      return std::make_shared<Result>(cs);
 }
 
 
 CUDNN_ROUTINE_HANDLER(DestroyFusedOpsPlan){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyFusedOpsPlan"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DestroyFusedOpsPlan"));
 
      cudnnFusedOpsPlan_t plan = in->Get<cudnnFusedOpsPlan_t>();
  
     cudnnStatus_t cs = cudnnDestroyFusedOpsPlan(plan);
 
     
-    LOG4CPLUS_DEBUG(logger, "cudnnCreateFusedOpsPlan Executed"); 
+    GVIRTUS_LOG_DEBUG(logger, "cudnnCreateFusedOpsPlan Executed"); 
     //cout << " DEBUG - cudnnCreateFusedOpsPlan Executed"<<endl;
     return std::make_shared<Result>(cs);   
 }
 
 CUDNN_ROUTINE_HANDLER(MakeFusedOpsPlan){
-     Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MakeFusedOpsPlan"));
+     static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MakeFusedOpsPlan"));
 
      cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
      cudnnFusedOpsPlan_t plan = in->Get<cudnnFusedOpsPlan_t>();
@@ -6344,17 +6401,17 @@ CUDNN_ROUTINE_HANDLER(MakeFusedOpsPlan){
       try{
           out->Add<size_t>(workspaceSizeInBytes);
     } catch(string e){
-         LOG4CPLUS_DEBUG(logger, e);
+         GVIRTUS_LOG_DEBUG(logger, e);
          return std::make_shared<Result>(cs);
     }
     
-     LOG4CPLUS_DEBUG(logger, "cudnnMakeFusedOpsPlan Executed");
+     GVIRTUS_LOG_DEBUG(logger, "cudnnMakeFusedOpsPlan Executed");
     //cout << " DEBUG - cudnnMakeFusedOpsPlan Executed"<<endl;
     return std::make_shared<Result>(cs, out);   
 }
 
 CUDNN_ROUTINE_HANDLER(FusedOpsExecute){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FusedOpsExecute"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("FusedOpsExecute"));
 
     cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
     cudnnFusedOpsPlan_t plan = in->Get<cudnnFusedOpsPlan_t>();
@@ -6362,13 +6419,101 @@ CUDNN_ROUTINE_HANDLER(FusedOpsExecute){
 
     cudnnStatus_t cs = cudnnFusedOpsExecute(handle, plan, varPack);
 
-    LOG4CPLUS_DEBUG(logger, "cudnnFusedOpsExecute Executed"); 
+    GVIRTUS_LOG_DEBUG(logger, "cudnnFusedOpsExecute Executed"); 
     //cout << " DEBUG - cudnnFusedOpsExecute Executed"<<endl;
     return std::make_shared<Result>(cs);   
 }
+
+/*
+ * A request whose descriptors are frontend shadows (see DescriptorShadow in
+ * the frontend): creates the descriptors the frontend has no handle for,
+ * applies the Set calls it kept, writes the handles where the arguments
+ * carry shadows and runs the request. The reply starts with the handles, so
+ * the frontend can send them in place of the shadows from then on.
+ */
+CUDNN_ROUTINE_HANDLER(ShadowBatch){
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("ShadowBatch"));
+
+    struct Shadow {
+        long long int shadow;
+        long long int handle;
+        int applied;
+    };
+    std::vector<Shadow> shadows;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    cudnnStatus_t cs = CUDNN_STATUS_SUCCESS;
+    try {
+        size_t count = in->Get<size_t>();
+        for (size_t i = 0; i < count && cs == CUDNN_STATUS_SUCCESS; i++) {
+            long long int shadow = in->Get<long long int>();
+            long long int handle = in->Get<long long int>();
+            char *create = in->AssignString();
+            size_t calls = in->Get<size_t>();
+            if (handle == 0) {
+                std::shared_ptr<Result> created = pThis->Execute(create, std::make_shared<Buffer>());
+                cs = created == NULL ? CUDNN_STATUS_EXECUTION_FAILED : (cudnnStatus_t)created->GetExitCode();
+                if (cs == CUDNN_STATUS_SUCCESS && created->GetOutputBuffer() == NULL)
+                    cs = CUDNN_STATUS_EXECUTION_FAILED;
+                if (cs != CUDNN_STATUS_SUCCESS)
+                    break;
+                handle = created->GetOutputBuffer()->Get<long long int>();
+            }
+            for (size_t j = 0; j < calls && cs == CUDNN_STATUS_SUCCESS; j++) {
+                char *routine = in->AssignString();
+                size_t size = in->Get<size_t>();
+                char *arguments = in->Assign<char>(size);
+                /* the descriptor is the first argument of a Set call */
+                memcpy(arguments, &handle, sizeof(handle));
+                std::shared_ptr<Result> set = pThis->Execute(routine, std::make_shared<Buffer>(arguments, size));
+                cs = set == NULL ? CUDNN_STATUS_EXECUTION_FAILED : (cudnnStatus_t)set->GetExitCode();
+            }
+            shadows.push_back({shadow, handle, cs == CUDNN_STATUS_SUCCESS});
+        }
+
+        out->Add(shadows.size());
+        for (auto &shadow : shadows) {
+            out->Add(shadow.shadow);
+            out->Add(shadow.handle);
+            out->Add(shadow.applied);
+        }
+        if (cs != CUDNN_STATUS_SUCCESS) {
+            out->Add((size_t)0);
+            return std::make_shared<Result>(cs, out);
+        }
+
+        char *routine = in->AssignString();
+        std::vector<std::pair<size_t, long long int>> fixups(in->Get<size_t>());
+        for (auto &fixup : fixups) {
+            fixup.first = in->Get<size_t>();
+            fixup.second = in->Get<long long int>();
+        }
+        size_t size = in->Get<size_t>();
+        char *arguments = in->Assign<char>(size);
+        for (auto &fixup : fixups)
+            for (auto &shadow : shadows)
+                if (shadow.shadow == fixup.second && fixup.first + sizeof(long long int) <= size)
+                    memcpy(arguments + fixup.first, &shadow.handle, sizeof(shadow.handle));
+
+        std::shared_ptr<Result> result = pThis->Execute(routine, std::make_shared<Buffer>(arguments, size));
+        if (result == NULL) {
+            out->Add((size_t)0);
+            return std::make_shared<Result>(CUDNN_STATUS_EXECUTION_FAILED, out);
+        }
+        std::shared_ptr<Buffer> output = result->GetOutputBuffer();
+        if (output == NULL)
+            out->Add((size_t)0);
+        else
+            out->Add(output->GetBuffer(), output->GetBufferSize());
+        GVIRTUS_LOG_DEBUG(logger, "cudnnShadowBatch Executed " << routine << " with " << shadows.size() << " descriptors");
+        return std::make_shared<Result>(result->GetExitCode(), out);
+    } catch (string e) {
+        GVIRTUS_LOG_DEBUG(logger, e);
+        return std::make_shared<Result>(CUDNN_STATUS_EXECUTION_FAILED);
+    }
+}
 /*
 CUDNN_ROUTINE_HANDLER(SetRNNDescriptor_v6){
-   Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v6"));
+   static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetRNNDescriptor_v6"));
 
    cudnnHandle_t handle = (cudnnHandle_t)in->Get<long long int>();
    cudnnRNNDescriptor_t rnnDesc = (cudnnRNNDescriptor_t)in->Get<long long int>(); //INPUT/OUTPUT
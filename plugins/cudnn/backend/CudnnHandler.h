@@ -128,6 +128,7 @@ CUDNN_ROUTINE_HANDLER(GetConvolution2dForwardOutputDim);
 #define CUDNNHANDLER_H
 
 #include <gvirtus/backend/Handler.h>
+#include <gvirtus/common/Log.h>
 #include <gvirtus/communicators/Result.h>
 
 #include <cudnn.h>
@@ -428,5 +429,8 @@ CUDNN_ROUTINE_HANDLER(DestroyFusedOpsPlan);
 CUDNN_ROUTINE_HANDLER(MakeFusedOpsPlan);
 CUDNN_ROUTINE_HANDLER(FusedOpsExecute);
 
+/* frontend descriptor shadows */
+CUDNN_ROUTINE_HANDLER(ShadowBatch);
+
 
 #endif  /* CUDNNHANDLER_H */
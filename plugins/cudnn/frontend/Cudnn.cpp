@@ -83,6 +83,10 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetStream(cudnnHandle_t handle, cudaSt
 }
 */
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnCreateTensorDescriptor(cudnnTensorDescriptor_t *tensorDesc){
+    if (DescriptorShadow::IsEnabled()) {
+        *tensorDesc = (cudnnTensorDescriptor_t)DescriptorShadow::Create("cudnnCreateTensorDescriptor");
+        return CUDNN_STATUS_SUCCESS;
+    }
     CudnnFrontend::Prepare();
 
     CudnnFrontend::Execute("cudnnCreateTensorDescriptor");
@@ -109,6 +113,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetTensor4dDescriptor( cudnnTensorDesc
     CudnnFrontend::AddVariableForArguments<int>(h);
     CudnnFrontend::AddVariableForArguments<int>(w);
 
+    if (DescriptorShadow::Record((uint64_t)tensorDesc, "cudnnSetTensor4dDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetTensor4dDescriptor");
     if(CudnnFrontend::Success()){
         tensorDesc = CudnnFrontend::GetOutputVariable<cudnnTensorDescriptor_t>();
@@ -140,7 +146,9 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetTensor4dDescriptorEx( cudnnTensorDe
     CudnnFrontend::AddVariableForArguments<int>(hStride);
     CudnnFrontend::AddVariableForArguments<int>(wStride);
 
-    CudnnFrontend::Execute("SetTensor4dDescriptorEx");
+    if (DescriptorShadow::Record((uint64_t)tensorDesc, "cudnnSetTensor4dDescriptorEx"))
+        return CUDNN_STATUS_SUCCESS;
+    CudnnFrontend::Execute("cudnnSetTensor4dDescriptorEx");
     if(CudnnFrontend::Success()){
         tensorDesc = CudnnFrontend::GetOutputVariable<cudnnTensorDescriptor_t>();
     }
@@ -190,6 +198,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetTensorNdDescriptor( cudnnTensorDesc
     CudnnFrontend::AddHostPointerForArguments<int>((int*)dimA);
     CudnnFrontend::AddHostPointerForArguments<int>((int*)strideA);
 
+    if (DescriptorShadow::Record((uint64_t)tensorDesc, "cudnnSetTensorNdDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetTensorNdDescriptor");
     if(CudnnFrontend::Success()){
          tensorDesc = CudnnFrontend::GetOutputVariable<cudnnTensorDescriptor_t>();
@@ -239,6 +249,11 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetTensorNdDescriptor(const cudnnTenso
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetTensorSizeInBytes(const cudnnTensorDescriptor_t tensorDesc,
                                                                size_t *size){
 
+    CudnnQueryCache::Key key("cudnnGetTensorSizeInBytes");
+    key.Descriptor(tensorDesc);
+    if (CudnnQueryCache::Get(key, size, sizeof(*size)))
+        return CUDNN_STATUS_SUCCESS;
+
     CudnnFrontend::Prepare();
 
     CudnnFrontend::AddVariableForArguments<long long int>((long long int)tensorDesc);
@@ -246,11 +261,15 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetTensorSizeInBytes(const cudnnTensor
     CudnnFrontend::Execute("cudnnGetTensorSizeInBytes");
     if(CudnnFrontend::Success()){
        *size = CudnnFrontend::GetOutputVariable<size_t>();
+       CudnnQueryCache::Put(key, size, sizeof(*size));
     }
     return CudnnFrontend::GetExitCode();
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnDestroyTensorDescriptor(cudnnTensorDescriptor_t tensorDesc){
+    if (DescriptorShadow::IsShadow((uint64_t)tensorDesc))
+        return DescriptorShadow::Destroy((uint64_t)tensorDesc, "cudnnDestroyTensorDescriptor");
+
     CudnnFrontend::Prepare();
 
     CudnnFrontend::AddVariableForArguments<long long int>((long long int) tensorDesc);
@@ -716,6 +735,10 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnScaleTensor( cudnnHandle_t
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnCreateFilterDescriptor(cudnnFilterDescriptor_t *filterDesc){
+    if (DescriptorShadow::IsEnabled()) {
+        *filterDesc = (cudnnFilterDescriptor_t)DescriptorShadow::Create("cudnnCreateFilterDescriptor");
+        return CUDNN_STATUS_SUCCESS;
+    }
     CudnnFrontend::Prepare();
 
     CudnnFrontend::Execute("cudnnCreateFilterDescriptor");
@@ -741,6 +764,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetFilter4dDescriptor( cudnnFilterDesc
     CudnnFrontend::AddVariableForArguments<int>(h);
     CudnnFrontend::AddVariableForArguments<int>(w);
 
+    if (DescriptorShadow::Record((uint64_t)filterDesc, "cudnnSetFilter4dDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetFilter4dDescriptor");
     if(CudnnFrontend::Success()){
         filterDesc = CudnnFrontend::GetOutputVariable<cudnnFilterDescriptor_t>();
@@ -788,6 +813,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetFilter4dDescriptor_v3( cudnnFilterD
     CudnnFrontend::AddVariableForArguments<int>(h);
     CudnnFrontend::AddVariableForArguments<int>(w);
 
+    if (DescriptorShadow::Record((uint64_t)filterDesc, "cudnnSetFilter4dDescriptor_v3"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetFilter4dDescriptor_v3");
 
     return CudnnFrontend::GetExitCode();
@@ -831,6 +858,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetFilter4dDescriptor_v4( cudnnFilterD
     CudnnFrontend::AddVariableForArguments<int>(h);
     CudnnFrontend::AddVariableForArguments<int>(w);
 
+    if (DescriptorShadow::Record((uint64_t)filterDesc, "cudnnSetFilter4dDescriptor_v4"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetFilter4dDescriptor_v4");
 
     return CudnnFrontend::GetExitCode();
@@ -876,6 +905,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetFilterNdDescriptor( cudnnFilterDesc
     CudnnFrontend::AddVariableForArguments<int>(nbDims);
     CudnnFrontend::AddHostPointerForArguments<int>((int *)filterDimA);
 
+    if (DescriptorShadow::Record((uint64_t)filterDesc, "cudnnSetFilterNdDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetFilterNdDescriptor");
     if(CudnnFrontend::Success())
         filterDesc = (cudnnFilterDescriptor_t) CudnnFrontend::GetOutputVariable<long long int>();
@@ -918,6 +949,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetFilterNdDescriptor_v3( cudnnFilterD
     CudnnFrontend::AddVariableForArguments<int>(nbDims);
     CudnnFrontend::AddHostPointerForArguments<int>((int *)filterDimA);
 
+    if (DescriptorShadow::Record((uint64_t)filterDesc, "cudnnSetFilterNdDescriptor_v3"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetFilterNdDescriptor_v3");
     if(CudnnFrontend::Success())
         filterDesc = (cudnnFilterDescriptor_t) CudnnFrontend::GetOutputVariable<long long int>();
@@ -957,6 +990,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetFilterNdDescriptor_v4( cudnnFilterD
     CudnnFrontend::AddVariableForArguments<int>(nbDims);
     CudnnFrontend::AddHostPointerForArguments<int>((int *)filterDimA);
 
+    if (DescriptorShadow::Record((uint64_t)filterDesc, "cudnnSetFilterNdDescriptor_v4"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetFilterNdDescriptor_v4");
     if(CudnnFrontend::Success())
         filterDesc = (cudnnFilterDescriptor_t) CudnnFrontend::GetOutputVariable<long long int>();
@@ -1001,6 +1036,9 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetFilterSizeInBytes(const cudnnFilter
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnDestroyFilterDescriptor(cudnnFilterDescriptor_t filterDesc){
+    if (DescriptorShadow::IsShadow((uint64_t)filterDesc))
+        return DescriptorShadow::Destroy((uint64_t)filterDesc, "cudnnDestroyFilterDescriptor");
+
     CudnnFrontend::Prepare();
 
     CudnnFrontend::AddVariableForArguments<long long int>((long long int) filterDesc);
@@ -1061,6 +1099,10 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnReorderFilterAndBias(cudnnHandle_t han
 #endif
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnCreateConvolutionDescriptor(cudnnConvolutionDescriptor_t *convDesc){
+    if (DescriptorShadow::IsEnabled()) {
+        *convDesc = (cudnnConvolutionDescriptor_t)DescriptorShadow::Create("cudnnCreateConvolutionDescriptor");
+        return CUDNN_STATUS_SUCCESS;
+    }
     CudnnFrontend::Prepare();
 
     CudnnFrontend::Execute("cudnnCreateConvolutionDescriptor");
@@ -1077,6 +1119,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetConvolutionMathType(cudnnConvolutio
     CudnnFrontend::AddVariableForArguments<long long int>((long long int)convDesc);
     CudnnFrontend::AddVariableForArguments<cudnnMathType_t>(mathType);
 
+    if (DescriptorShadow::Record((uint64_t)convDesc, "cudnnSetConvolutionMathType"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetConvolutionMathType");
 
     return CudnnFrontend::GetExitCode(); 
@@ -1102,6 +1146,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetConvolutionGroupCount(cudnnConvolut
      CudnnFrontend::AddVariableForArguments<long long int>((long long int)convDesc);
      CudnnFrontend::AddVariableForArguments<int>(groupCount);
      
+     if (DescriptorShadow::Record((uint64_t)convDesc, "cudnnSetConvolutionGroupCount"))
+         return CUDNN_STATUS_SUCCESS;
      CudnnFrontend::Execute("cudnnSetConvolutionGroupCount");
      
      return CudnnFrontend::GetExitCode();
@@ -1170,6 +1216,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI  cudnnSetConvolution2dDescriptor( cudnnConv
     CudnnFrontend::AddVariableForArguments<cudnnConvolutionMode_t>(mode);
     CudnnFrontend::AddVariableForArguments<cudnnDataType_t>(computeType);
 
+    if (DescriptorShadow::Record((uint64_t)convDesc, "cudnnSetConvolution2dDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetConvolution2dDescriptor");
     if(CudnnFrontend::Success())
         convDesc = (cudnnConvolutionDescriptor_t)CudnnFrontend::GetOutputVariable<long long int>();
@@ -1246,6 +1294,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetConvolutionNdDescriptor(cudnnConvol
     CudnnFrontend::AddVariableForArguments<cudnnConvolutionMode_t>(mode);
     CudnnFrontend::AddVariableForArguments<cudnnDataType_t>(computeType);
 
+    if (DescriptorShadow::Record((uint64_t)convDesc, "cudnnSetConvolutionNdDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetConvolutionNdDescriptor");
     if(CudnnFrontend::Success()){
         convDesc = CudnnFrontend::GetOutputVariable<cudnnConvolutionDescriptor_t>();
@@ -1299,6 +1349,9 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionNdForwardOutputDim(const
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnDestroyConvolutionDescriptor(cudnnConvolutionDescriptor_t convDesc){
+    if (DescriptorShadow::IsShadow((uint64_t)convDesc))
+        return DescriptorShadow::Destroy((uint64_t)convDesc, "cudnnDestroyConvolutionDescriptor");
+
 
     CudnnFrontend::Prepare();
    
@@ -1421,6 +1474,17 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionForwardAlgorithm_v7(cudn
  									    int *returnedAlgoCount,
 								     	    cudnnConvolutionFwdAlgoPerf_t *perfResults){
 
+    struct {
+        int count;
+        cudnnConvolutionFwdAlgoPerf_t perf;
+    } answer;
+    CudnnQueryCache::Key key("cudnnGetConvolutionForwardAlgorithm_v7");
+    key.Handle(handle).Descriptor(srcDesc).Descriptor(filterDesc).Descriptor(convDesc).Descriptor(destDesc).Value(requestedAlgoCount);
+    if (CudnnQueryCache::Get(key, &answer, sizeof(answer))) {
+        *returnedAlgoCount = answer.count;
+        *perfResults = answer.perf;
+        return CUDNN_STATUS_SUCCESS;
+    }
 
     CudnnFrontend::Prepare();
    
@@ -1435,6 +1499,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionForwardAlgorithm_v7(cudn
     if(CudnnFrontend::Success()){
         *returnedAlgoCount = CudnnFrontend::GetOutputVariable<int>();
         *perfResults       = CudnnFrontend::GetOutputVariable<cudnnConvolutionFwdAlgoPerf_t>();
+        answer = {*returnedAlgoCount, *perfResults};
+        CudnnQueryCache::Put(key, &answer, sizeof(answer));
     }
     return CudnnFrontend::GetExitCode();
 }
@@ -1447,7 +1513,12 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionForwardWorkspaceSize(cud
                                                                                   const cudnnTensorDescriptor_t yDesc,
                                                                                   cudnnConvolutionFwdAlgo_t algo,
                                                                                    size_t *sizeInBytes){
-    
+
+    CudnnQueryCache::Key key("cudnnGetConvolutionForwardWorkspaceSize");
+    key.Handle(handle).Descriptor(xDesc).Descriptor(wDesc).Descriptor(convDesc).Descriptor(yDesc).Value(algo);
+    if (CudnnQueryCache::Get(key, sizeInBytes, sizeof(*sizeInBytes)))
+        return CUDNN_STATUS_SUCCESS;
+
     CudnnFrontend::Prepare();
    
     CudnnFrontend::AddVariableForArguments<long long int>((long long int)handle);
@@ -1460,6 +1531,7 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionForwardWorkspaceSize(cud
     CudnnFrontend::Execute("cudnnGetConvolutionForwardWorkspaceSize");
     if(CudnnFrontend::Success()){
         *sizeInBytes = CudnnFrontend::GetOutputVariable<size_t>();
+        CudnnQueryCache::Put(key, sizeInBytes, sizeof(*sizeInBytes));
      }
      return CudnnFrontend::GetExitCode();
 }
@@ -1697,6 +1769,18 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardFilterAlgorithm_
                                                                                    int *returnedAlgoCount,
                                                                                    cudnnConvolutionBwdFilterAlgoPerf_t *perfResults){
 
+      struct {
+          int count;
+          cudnnConvolutionBwdFilterAlgoPerf_t perf;
+      } answer;
+      CudnnQueryCache::Key key("cudnnGetConvolutionBackwardFilterAlgorithm_v7");
+      key.Handle(handle).Descriptor(srcDesc).Descriptor(diffDesc).Descriptor(convDesc).Descriptor(gradDesc).Value(requestedAlgoCount);
+      if (CudnnQueryCache::Get(key, &answer, sizeof(answer))) {
+          *returnedAlgoCount = answer.count;
+          *perfResults = answer.perf;
+          return CUDNN_STATUS_SUCCESS;
+      }
+
       CudnnFrontend::Prepare();
 
       CudnnFrontend::AddVariableForArguments<long long int>((long long int)handle);
@@ -1710,6 +1794,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardFilterAlgorithm_
       if(CudnnFrontend::Success()){
           *returnedAlgoCount = CudnnFrontend::GetOutputVariable<int>();
           *perfResults       = CudnnFrontend::GetOutputVariable<cudnnConvolutionBwdFilterAlgoPerf_t>();
+          answer = {*returnedAlgoCount, *perfResults};
+          CudnnQueryCache::Put(key, &answer, sizeof(answer));
       }
       return CudnnFrontend::GetExitCode();
 }
@@ -1723,6 +1809,10 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardFilterWorkspaceS
                                                                                     cudnnConvolutionBwdFilterAlgo_t algo,
                                                                                     size_t *sizeInBytes){
 
+     CudnnQueryCache::Key key("cudnnGetConvolutionBackwardFilterWorkspaceSize");
+     key.Handle(handle).Descriptor(xDesc).Descriptor(dyDesc).Descriptor(convDesc).Descriptor(gradDesc).Value(algo);
+     if (CudnnQueryCache::Get(key, sizeInBytes, sizeof(*sizeInBytes)))
+         return CUDNN_STATUS_SUCCESS;
 
      CudnnFrontend::Prepare();
 
@@ -1737,6 +1827,7 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardFilterWorkspaceS
     CudnnFrontend::Execute("cudnnGetConvolutionBackwardFilterWorkspaceSize");
     if(CudnnFrontend::Success()){
       *sizeInBytes = CudnnFrontend::GetOutputVariable<size_t>();
+      CudnnQueryCache::Put(key, sizeInBytes, sizeof(*sizeInBytes));
     }
     return CudnnFrontend::GetExitCode();
 }
@@ -1893,6 +1984,18 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardDataAlgorithm_v7
 										 int *returnedAlgoCount,
 										 cudnnConvolutionBwdDataAlgoPerf_t *perfResults){
 
+     struct {
+         int count;
+         cudnnConvolutionBwdDataAlgoPerf_t perf;
+     } answer;
+     CudnnQueryCache::Key key("cudnnGetConvolutionBackwardDataAlgorithm_v7");
+     key.Handle(handle).Descriptor(filterDesc).Descriptor(diffDesc).Descriptor(convDesc).Descriptor(gradDesc).Value(requestedAlgoCount);
+     if (CudnnQueryCache::Get(key, &answer, sizeof(answer))) {
+         *returnedAlgoCount = answer.count;
+         *perfResults = answer.perf;
+         return CUDNN_STATUS_SUCCESS;
+     }
+
      CudnnFrontend::Prepare();
    
      CudnnFrontend::AddVariableForArguments<long long int>((long long int)handle);
@@ -1906,6 +2009,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardDataAlgorithm_v7
      if(CudnnFrontend::Success()){
           *returnedAlgoCount = CudnnFrontend::GetOutputVariable<int>();
           *perfResults       = CudnnFrontend::GetOutputVariable<cudnnConvolutionBwdDataAlgoPerf_t>();
+          answer = {*returnedAlgoCount, *perfResults};
+          CudnnQueryCache::Put(key, &answer, sizeof(answer));
      }
      return CudnnFrontend::GetExitCode();
 }
@@ -1919,6 +2024,10 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardDataWorkspaceSiz
 										  cudnnConvolutionBwdDataAlgo_t algo,
 										  size_t *sizeInBytes){
 
+    CudnnQueryCache::Key key("cudnnGetConvolutionBackwardDataWorkspaceSize");
+    key.Handle(handle).Descriptor(wDesc).Descriptor(dyDesc).Descriptor(convDesc).Descriptor(dxDesc).Value(algo);
+    if (CudnnQueryCache::Get(key, sizeInBytes, sizeof(*sizeInBytes)))
+        return CUDNN_STATUS_SUCCESS;
 
     CudnnFrontend::Prepare();
 
@@ -1932,6 +2041,7 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetConvolutionBackwardDataWorkspaceSiz
     CudnnFrontend::Execute("cudnnGetConvolutionBackwardDataWorkspaceSize");
     if(CudnnFrontend::Success()){
           *sizeInBytes = CudnnFrontend::GetOutputVariable<size_t>(); 
+          CudnnQueryCache::Put(key, sizeInBytes, sizeof(*sizeInBytes));
     }
     return CudnnFrontend::GetExitCode();
 }
@@ -2062,6 +2172,10 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSoftmaxBackward(cudnnHandle_t handle,
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnCreatePoolingDescriptor(cudnnPoolingDescriptor_t *poolingDesc){
+    if (DescriptorShadow::IsEnabled()) {
+        *poolingDesc = (cudnnPoolingDescriptor_t)DescriptorShadow::Create("cudnnCreatePoolingDescriptor");
+        return CUDNN_STATUS_SUCCESS;
+    }
    CudnnFrontend::Prepare();
 
    CudnnFrontend::Execute("cudnnCreatePoolingDescriptor");
@@ -2091,6 +2205,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetPooling2dDescriptor(cudnnPoolingDes
    CudnnFrontend::AddVariableForArguments<int>(verticalStride);
    CudnnFrontend::AddVariableForArguments<int>(horizontalStride);
 
+   if (DescriptorShadow::Record((uint64_t)poolingDesc, "cudnnSetPooling2dDescriptor"))
+       return CUDNN_STATUS_SUCCESS;
    CudnnFrontend::Execute("cudnnSetPooling2dDescriptor");
 
    if(CudnnFrontend::Success()){
@@ -2145,6 +2261,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetPoolingNdDescriptor(cudnnPoolingDes
     CudnnFrontend::AddHostPointerForArguments<int>((int*)paddingA);
     CudnnFrontend::AddHostPointerForArguments<int>((int*)strideA);
 
+    if (DescriptorShadow::Record((uint64_t)poolingDesc, "cudnnSetPoolingNdDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetPoolingNdDescriptor");
     if(CudnnFrontend::Success()){
        poolingDesc = CudnnFrontend::GetOutputVariable<cudnnPoolingDescriptor_t>();
@@ -2219,6 +2337,9 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetPooling2dForwardOutputDim(const cud
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnDestroyPoolingDescriptor(cudnnPoolingDescriptor_t poolingDesc){
+    if (DescriptorShadow::IsShadow((uint64_t)poolingDesc))
+        return DescriptorShadow::Destroy((uint64_t)poolingDesc, "cudnnDestroyPoolingDescriptor");
+
 
     CudnnFrontend::Prepare();
     
@@ -2296,6 +2417,10 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnPoolingBackward(cudnnHandle_t handle,
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnCreateActivationDescriptor(cudnnActivationDescriptor_t *activationDesc){
+    if (DescriptorShadow::IsEnabled()) {
+        *activationDesc = (cudnnActivationDescriptor_t)DescriptorShadow::Create("cudnnCreateActivationDescriptor");
+        return CUDNN_STATUS_SUCCESS;
+    }
    CudnnFrontend::Prepare();
 
    CudnnFrontend::Execute("cudnnCreateActivationDescriptor");
@@ -2313,6 +2438,8 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnSetActivationDescriptor(cudnnActivatio
     CudnnFrontend::AddVariableForArguments<cudnnActivationMode_t>(mode);
     CudnnFrontend::AddVariableForArguments<cudnnNanPropagation_t>(reluNanOpt);
     CudnnFrontend::AddVariableForArguments<double>(coef);
+    if (DescriptorShadow::Record((uint64_t)activationDesc, "cudnnSetActivationDescriptor"))
+        return CUDNN_STATUS_SUCCESS;
     CudnnFrontend::Execute("cudnnSetActivationDescriptor");
 
     if(CudnnFrontend::Success()){
@@ -2337,6 +2464,9 @@ extern "C" cudnnStatus_t CUDNNWINAPI cudnnGetActivationDescriptor(const cudnnAct
 }
 
 extern "C" cudnnStatus_t CUDNNWINAPI cudnnDestroyActivationDescriptor(cudnnActivationDescriptor_t activationDesc){
+    if (DescriptorShadow::IsShadow((uint64_t)activationDesc))
+        return DescriptorShadow::Destroy((uint64_t)activationDesc, "cudnnDestroyActivationDescriptor");
+
     CudnnFrontend::Prepare();
     CudnnFrontend::AddVariableForArguments<long long int>((long long int)activationDesc);
     CudnnFrontend::Execute("cudnnDestroyActivationDescriptor");
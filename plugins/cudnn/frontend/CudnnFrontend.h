@@ -30,11 +30,15 @@
 #include <stack>
 #include <list>
 #include <iostream>
+#include <type_traits>
 
 #include <cudnn.h>
 
 #include <gvirtus/frontend/Frontend.h>
 
+#include "CudnnQueryCache.h"
+#include "DescriptorShadow.h"
+
 using gvirtus::communicators::Buffer;
 using gvirtus::frontend::Frontend;
 
@@ -46,7 +50,10 @@ typedef struct __configureFunction{
 class CudnnFrontend {
 public:
     static inline void Execute(const char * routine, const Buffer * input_buffer = NULL) {
-        Frontend::GetFrontend()->Execute(routine, input_buffer);
+        if (input_buffer == NULL && DescriptorShadow::IsPending())
+            DescriptorShadow::Execute(routine);
+        else
+            Frontend::GetFrontend()->Execute(routine, input_buffer);
     }
 
     /**
@@ -56,6 +63,7 @@ public:
      */
     static inline void Prepare() {
         Frontend::GetFrontend()->Prepare();
+        DescriptorShadow::Prepare();
     }
 
     static inline Buffer *GetLaunchBuffer() {
@@ -69,7 +77,12 @@ public:
      * @param var the variable to add as a parameter.
      */
     template <class T> static inline void AddVariableForArguments(T var) {
-        Frontend::GetFrontend()->GetInputBuffer()->Add(var);
+        Buffer *input = Frontend::GetFrontend()->GetInputBuffer();
+        /* descriptors are sent as long long int */
+        if constexpr (std::is_integral<T>::value && sizeof(T) == sizeof(uint64_t))
+            if (DescriptorShadow::IsShadow((uint64_t) var))
+                var = (T) DescriptorShadow::Use((uint64_t) var, input->GetBufferSize());
+        input->Add(var);
     }
 
     /**
@@ -92,7 +105,16 @@ public:
      * @param n the length of the array, if ptr is an array.
      */
     template <class T>static inline void AddHostPointerForArguments(T *ptr, size_t n = 1) {
-        Frontend::GetFrontend()->GetInputBuffer()->Add(ptr, n);
+        Buffer *input = Frontend::GetFrontend()->GetInputBuffer();
+        size_t offset = input->GetBufferSize() + sizeof(size_t);
+        input->Add(ptr, n);
+        /* arrays of descriptors */
+        if constexpr (std::is_pointer<T>::value)
+            for (size_t i = 0; ptr != NULL && i < n; i++)
+                if (DescriptorShadow::IsShadow((uint64_t) ptr[i])) {
+                    uint64_t value = DescriptorShadow::Use((uint64_t) ptr[i], offset + i * sizeof(T));
+                    memcpy((char *) input->GetBuffer() + offset + i * sizeof(T), &value, sizeof(value));
+                }
     }
 
     /**
@@ -0,0 +1,109 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "CudnnQueryCache.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <iostream>
+#include <iterator>
+
+#include "CudnnFrontend.h"
+
+static bool EnvEnabled(const char *name, bool value) {
+  char *val = getenv(name);
+  if (val == NULL) return value;
+  return strcasecmp(val, "on") == 0 || strcasecmp(val, "true") == 0 ||
+         strcmp(val, "1") == 0;
+}
+
+bool CudnnQueryCache::mEnabled = EnvEnabled("GVIRTUS_QUERY_CACHE", true);
+std::mutex CudnnQueryCache::mMutex;
+std::unordered_map<std::string, CudnnQueryCache::Entry>
+    *CudnnQueryCache::mpEntries =
+        new std::unordered_map<std::string, CudnnQueryCache::Entry>();
+std::map<std::string, CudnnQueryCache::Counters> *CudnnQueryCache::mpCounters =
+    new std::map<std::string, CudnnQueryCache::Counters>();
+
+bool CudnnQueryCache::mDumping =
+    EnvEnabled("GVIRTUS_DUMP_STATS", false) && atexit(Dump) == 0;
+
+CudnnQueryCache::Key::Key(const char *routine)
+    : mRoutine(routine), mBytes(routine), mHandle(0), mValid(mEnabled) {}
+
+CudnnQueryCache::Key &CudnnQueryCache::Key::Handle(cudnnHandle_t handle) {
+  /* the same handle value may come from two backends */
+  Value(Frontend::GetFrontend()->GetBackend());
+  Value((uint64_t)handle);
+  mHandle = (uint64_t)handle;
+  return *this;
+}
+
+CudnnQueryCache::Key &CudnnQueryCache::Key::Descriptor(const void *descriptor) {
+  std::string signature;
+  if (!mValid || !DescriptorShadow::Signature((uint64_t)descriptor, &signature)) {
+    mValid = false;
+    return *this;
+  }
+  Value(signature.size());
+  mBytes.append(signature);
+  return *this;
+}
+
+bool CudnnQueryCache::Get(const Key &key, void *value, size_t size) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  Counters &counters = (*mpCounters)[key.mRoutine];
+  auto it = key.mValid ? mpEntries->find(key.mBytes) : mpEntries->end();
+  if (it == mpEntries->end() || it->second.value.size() != size) {
+    counters.misses++;
+    return false;
+  }
+  memmove(value, it->second.value.data(), size);
+  counters.hits++;
+  return true;
+}
+
+void CudnnQueryCache::Put(const Key &key, const void *value, size_t size) {
+  if (!key.mValid) return;
+  std::lock_guard<std::mutex> lock(mMutex);
+  (*mpEntries)[key.mBytes] = {std::string((const char *)value, size),
+                              key.mHandle};
+}
+
+void CudnnQueryCache::InvalidateHandle(cudnnHandle_t handle) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  for (auto it = mpEntries->begin(); it != mpEntries->end();)
+    it = it->second.handle == (uint64_t)handle ? mpEntries->erase(it)
+                                               : std::next(it);
+}
+
+void CudnnQueryCache::Dump() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  for (auto &routine : *mpCounters) {
+    uint64_t hits = routine.second.hits, misses = routine.second.misses;
+    std::cerr << "[GVIRTUS_STATS] cuDNN query cache: " << routine.first << ": "
+              << hits << " hit(s) out of " << hits + misses << " quer(ies), "
+              << (100.0 * hits / (hits + misses)) << "% hit rate\n";
+  }
+}
@@ -0,0 +1,117 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CUDNNQUERYCACHE_H
+#define CUDNNQUERYCACHE_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cudnn.h>
+
+/**
+ * CudnnQueryCache keeps the answers of the workspace size, algorithm
+ * heuristic and tensor size queries, which depend only on the settings of
+ * the descriptors they are given and on the device.
+ *
+ * An answer is keyed by the routine, the signature of every descriptor (see
+ * DescriptorShadow::Signature()) and the other arguments, so descriptors set
+ * up alike share it whoever created them. The signature is the history of a
+ * descriptor, not its state: descriptors that end up with the same settings
+ * through different calls, e.g. a 4d tensor set with
+ * cudnnSetTensorNdDescriptor() instead of cudnnSetTensor4dDescriptor(), or
+ * the same calls in another order, have different keys. That costs a query
+ * sent again, never a wrong answer. Queries on descriptors that are not
+ * shadows are always sent. The handle stands for the device, as a cuDNN
+ * handle belongs to the device current when it was created: the answers
+ * obtained through a handle are dropped when it is destroyed.
+ *
+ * Lookups are counted by routine; with GVIRTUS_DUMP_STATS set the hit rates
+ * are printed at exit. GVIRTUS_QUERY_CACHE=0 disables the cache.
+ */
+class CudnnQueryCache {
+ public:
+  class Key {
+   public:
+    explicit Key(const char *routine);
+
+    /**
+     * Keys on the device of handle.
+     */
+    Key &Handle(cudnnHandle_t handle);
+
+    /**
+     * Keys on the settings of descriptor.
+     */
+    Key &Descriptor(const void *descriptor);
+
+    template <class T>
+    Key &Value(T value) {
+      mBytes.append((const char *)&value, sizeof(value));
+      return *this;
+    }
+
+   private:
+    friend class CudnnQueryCache;
+
+    const char *mRoutine;
+    std::string mBytes;
+    uint64_t mHandle;
+    bool mValid;
+  };
+
+  /**
+   * Copies the answer known for key to value.
+   */
+  static bool Get(const Key &key, void *value, size_t size);
+
+  static void Put(const Key &key, const void *value, size_t size);
+
+  /**
+   * Drops the answers obtained through handle.
+   */
+  static void InvalidateHandle(cudnnHandle_t handle);
+
+ private:
+  struct Entry {
+    std::string value;
+    uint64_t handle;
+  };
+
+  struct Counters {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+  };
+
+  static void Dump();
+
+  static bool mEnabled;
+  static bool mDumping;
+  static std::mutex mMutex;
+  static std::unordered_map<std::string, Entry> *mpEntries;
+  static std::map<std::string, Counters> *mpCounters;
+};
+
+#endif /* CUDNNQUERYCACHE_H */
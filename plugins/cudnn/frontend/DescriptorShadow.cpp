@@ -0,0 +1,238 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "DescriptorShadow.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "CudnnFrontend.h"
+
+static bool EnvEnabled() {
+  char *val = getenv("GVIRTUS_CUDNN_SHADOW");
+  return val == NULL || strcmp(val, "0") != 0;
+}
+
+bool DescriptorShadow::mEnabled = EnvEnabled();
+std::mutex DescriptorShadow::mMutex;
+std::condition_variable DescriptorShadow::mMaterialized;
+std::unordered_map<uint64_t, DescriptorShadow::Shadow>
+    *DescriptorShadow::mpShadows =
+        new std::unordered_map<uint64_t, DescriptorShadow::Shadow>();
+uint64_t DescriptorShadow::mLast = 0;
+
+thread_local std::vector<std::pair<size_t, uint64_t>>
+    DescriptorShadow::mFixups;
+
+uint64_t DescriptorShadow::Create(const char *routine) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  uint64_t descriptor = Tag | ++mLast;
+  (*mpShadows)[descriptor].create = routine;
+  return descriptor;
+}
+
+bool DescriptorShadow::Record(uint64_t descriptor, const char *routine) {
+  if (!IsShadow(descriptor)) return false;
+  Buffer *input = Frontend::GetFrontend()->GetInputBuffer();
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mpShadows->find(descriptor);
+    if (it == mpShadows->end()) return false;
+    /* a later call of the same routine overrides the earlier one, whatever
+     * was set in between */
+    std::vector<Call> &calls = it->second.calls;
+    calls.erase(std::remove_if(calls.begin(), calls.end(),
+                               [&](const Call &call) {
+                                 return call.routine == routine;
+                               }),
+                calls.end());
+    calls.push_back(
+        {routine, std::string(input->GetBuffer(), input->GetBufferSize())});
+    it->second.version++;
+  }
+  mFixups.clear();
+  return true;
+}
+
+cudnnStatus_t DescriptorShadow::Destroy(uint64_t descriptor,
+                                        const char *routine) {
+  std::map<int, Materialized> backends;
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    auto it = mpShadows->find(descriptor);
+    /* the descriptors being created are destroyed too */
+    while (it != mpShadows->end() && !it->second.materializing.empty()) {
+      mMaterialized.wait(lock);
+      it = mpShadows->find(descriptor);
+    }
+    if (it == mpShadows->end()) return CUDNN_STATUS_BAD_PARAM;
+    backends.swap(it->second.backends);
+    mpShadows->erase(it);
+  }
+
+  Frontend *frontend = Frontend::GetFrontend();
+  int selected = frontend->GetBackend();
+  cudnnStatus_t status = CUDNN_STATUS_SUCCESS;
+  for (auto &backend : backends) {
+    if (backend.first != frontend->GetBackend())
+      frontend->SelectBackend(backend.first);
+    CudnnFrontend::Prepare();
+    CudnnFrontend::AddVariableForArguments<long long int>(
+        (long long int)backend.second.handle);
+    CudnnFrontend::Execute(routine);
+    if (status == CUDNN_STATUS_SUCCESS) status = CudnnFrontend::GetExitCode();
+  }
+  if (frontend->GetBackend() != selected) frontend->SelectBackend(selected);
+  return status;
+}
+
+bool DescriptorShadow::Signature(uint64_t descriptor, std::string *signature) {
+  if (!IsShadow(descriptor)) return false;
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mpShadows->find(descriptor);
+  if (it == mpShadows->end()) return false;
+  signature->append(it->second.create);
+  for (auto &call : it->second.calls) {
+    /* the descriptor itself, first, is left out */
+    size_t size = call.arguments.size() - sizeof(uint64_t);
+    signature->append(call.routine.c_str(), call.routine.size() + 1);
+    signature->append((const char *)&size, sizeof(size));
+    signature->append(call.arguments, sizeof(uint64_t), size);
+  }
+  return true;
+}
+
+uint64_t DescriptorShadow::Use(uint64_t value, size_t offset) {
+  int backend = Frontend::GetFrontend()->GetBackend();
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mpShadows->find(value);
+  if (it == mpShadows->end()) return value;
+  auto materialized = it->second.backends.find(backend);
+  if (materialized != it->second.backends.end() &&
+      materialized->second.version == it->second.version)
+    return materialized->second.handle;
+  mFixups.push_back({offset, value});
+  return value;
+}
+
+/*
+ * The frame is the shadows, each with the descriptor of the backend (0 if it
+ * must be created), its create routine and the calls to apply; then the
+ * routine, where its arguments carry shadows and the arguments. The reply is
+ * the shadows created or set up, each with its descriptor and whether the
+ * calls were applied, then the output of the routine.
+ */
+void DescriptorShadow::Execute(const char *routine) {
+  Frontend *frontend = Frontend::GetFrontend();
+  Buffer *input = frontend->GetInputBuffer();
+  int backend = frontend->GetBackend();
+
+  std::vector<uint64_t> pending;
+  for (auto &fixup : mFixups)
+    if (std::find(pending.begin(), pending.end(), fixup.second) ==
+        pending.end())
+      pending.push_back(fixup.second);
+
+  Buffer frame;
+  std::map<uint64_t, uint64_t> versions;
+  /* the shadows this request creates */
+  std::vector<uint64_t> creating;
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    /* another thread creating one of them on this backend is waited for; the
+     * shadows are taken all at once, so that no two threads wait on each
+     * other */
+    auto creatingElsewhere = [&](uint64_t descriptor) {
+      auto it = mpShadows->find(descriptor);
+      return it != mpShadows->end() &&
+             it->second.backends.count(backend) == 0 &&
+             it->second.materializing.count(backend) != 0;
+    };
+    while (std::any_of(pending.begin(), pending.end(), creatingElsewhere))
+      mMaterialized.wait(lock);
+    /* destroyed by another thread since: sent as they are */
+    pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                 [](uint64_t shadow) {
+                                   return mpShadows->find(shadow) ==
+                                          mpShadows->end();
+                                 }),
+                  pending.end());
+    frame.Add(pending.size());
+    for (uint64_t descriptor : pending) {
+      Shadow &shadow = mpShadows->at(descriptor);
+      auto materialized = shadow.backends.find(backend);
+      bool held = materialized != shadow.backends.end();
+      bool current = held && materialized->second.version == shadow.version;
+      if (!held) {
+        shadow.materializing.insert(backend);
+        creating.push_back(descriptor);
+      }
+      frame.Add(descriptor);
+      frame.Add(held ? materialized->second.handle : (uint64_t)0);
+      frame.AddString(shadow.create);
+      frame.Add(current ? (size_t)0 : shadow.calls.size());
+      if (!current)
+        for (auto &call : shadow.calls) {
+          frame.AddString(call.routine.c_str());
+          frame.Add(call.arguments.size());
+          frame.Add(call.arguments.data(), call.arguments.size());
+        }
+      versions[descriptor] = shadow.version;
+    }
+  }
+  frame.AddString(routine);
+  frame.Add(mFixups.size());
+  for (auto &fixup : mFixups) {
+    frame.Add(fixup.first);
+    frame.Add(fixup.second);
+  }
+  frame.Add(input->GetBufferSize());
+  frame.Add(input->GetBuffer(), input->GetBufferSize());
+  mFixups.clear();
+
+  frontend->Execute("cudnnShadowBatch", &frame);
+
+  Buffer *output = frontend->GetOutputBuffer();
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (output->GetBufferSize() != 0) {
+    size_t count = output->Get<size_t>();
+    for (size_t i = 0; i < count; i++) {
+      uint64_t descriptor = output->Get<uint64_t>();
+      uint64_t handle = output->Get<uint64_t>();
+      int applied = output->Get<int>();
+      auto it = mpShadows->find(descriptor);
+      if (it == mpShadows->end()) continue;
+      /* not applied: the calls are sent again with the next request */
+      it->second.backends[backend] = {handle,
+                                      applied ? versions[descriptor] : 0};
+    }
+    output->Get<size_t>();
+  }
+  /* created or not, the waiting threads look again */
+  for (uint64_t descriptor : creating) {
+    auto it = mpShadows->find(descriptor);
+    if (it != mpShadows->end()) it->second.materializing.erase(backend);
+  }
+  if (!creating.empty()) mMaterialized.notify_all();
+}
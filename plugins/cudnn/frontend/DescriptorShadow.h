@@ -0,0 +1,153 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef DESCRIPTORSHADOW_H
+#define DESCRIPTORSHADOW_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cudnn.h>
+
+/**
+ * DescriptorShadow keeps the tensor, filter, convolution, activation and
+ * pooling descriptors of the process on the frontend, so that creating them
+ * and setting them up costs no round trip.
+ *
+ * A created descriptor is a shadow: a tagged value that is no address. Its
+ * Set calls are kept as the arguments they would have been sent with, the
+ * last call of each routine only. The first request that carries a shadow
+ * the backend does not hold, or holds with older settings, is sent as a
+ * cudnnShadowBatch frame: the backend creates the descriptors it lacks,
+ * applies the kept calls, writes the descriptors into the arguments of the
+ * request and runs it, and the frontend remembers the descriptors it was
+ * told about. Later requests carry them in place of the shadows.
+ *
+ * The calls kept on a shadow are checked when they are applied: an error in
+ * one is the exit code of the request that sent them.
+ *
+ * Descriptors are per backend, as a thread may select another one. A thread
+ * that needs a shadow another thread is creating on the same backend waits
+ * for it, so that each backend creates it once. Shadows are enabled unless
+ * GVIRTUS_CUDNN_SHADOW is 0.
+ */
+class DescriptorShadow {
+ public:
+  static const uint64_t Tag = 0xC0DE000000000000ull;
+  static const uint64_t TagMask = 0xFFFF000000000000ull;
+
+  static inline bool IsEnabled() { return mEnabled; }
+
+  static inline bool IsShadow(uint64_t value) {
+    return (value & TagMask) == Tag;
+  }
+
+  /**
+   * Creates a shadow, which the backend will create with routine.
+   */
+  static uint64_t Create(const char *routine);
+
+  /**
+   * Keeps the arguments prepared for routine, a Set call whose first
+   * argument is descriptor, in place of sending them.
+   *
+   * @return false if descriptor is no shadow and the call must be sent.
+   */
+  static bool Record(uint64_t descriptor, const char *routine);
+
+  /**
+   * Destroys a shadow, sending routine to every backend that holds it.
+   */
+  static cudnnStatus_t Destroy(uint64_t descriptor, const char *routine);
+
+  /**
+   * Writes the settings of a shadow, as the calls that made them in the
+   * order they were last made, to signature: shadows set up with the same
+   * calls have the same signature. Equal settings made by other calls are
+   * not recognized.
+   *
+   * @return false if descriptor is no shadow.
+   */
+  static bool Signature(uint64_t descriptor, std::string *signature);
+
+  /**
+   * Returns the value to send for an argument at offset in the prepared
+   * arguments: the descriptor of the backend for a shadow it holds up to
+   * date, or value itself, to be written over when the request is sent.
+   */
+  static uint64_t Use(uint64_t value, size_t offset);
+
+  /**
+   * Checks if the prepared arguments carry shadows the backend must get.
+   */
+  static inline bool IsPending() { return !mFixups.empty(); }
+
+  static inline void Prepare() { mFixups.clear(); }
+
+  /**
+   * Sends routine, with the prepared arguments, in a cudnnShadowBatch frame,
+   * and reads the descriptors created for it. The output of routine is left
+   * to read.
+   */
+  static void Execute(const char *routine);
+
+ private:
+  struct Call {
+    std::string routine;
+    std::string arguments;
+  };
+
+  struct Materialized {
+    uint64_t handle;
+    /* of the calls applied to it */
+    uint64_t version;
+  };
+
+  struct Shadow {
+    const char *create;
+    std::vector<Call> calls;
+    uint64_t version = 0;
+    /* by backend */
+    std::map<int, Materialized> backends;
+    /* the backends a request in flight creates it on */
+    std::set<int> materializing;
+  };
+
+  static bool mEnabled;
+  static std::mutex mMutex;
+  /* signalled as requests creating shadows are answered */
+  static std::condition_variable mMaterialized;
+  static std::unordered_map<uint64_t, Shadow> *mpShadows;
+  static uint64_t mLast;
+
+  /* where the prepared arguments carry a shadow */
+  static thread_local std::vector<std::pair<size_t, uint64_t>> mFixups;
+};
+
+#endif /* DESCRIPTORSHADOW_H */
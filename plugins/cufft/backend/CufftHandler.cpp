@@ -67,7 +67,7 @@ bool CufftHandler::CanExecute(std::string routine) {
 }
 
 std::shared_ptr<Result> CufftHandler::Execute(std::string routine, std::shared_ptr<Buffer> input_buffer) {
-    LOG4CPLUS_DEBUG(logger,"Called " << routine);
+    GVIRTUS_LOG_DEBUG(logger,"Called " << routine);
     map<string, CufftHandler::CufftRoutineHandler>::iterator it;
     it = mspHandlers->find(routine);
     if (it == mspHandlers->end())
@@ -87,7 +87,7 @@ std::shared_ptr<Result> CufftHandler::Execute(std::string routine, std::shared_p
  * The batch input parameter tells cuFFT how many 1D transforms to configure.
  */
 CUFFT_ROUTINE_HANDLER(Plan1d) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan1D"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan1D"));
     
     cufftHandle *plan_adv = in->Assign<cufftHandle>();
     int nx = in->Get<int>();
@@ -101,11 +101,11 @@ CUFFT_ROUTINE_HANDLER(Plan1d) {
     try{
         out->Add(plan_adv);
     } catch (string e) {
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation); //???
     }
-    cout <<"DEBUG - Plan: "<< *plan_adv<<"\n";
-    cout<<"DEBUG - cufftPlan1d Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "Plan: "<< *plan_adv);
+    GVIRTUS_LOG_DEBUG(logger, "cufftPlan1d Executed");
     return std::make_shared<Result>(exit_code, out);
 }
 
@@ -114,7 +114,7 @@ CUFFT_ROUTINE_HANDLER(Plan1d) {
  * Creates a 2D FFT plan configuration according to specified signal sizes and data type.
  */
 CUFFT_ROUTINE_HANDLER(Plan2d) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan2d"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan2d"));
 
     cufftHandle plan;// = in->Assign<cufftHandle>();
     int nx = in->Get<int>();
@@ -126,11 +126,11 @@ CUFFT_ROUTINE_HANDLER(Plan2d) {
     try {
         out->Add(&plan);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation); //???
     }
-    cout <<"DEBUG - Plan: "<< plan<<"\n";
-    cout<<"DEBUG - cufftPlan2d Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "Plan: "<< plan);
+    GVIRTUS_LOG_DEBUG(logger, "cufftPlan2d Executed");
     return std::make_shared<Result>(exit_code, out);
 }
 
@@ -140,7 +140,7 @@ CUFFT_ROUTINE_HANDLER(Plan2d) {
  * This function is the same as cufftPlan2d() except that it takes a third size parameter nz.
  */
 CUFFT_ROUTINE_HANDLER(Plan3d) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan3D"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan3D"));
     try{
         cufftHandle *plan = in->Assign<cufftHandle>();
         int nx = in->Get<int>();
@@ -152,7 +152,7 @@ CUFFT_ROUTINE_HANDLER(Plan3d) {
         out->Add(plan);
         return std::make_shared<Result>(ec, out);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation); //???
     }
 }
@@ -162,7 +162,7 @@ CUFFT_ROUTINE_HANDLER(Plan3d) {
  * The batch input parameter tells cuFFT how many transforms to configure. With this function, batched plans of 1, 2, or 3 dimensions may be created.
  */
 CUFFT_ROUTINE_HANDLER(PlanMany) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan3D"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Plan3D"));
     
     cufftHandle *plan = in->Assign<cufftHandle>();
     int rank = in->Get<int>();
@@ -183,14 +183,14 @@ CUFFT_ROUTINE_HANDLER(PlanMany) {
         out->Add(plan);
         return std::make_shared<Result>(exit_code, out);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation); //???
     }
 }
 
 
 CUFFT_ROUTINE_HANDLER(ExecC2R) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecC2R"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecC2R"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cufftReal *odata;
@@ -211,37 +211,37 @@ CUFFT_ROUTINE_HANDLER(ExecC2R) {
     try{
         out->AddMarshal(odata);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftExecC2R Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftExecC2R Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 #if (CUDART_VERSION <= 9000)
 CUFFT_ROUTINE_HANDLER(SetCompatibilityMode) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetCompatibilityMode"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetCompatibilityMode"));
     cufftHandle plan = in->Get<cufftHandle>();
     cufftCompatibility mode = in->Get<cufftCompatibility>();
     cufftResult exit_code = cufftSetCompatibilityMode(plan, mode);
-    cout<<"DEBUG - cufftSetCompatibilityMode Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftSetCompatibilityMode Executed");
     return std::make_shared<Result>(exit_code);
 }
 #endif
 
 CUFFT_ROUTINE_HANDLER(Create) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Create"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Create"));
     cufftHandle *plan_adv = in->Assign<cufftHandle>();
     cufftResult exit_code = cufftCreate(plan_adv);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try {
         out->Add(plan_adv);
     } catch (string e) {
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout <<"DEBUG - Plan: "<< *plan_adv<<"\n";
-    cout<<"DEBUG - cufftCreate Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "Plan: "<< *plan_adv);
+    GVIRTUS_LOG_DEBUG(logger, "cufftCreate Executed");
     
     return std::make_shared<Result>(exit_code, out);
     //return std::make_shared<Result>(ec, out);
@@ -252,31 +252,31 @@ CUFFT_ROUTINE_HANDLER(Create) {
  * This function should be called once a plan is no longer needed, to avoid wasting GPU memory.
  */
 CUFFT_ROUTINE_HANDLER(Destroy) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Create"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Create"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cufftResult exit_code = cufftDestroy(plan);
     
-    cout << "DEBUG - cufftDestroy Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftDestroy Executed");
     return std::make_shared<Result>(exit_code);
 }
 
 CUFFT_ROUTINE_HANDLER(SetWorkArea){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetWorkArea"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetWorkArea"));
     cufftHandle plan = in->Get<cufftHandle>();
     void * workArea = in->GetFromMarshal<void*>();
     cufftResult exit_code = cufftSetWorkArea(plan,workArea);
-    cout << "DEBUG - cufftSetWorkArea Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftSetWorkArea Executed");
     return std::make_shared<Result>(exit_code);
 }
 
 
 CUFFT_ROUTINE_HANDLER(SetAutoAllocation){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetAutoallocation"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetAutoallocation"));
     cufftHandle plan = in->Get<cufftHandle>();
     int autoAllocate = in->Get<int>();
     cufftResult exit_code = cufftSetAutoAllocation(plan,autoAllocate);
-    cout << "DEBUG - cufftSetAutoallocation Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftSetAutoallocation Executed");
     return std::make_shared<Result>(exit_code);
 }
 
@@ -301,7 +301,7 @@ CUFFT_ROUTINE_HANDLER(SetAutoAllocation){
     @return    *workSize   Pointer to the size(s) of the work areas.
 */
 CUFFT_ROUTINE_HANDLER(XtMakePlanMany) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtMakePlanMany"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtMakePlanMany"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int rank = in->Get<int>();
@@ -328,10 +328,10 @@ CUFFT_ROUTINE_HANDLER(XtMakePlanMany) {
         //out->Add(onembed);
         out->Add(workSize);   
     } catch (string e) {
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftXtMakePlanMany Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftXtMakePlanMany Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 #endif
@@ -343,7 +343,7 @@ CUFFT_ROUTINE_HANDLER(XtMakePlanMany) {
  *This function stores the Fourier coefficients in the odata array. If idata and odata are the same, this method does an in-place transform. 
  */
 CUFFT_ROUTINE_HANDLER(ExecC2C){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecC2C"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecC2C"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cufftComplex *idata,*odata;
@@ -365,15 +365,15 @@ CUFFT_ROUTINE_HANDLER(ExecC2C){
     try{
         out->AddMarshal(odata);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftExecC2C Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftExecC2C Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(ExecR2C){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecR2C"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecR2C"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cufftReal *idata;
@@ -391,16 +391,16 @@ CUFFT_ROUTINE_HANDLER(ExecR2C){
     try{
         out->AddMarshal(odata);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftExecR2C Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftExecR2C Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 
 CUFFT_ROUTINE_HANDLER(ExecZ2Z){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecZ2Z"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecZ2Z"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cufftDoubleComplex *idata,*odata;
@@ -419,16 +419,16 @@ CUFFT_ROUTINE_HANDLER(ExecZ2Z){
     try{
         out->AddMarshal(odata);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftExecZ2Z Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftExecZ2Z Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 
 CUFFT_ROUTINE_HANDLER(ExecD2Z){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecD2Z"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecD2Z"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cufftDoubleReal *idata;
@@ -449,16 +449,16 @@ CUFFT_ROUTINE_HANDLER(ExecD2Z){
     try{
         out->AddMarshal(odata);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftExecD2Z Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftExecD2Z Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 
 CUFFT_ROUTINE_HANDLER(ExecZ2D){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecZ2D"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("ExecZ2D"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cufftDoubleComplex *idata;
@@ -477,10 +477,10 @@ CUFFT_ROUTINE_HANDLER(ExecZ2D){
     try{
         out->AddMarshal(odata);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftExecZ2D Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftExecZ2D Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
@@ -495,20 +495,20 @@ CUFFT_ROUTINE_HANDLER(ExecZ2D){
  * @param *whichGPUs
  */
 CUFFT_ROUTINE_HANDLER(XtSetGPUs){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtSetGPUs"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtSetGPUs"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int nGPUs = in->Get<int>();
     int *whichGPUs = (in->Assign<int>());
     cufftResult exit_code = cufftXtSetGPUs(plan,nGPUs,whichGPUs);
     
-    cout<<"DEBUG - cufftXtSetGPUs Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftXtSetGPUs Executed");
     return std::make_shared<Result>(exit_code);
 }
 
 
 CUFFT_ROUTINE_HANDLER(Estimate1d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Estimate1d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Estimate1d"));
     
     int nx = in->Get<int>();
     cufftType type = in->Get<cufftType>();
@@ -520,16 +520,16 @@ CUFFT_ROUTINE_HANDLER(Estimate1d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftEstimate1d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftEstimate1d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(Estimate2d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Estimate2d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Estimate2d"));
     
     int nx = in->Get<int>();
     int ny = in->Get<int>();
@@ -541,17 +541,17 @@ CUFFT_ROUTINE_HANDLER(Estimate2d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftEstimate2d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftEstimate2d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 
 CUFFT_ROUTINE_HANDLER(Estimate3d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Estimate3d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("Estimate3d"));
     
     int nx = in->Get<int>();
     int ny = in->Get<int>();
@@ -564,16 +564,16 @@ CUFFT_ROUTINE_HANDLER(Estimate3d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftEstimate3d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftEstimate3d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(EstimateMany) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("EstimateMany"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("EstimateMany"));
     
     int rank = in->Get<int>();
     int * n = in->Assign<int>();
@@ -595,11 +595,11 @@ CUFFT_ROUTINE_HANDLER(EstimateMany) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftEstimateMany Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftEstimateMany Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
@@ -616,7 +616,7 @@ CUFFT_ROUTINE_HANDLER(EstimateMany) {
  * @param *workSize 
  */
 CUFFT_ROUTINE_HANDLER(MakePlan1d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlan1d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlan1d"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int nx = in->Get<int>();
@@ -629,16 +629,16 @@ CUFFT_ROUTINE_HANDLER(MakePlan1d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftMakePlan1d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftMakePlan1d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(MakePlan2d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlan2d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlan2d"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int nx = in->Get<int>();
@@ -651,16 +651,16 @@ CUFFT_ROUTINE_HANDLER(MakePlan2d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftMakePlan2d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftMakePlan2d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(MakePlan3d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlan3d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlan3d"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int nx = in->Get<int>();
@@ -674,17 +674,17 @@ CUFFT_ROUTINE_HANDLER(MakePlan3d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftMakePlan3d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftMakePlan3d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 
 CUFFT_ROUTINE_HANDLER(MakePlanMany) {
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MakePlanMany"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("MakePlanMany"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int rank = in->Get<int>();
@@ -706,17 +706,17 @@ CUFFT_ROUTINE_HANDLER(MakePlanMany) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftMakePlanMany Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftMakePlanMany Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 #if CUDART_VERSION >= 7000
 CUFFT_ROUTINE_HANDLER(MakePlanMany64) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlanMany64"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("MakePlanMany64"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int rank = in->Get<int>();
@@ -738,16 +738,16 @@ CUFFT_ROUTINE_HANDLER(MakePlanMany64) {
     try{
         out->Add(workSize);   
     } catch (string e) {
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftMakePlanMany64 Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftMakePlanMany64 Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 #endif
 
 CUFFT_ROUTINE_HANDLER(GetSize1d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize1d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize1d"));
         
     cufftHandle handle = in->Get<cufftHandle>();
     int nx = in->Get<int>();
@@ -760,17 +760,17 @@ CUFFT_ROUTINE_HANDLER(GetSize1d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftGetSize1d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetSize1d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 
 CUFFT_ROUTINE_HANDLER(GetSize2d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize2d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize2d"));
         
     cufftHandle handle = in->Get<cufftHandle>();
     int nx = in->Get<int>();
@@ -783,16 +783,16 @@ CUFFT_ROUTINE_HANDLER(GetSize2d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftGetSize2d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetSize2d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(GetSize3d) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize3d"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize3d"));
         
     cufftHandle handle = in->Get<cufftHandle>();
     int nx = in->Get<int>();
@@ -806,16 +806,16 @@ CUFFT_ROUTINE_HANDLER(GetSize3d) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftGetSize3d Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetSize3d Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(GetSizeMany) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSizeMany"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSizeMany"));
     
     cufftHandle handle = in->Get<cufftHandle>();
     int rank = in->Get<int>();
@@ -837,17 +837,17 @@ CUFFT_ROUTINE_HANDLER(GetSizeMany) {
     try{
         out->Add(workSize);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftGetSizeMany Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetSizeMany Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 #if CUDART_VERSION >= 7000
 CUFFT_ROUTINE_HANDLER(GetSizeMany64) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSizeMany64"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSizeMany64"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     int rank = in->Get<int>();
@@ -869,16 +869,16 @@ CUFFT_ROUTINE_HANDLER(GetSizeMany64) {
     try{
         out->Add(workSize);   
     } catch (string e) {
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftGetSizeMany64 Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetSizeMany64 Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 #endif
 
 CUFFT_ROUTINE_HANDLER(GetSize) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetSize"));
     
     cufftHandle handle = in->Get<cufftHandle>();
     size_t * workSize = in->Assign<size_t>();
@@ -887,33 +887,33 @@ CUFFT_ROUTINE_HANDLER(GetSize) {
     try{
         out->Add(workSize);   
     } catch (string e) {
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftGetSize Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetSize Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 CUFFT_ROUTINE_HANDLER(SetStream) {
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cudaStream_t stream = in->GetFromMarshal<cudaStream_t>();
     
     cufftResult exit_code = cufftSetStream(plan,stream);
     
-    cout<<"DEBUG - cufftSetStream Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftSetStream Executed");
     return std::make_shared<Result>(exit_code);
 }
 
 #if __CUDA_API_VERSION >= 7000
 CUFFT_ROUTINE_HANDLER(GetProperty){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetProperty"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetProperty"));
     
     libraryPropertyType type = in->Get<libraryPropertyType>();
     int * value = in->Assign<int>();
     cufftResult exit_code = cufftGetProperty(type,value);
-    cout<<"DEBUG - cufftGetProperty Executed\n";
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetProperty Executed");
     return std::make_shared<Result>(exit_code);
 }
 #endif
@@ -926,7 +926,7 @@ CUFFT_ROUTINE_HANDLER(GetProperty){
  * @param format
  */
 CUFFT_ROUTINE_HANDLER(XtMalloc){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtMalloc"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtMalloc"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cudaLibXtDesc ** desc = in->Assign<cudaLibXtDesc*>();
@@ -938,11 +938,11 @@ CUFFT_ROUTINE_HANDLER(XtMalloc){
     try{
         out->Add(desc);
     } catch (string e){
-        cout << "DEBUG - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger, "" <<  e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftXtMalloc Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftXtMalloc Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
@@ -954,10 +954,10 @@ CUFFT_ROUTINE_HANDLER(XtMalloc){
  * @param type
  */
 CUFFT_ROUTINE_HANDLER(XtMemcpy){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtMemcpy"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtMemcpy"));
     
     cufftHandle plan = in->Get<cufftHandle>();
-    cout<<"plan_input: "<< plan<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "plan_input: " << plan);
     void * dstPointer = NULL;
     
     void * srcPointer = NULL;
@@ -967,28 +967,13 @@ CUFFT_ROUTINE_HANDLER(XtMemcpy){
     try{
         switch(type){
             case CUFFT_COPY_HOST_TO_DEVICE:
-                cout<<"type: HOST_TO_DEVICE"<< endl;  
                 dstPointer = in->GetFromMarshal<void*>();
-                cout<<"dstPointer:"<< dstPointer <<endl;
                 srcPointer = (in->Assign<void>());
-                cout<<"srcPointer:"<< srcPointer <<endl;
+                GVIRTUS_LOG_DEBUG(logger, "type: HOST_TO_DEVICE dstPointer: " << dstPointer << " srcPointer: " << srcPointer);
                 
                 exit_code = cufftXtMemcpy(plan,dstPointer,srcPointer,CUFFT_COPY_HOST_TO_DEVICE);
                 
-                cout<<"type: HOST_TO_DEVICE"<< endl;  
-                if (exit_code == CUFFT_INVALID_PLAN)
-                    cout << "A"<<endl;
-                if (exit_code == CUFFT_INVALID_VALUE)
-                    cout << "B"<<endl;
-                if (exit_code == CUFFT_INTERNAL_ERROR)
-                    cout << "C"<<endl;
-                if (exit_code == CUFFT_SETUP_FAILED)
-                    cout << "D"<<endl;
-                if (exit_code == CUFFT_INVALID_DEVICE)
-                    cout << "E"<<endl;
-                if (exit_code == CUFFT_SUCCESS)
-                    cout << "F"<<endl;
-                cout <<"exit_code: "<<exit_code<<endl;
+                GVIRTUS_LOG_DEBUG(logger, "exit_code: " << exit_code);
                 //out->AddMarshal(dstPointer);
                 break;
             /*case CUFFT_COPY_DEVICE_TO_DEVICE:
@@ -1014,16 +999,16 @@ CUFFT_ROUTINE_HANDLER(XtMemcpy){
         }
     } catch (string e){
         cout << "EXCEPTION - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftXtMemcpy Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftXtMemcpy Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 /*Da testare*/
 CUFFT_ROUTINE_HANDLER(XtExecDescriptorC2C){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtExecDescriptorC2C"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtExecDescriptorC2C"));
     
     cufftHandle plan = in->Get<cufftHandle>();
     cudaLibXtDesc *input = in->GetFromMarshal<cudaLibXtDesc*>();
@@ -1036,26 +1021,26 @@ CUFFT_ROUTINE_HANDLER(XtExecDescriptorC2C){
         out->AddMarshal(output);
     } catch (string e){
         cout << "EXCEPTION - " <<  e << endl;
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(cudaErrorMemoryAllocation);
     }
-    cout<<"DEBUG - cufftXtExecDescriptorC2C Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftXtExecDescriptorC2C Executed");
     return std::make_shared<Result>(exit_code,out);
 }
 
 /*Da testare*/
 CUFFT_ROUTINE_HANDLER(XtFree){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtFree"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtFree"));
     cudaLibXtDesc *descriptor = in->Assign<cudaLibXtDesc>();
     cufftResult exit_code = cufftXtFree(descriptor);
-    cout<<"DEBUG - cufftXtMemcpy Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftXtMemcpy Executed");
     return std::make_shared<Result>(exit_code);
 }
 
 
 /* -- FUNCTION NOT SUPPORTED IN GVIRTUS -- */
 CUFFT_ROUTINE_HANDLER(XtSetCallback){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtSetCallback"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("XtSetCallback"));
     
     /*cufftHandle plan = in->Get<cufftHandle>();
     cout << "plan:"<< plan<<endl;
@@ -1069,10 +1054,10 @@ CUFFT_ROUTINE_HANDLER(XtSetCallback){
 }
 
 CUFFT_ROUTINE_HANDLER(GetVersion){
-    Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
+    static Logger logger=Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
     int *version = in->Assign<int>();
     cufftResult exit_code = cufftGetVersion(version);
-    cout<<"DEBUG - cufftGetVersion Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cufftGetVersion Executed");
 }
 
 
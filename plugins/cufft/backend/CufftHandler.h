@@ -41,6 +41,7 @@
 #include <cuda_runtime_api.h>
 
 #include <gvirtus/backend/Handler.h>
+#include <gvirtus/common/Log.h>
 #include <gvirtus/communicators/Result.h>
 
 #include <cufft.h>
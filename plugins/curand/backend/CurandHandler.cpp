@@ -50,7 +50,7 @@ bool CurandHandler::CanExecute(std::string routine) {
 }
 
 std::shared_ptr<Result> CurandHandler::Execute(std::string routine, std::shared_ptr<Buffer> in) {
-    LOG4CPLUS_DEBUG(logger,"Called " << routine);
+    GVIRTUS_LOG_DEBUG(logger,"Called " << routine);
     map<string, CurandHandler::CurandRoutineHandler>::iterator it;
     it = mspHandlers->find(routine);
     if (it == mspHandlers->end())
@@ -36,8 +36,7 @@ using gvirtus::communicators::Buffer;
 using gvirtus::communicators::Result;
 
 CURAND_ROUTINE_HANDLER(CreateGenerator){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateGenerator"));
-    cout<<"ciao ciao ciao"<<endl;
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateGenerator"));
     curandGenerator_t generator;
     curandRngType_t gnrType = (curandRngType_t) in->Get<int>();
     curandStatus_t cs = curandCreateGenerator(&generator,gnrType);
@@ -51,7 +50,7 @@ CURAND_ROUTINE_HANDLER(CreateGenerator){
 }
 
 CURAND_ROUTINE_HANDLER(CreateGeneratorHost){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateGeneratorHost"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("CreateGeneratorHost"));
     
     curandGenerator_t generator;
     curandRngType_t gnrType = (curandRngType_t) in->Get<int>();
@@ -67,7 +66,7 @@ CURAND_ROUTINE_HANDLER(CreateGeneratorHost){
 
 
 CURAND_ROUTINE_HANDLER(Generate){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Generate"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Generate"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     unsigned int * outputPtr = in->Assign<unsigned int>();
@@ -79,7 +78,7 @@ CURAND_ROUTINE_HANDLER(Generate){
 }
 
 CURAND_ROUTINE_HANDLER(GenerateLongLong){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLongLong"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLongLong"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     unsigned long long int * outputPtr = in->Assign<unsigned long long int>();
@@ -90,7 +89,7 @@ CURAND_ROUTINE_HANDLER(GenerateLongLong){
 }
 
 CURAND_ROUTINE_HANDLER(GenerateUniform){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateUniform"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateUniform"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     float * outputPtr = in->Assign<float>();
@@ -101,7 +100,7 @@ CURAND_ROUTINE_HANDLER(GenerateUniform){
 }
 
 CURAND_ROUTINE_HANDLER(GenerateNormal){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateNormal"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateNormal"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     float * outputPtr = in->Assign<float>();
@@ -115,7 +114,7 @@ CURAND_ROUTINE_HANDLER(GenerateNormal){
 
 
 CURAND_ROUTINE_HANDLER(GenerateLogNormal){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLogNormal"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLogNormal"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     float * outputPtr = in->Assign<float>();
@@ -128,7 +127,7 @@ CURAND_ROUTINE_HANDLER(GenerateLogNormal){
 }
 
 CURAND_ROUTINE_HANDLER(GeneratePoisson){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GeneratePoisson"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GeneratePoisson"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     unsigned int * outputPtr = in->Assign<unsigned int>();
@@ -140,7 +139,7 @@ CURAND_ROUTINE_HANDLER(GeneratePoisson){
 }
 
 CURAND_ROUTINE_HANDLER(GenerateUniformDouble){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateUniformDouble"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateUniformDouble"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     double * outputPtr = in->Assign<double>();
@@ -151,7 +150,7 @@ CURAND_ROUTINE_HANDLER(GenerateUniformDouble){
 }
 
 CURAND_ROUTINE_HANDLER(GenerateNormalDouble){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateNormalDouble"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateNormalDouble"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     double * outputPtr = in->Assign<double>();
@@ -165,7 +164,7 @@ CURAND_ROUTINE_HANDLER(GenerateNormalDouble){
 }
 
 CURAND_ROUTINE_HANDLER(GenerateLogNormalDouble){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLogNormalDouble"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLogNormalDouble"));
     
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     double * outputPtr = in->Assign<double>();
@@ -179,11 +178,10 @@ CURAND_ROUTINE_HANDLER(GenerateLogNormalDouble){
 }
 
 CURAND_ROUTINE_HANDLER(SetPseudoRandomGeneratorSeed){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLogNormalDouble"));
-    cout<<"ciao ciao ciao"<<endl;
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GenerateLogNormalDouble"));
     curandGenerator_t generator = (curandGenerator_t)in->Get<long long int>();
     unsigned long long seed = in->Get<unsigned long long>();
-    cout<<"generator: "<< generator << " seed: "<< seed<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "generator: "<< generator << " seed: "<< seed);
     curandStatus_t cs = curandSetPseudoRandomGeneratorSeed(generator,seed);
     return std::make_shared<Result>(cs);
 }
\ No newline at end of file
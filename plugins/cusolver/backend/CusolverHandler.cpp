@@ -69,7 +69,7 @@ bool CusolverHandler::CanExecute(std::string routine) {
 }
 
 std::shared_ptr<gvirtus::communicators::Result> CusolverHandler::Execute(std::string routine, std::shared_ptr<gvirtus::communicators::Buffer> input_buffer) {
-    LOG4CPLUS_DEBUG(logger,"Called " << routine);
+    GVIRTUS_LOG_DEBUG(logger,"Called " << routine);
     map<string, CusolverHandler::CusolverRoutineHandler>::iterator it;
     it = mspHandlers->find(routine);
     if (it == mspHandlers->end())
@@ -77,8 +77,8 @@ std::shared_ptr<gvirtus::communicators::Result> CusolverHandler::Execute(std::st
     try {
         return it->second(this, input_buffer);
     } catch (const char *ex) {
-        LOG4CPLUS_DEBUG(logger,ex);
-        LOG4CPLUS_DEBUG(logger,strerror(errno));
+        GVIRTUS_LOG_DEBUG(logger,ex);
+        GVIRTUS_LOG_DEBUG(logger,strerror(errno));
     }
     return NULL;
 }
@@ -97,65 +97,65 @@ void CusolverHandler::Initialize(){
 }
 
 CUSOLVER_ROUTINE_HANDLER(DnGetVersion){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnGetVersion"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnGetVersion"));
 
     size_t version = cusolverDnGetVersion();
-    LOG4CPLUS_DEBUG(logger,"cusolverDnGetVersion Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusolverDnGetVersion Executed");
     return std::make_shared<Result>(version);
 }
 
 CUSOLVER_ROUTINE_HANDLER(DnGetErrorString){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnGetErrorString"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnGetErrorString"));
     cusolverDnStatus_t cs = in->Get<cusolverDnStatus_t>();
     const char * s = cusolverDnGetErrorString(cs);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
         out->Add((char *)s);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(CUSOLVER_STATUS_EXECUTION_FAILED);
     }
-    LOG4CPLUS_DEBUG(logger,"cusolverDnGetErrorString Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusolverDnGetErrorString Executed");
     return std::make_shared<Result>(CUDNN_STATUS_SUCCESS,out);
 }
 
 CUSOLVER_ROUTINE_HANDLER(DnCreate){
 
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnCreate"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnCreate"));
     cusolverDnHandle_t handle;
     cusolverDnStatus_t cs = cusolverDnCreate(&handle);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
         out->Add<cusolverDnHandle_t>(handle);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(CUSOLVER_STATUS_EXECUTION_FAILED);
     }
-    LOG4CPLUS_DEBUG(logger,"cusolverDnCreate Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusolverDnCreate Executed");
     return std::make_shared<Result>(cs,out);
 }
 
 CUSOLVER_ROUTINE_HANDLER(DnDestroy){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnDestroy"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnDestroy"));
  
     cusolverDnHandle_t handle = (cuSolverDnHandle_t)in->Get<long long int>();
     cusolverDnStatus_t cs = cusolverDnDestroy(handle);
-    LOG4CPLUS_DEBUG(logger,"cusolverDnDestroy Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusolverDnDestroy Executed");
     return std::make_shared<Result>(cs);
 }
  
 CUSOLVER_ROUTINE_HANDLER(DnSetStream){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnSetStream"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnSetStream"));
     cusolverDnHandle_t handle = (cusolverDnHandle_t)in->Get<long long int>();
     cudaStream_t streamId = (cudaStream_t) in->Get<long long int>();
 
     cusolverDnStatus_t cs = cuSolverDnSetStream(handle,streamId);
-    LOG4CPLUS_DEBUG(logger,"cusolverDnSetStream Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusolverDnSetStream Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUSOLVER_ROUTINE_HANDLER(DnGetStream){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnGetStream"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("DnGetStream"));
     cusolverDnHandle_t handle = (cusolverDnHandle_t)in->Get<long long int>();
     cudaStream_t *streamId;
     cusolverDnStatus_t cs = cusolverDnGetStream(handle,streamId);
@@ -163,10 +163,10 @@ CUSOLVER_ROUTINE_HANDLER(DnGetStream){
     try {
          out->Add<long long int>((long long int)*streamId);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }
-    LOG4CPLUS_DEBUG(logger,"cusolverDnGetStream Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusolverDnGetStream Executed");
     return std::make_shared<Result>(cs,out);
 }
 
@@ -28,6 +28,7 @@
 #define CUSOLVERHANDLER_H
 
 #include <gvirtus/backend/Handler.h>
+#include <gvirtus/common/Log.h>
 #include <gvirtus/communicators/Result.h>
 
 #include <cusolverDn.h>
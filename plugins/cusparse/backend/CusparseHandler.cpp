@@ -69,7 +69,7 @@ bool CusparseHandler::CanExecute(std::string routine) {
 }
 
 std::shared_ptr<Result> CusparseHandler::Execute(std::string routine, std::shared_ptr<Buffer> input_buffer) {
-    LOG4CPLUS_DEBUG(logger,"Called " << routine);
+    GVIRTUS_LOG_DEBUG(logger,"Called " << routine);
     map<string, CusparseHandler::CusparseRoutineHandler>::iterator it;
     it = mspHandlers->find(routine);
     if (it == mspHandlers->end())
@@ -77,8 +77,8 @@ std::shared_ptr<Result> CusparseHandler::Execute(std::string routine, std::share
     try {
         return it->second(this, input_buffer);
     } catch (const char *ex) {
-        LOG4CPLUS_DEBUG(logger,ex);
-        LOG4CPLUS_DEBUG(logger,strerror(errno));
+        GVIRTUS_LOG_DEBUG(logger,ex);
+        GVIRTUS_LOG_DEBUG(logger,strerror(errno));
     }
     return NULL;
 }
@@ -97,66 +97,66 @@ void CudnnHandler::Initialize(){
 }
 
 CUSPARSE_ROUTINE_HANDLER(GetVersion){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetVersion"));
 
     size_t version = cusparseGetVersion();
-    LOG4CPLUS_DEBUG(logger,"cusparseGetVersion Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusparseGetVersion Executed");
     return std::make_shared<Result>(version);
 }
 
 CUSPARSE_ROUTINE_HANDLER(GetErrorString){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetErrorString"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetErrorString"));
     cusparseStatus_t cs = in->Get<cusparseStatus_t>();
     const char * s = cusparseGetErrorString(cs);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
         out->Add((char *)s);
     } catch (string e){
-        LOG4CPLUS_DEBUG(logger,e);
+        GVIRTUS_LOG_DEBUG(logger,e);
         return std::make_shared<Result>(CUSPARSE_STATUS_EXECUTION_FAILED);
     }
-    LOG4CPLUS_DEBUG(logger,"cusparseGetErrorString Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusparseGetErrorString Executed");
     return std::make_shared<Result>(CUSPARSE_STATUS_SUCCESS,out);
 }
 
 CUSPARSE_ROUTINE_HANDLER(Create){
 
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Create"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Create"));
     cusparseHandle_t handle;
     cusparseStatus_t cs = cusparseCreate(&handle);
     std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
     try{
          out->Add<cusparseHandle_t>(handle);
     } catch (string e){
-                        LOG4CPLUS_DEBUG(logger,e);
+                        GVIRTUS_LOG_DEBUG(logger,e);
                         return std::make_shared<Result>(CUSPARSE_STATUS_EXECUTION_FAILED);
     }
-    LOG4CPLUS_DEBUG(logger,"cusparseCreate Executed");
+    GVIRTUS_LOG_DEBUG(logger,"cusparseCreate Executed");
     return std::make_shared<Result>(cs,out);
 
 }
 
 CUSPARSE_ROUTINE_HANDLER(Destroy){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Destroy"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("Destroy"));
 
     cusparseHandle_t handle = (cusparseHandle_t)in->Get<long long int>();
     cusparseStatus_t cs = cusparseDestroy(handle);
-    cout << "DEBUG - cusparseDestroy Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cusparseDestroy Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUSPARSE_ROUTINE_HANDLER(SetStream){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("SetStream"));
     cusparseHandle_t handle = (cusparseHandle_t)in->Get<long long int>();
     cudaStream_t streamId = (cudaStream_t) in->Get<long long int>();
 
     cusparseStatus_t cs = cusparseSetStream(handle,streamId);
-    cout << "DEBUG - cusparseSetStream Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cusparseSetStream Executed");
     return std::make_shared<Result>(cs);
 }
 
 CUSPARSE_ROUTINE_HANDLER(GetStream){
-    Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetStream"));
+    static Logger logger = Logger::getInstance(LOG4CPLUS_TEXT("GetStream"));
     cusparseHandle_t handle = (cusparseHandle_t)in->Get<long long int>();
     cudaStream_t *streamId;
     cudnnStatus_t cs = cusparseGetStream(handle,streamId);
@@ -164,9 +164,9 @@ CUSPARSE_ROUTINE_HANDLER(GetStream){
     try {
          out->Add<long long int>((long long int)*streamId);
     } catch (string e){
-         LOG4CPLUS_DEBUG(logger,e);
+         GVIRTUS_LOG_DEBUG(logger,e);
          return std::make_shared<Result>(cs);
     }
-    cout << "DEBUG - cusparseGetStream Executed"<<endl;
+    GVIRTUS_LOG_DEBUG(logger, "cusparseGetStream Executed");
     return std::make_shared<Result>(cs,out);
 }
@@ -27,6 +27,7 @@
 #define CUSPARSEHANDLER_H
 
 #include <gvirtus/backend/Handler.h>
+#include <gvirtus/common/Log.h>
 #include <gvirtus/communicators/Result.h>
 
 #include <cusparse.h>
@@ -0,0 +1,339 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "NullDevHandler.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include <gvirtus/common/LiveStats.h>
+
+using namespace std;
+using namespace log4cplus;
+
+map<string, NullDevHandler::NullDevRoutineHandler>
+    *NullDevHandler::mspHandlers = NULL;
+uint64_t NullDevHandler::msMemoryTotal = 16ull << 30;
+int NullDevHandler::msDevices = 1;
+
+static const size_t Alignment = 256;
+
+static thread_local cudaError_t tlsLastError = cudaSuccess;
+static thread_local int tlsDevice = 0;
+
+extern "C" std::shared_ptr<NullDevHandler> create_t() {
+  return std::make_shared<NullDevHandler>();
+}
+
+static uint64_t GetEnvSize(const char *name, uint64_t value) {
+  char *val = getenv(name);
+  if (val == NULL || *val == '\0') return value;
+  return strtoull(val, NULL, 0);
+}
+
+NullDevHandler::NullDevHandler() {
+  logger = Logger::getInstance(LOG4CPLUS_TEXT("NullDevHandler"));
+  mMemoryUsed = 0;
+  mBusyUntil = 0;
+  mLaunchDuration = GetEnvSize("GVIRTUS_NULLDEV_LAUNCH_NS", 0);
+  msMemoryTotal = GetEnvSize("GVIRTUS_NULLDEV_MEMORY", msMemoryTotal);
+  msDevices = (int)GetEnvSize("GVIRTUS_NULLDEV_DEVICES", msDevices);
+  if (msDevices < 1) msDevices = 1;
+  GVIRTUS_LOG_INFO(logger, "Null device: " << msDevices << " devices, "
+                                           << msMemoryTotal
+                                           << " bytes, kernels last "
+                                           << mLaunchDuration << " ns");
+  Initialize();
+}
+
+NullDevHandler::~NullDevHandler() {
+  for (auto &it : mAllocations) free((void *)it.first);
+}
+
+bool NullDevHandler::CanExecute(std::string routine) {
+  return mspHandlers->find(routine) != mspHandlers->end();
+}
+
+std::shared_ptr<Result> NullDevHandler::Execute(
+    std::string routine, std::shared_ptr<Buffer> input_buffer) {
+  map<string, NullDevHandler::NullDevRoutineHandler>::iterator it;
+  it = mspHandlers->find(routine);
+  GVIRTUS_LOG_DEBUG(logger, "Called: " << routine);
+  if (it == mspHandlers->end()) throw "No handler for '" + routine + "' found!";
+  std::shared_ptr<Result> result = it->second(this, input_buffer);
+  /* the error routines report the error, they do not make one */
+  if (result->GetExitCode() != cudaSuccess && it->second != handleGetLastError &&
+      it->second != handlePeekAtLastError)
+    tlsLastError = (cudaError_t)result->GetExitCode();
+  return result;
+}
+
+bool NullDevHandler::ReportLoad(
+    std::vector<gvirtus::communicators::DeviceLoad> &devices) {
+  std::shared_lock<std::shared_mutex> lock(mAllocationsMutex);
+  devices.push_back({mMemoryUsed, msMemoryTotal, -1});
+  return true;
+}
+
+void *NullDevHandler::Malloc(size_t size) {
+  /* as cudaMalloc, a zero sized allocation still gets an address */
+  size_t rounded =
+      size == 0 ? Alignment : (size + Alignment - 1) & ~(Alignment - 1);
+  {
+    std::unique_lock<std::shared_mutex> lock(mAllocationsMutex);
+    if (rounded > msMemoryTotal - mMemoryUsed) return NULL;
+    mMemoryUsed += rounded;
+  }
+  void *devPtr = aligned_alloc(Alignment, rounded);
+  std::unique_lock<std::shared_mutex> lock(mAllocationsMutex);
+  if (devPtr == NULL) {
+    mMemoryUsed -= rounded;
+    return NULL;
+  }
+  mAllocations[(uintptr_t)devPtr] = rounded;
+  gvirtus::common::LiveStats::AddMemory(rounded);
+  return devPtr;
+}
+
+bool NullDevHandler::Free(void *devPtr) {
+  {
+    std::unique_lock<std::shared_mutex> lock(mAllocationsMutex);
+    auto it = mAllocations.find((uintptr_t)devPtr);
+    if (it == mAllocations.end()) return false;
+    mMemoryUsed -= it->second;
+    gvirtus::common::LiveStats::AddMemory(-(int64_t)it->second);
+    mAllocations.erase(it);
+  }
+  free(devPtr);
+  return true;
+}
+
+bool NullDevHandler::IsDeviceRange(const void *ptr, size_t size) {
+  uintptr_t address = (uintptr_t)ptr;
+  std::shared_lock<std::shared_mutex> lock(mAllocationsMutex);
+  auto it = mAllocations.upper_bound(address);
+  if (it == mAllocations.begin()) return false;
+  --it;
+  size_t offset = address - it->first;
+  return offset <= it->second && size <= it->second - offset;
+}
+
+pointer_t NullDevHandler::CreateStream() {
+  auto stream = std::make_shared<Stream>();
+  pointer_t handle = (pointer_t)stream.get();
+  mStreams.Put(handle, stream);
+  return handle;
+}
+
+bool NullDevHandler::DestroyStream(pointer_t handle) {
+  return mStreams.Erase(handle);
+}
+
+std::shared_ptr<NullDevHandler::Stream> NullDevHandler::GetStream(
+    cudaStream_t stream) {
+  pointer_t handle = (pointer_t)stream;
+  /* 0, cudaStreamLegacy and cudaStreamPerThread */
+  if (handle <= 2)
+    return std::shared_ptr<Stream>(std::shared_ptr<Stream>(), &mDefaultStream);
+  std::shared_ptr<Stream> result;
+  mStreams.Find(handle, &result);
+  return result;
+}
+
+pointer_t NullDevHandler::CreateEvent() {
+  auto event = std::make_shared<Event>();
+  pointer_t handle = (pointer_t)event.get();
+  mEvents.Put(handle, event);
+  return handle;
+}
+
+bool NullDevHandler::DestroyEvent(pointer_t handle) {
+  return mEvents.Erase(handle);
+}
+
+std::shared_ptr<NullDevHandler::Event> NullDevHandler::GetEvent(
+    cudaEvent_t event) {
+  std::shared_ptr<Event> result;
+  mEvents.Find((pointer_t)event, &result);
+  return result;
+}
+
+uint64_t NullDevHandler::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/* moves busyUntil forward to time, never back */
+static void Advance(std::atomic<uint64_t> &busyUntil, uint64_t time) {
+  uint64_t busy = busyUntil.load();
+  while (busy < time && !busyUntil.compare_exchange_weak(busy, time))
+    ;
+}
+
+uint64_t NullDevHandler::Enqueue(Stream *stream, uint64_t duration) {
+  uint64_t now = Now();
+  uint64_t busy = stream->busyUntil.load();
+  uint64_t done;
+  do {
+    done = (busy > now ? busy : now) + duration;
+  } while (!stream->busyUntil.compare_exchange_weak(busy, done));
+  Advance(mBusyUntil, done);
+  return done;
+}
+
+void NullDevHandler::WaitFor(Stream *stream, uint64_t time) {
+  Advance(stream->busyUntil, time);
+  Advance(mBusyUntil, time);
+}
+
+void NullDevHandler::SleepUntil(uint64_t time) {
+  if (time <= Now()) return;
+  std::this_thread::sleep_until(std::chrono::steady_clock::time_point(
+      std::chrono::nanoseconds(time)));
+}
+
+void NullDevHandler::Synchronize() { SleepUntil(mBusyUntil.load()); }
+
+void NullDevHandler::RegisterDeviceFunction(pointer_t handler,
+                                            const char *function) {
+  mDeviceFunction.Put(handler, function);
+}
+
+bool NullDevHandler::IsDeviceFunction(pointer_t handler) {
+  return mDeviceFunction.Contains(handler);
+}
+
+/**
+ * Gives the variable its device memory, zeroed: the initial value is in the
+ * fat binary, which the null device does not read.
+ */
+void NullDevHandler::RegisterVar(pointer_t handler, size_t size) {
+  if (mVar.Contains(handler)) return;
+  void *devPtr = Malloc(size);
+  if (devPtr == NULL) return;
+  memset(devPtr, 0, size);
+  mVar.Put(handler, std::make_pair(devPtr, size));
+}
+
+void *NullDevHandler::GetSymbol(std::shared_ptr<Buffer> in, size_t *size) {
+  std::pair<void *, size_t> var(NULL, 0);
+  mVar.Find(in->Get<pointer_t>(), &var);
+  if (size != NULL) *size = var.second;
+  return var.first;
+}
+
+cudaError_t NullDevHandler::PeekAtLastError() { return tlsLastError; }
+
+int NullDevHandler::GetCurrentDevice() { return tlsDevice; }
+
+bool NullDevHandler::SetCurrentDevice(int device) {
+  if (!IsDevice(device)) return false;
+  tlsDevice = device;
+  return true;
+}
+
+cudaError_t NullDevHandler::GetLastError() {
+  cudaError_t error = tlsLastError;
+  tlsLastError = cudaSuccess;
+  return error;
+}
+
+void NullDevHandler::Initialize() {
+  if (mspHandlers != NULL) return;
+  mspHandlers = new map<string, NullDevHandler::NullDevRoutineHandler>();
+
+  /* NullDevHandler_device */
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(GetDevice));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(GetDeviceCount));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(GetDeviceProperties));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(SetDevice));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(SetDeviceFlags));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(DeviceReset));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(DeviceSynchronize));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(DeviceSetCacheConfig));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(DeviceSetLimit));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(DeviceGetAttribute));
+  mspHandlers->insert(
+      NULLDEV_ROUTINE_HANDLER_PAIR(DeviceGetStreamPriorityRange));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(GetErrorString));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(GetLastError));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(PeekAtLastError));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(ThreadExit));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(ThreadSynchronize));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(DriverGetVersion));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RuntimeGetVersion));
+
+  /* NullDevHandler_stream */
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(StreamCreate));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(StreamCreateWithFlags));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(StreamCreateWithPriority));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(StreamDestroy));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(StreamQuery));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(StreamSynchronize));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(StreamWaitEvent));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(EventCreate));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(EventCreateWithFlags));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(EventDestroy));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(EventElapsedTime));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(EventQuery));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(EventRecord));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(EventSynchronize));
+
+  /* NullDevHandler_memory */
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(Free));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(GetSymbolAddress));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(GetSymbolSize));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(Malloc));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(MallocPitch));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(Memcpy));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(MemcpyAsync));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(MemcpyFromSymbol));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(MemcpyToSymbol));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(MemcpyGather));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(Memset));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(Memset2D));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(HostArenaAttach));
+
+  /* NullDevHandler_execution */
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(ConfigureCall));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(FuncGetAttributes));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(FuncSetCacheConfig));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(FuncSetAttribute));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(Launch));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(LaunchKernel));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(SetupArgument));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(PushCallConfiguration));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(PopCallConfiguration));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterFatBinary));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterFatBinaryEnd));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(UnregisterFatBinary));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterFunction));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterVar));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterSharedVar));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterShared));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterTexture));
+  mspHandlers->insert(NULLDEV_ROUTINE_HANDLER_PAIR(RegisterSurface));
+}
@@ -0,0 +1,276 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   NullDevHandler.h
+ *
+ * @brief  A backend plugin answering the CUDA Runtime routines of the cudart
+ * frontend with a device made of host memory.
+ */
+
+#ifndef _NULLDEVHANDLER_H
+#define _NULLDEVHANDLER_H
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+
+#include <cuda_runtime_api.h>
+
+#include <gvirtus/backend/Handler.h>
+#include <gvirtus/common/Log.h>
+#include <gvirtus/common/Registry.h>
+#include <gvirtus/communicators/Result.h>
+
+#include "log4cplus/logger.h"
+#include "log4cplus/loggingmacros.h"
+
+using gvirtus::common::pointer_t;
+using gvirtus::common::Registry;
+using gvirtus::communicators::Buffer;
+using gvirtus::communicators::Result;
+
+/**
+ * NullDevHandler stands in for CudaRtHandler when the transport, and not the
+ * GPU, is what is measured or tested: it speaks the same protocol, so a
+ * backend listing "nulldev" instead of "cudart" among its plugins serves the
+ * unchanged cudart frontend.
+ *
+ * Device memory is host memory: copies and memsets are host copies, device
+ * pointers are host addresses. Kernels are not run. Each stream keeps the
+ * time at which its work would be done: a launch moves it forward by the
+ * simulated kernel duration, events record it and synchronizing sleeps until
+ * it. Routines the cudart plugin offers and this one does not (arrays,
+ * textures, OpenGL, IPC, ...) are reported as unknown by the backend.
+ *
+ * Configured by the environment of the backend:
+ *   GVIRTUS_NULLDEV_LAUNCH_NS  simulated duration of a kernel (default 0)
+ *   GVIRTUS_NULLDEV_MEMORY     bytes of device memory (default 16 GiB)
+ */
+class NullDevHandler : public gvirtus::backend::Handler {
+ public:
+  NullDevHandler();
+  virtual ~NullDevHandler();
+  bool CanExecute(std::string routine);
+  std::shared_ptr<Result> Execute(std::string routine,
+                                  std::shared_ptr<Buffer> input_buffer);
+  bool ReportLoad(std::vector<gvirtus::communicators::DeviceLoad> &devices);
+
+  /**
+   * A stream of the simulated device. Work is never queued, only timed.
+   */
+  struct Stream {
+    /* steady clock nanoseconds at which the last work enqueued is done */
+    std::atomic<uint64_t> busyUntil{0};
+  };
+
+  struct Event {
+    /* steady clock nanoseconds of the recorded point, 0 if never recorded */
+    std::atomic<uint64_t> time{0};
+  };
+
+  /**
+   * Device memory, 256 bytes aligned as cudaMalloc's.
+   *
+   * @return NULL if the device is out of memory.
+   */
+  void *Malloc(size_t size);
+  bool Free(void *devPtr);
+
+  /**
+   * Checks that [ptr, ptr + size) lies in one allocation: the backend is
+   * shared, a wrong pointer must not reach memcpy.
+   */
+  bool IsDeviceRange(const void *ptr, size_t size);
+
+  /*
+   * Streams and events are known by the address of their object. Stream 0,
+   * as cudaStreamLegacy and cudaStreamPerThread, is the default stream.
+   */
+  pointer_t CreateStream();
+  bool DestroyStream(pointer_t handle);
+  std::shared_ptr<Stream> GetStream(cudaStream_t stream);
+  pointer_t CreateEvent();
+  bool DestroyEvent(pointer_t handle);
+  std::shared_ptr<Event> GetEvent(cudaEvent_t event);
+
+  /**
+   * Appends work lasting duration nanoseconds to stream.
+   *
+   * @return when the work is done.
+   */
+  uint64_t Enqueue(Stream *stream, uint64_t duration);
+
+  /**
+   * Makes stream wait for the given point in time, as for an event.
+   */
+  void WaitFor(Stream *stream, uint64_t time);
+
+  /**
+   * Sleeps until the given point in time, or until every stream is done.
+   */
+  static void SleepUntil(uint64_t time);
+  void Synchronize();
+
+  static uint64_t Now();
+
+  inline uint64_t GetLaunchDuration() { return mLaunchDuration; }
+
+  /*
+   * Functions and variables are known by their handle, the address of the
+   * registered object in the frontend, as in CudaRtHandler.
+   */
+  void RegisterDeviceFunction(pointer_t handler, const char *function);
+  bool IsDeviceFunction(pointer_t handler);
+  void RegisterVar(pointer_t handler, size_t size);
+
+  /**
+   * Reads the handle of a symbol.
+   *
+   * @param size if not NULL, set to the size of the variable.
+   * @return the device memory of the variable, NULL if it is not registered.
+   */
+  void *GetSymbol(std::shared_ptr<Buffer> in, size_t *size = NULL);
+
+  static void FillProperties(cudaDeviceProp *prop);
+  static const char *GetErrorString(cudaError_t error);
+
+  /* the error of the last failed routine of the session, as cudaGetLastError
+   * reports it */
+  static cudaError_t PeekAtLastError();
+  static cudaError_t GetLastError();
+
+  /* the device the session selected, out of the GVIRTUS_NULLDEV_DEVICES
+   * alike ones */
+  static int GetCurrentDevice();
+  static bool SetCurrentDevice(int device);
+  static bool IsDevice(int device) { return device >= 0 && device < msDevices; }
+  static int GetDeviceCount() { return msDevices; }
+
+ private:
+  log4cplus::Logger logger;
+  void Initialize();
+  typedef std::shared_ptr<Result> (*NullDevRoutineHandler)(
+      NullDevHandler *, std::shared_ptr<Buffer>);
+  static std::map<std::string, NullDevRoutineHandler> *mspHandlers;
+  static uint64_t msMemoryTotal;
+  static int msDevices;
+
+  /* address -> size, ordered to find the allocation holding a pointer */
+  std::map<uintptr_t, size_t> mAllocations;
+  std::shared_mutex mAllocationsMutex;
+  uint64_t mMemoryUsed;
+
+  Stream mDefaultStream;
+  Registry<pointer_t, std::shared_ptr<Stream>> mStreams;
+  Registry<pointer_t, std::shared_ptr<Event>> mEvents;
+  /* the latest busyUntil of all the streams */
+  std::atomic<uint64_t> mBusyUntil;
+  uint64_t mLaunchDuration;
+
+  Registry<pointer_t, std::string> mDeviceFunction;
+  /* handle -> device memory and size */
+  Registry<pointer_t, std::pair<void *, size_t>> mVar;
+};
+
+#define NULLDEV_ROUTINE_HANDLER(name)                         \
+  std::shared_ptr<Result> handle##name(NullDevHandler *pThis, \
+                                       std::shared_ptr<Buffer> input_buffer)
+/* the routines keep their cudart name: the frontend cannot tell */
+#define NULLDEV_ROUTINE_HANDLER_PAIR(name) make_pair("cuda" #name, handle##name)
+
+/* NullDevHandler_device */
+NULLDEV_ROUTINE_HANDLER(GetDevice);
+NULLDEV_ROUTINE_HANDLER(GetDeviceCount);
+NULLDEV_ROUTINE_HANDLER(GetDeviceProperties);
+NULLDEV_ROUTINE_HANDLER(SetDevice);
+NULLDEV_ROUTINE_HANDLER(SetDeviceFlags);
+NULLDEV_ROUTINE_HANDLER(DeviceReset);
+NULLDEV_ROUTINE_HANDLER(DeviceSynchronize);
+NULLDEV_ROUTINE_HANDLER(DeviceSetCacheConfig);
+NULLDEV_ROUTINE_HANDLER(DeviceSetLimit);
+NULLDEV_ROUTINE_HANDLER(DeviceGetAttribute);
+NULLDEV_ROUTINE_HANDLER(DeviceGetStreamPriorityRange);
+NULLDEV_ROUTINE_HANDLER(GetErrorString);
+NULLDEV_ROUTINE_HANDLER(GetLastError);
+NULLDEV_ROUTINE_HANDLER(PeekAtLastError);
+NULLDEV_ROUTINE_HANDLER(ThreadExit);
+NULLDEV_ROUTINE_HANDLER(ThreadSynchronize);
+NULLDEV_ROUTINE_HANDLER(DriverGetVersion);
+NULLDEV_ROUTINE_HANDLER(RuntimeGetVersion);
+
+/* NullDevHandler_stream */
+NULLDEV_ROUTINE_HANDLER(StreamCreate);
+NULLDEV_ROUTINE_HANDLER(StreamCreateWithFlags);
+NULLDEV_ROUTINE_HANDLER(StreamCreateWithPriority);
+NULLDEV_ROUTINE_HANDLER(StreamDestroy);
+NULLDEV_ROUTINE_HANDLER(StreamQuery);
+NULLDEV_ROUTINE_HANDLER(StreamSynchronize);
+NULLDEV_ROUTINE_HANDLER(StreamWaitEvent);
+NULLDEV_ROUTINE_HANDLER(EventCreate);
+NULLDEV_ROUTINE_HANDLER(EventCreateWithFlags);
+NULLDEV_ROUTINE_HANDLER(EventDestroy);
+NULLDEV_ROUTINE_HANDLER(EventElapsedTime);
+NULLDEV_ROUTINE_HANDLER(EventQuery);
+NULLDEV_ROUTINE_HANDLER(EventRecord);
+NULLDEV_ROUTINE_HANDLER(EventSynchronize);
+
+/* NullDevHandler_memory */
+NULLDEV_ROUTINE_HANDLER(Free);
+NULLDEV_ROUTINE_HANDLER(GetSymbolAddress);
+NULLDEV_ROUTINE_HANDLER(GetSymbolSize);
+NULLDEV_ROUTINE_HANDLER(Malloc);
+NULLDEV_ROUTINE_HANDLER(MallocPitch);
+NULLDEV_ROUTINE_HANDLER(Memcpy);
+NULLDEV_ROUTINE_HANDLER(MemcpyAsync);
+NULLDEV_ROUTINE_HANDLER(MemcpyFromSymbol);
+NULLDEV_ROUTINE_HANDLER(MemcpyToSymbol);
+NULLDEV_ROUTINE_HANDLER(MemcpyGather);
+NULLDEV_ROUTINE_HANDLER(Memset);
+NULLDEV_ROUTINE_HANDLER(Memset2D);
+NULLDEV_ROUTINE_HANDLER(HostArenaAttach);
+
+/* NullDevHandler_execution */
+NULLDEV_ROUTINE_HANDLER(ConfigureCall);
+NULLDEV_ROUTINE_HANDLER(FuncGetAttributes);
+NULLDEV_ROUTINE_HANDLER(FuncSetCacheConfig);
+NULLDEV_ROUTINE_HANDLER(FuncSetAttribute);
+NULLDEV_ROUTINE_HANDLER(Launch);
+NULLDEV_ROUTINE_HANDLER(LaunchKernel);
+NULLDEV_ROUTINE_HANDLER(SetupArgument);
+NULLDEV_ROUTINE_HANDLER(PushCallConfiguration);
+NULLDEV_ROUTINE_HANDLER(PopCallConfiguration);
+NULLDEV_ROUTINE_HANDLER(RegisterFatBinary);
+NULLDEV_ROUTINE_HANDLER(RegisterFatBinaryEnd);
+NULLDEV_ROUTINE_HANDLER(UnregisterFatBinary);
+NULLDEV_ROUTINE_HANDLER(RegisterFunction);
+NULLDEV_ROUTINE_HANDLER(RegisterVar);
+NULLDEV_ROUTINE_HANDLER(RegisterSharedVar);
+NULLDEV_ROUTINE_HANDLER(RegisterShared);
+NULLDEV_ROUTINE_HANDLER(RegisterTexture);
+NULLDEV_ROUTINE_HANDLER(RegisterSurface);
+
+#endif /* _NULLDEVHANDLER_H */
@@ -0,0 +1,311 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "NullDevHandler.h"
+
+#include <cstring>
+
+using namespace std;
+
+/**
+ * The devices of the null device plugin, GVIRTUS_NULLDEV_DEVICES of them, one
+ * by default: compute capability 7.0 parts with a single multiprocessor and
+ * the memory set by GVIRTUS_NULLDEV_MEMORY, which they share.
+ */
+void NullDevHandler::FillProperties(cudaDeviceProp *prop) {
+  memset(prop, 0, sizeof(cudaDeviceProp));
+  strncpy(prop->name, "GVirtuS null device", sizeof(prop->name) - 1);
+  prop->totalGlobalMem = msMemoryTotal;
+  prop->sharedMemPerBlock = 48 << 10;
+  prop->regsPerBlock = 65536;
+  prop->warpSize = 32;
+  prop->memPitch = SIZE_MAX;
+  prop->maxThreadsPerBlock = 1024;
+  prop->maxThreadsDim[0] = 1024;
+  prop->maxThreadsDim[1] = 1024;
+  prop->maxThreadsDim[2] = 64;
+  prop->maxGridSize[0] = 0x7fffffff;
+  prop->maxGridSize[1] = 65535;
+  prop->maxGridSize[2] = 65535;
+  prop->totalConstMem = 64 << 10;
+  prop->major = 7;
+  prop->minor = 0;
+  prop->textureAlignment = 512;
+  prop->multiProcessorCount = 1;
+  prop->concurrentKernels = 1;
+  prop->asyncEngineCount = 1;
+  prop->unifiedAddressing = 1;
+  prop->maxThreadsPerMultiProcessor = 2048;
+}
+
+const char *NullDevHandler::GetErrorString(cudaError_t error) {
+  switch (error) {
+    case cudaSuccess:
+      return "no error";
+    case cudaErrorInvalidValue:
+      return "invalid argument";
+    case cudaErrorMemoryAllocation:
+      return "out of memory";
+    case cudaErrorInvalidDevice:
+      return "invalid device ordinal";
+    case cudaErrorInvalidDevicePointer:
+      return "invalid device pointer";
+    case cudaErrorInvalidSymbol:
+      return "invalid device symbol";
+    case cudaErrorInvalidResourceHandle:
+      return "invalid resource handle";
+    case cudaErrorInvalidDeviceFunction:
+      return "invalid device function";
+    case cudaErrorInvalidMemcpyDirection:
+      return "invalid copy direction for memcpy";
+    case cudaErrorNotReady:
+      return "device not ready";
+    default:
+      return "unrecognized error code";
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(GetDevice) {
+  try {
+    int *device = input_buffer->Assign<int>();
+    if (device == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    *device = NullDevHandler::GetCurrentDevice();
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(device);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(GetDeviceCount) {
+  try {
+    int *count = input_buffer->Assign<int>();
+    if (count == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    *count = NullDevHandler::GetDeviceCount();
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(count);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(GetDeviceProperties) {
+  try {
+    cudaDeviceProp *prop = input_buffer->Assign<cudaDeviceProp>();
+    int device = input_buffer->Get<int>();
+    if (prop == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    if (!NullDevHandler::IsDevice(device))
+      return std::make_shared<Result>(cudaErrorInvalidDevice);
+    NullDevHandler::FillProperties(prop);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(prop, 1);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(SetDevice) {
+  try {
+    int device = input_buffer->Get<int>();
+    return std::make_shared<Result>(NullDevHandler::SetCurrentDevice(device)
+                                        ? cudaSuccess
+                                        : cudaErrorInvalidDevice);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(SetDeviceFlags) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+/* allocations are left alone: other sessions share the device */
+NULLDEV_ROUTINE_HANDLER(DeviceReset) {
+  pThis->Synchronize();
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(DeviceSynchronize) {
+  pThis->Synchronize();
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(DeviceSetCacheConfig) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(DeviceSetLimit) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(DeviceGetAttribute) {
+  try {
+    int *value = input_buffer->Assign<int>();
+    if (value == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    cudaDeviceAttr attr = input_buffer->Get<cudaDeviceAttr>();
+    int device = input_buffer->Get<int>();
+    if (!NullDevHandler::IsDevice(device))
+      return std::make_shared<Result>(cudaErrorInvalidDevice);
+
+    cudaDeviceProp prop;
+    NullDevHandler::FillProperties(&prop);
+    switch (attr) {
+      case cudaDevAttrMaxThreadsPerBlock:
+        *value = prop.maxThreadsPerBlock;
+        break;
+      case cudaDevAttrMaxBlockDimX:
+      case cudaDevAttrMaxBlockDimY:
+      case cudaDevAttrMaxBlockDimZ:
+        *value = prop.maxThreadsDim[attr - cudaDevAttrMaxBlockDimX];
+        break;
+      case cudaDevAttrMaxGridDimX:
+      case cudaDevAttrMaxGridDimY:
+      case cudaDevAttrMaxGridDimZ:
+        *value = prop.maxGridSize[attr - cudaDevAttrMaxGridDimX];
+        break;
+      case cudaDevAttrMaxSharedMemoryPerBlock:
+        *value = (int)prop.sharedMemPerBlock;
+        break;
+      case cudaDevAttrTotalConstantMemory:
+        *value = (int)prop.totalConstMem;
+        break;
+      case cudaDevAttrWarpSize:
+        *value = prop.warpSize;
+        break;
+      case cudaDevAttrMaxRegistersPerBlock:
+        *value = prop.regsPerBlock;
+        break;
+      case cudaDevAttrMultiProcessorCount:
+        *value = prop.multiProcessorCount;
+        break;
+      case cudaDevAttrMaxThreadsPerMultiProcessor:
+        *value = prop.maxThreadsPerMultiProcessor;
+        break;
+      case cudaDevAttrComputeCapabilityMajor:
+        *value = prop.major;
+        break;
+      case cudaDevAttrComputeCapabilityMinor:
+        *value = prop.minor;
+        break;
+      case cudaDevAttrConcurrentKernels:
+        *value = prop.concurrentKernels;
+        break;
+      case cudaDevAttrAsyncEngineCount:
+        *value = prop.asyncEngineCount;
+        break;
+      case cudaDevAttrUnifiedAddressing:
+        *value = prop.unifiedAddressing;
+        break;
+      default:
+        *value = 0;
+        break;
+    }
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(value);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(DeviceGetStreamPriorityRange) {
+  try {
+    int *leastPriority = input_buffer->Assign<int>();
+    int *greatestPriority = input_buffer->Assign<int>();
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    /* priorities are accepted and ignored */
+    if (leastPriority != NULL) *leastPriority = 0;
+    if (greatestPriority != NULL) *greatestPriority = 0;
+    out->Add(leastPriority);
+    out->Add(greatestPriority);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(GetErrorString) {
+  try {
+    cudaError_t error = input_buffer->Get<cudaError_t>();
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->AddString(NullDevHandler::GetErrorString(error));
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(GetLastError) {
+  return std::make_shared<Result>(NullDevHandler::GetLastError());
+}
+
+NULLDEV_ROUTINE_HANDLER(PeekAtLastError) {
+  return std::make_shared<Result>(NullDevHandler::PeekAtLastError());
+}
+
+NULLDEV_ROUTINE_HANDLER(ThreadExit) {
+  pThis->Synchronize();
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(ThreadSynchronize) {
+  pThis->Synchronize();
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(DriverGetVersion) {
+  try {
+    int *version = input_buffer->Assign<int>();
+    if (version == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    *version = CUDART_VERSION;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(version);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(RuntimeGetVersion) {
+  try {
+    int *version = input_buffer->Assign<int>();
+    if (version == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    *version = CUDART_VERSION;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(version);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
@@ -0,0 +1,226 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "NullDevHandler.h"
+
+#include <cstring>
+
+using namespace std;
+
+/* the configuration pushed by the kernel launch stub of the session */
+struct CallConfiguration {
+  dim3 gridDim;
+  dim3 blockDim;
+  size_t sharedMem;
+  cudaStream_t stream;
+};
+
+static thread_local CallConfiguration tlsCallConfiguration;
+
+NULLDEV_ROUTINE_HANDLER(ConfigureCall) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(FuncGetAttributes) {
+  try {
+    input_buffer->Assign<cudaFuncAttributes>();
+    pointer_t handler = input_buffer->Get<pointer_t>();
+    if (!pThis->IsDeviceFunction(handler))
+      return std::make_shared<Result>(cudaErrorInvalidDeviceFunction);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    cudaFuncAttributes *attr = out->Delegate<cudaFuncAttributes>();
+    memset(attr, 0, sizeof(cudaFuncAttributes));
+    attr->maxThreadsPerBlock = 1024;
+    attr->ptxVersion = 70;
+    attr->binaryVersion = 70;
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(FuncSetCacheConfig) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(FuncSetAttribute) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+/* cudaConfigureCall, cudaSetupArgument and cudaLaunch in a request */
+NULLDEV_ROUTINE_HANDLER(Launch) {
+  try {
+    if (input_buffer->Get<int>() != 0x434e34c)
+      return std::make_shared<Result>(cudaErrorInvalidValue);
+    input_buffer->Get<dim3>();
+    input_buffer->Get<dim3>();
+    input_buffer->Get<size_t>();
+    cudaStream_t handle = input_buffer->Get<cudaStream_t>();
+
+    int ctrl;
+    while ((ctrl = input_buffer->Get<int>()) == 0x53544147) {
+      input_buffer->AssignAll<char>();
+      input_buffer->Get<size_t>();
+      input_buffer->Get<size_t>();
+    }
+    if (ctrl != 0x4c41554e)
+      return std::make_shared<Result>(cudaErrorInvalidValue);
+    pointer_t handler = input_buffer->Get<pointer_t>();
+
+    auto stream = pThis->GetStream(handle);
+    if (stream == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    if (!pThis->IsDeviceFunction(handler))
+      return std::make_shared<Result>(cudaErrorInvalidDeviceFunction);
+    pThis->Enqueue(stream.get(), pThis->GetLaunchDuration());
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+/* the arguments are not looked at: there is no kernel to pass them to */
+NULLDEV_ROUTINE_HANDLER(LaunchKernel) {
+  try {
+    pointer_t func = input_buffer->Get<pointer_t>();
+    input_buffer->Get<dim3>();
+    input_buffer->Get<dim3>();
+    input_buffer->Get<size_t>();
+    auto stream = pThis->GetStream(input_buffer->Get<cudaStream_t>());
+    if (stream == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    if (!pThis->IsDeviceFunction(func))
+      return std::make_shared<Result>(cudaErrorInvalidDeviceFunction);
+    pThis->Enqueue(stream.get(), pThis->GetLaunchDuration());
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(SetupArgument) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(PushCallConfiguration) {
+  try {
+    CallConfiguration &configuration = tlsCallConfiguration;
+    configuration.gridDim = input_buffer->Get<dim3>();
+    configuration.blockDim = input_buffer->Get<dim3>();
+    configuration.sharedMem = input_buffer->Get<size_t>();
+    configuration.stream = input_buffer->Get<cudaStream_t>();
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(PopCallConfiguration) {
+  CallConfiguration &configuration = tlsCallConfiguration;
+  std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+  out->Add(configuration.gridDim);
+  out->Add(configuration.blockDim);
+  out->AddMarshal(configuration.sharedMem);
+  out->AddMarshal(configuration.stream);
+  return std::make_shared<Result>(cudaSuccess, out);
+}
+
+/*
+ * The fat binaries are not loaded: only the functions and variables they
+ * register are remembered, to check the handles of later requests.
+ */
+
+NULLDEV_ROUTINE_HANDLER(RegisterFatBinary) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(RegisterFatBinaryEnd) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(UnregisterFatBinary) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(RegisterFunction) {
+  try {
+    input_buffer->Get<pointer_t>();
+    pointer_t hostfun = input_buffer->Get<pointer_t>();
+    char *deviceFun = input_buffer->AssignString();
+    input_buffer->AssignString();
+    input_buffer->Get<int>();
+    uint3 *tid = input_buffer->Assign<uint3>();
+    uint3 *bid = input_buffer->Assign<uint3>();
+    dim3 *bDim = input_buffer->Assign<dim3>();
+    dim3 *gDim = input_buffer->Assign<dim3>();
+    int *wSize = input_buffer->Assign<int>();
+    pThis->RegisterDeviceFunction(hostfun, deviceFun);
+
+    std::shared_ptr<Buffer> output_buffer = std::make_shared<Buffer>();
+    output_buffer->AddString(deviceFun);
+    output_buffer->Add(tid);
+    output_buffer->Add(bid);
+    output_buffer->Add(bDim);
+    output_buffer->Add(gDim);
+    output_buffer->Add(wSize);
+    return std::make_shared<Result>(cudaSuccess, output_buffer);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(RegisterVar) {
+  try {
+    input_buffer->Get<pointer_t>();
+    pointer_t hostVar = input_buffer->Get<pointer_t>();
+    input_buffer->AssignString();
+    input_buffer->AssignString();
+    input_buffer->Get<int>();
+    int size = input_buffer->Get<int>();
+    pThis->RegisterVar(hostVar, size);
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(RegisterSharedVar) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(RegisterShared) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(RegisterTexture) {
+  return std::make_shared<Result>(cudaSuccess);
+}
+
+NULLDEV_ROUTINE_HANDLER(RegisterSurface) {
+  return std::make_shared<Result>(cudaSuccess);
+}
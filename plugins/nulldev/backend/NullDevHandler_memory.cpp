@@ -0,0 +1,318 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "NullDevHandler.h"
+
+#include <cstring>
+
+using namespace std;
+
+/* the first entry of each copy of a cudaMemcpyGather request, as CudaUtil's */
+typedef enum { GatherMemcpy, GatherMemcpyAsync, GatherMemcpyToSymbol } GatherOp;
+
+/*
+ * The copies are done when the request is: what the stream ran before does
+ * not change device memory. Synchronous copies still wait for the device,
+ * as they would for the kernels of the default stream.
+ */
+
+NULLDEV_ROUTINE_HANDLER(Free) {
+  void *devPtr = input_buffer->GetFromMarshal<void *>();
+  if (devPtr == NULL) return std::make_shared<Result>(cudaSuccess);
+  return std::make_shared<Result>(pThis->Free(devPtr) ? cudaSuccess
+                                                      : cudaErrorInvalidValue);
+}
+
+NULLDEV_ROUTINE_HANDLER(GetSymbolAddress) {
+  void *devPtr = pThis->GetSymbol(input_buffer);
+  if (devPtr == NULL) return std::make_shared<Result>(cudaErrorInvalidSymbol);
+  std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+  out->AddMarshal(devPtr);
+  return std::make_shared<Result>(cudaSuccess, out);
+}
+
+NULLDEV_ROUTINE_HANDLER(GetSymbolSize) {
+  try {
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    size_t *size = out->Delegate<size_t>();
+    *size = *(input_buffer->Assign<size_t>());
+    if (pThis->GetSymbol(input_buffer, size) == NULL)
+      return std::make_shared<Result>(cudaErrorInvalidSymbol);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(Malloc) {
+  try {
+    size_t size = input_buffer->Get<size_t>();
+    void *devPtr = pThis->Malloc(size);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->AddMarshal(devPtr);
+    return std::make_shared<Result>(
+        devPtr != NULL ? cudaSuccess : cudaErrorMemoryAllocation, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(MallocPitch) {
+  try {
+    input_buffer->Get<size_t>();
+    size_t width = input_buffer->Get<size_t>();
+    size_t height = input_buffer->Get<size_t>();
+    size_t pitch = (width + 511) & ~(size_t)511;
+    void *devPtr = pThis->Malloc(pitch * height);
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->AddMarshal(devPtr);
+    out->Add(pitch);
+    return std::make_shared<Result>(
+        devPtr != NULL ? cudaSuccess : cudaErrorMemoryAllocation, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+/**
+ * Copies count bytes as cudaMemcpy would, the input laid out as the
+ * cudart frontend marshals it: kind and count at its end.
+ */
+static std::shared_ptr<Result> Copy(NullDevHandler *pThis,
+                                    std::shared_ptr<Buffer> input_buffer,
+                                    size_t count, cudaMemcpyKind kind) {
+  void *dst, *src;
+  std::shared_ptr<Buffer> out;
+  switch (kind) {
+    case cudaMemcpyHostToDevice:
+      dst = input_buffer->GetFromMarshal<void *>();
+      src = input_buffer->AssignAll<char>();
+      if (!pThis->IsDeviceRange(dst, count))
+        return std::make_shared<Result>(cudaErrorInvalidValue);
+      if (count > 0) memcpy(dst, src, count);
+      return std::make_shared<Result>(cudaSuccess);
+    case cudaMemcpyDeviceToHost:
+      /* skipping a char for fake host pointer */
+      input_buffer->Assign<char>();
+      src = input_buffer->GetFromMarshal<void *>();
+      if (!pThis->IsDeviceRange(src, count))
+        return std::make_shared<Result>(cudaErrorInvalidValue);
+      out = std::make_shared<Buffer>(count);
+      out->Add<char>((char *)src, count);
+      return std::make_shared<Result>(cudaSuccess, out);
+    case cudaMemcpyDeviceToDevice:
+      dst = input_buffer->GetFromMarshal<void *>();
+      src = input_buffer->GetFromMarshal<void *>();
+      if (!pThis->IsDeviceRange(dst, count) ||
+          !pThis->IsDeviceRange(src, count))
+        return std::make_shared<Result>(cudaErrorInvalidValue);
+      memmove(dst, src, count);
+      return std::make_shared<Result>(cudaSuccess);
+    default:
+      return std::make_shared<Result>(cudaErrorInvalidMemcpyDirection);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(Memcpy) {
+  try {
+    cudaMemcpyKind kind = input_buffer->BackGet<cudaMemcpyKind>();
+    size_t count = input_buffer->BackGet<size_t>();
+    pThis->Synchronize();
+    return Copy(pThis, input_buffer, count, kind);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(MemcpyAsync) {
+  try {
+    cudaStream_t handle = input_buffer->BackGet<cudaStream_t>();
+    cudaMemcpyKind kind = input_buffer->BackGet<cudaMemcpyKind>();
+    size_t count = input_buffer->BackGet<size_t>();
+    auto stream = pThis->GetStream(handle);
+    if (stream == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    /* host to host is done by the frontend */
+    if (kind == cudaMemcpyHostToHost || kind == cudaMemcpyDefault)
+      return std::make_shared<Result>(cudaSuccess);
+    pThis->Enqueue(stream.get(), 0);
+    return Copy(pThis, input_buffer, count, kind);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(MemcpyFromSymbol) {
+  try {
+    void *dst = input_buffer->GetFromMarshal<void *>();
+    char *symbol = (char *)pThis->GetSymbol(input_buffer);
+    size_t count = input_buffer->Get<size_t>();
+    size_t offset = input_buffer->Get<size_t>();
+    cudaMemcpyKind kind = input_buffer->Get<cudaMemcpyKind>();
+    if (symbol == NULL) return std::make_shared<Result>(cudaErrorInvalidSymbol);
+    if (!pThis->IsDeviceRange(symbol + offset, count))
+      return std::make_shared<Result>(cudaErrorInvalidValue);
+    pThis->Synchronize();
+
+    std::shared_ptr<Buffer> out;
+    switch (kind) {
+      case cudaMemcpyDeviceToHost:
+        out = std::make_shared<Buffer>(count);
+        out->Add<char>(symbol + offset, count);
+        return std::make_shared<Result>(cudaSuccess, out);
+      case cudaMemcpyDeviceToDevice:
+        if (!pThis->IsDeviceRange(dst, count))
+          return std::make_shared<Result>(cudaErrorInvalidValue);
+        memmove(dst, symbol + offset, count);
+        return std::make_shared<Result>(cudaSuccess);
+      default:
+        return std::make_shared<Result>(cudaErrorInvalidMemcpyDirection);
+    }
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(MemcpyToSymbol) {
+  try {
+    cudaMemcpyKind kind = input_buffer->BackGet<cudaMemcpyKind>();
+    size_t offset = input_buffer->BackGet<size_t>();
+    size_t count = input_buffer->BackGet<size_t>();
+    char *symbol = (char *)pThis->GetSymbol(input_buffer);
+    if (symbol == NULL) return std::make_shared<Result>(cudaErrorInvalidSymbol);
+    if (!pThis->IsDeviceRange(symbol + offset, count))
+      return std::make_shared<Result>(cudaErrorInvalidValue);
+    pThis->Synchronize();
+
+    void *src;
+    switch (kind) {
+      case cudaMemcpyHostToDevice:
+        src = input_buffer->AssignAll<char>();
+        break;
+      case cudaMemcpyDeviceToDevice:
+        src = input_buffer->GetFromMarshal<void *>();
+        if (!pThis->IsDeviceRange(src, count))
+          return std::make_shared<Result>(cudaErrorInvalidValue);
+        break;
+      default:
+        return std::make_shared<Result>(cudaErrorInvalidMemcpyDirection);
+    }
+    if (count > 0) memmove(symbol + offset, src, count);
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(MemcpyGather) {
+  try {
+    size_t entries = input_buffer->BackGet<size_t>();
+    cudaError_t exit_code = cudaSuccess;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    for (size_t i = 0; i < entries; i++) {
+      GatherOp op = input_buffer->Get<GatherOp>();
+      cudaError_t entry_code = cudaSuccess;
+      char *dst;
+      size_t offset = 0, count;
+      switch (op) {
+        case GatherMemcpy:
+          dst = input_buffer->GetFromMarshal<char *>();
+          break;
+        case GatherMemcpyAsync:
+          dst = input_buffer->GetFromMarshal<char *>();
+          if (pThis->GetStream(input_buffer->GetFromMarshal<cudaStream_t>()) ==
+              nullptr)
+            entry_code = cudaErrorInvalidResourceHandle;
+          break;
+        case GatherMemcpyToSymbol:
+          dst = (char *)pThis->GetSymbol(input_buffer);
+          offset = input_buffer->Get<size_t>();
+          if (dst == NULL) entry_code = cudaErrorInvalidSymbol;
+          break;
+        default:
+          return std::make_shared<Result>(cudaErrorInvalidValue);
+      }
+      /* the length is the prefix Buffer::Add(src, count) wrote */
+      char *src = input_buffer->AssignAll<char>(&count);
+      if (entry_code == cudaSuccess && !pThis->IsDeviceRange(dst + offset, count))
+        entry_code = cudaErrorInvalidValue;
+      if (entry_code == cudaSuccess && count > 0)
+        memcpy(dst + offset, src, count);
+      out->Add(entry_code);
+      if (exit_code == cudaSuccess) exit_code = entry_code;
+    }
+    return std::make_shared<Result>(exit_code, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(Memset) {
+  try {
+    void *devPtr = input_buffer->GetFromMarshal<void *>();
+    int value = input_buffer->Get<int>();
+    size_t count = input_buffer->Get<size_t>();
+    if (!pThis->IsDeviceRange(devPtr, count))
+      return std::make_shared<Result>(cudaErrorInvalidValue);
+    pThis->Synchronize();
+    memset(devPtr, value, count);
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(Memset2D) {
+  try {
+    char *devPtr = input_buffer->GetFromMarshal<char *>();
+    size_t pitch = input_buffer->Get<size_t>();
+    int value = input_buffer->Get<int>();
+    size_t width = input_buffer->Get<size_t>();
+    size_t height = input_buffer->Get<size_t>();
+    if (width > pitch ||
+        (height > 0 &&
+         !pThis->IsDeviceRange(devPtr, pitch * (height - 1) + width)))
+      return std::make_shared<Result>(cudaErrorInvalidValue);
+    pThis->Synchronize();
+    for (size_t row = 0; row < height; row++)
+      memset(devPtr + row * pitch, value, width);
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+/* there is no pinned memory to share: the frontend keeps copying on the
+ * wire */
+NULLDEV_ROUTINE_HANDLER(HostArenaAttach) {
+  return std::make_shared<Result>(cudaErrorInvalidValue);
+}
@@ -0,0 +1,205 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "NullDevHandler.h"
+
+using namespace std;
+
+NULLDEV_ROUTINE_HANDLER(StreamCreate) {
+  std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+  out->Add(pThis->CreateStream());
+  return std::make_shared<Result>(cudaSuccess, out);
+}
+
+NULLDEV_ROUTINE_HANDLER(StreamCreateWithFlags) {
+  try {
+    input_buffer->Get<unsigned int>();
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(pThis->CreateStream());
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(StreamCreateWithPriority) {
+  try {
+    input_buffer->Get<unsigned int>();
+    input_buffer->Get<int>();
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(pThis->CreateStream());
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+/* as cudaStreamDestroy, work still pending completes: nothing waits for it */
+NULLDEV_ROUTINE_HANDLER(StreamDestroy) {
+  try {
+    pointer_t stream = (pointer_t)input_buffer->Get<cudaStream_t>();
+    return std::make_shared<Result>(pThis->DestroyStream(stream)
+                                        ? cudaSuccess
+                                        : cudaErrorInvalidResourceHandle);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(StreamQuery) {
+  try {
+    auto stream = pThis->GetStream(input_buffer->Get<cudaStream_t>());
+    if (stream == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    return std::make_shared<Result>(
+        stream->busyUntil.load() <= NullDevHandler::Now() ? cudaSuccess
+                                                          : cudaErrorNotReady);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(StreamSynchronize) {
+  try {
+    auto stream = pThis->GetStream(input_buffer->Get<cudaStream_t>());
+    if (stream == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    NullDevHandler::SleepUntil(stream->busyUntil.load());
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(StreamWaitEvent) {
+  try {
+    auto stream = pThis->GetStream(input_buffer->Get<cudaStream_t>());
+    auto event = pThis->GetEvent(input_buffer->Get<cudaEvent_t>());
+    input_buffer->Get<unsigned int>();
+    if (stream == nullptr || event == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    pThis->WaitFor(stream.get(), event->time.load());
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(EventCreate) {
+  std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+  out->Add(pThis->CreateEvent());
+  return std::make_shared<Result>(cudaSuccess, out);
+}
+
+NULLDEV_ROUTINE_HANDLER(EventCreateWithFlags) {
+  try {
+    input_buffer->Get<int>();
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(pThis->CreateEvent());
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(EventDestroy) {
+  try {
+    pointer_t event = (pointer_t)input_buffer->Get<cudaEvent_t>();
+    return std::make_shared<Result>(pThis->DestroyEvent(event)
+                                        ? cudaSuccess
+                                        : cudaErrorInvalidResourceHandle);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(EventElapsedTime) {
+  try {
+    float *ms = input_buffer->Assign<float>();
+    auto start = pThis->GetEvent(input_buffer->Get<cudaEvent_t>());
+    auto end = pThis->GetEvent(input_buffer->Get<cudaEvent_t>());
+    if (ms == NULL) return std::make_shared<Result>(cudaErrorInvalidValue);
+    if (start == nullptr || end == nullptr || start->time.load() == 0 ||
+        end->time.load() == 0)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    uint64_t now = NullDevHandler::Now();
+    if (start->time.load() > now || end->time.load() > now)
+      return std::make_shared<Result>(cudaErrorNotReady);
+    *ms = ((double)end->time.load() - (double)start->time.load()) / 1e6;
+    std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+    out->Add(ms);
+    return std::make_shared<Result>(cudaSuccess, out);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(EventQuery) {
+  try {
+    auto event = pThis->GetEvent(input_buffer->Get<cudaEvent_t>());
+    if (event == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    return std::make_shared<Result>(
+        event->time.load() <= NullDevHandler::Now() ? cudaSuccess
+                                                    : cudaErrorNotReady);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+/* the event is the point at which the work already in the stream is done */
+NULLDEV_ROUTINE_HANDLER(EventRecord) {
+  try {
+    auto event = pThis->GetEvent(input_buffer->Get<cudaEvent_t>());
+    auto stream = pThis->GetStream(input_buffer->Get<cudaStream_t>());
+    if (event == nullptr || stream == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    event->time = pThis->Enqueue(stream.get(), 0);
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
+
+NULLDEV_ROUTINE_HANDLER(EventSynchronize) {
+  try {
+    auto event = pThis->GetEvent(input_buffer->Get<cudaEvent_t>());
+    if (event == nullptr)
+      return std::make_shared<Result>(cudaErrorInvalidResourceHandle);
+    NullDevHandler::SleepUntil(event->time.load());
+    return std::make_shared<Result>(cudaSuccess);
+  } catch (string e) {
+    cerr << e << endl;
+    return std::make_shared<Result>(cudaErrorMemoryAllocation);
+  }
+}
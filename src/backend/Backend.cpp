@@ -1,5 +1,6 @@
 #include "gvirtus/backend/Backend.h"
 
+#include <gvirtus/common/Log.h>
 #include <gvirtus/communicators/CommunicatorFactory.h>
 #include <gvirtus/communicators/EndpointFactory.h>
 
@@ -25,15 +26,15 @@ Backend::Backend(const fs::path &path) {
         exit(EXIT_FAILURE);
     }
 
-    LOG4CPLUS_DEBUG(logger, "✓ - " << fs::path(__FILE__).filename() << ":" << __LINE__ << ":" << " Json file has been loaded.");
+    GVIRTUS_LOG_DEBUG(logger, "✓ - " << fs::path(__FILE__).filename() << ":" << __LINE__ << ":" << " Json file has been loaded.");
 
     // endpoints setup
-    LOG4CPLUS_TRACE(logger, "🛈  - Initializing endpoints setup");
+    GVIRTUS_LOG_TRACE(logger, "🛈  - Initializing endpoints setup");
 
     _properties = common::JSON<Property>(path).parser();
     _children.reserve(_properties.endpoints());
 
-    LOG4CPLUS_TRACE(logger, "🛈  - Got properties and reserved children array");
+    GVIRTUS_LOG_TRACE(logger, "🛈  - Got properties and reserved children array");
 
     if (_properties.endpoints() > 1) LOG4CPLUS_INFO(logger, "🛈  - Application serves on " << _properties.endpoints() << " several endpoint");
 
@@ -42,7 +43,7 @@ Backend::Backend(const fs::path &path) {
             _children.push_back(
                     std::make_unique<Process>(
                             communicators::CommunicatorFactory::get_communicator(
-                                    communicators::EndpointFactory::get_endpoint(path),
+                                    communicators::EndpointFactory::get_endpoint(path, i),
                                     _properties.secure()
                             ),
                             _properties.plugins().at(i)
@@ -93,7 +94,7 @@ void Backend::Start() {
     //   "]: Started."); children->Start(); LOG4CPLUS_DEBUG(logger, "✓ - [Thread "
     //   << std::this_thread::get_id() << "]: Finished.");
     // };
-    LOG4CPLUS_DEBUG(logger, "✓ - [Process " << getpid() << "] " << "Backend::Start() called.");
+    GVIRTUS_LOG_DEBUG(logger, "✓ - [Process " << getpid() << "] " << "Backend::Start() called.");
 
     int pid = 0;
 
@@ -102,7 +103,7 @@ void Backend::Start() {
         activeChilds++;
         if ((pid = fork()) == 0) {
             _children[i]->Start();
-            LOG4CPLUS_TRACE(logger, "Child exited.");
+            GVIRTUS_LOG_TRACE(logger, "Child exited.");
             break;
         }
     }
@@ -114,21 +115,21 @@ void Backend::Start() {
         signal(SIGINT, SIG_IGN);
         signal(SIGHUP, SIG_IGN);
 
-        LOG4CPLUS_TRACE(logger, "Active childs: " << activeChilds);
+        GVIRTUS_LOG_TRACE(logger, "Active childs: " << activeChilds);
 
         int status;
         do {
-            LOG4CPLUS_DEBUG(logger, "✓ - [Process " << getpid() << "] " << "Waiting for childs to terminate. Current active childs: " << activeChilds);
+            GVIRTUS_LOG_DEBUG(logger, "✓ - [Process " << getpid() << "] " << "Waiting for childs to terminate. Current active childs: " << activeChilds);
             int waitres = wait(&status);
             activeChilds--;
 
-            LOG4CPLUS_TRACE(logger, "Active childs: %d" << activeChilds);
+            GVIRTUS_LOG_TRACE(logger, "Active childs: %d" << activeChilds);
 
             if (waitres < 0) {
-                LOG4CPLUS_TRACE(logger, "Error " << strerror(errno) << " on wait.");
+                GVIRTUS_LOG_TRACE(logger, "Error " << strerror(errno) << " on wait.");
             }
             else {
-                LOG4CPLUS_TRACE(logger, "Process " << waitres << " returned successfully.");
+                GVIRTUS_LOG_TRACE(logger, "Process " << waitres << " returned successfully.");
                 break;
             }
         } while (not WIFEXITED(status) and not WIFSIGNALED(status));
@@ -139,11 +140,11 @@ void Backend::Start() {
         pause();
     }
 
-    LOG4CPLUS_DEBUG(logger, "✓ - [Process " << getpid() << "] " << "Backend::Start() returned.");
+    GVIRTUS_LOG_DEBUG(logger, "✓ - [Process " << getpid() << "] " << "Backend::Start() returned.");
 }
 
 void Backend::EventOccurred(std::string &event, void *object) {
-    LOG4CPLUS_DEBUG(logger, "✓ - EventOccurred: " << event);
+    GVIRTUS_LOG_DEBUG(logger, "✓ - EventOccurred: " << event);
 }
 
 
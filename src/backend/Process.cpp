@@ -1,7 +1,13 @@
 #include "gvirtus/backend/Process.h"
 
 #include <gvirtus/common/JSON.h>
+#include <gvirtus/common/LiveStats.h>
+#include <gvirtus/common/Log.h>
+#include <gvirtus/common/Probe.h>
 #include <gvirtus/common/SignalException.h>
+#include <gvirtus/common/Stats.h>
+#include <gvirtus/common/Timeline.h>
+#include <gvirtus/communicators/ClockSync.h>
 #include <gvirtus/common/SignalState.h>
 
 #include <gvirtus/backend/Process.h>
@@ -12,8 +18,6 @@
 #include <thread>
 #include <iostream>
 
-#define DEBUG
-
 using gvirtus::backend::Process;
 using gvirtus::common::LD_Lib;
 using gvirtus::communicators::Buffer;
@@ -71,9 +75,7 @@ bool getstring(Communicator *c, string &s) {
             // if read, return true
             if (size > 0) {
                 s += std::string(buf);
-                printf("append\n");
                 //free(buf);
-                printf("free\n");
                 return true;
             }
         }
@@ -97,13 +99,20 @@ std::string getGVirtuSHome() {
 }
 
 void Process::Start() {
-    LOG4CPLUS_DEBUG(logger, "✓ - [Process " << getpid() << "] Process::Start() called.");
+    GVIRTUS_LOG_DEBUG(logger, "✓ - [Process " << getpid() << "] Process::Start() called.");
+
+    // dopo la fork: i thread che scrivono statistiche e timeline su SIGUSR2 e SIGUSR1
+    // sono di questo processo, e %p in GVIRTUS_TIMELINE è il suo pid, come il
+    // segmento delle statistiche live, che ogni endpoint ha suo
+    common::Stats::Init("backend");
+    common::Timeline::Init("backend");
+    common::LiveStats::Init();
 
     for_each(mPlugins.begin(), mPlugins.end(), [this](const std::string &plug) {
                  std::string gvirtus_home = getGVirtuSHome();
 
                  std::string to_append = "libgvirtus-plugin-" + plug + ".so";
-                 LOG4CPLUS_DEBUG(logger, "✓ - [Process " << getpid() << "] appending " << to_append << ".");
+                 GVIRTUS_LOG_DEBUG(logger, "✓ - [Process " << getpid() << "] appending " << to_append << ".");
 
                  auto ld_path = fs::path(gvirtus_home + "/lib").append(to_append);
 
@@ -120,16 +129,44 @@ void Process::Start() {
 
     // inserisci i sym dei plugin in h
     std::function<void(Communicator *)> execute = [=](Communicator *client_comm) {
-        LOG4CPLUS_DEBUG(logger, "✓ - [Process " << getpid() << "]" << "Process::Start()'s \"execute\" lambda called");
+        GVIRTUS_LOG_DEBUG(logger, "✓ - [Process " << getpid() << "]" << "Process::Start()'s \"execute\" lambda called");
         // carica i puntatori ai simboli dei moduli in mHandlers
 
         string routine;
         std::shared_ptr<Buffer> input_buffer = std::make_shared<Buffer>();
+        uint64_t id = 0;
+        // il nome dato dal frontend alla connessione nella timeline, e la differenza tra i due orologi
+        uint64_t session = 0;
+        int64_t offset = 0;
+        mSessions++;
+        common::LiveStats::Session *live = common::LiveStats::OpenSession();
 
         while (getstring(client_comm, routine)) {
-            LOG4CPLUS_DEBUG(logger, "✓ - Received routine " << routine);
+            GVIRTUS_LOG_DEBUG(logger, "✓ - Received routine " << routine);
 
+            auto received = steady_clock::now();
             input_buffer->Reset(client_comm);
+            auto unpacked = steady_clock::now();
+
+            // il carico del backend è servito dal processo stesso, senza plugin
+            if (routine == communicators::LoadReport::Routine) {
+                auto out = std::make_shared<Buffer>();
+                ReportLoad().Marshal(out.get());
+                std::make_shared<communicators::Result>(0, out)->Dump(client_comm);
+                continue;
+            }
+            // anche la sincronizzazione degli orologi, che non conta come richiesta
+            if (routine == communicators::ClockSync::Routine) {
+                auto sync = communicators::ClockSync::Unmarshal(input_buffer.get());
+                session = sync.session;
+                offset = sync.offset;
+                auto out = std::make_shared<Buffer>();
+                out->Add(common::Timeline::WallClock(steady_clock::now()));
+                std::make_shared<communicators::Result>(0, out)->Dump(client_comm);
+                continue;
+            }
+            id++;
+            GVIRTUS_PROBE(frame__received, routine.c_str(), id, input_buffer->GetBufferSize());
 
             std::shared_ptr<Handler> h = nullptr;
             for (auto &ptr_el : _handlers) {
@@ -140,24 +177,46 @@ void Process::Start() {
             }
 
             std::shared_ptr<communicators::Result> result;
+            auto start = steady_clock::now();
             if (h == nullptr) {
                 LOG4CPLUS_ERROR(logger, "✖ - [Process " << getpid() << "]: Requested unknown routine " << routine << ".");
                 result = std::make_shared<communicators::Result>(-1, std::make_shared<Buffer>());
             } else {
                 // esegue la routine e salva il risultato in result
-                auto start = steady_clock::now();
+                mRequests++;
+                GVIRTUS_PROBE(handler__start, routine.c_str(), id);
                 result = h->Execute(routine, input_buffer);
-                result->TimeTaken(std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start).count() / 1000.0);
+                GVIRTUS_PROBE(handler__end, routine.c_str(), id, result->GetExitCode());
+                mRequests--;
+                result->TimeTaken(std::chrono::duration<double>(steady_clock::now() - start).count());
             }
+            auto executed = steady_clock::now();
 
             // scrive il risultato sul communicator
             result->Dump(client_comm);
+            GVIRTUS_PROBE(reply__sent, routine.c_str(), id, result->GetOutputSize());
+            auto replied = steady_clock::now();
+            uint64_t latency = std::chrono::duration_cast<std::chrono::nanoseconds>(replied - received).count();
+            common::Stats::Record(routine.c_str(), input_buffer->GetBufferSize(), result->GetOutputSize(),
+                                  latency, (uint64_t) (result->TimeTaken() * 1e9));
+            common::LiveStats::Record(live, routine.c_str(), input_buffer->GetBufferSize(),
+                                      result->GetOutputSize(), latency, (uint64_t) (result->TimeTaken() * 1e9));
+            if (common::Timeline::IsEnabled())
+                common::Timeline::Record(routine.c_str(), session, id, -1,
+                                         {received, {unpacked, start, executed, replied}}, offset);
             if (result->GetExitCode() != 0 && routine.compare("cudaLaunch")) {
-                LOG4CPLUS_DEBUG(logger, "✓ - [Process " << getpid() << "]: Requested '" << routine << "' routine.");
-                LOG4CPLUS_DEBUG(logger, "✓ - - [Process " << getpid() << "]: Exit Code '" << result->GetExitCode() << "'.");
+                GVIRTUS_LOG_DEBUG(logger, "✓ - [Process " << getpid() << "]: Requested '" << routine << "' routine.");
+                GVIRTUS_LOG_DEBUG(logger, "✓ - - [Process " << getpid() << "]: Exit Code '" << result->GetExitCode() << "'.");
             }
         }
 
+        // la connessione è chiusa: i plugin rilasciano quanto tenuto dalla sessione
+        for (auto &ptr_el : _handlers)
+            ptr_el->obj_ptr()->SessionEnded();
+        common::LiveStats::CloseSession(live);
+        common::Stats::EndThread();
+        common::Timeline::EndThread();
+        mSessions--;
         Notify("process-ended");
     };
 
@@ -185,7 +244,7 @@ void Process::Start() {
             // check if process received SIGINT
 
             if (common::SignalState::get_signal_state(SIGINT)) {
-                LOG4CPLUS_DEBUG(logger, "✓ - SIGINT received, killing server on [Process " << getpid() << "]...");
+                GVIRTUS_LOG_DEBUG(logger, "✓ - SIGINT received, killing server on [Process " << getpid() << "]...");
                 break;
             }
 
@@ -195,10 +254,24 @@ void Process::Start() {
         LOG4CPLUS_ERROR(logger, "✖ - [Process " << getpid() << "]: " << exc);
     }
 
-    LOG4CPLUS_DEBUG(logger, "✓ - Process::Start() returned [Process " << getpid() << "].");
+    GVIRTUS_LOG_DEBUG(logger, "✓ - Process::Start() returned [Process " << getpid() << "].");
     //exit(EXIT_SUCCESS);
 }
 
+/**
+ * Reports the load of this backend to a frontend choosing among a pool. The
+ * session asking is not counted.
+ */
+gvirtus::communicators::LoadReport Process::ReportLoad() {
+    communicators::LoadReport report;
+    report.sessions = mSessions - 1;
+    report.requests = mRequests;
+    for (auto &ptr_el : _handlers)
+        if (ptr_el->obj_ptr()->ReportLoad(report.devices))
+            break;
+    return report;
+}
+
 Process::~Process() {
     _communicator.reset();
     _handlers.clear();
@@ -24,6 +24,7 @@
 
 #include "gvirtus/backend/Backend.h"
 #include "gvirtus/backend/Property.h"
+#include "gvirtus/common/Log.h"
 
 #include "log4cplus/configurator.h"
 #include "log4cplus/logger.h"
@@ -47,6 +48,9 @@ void loggerConfig() {
     log4cplus::LogLevel logLevel = logLevelString.empty() ? log4cplus::INFO_LOG_LEVEL : std::stoi(logLevelString);
 
     logger.setLogLevel(logLevel);
+    // handler loggers are children of the root logger: set it once here
+    log4cplus::Logger::getRoot().setLogLevel(logLevel);
+    gvirtus::common::Log::SetThreshold(logLevel);
 }
 
 /**
@@ -10,6 +10,7 @@
  */
 
 #include <gvirtus/common/Decoder.h>
+#include <gvirtus/common/Log.h>
 
 #include <cstdio>
 #include <iostream>
@@ -33,7 +34,7 @@ int Decoder::Decode(char value_in) { return Value(value_in); }
 
 int Decoder::Decode(const char *code_in, const int length_in,
                     char *plaintext_out) {
-  LOG4CPLUS_DEBUG(logger, "Decoder::Decode(const char*, const int, char *)");
+  GVIRTUS_LOG_DEBUG(logger, "Decoder::Decode(const char*, const int, char *)");
   return Block(code_in, length_in, plaintext_out);
 }
 
@@ -73,7 +74,7 @@ int Decoder::Value(char value_in) {
 
 int Decoder::Block(const char *code_in, const int length_in,
                    char *plaintext_out) {
-  LOG4CPLUS_DEBUG(logger, "Decoder::Block");
+  GVIRTUS_LOG_DEBUG(logger, "Decoder::Block");
   const char *codechar = code_in;
   char *plainchar = plaintext_out;
   char fragment;
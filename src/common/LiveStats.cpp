@@ -0,0 +1,197 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <gvirtus/common/LiveStats.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+
+using gvirtus::common::LiveStats;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "the counters are shared with other processes");
+
+LiveStats::Segment *LiveStats::mpSegment = nullptr;
+std::string LiveStats::msName;
+thread_local LiveStats::Session *LiveStats::tlsSession = nullptr;
+
+std::string LiveStats::DefaultName(int pid) {
+  return "/gvirtus-" + std::to_string(pid);
+}
+
+void LiveStats::Init() {
+  if (mpSegment != nullptr) return;
+  char *name = getenv("GVIRTUS_LIVE_STATS");
+  if (name != NULL && strcmp(name, "off") == 0) return;
+  msName = name != NULL && *name != 0 ? name : DefaultName(getpid());
+  if (msName[0] != '/') msName = "/" + msName;
+  /* so that the processes of the endpoints each have their own */
+  size_t pid = msName.find("%p");
+  if (pid != std::string::npos)
+    msName.replace(pid, 2, std::to_string(getpid()));
+
+  int fd = shm_open(msName.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (fd < 0) {
+    std::cerr << "GVIRTUS_LIVE_STATS: can't create " << msName << ": "
+              << strerror(errno) << std::endl;
+    return;
+  }
+  void *segment = MAP_FAILED;
+  if (ftruncate(fd, sizeof(Segment)) == 0)
+    segment = mmap(NULL, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED,
+                   fd, 0);
+  close(fd);
+  if (segment == MAP_FAILED) {
+    std::cerr << "GVIRTUS_LIVE_STATS: can't map " << msName << ": "
+              << strerror(errno) << std::endl;
+    shm_unlink(msName.c_str());
+    return;
+  }
+
+  /* the new file is zeros: every counter, slot and routine is free */
+  mpSegment = (Segment *)segment;
+  mpSegment->version = Version;
+  mpSegment->pid = getpid();
+  mpSegment->started =
+      duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+          .count();
+  mpSegment->magic.store(Magic, std::memory_order_release);
+  atexit(Remove);
+}
+
+LiveStats::Session *LiveStats::OpenSession() {
+  if (mpSegment == nullptr) return nullptr;
+  for (Session &session : mpSegment->sessions) {
+    uint64_t generation = session.generation.load(std::memory_order_relaxed);
+    if (generation % 2 == 1 ||
+        !session.generation.compare_exchange_strong(generation,
+                                                    generation + 1))
+      continue;
+    Counters &counters = session.counters;
+    counters.requests.store(0, std::memory_order_relaxed);
+    counters.requestBytes.store(0, std::memory_order_relaxed);
+    counters.replyBytes.store(0, std::memory_order_relaxed);
+    counters.latency.store(0, std::memory_order_relaxed);
+    counters.execution.store(0, std::memory_order_relaxed);
+    session.memory.store(0, std::memory_order_relaxed);
+    session.tid.store(syscall(SYS_gettid), std::memory_order_relaxed);
+    session.connected.store(
+        duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+            .count(),
+        std::memory_order_relaxed);
+    return tlsSession = &session;
+  }
+  mpSegment->sessionsLost.fetch_add(1, std::memory_order_relaxed);
+  return nullptr;
+}
+
+void LiveStats::CloseSession(Session *session) {
+  if (session == nullptr) return;
+  session->generation.fetch_add(1, std::memory_order_release);
+  if (tlsSession == session) tlsSession = nullptr;
+}
+
+static void Add(LiveStats::Counters &counters, size_t request_bytes,
+                size_t reply_bytes, uint64_t latency, uint64_t execution) {
+  counters.requests.fetch_add(1, std::memory_order_relaxed);
+  counters.requestBytes.fetch_add(request_bytes, std::memory_order_relaxed);
+  counters.replyBytes.fetch_add(reply_bytes, std::memory_order_relaxed);
+  counters.latency.fetch_add(latency, std::memory_order_relaxed);
+  counters.execution.fetch_add(execution, std::memory_order_relaxed);
+}
+
+void LiveStats::Record(Session *session, const char *routine,
+                       size_t request_bytes, size_t reply_bytes,
+                       uint64_t latency, uint64_t execution) {
+  if (session == nullptr) return;
+  Add(session->counters, request_bytes, reply_bytes, latency, execution);
+  Routine *slot = GetRoutine(routine);
+  if (slot != nullptr)
+    Add(slot->counters, request_bytes, reply_bytes, latency, execution);
+}
+
+/**
+ * The slot of routine, named on first use. Each thread remembers the slots
+ * it found: the table is only probed once per routine and thread.
+ */
+LiveStats::Routine *LiveStats::GetRoutine(const char *routine) {
+  static thread_local std::unordered_map<std::string, Routine *> tlsRoutines;
+  /* reused, so that looking up a routine allocates nothing */
+  static thread_local std::string key;
+  key.assign(routine, strnlen(routine, NameSize - 1));
+  auto it = tlsRoutines.find(key);
+  if (it != tlsRoutines.end()) return it->second;
+
+  size_t hash = std::hash<std::string>()(key);
+  for (size_t i = 0; i < MaxRoutines; i++) {
+    Routine &slot = mpSegment->routines[(hash + i) & (MaxRoutines - 1)];
+    uint32_t state = slot.state.load(std::memory_order_acquire);
+    if (state == 0 && slot.state.compare_exchange_strong(state, 1)) {
+      memcpy(slot.name, key.c_str(), key.size() + 1);
+      slot.state.store(2, std::memory_order_release);
+      return tlsRoutines[key] = &slot;
+    }
+    /* another thread is naming it, perhaps after this routine */
+    while (state == 1) {
+      std::this_thread::yield();
+      state = slot.state.load(std::memory_order_acquire);
+    }
+    if (strcmp(slot.name, key.c_str()) == 0) return tlsRoutines[key] = &slot;
+  }
+  return nullptr;
+}
+
+void LiveStats::Remove() { shm_unlink(msName.c_str()); }
+
+const LiveStats::Segment *LiveStats::Attach(const std::string &name) {
+  std::string path = name[0] == '/' ? name : "/" + name;
+  int fd = shm_open(path.c_str(), O_RDONLY, 0);
+  if (fd < 0) throw "LiveStats: can't open " + path + ": " + strerror(errno);
+  struct stat st;
+  void *segment = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && (size_t)st.st_size == sizeof(Segment))
+    segment = mmap(NULL, sizeof(Segment), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (segment == MAP_FAILED)
+    throw "LiveStats: " + path + " is not a segment of this version.";
+  const Segment *live = (const Segment *)segment;
+  if (live->magic.load(std::memory_order_acquire) != Magic ||
+      live->version != Version) {
+    munmap(segment, sizeof(Segment));
+    throw "LiveStats: " + path + " is not a segment of this version.";
+  }
+  return live;
+}
@@ -0,0 +1,61 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <gvirtus/common/SignalDumper.h>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <thread>
+
+using gvirtus::common::SignalDumper;
+
+/* the write end of the pipe of each signal, read by the handler */
+static int msPipes[NSIG];
+
+bool SignalDumper::Install(int signo, void (*dump)()) {
+  int fds[2];
+  if (pipe(fds) != 0) return false;
+  fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+  fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+  fcntl(fds[1], F_SETFL, O_NONBLOCK);
+  msPipes[signo] = fds[1];
+  std::thread(Run, fds[0], dump).detach();
+
+  struct sigaction action = {};
+  action.sa_handler = OnSignal;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  sigaction(signo, &action, NULL);
+  return true;
+}
+
+void SignalDumper::OnSignal(int signo) {
+  char c = 0;
+  if (write(msPipes[signo], &c, 1) < 0) return;
+}
+
+void SignalDumper::Run(int fd, void (*dump)()) {
+  char c;
+  while (read(fd, &c, 1) == 1) dump();
+}
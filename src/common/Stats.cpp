@@ -0,0 +1,302 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <gvirtus/common/Stats.h>
+
+#include <gvirtus/common/SignalDumper.h>
+
+#include <signal.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+using gvirtus::common::Histogram;
+using gvirtus::common::RoutineStats;
+using gvirtus::common::SignalDumper;
+using gvirtus::common::Stats;
+
+size_t Histogram::BucketOf(uint64_t value) {
+  if (value < (1u << SubBucketBits)) return (size_t)value;
+  unsigned msb = 63 - __builtin_clzll(value);
+  if (msb > MaxBits) return Buckets - 1;
+  unsigned shift = msb - SubBucketBits;
+  return ((size_t)(shift + 1) << SubBucketBits) +
+         (size_t)((value >> shift) & ((1u << SubBucketBits) - 1));
+}
+
+uint64_t Histogram::UpperBound(size_t bucket) {
+  if (bucket < (1u << SubBucketBits)) return bucket;
+  unsigned shift = (unsigned)(bucket >> SubBucketBits) - 1;
+  uint64_t sub = bucket & ((1u << SubBucketBits) - 1);
+  return (((1ull << SubBucketBits) + sub + 1) << shift) - 1;
+}
+
+void Histogram::Record(uint64_t value) {
+  mBuckets[BucketOf(value)]++;
+  mCount++;
+  mSum += value;
+  if (value < mMin) mMin = value;
+  if (value > mMax) mMax = value;
+}
+
+void Histogram::Merge(const Histogram &other) {
+  for (size_t i = 0; i < Buckets; i++) mBuckets[i] += other.mBuckets[i];
+  mCount += other.mCount;
+  mSum += other.mSum;
+  if (other.mMin < mMin) mMin = other.mMin;
+  if (other.mMax > mMax) mMax = other.mMax;
+}
+
+uint64_t Histogram::Percentile(double fraction) const {
+  if (mCount == 0) return 0;
+  uint64_t rank = (uint64_t)std::ceil(fraction * mCount);
+  if (rank == 0) rank = 1;
+  uint64_t seen = 0;
+  for (size_t i = 0; i < Buckets; i++) {
+    seen += mBuckets[i];
+    if (seen >= rank) return std::min(UpperBound(i), mMax);
+  }
+  return mMax;
+}
+
+void RoutineStats::Merge(const RoutineStats &other) {
+  calls += other.calls;
+  requestBytes += other.requestBytes;
+  replyBytes += other.replyBytes;
+  latency.Merge(other.latency);
+  execution.Merge(other.execution);
+  wire.Merge(other.wire);
+}
+
+bool Stats::msEnabled = false;
+Stats::Format Stats::msFormat = Stats::Json;
+std::string Stats::msSide;
+std::string Stats::msFile;
+std::mutex Stats::msThreadsMutex;
+std::vector<std::shared_ptr<Stats::ThreadStats>> *Stats::mpThreads =
+    new std::vector<std::shared_ptr<Stats::ThreadStats>>();
+std::unordered_map<std::string, RoutineStats> *Stats::mpEnded =
+    new std::unordered_map<std::string, RoutineStats>();
+thread_local Stats::ThreadStats *Stats::tlsStats = nullptr;
+
+void Stats::Init(const char *side) {
+  char *format = getenv("GVIRTUS_STATS");
+  if (format == NULL) return;
+  if (strcasecmp(format, "json") == 0)
+    msFormat = Json;
+  else if (strcasecmp(format, "prometheus") == 0)
+    msFormat = Prometheus;
+  else {
+    std::cerr << "GVIRTUS_STATS: unknown format '" << format
+              << "', expected json or prometheus" << std::endl;
+    return;
+  }
+  char *file = getenv("GVIRTUS_STATS_FILE");
+  msSide = side;
+  msFile = file == NULL ? "" : file;
+  msEnabled = true;
+  atexit(DumpToFile);
+  SignalDumper::Install(SIGUSR2, DumpToFile);
+}
+
+void Stats::Record(const char *routine, size_t request_bytes,
+                   size_t reply_bytes, uint64_t latency, uint64_t execution) {
+  if (!msEnabled) return;
+  /* reused, so that looking up a routine allocates nothing */
+  static thread_local std::string key;
+  ThreadStats *thread_stats = GetThreadStats();
+  key.assign(routine);
+  std::lock_guard<std::mutex> lock(thread_stats->mutex);
+  RoutineStats &stats = thread_stats->routines[key];
+  stats.calls++;
+  stats.requestBytes += request_bytes;
+  stats.replyBytes += reply_bytes;
+  stats.latency.Record(latency);
+  stats.execution.Record(execution);
+  stats.wire.Record(latency > execution ? latency - execution : 0);
+}
+
+void Stats::Dump(std::ostream &os, Format format) {
+  if (format == Json)
+    DumpJson(os);
+  else
+    DumpPrometheus(os);
+  os.flush();
+}
+
+/**
+ * The table of the calling thread, registered on first use. Tables outlive
+ * the threads that do not call EndThread(): what they counted is still
+ * dumped.
+ */
+Stats::ThreadStats *Stats::GetThreadStats() {
+  if (tlsStats != nullptr) return tlsStats;
+  auto stats = std::make_shared<ThreadStats>();
+  std::lock_guard<std::mutex> lock(msThreadsMutex);
+  mpThreads->push_back(stats);
+  return tlsStats = stats.get();
+}
+
+void Stats::EndThread() {
+  if (tlsStats == nullptr) return;
+  std::lock_guard<std::mutex> lock(msThreadsMutex);
+  for (auto it = mpThreads->begin(); it != mpThreads->end(); ++it) {
+    if (it->get() != tlsStats) continue;
+    {
+      std::lock_guard<std::mutex> thread_lock((*it)->mutex);
+      for (auto &routine : (*it)->routines)
+        (*mpEnded)[routine.first].Merge(routine.second);
+    }
+    mpThreads->erase(it);
+    break;
+  }
+  tlsStats = nullptr;
+}
+
+std::unordered_map<std::string, RoutineStats> Stats::Merge() {
+  std::lock_guard<std::mutex> lock(msThreadsMutex);
+  std::unordered_map<std::string, RoutineStats> merged(*mpEnded);
+  for (auto &thread_stats : *mpThreads) {
+    std::lock_guard<std::mutex> thread_lock(thread_stats->mutex);
+    for (auto &it : thread_stats->routines) merged[it.first].Merge(it.second);
+  }
+  return merged;
+}
+
+static void DumpJsonHistogram(std::ostream &os, const char *name,
+                              const Histogram &histogram) {
+  os << "\"" << name << "\":{\"count\":" << histogram.Count()
+     << ",\"sum\":" << histogram.Sum() << ",\"min\":" << histogram.Min()
+     << ",\"max\":" << histogram.Max()
+     << ",\"p50\":" << histogram.Percentile(0.5)
+     << ",\"p90\":" << histogram.Percentile(0.9)
+     << ",\"p99\":" << histogram.Percentile(0.99)
+     << ",\"p999\":" << histogram.Percentile(0.999) << ",\"buckets\":[";
+  bool first = true;
+  for (size_t i = 0; i < Histogram::Buckets; i++) {
+    if (histogram.BucketCount(i) == 0) continue;
+    os << (first ? "" : ",") << "[" << Histogram::UpperBound(i) << ","
+       << histogram.BucketCount(i) << "]";
+    first = false;
+  }
+  os << "]}";
+}
+
+/**
+ * One object per dump: {"side":..., "pid":..., "routines":{name:{...}}},
+ * durations in nanoseconds, buckets as [upper bound, count] pairs.
+ */
+void Stats::DumpJson(std::ostream &os) {
+  /* sorted, so that two dumps compare line by line */
+  auto merged = Merge();
+  std::map<std::string, RoutineStats *> sorted;
+  for (auto &it : merged) sorted[it.first] = &it.second;
+
+  os << "{\"side\":\"" << msSide << "\",\"pid\":" << getpid()
+     << ",\"routines\":{";
+  bool first = true;
+  for (auto &it : sorted) {
+    const RoutineStats &stats = *it.second;
+    os << (first ? "" : ",") << "\n\"" << it.first
+       << "\":{\"calls\":" << stats.calls
+       << ",\"request_bytes\":" << stats.requestBytes
+       << ",\"reply_bytes\":" << stats.replyBytes << ",";
+    DumpJsonHistogram(os, "latency_ns", stats.latency);
+    os << ",";
+    DumpJsonHistogram(os, "execution_ns", stats.execution);
+    os << ",";
+    DumpJsonHistogram(os, "wire_ns", stats.wire);
+    os << "}";
+    first = false;
+  }
+  os << "}}\n";
+}
+
+static void DumpPrometheusHistogram(std::ostream &os, const char *name,
+                                    const std::string &labels,
+                                    const Histogram &histogram) {
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < Histogram::Buckets; i++) {
+    if (histogram.BucketCount(i) == 0) continue;
+    cumulative += histogram.BucketCount(i);
+    os << name << "_bucket{" << labels << ",le=\""
+       << Histogram::UpperBound(i) / 1e9 << "\"} " << cumulative << "\n";
+  }
+  os << name << "_bucket{" << labels << ",le=\"+Inf\"} " << histogram.Count()
+     << "\n"
+     << name << "_sum{" << labels << "} " << histogram.Sum() / 1e9 << "\n"
+     << name << "_count{" << labels << "} " << histogram.Count() << "\n";
+}
+
+/**
+ * Prometheus text exposition format, durations in seconds.
+ */
+void Stats::DumpPrometheus(std::ostream &os) {
+  auto merged = Merge();
+  std::map<std::string, RoutineStats *> sorted;
+  for (auto &it : merged) sorted[it.first] = &it.second;
+
+  std::streamsize precision = os.precision(9);
+  os << "# TYPE gvirtus_requests_total counter\n";
+  for (auto &it : sorted)
+    os << "gvirtus_requests_total{side=\"" << msSide << "\",routine=\""
+       << it.first << "\"} " << it.second->calls << "\n";
+  os << "# TYPE gvirtus_request_bytes_total counter\n";
+  for (auto &it : sorted)
+    os << "gvirtus_request_bytes_total{side=\"" << msSide << "\",routine=\""
+       << it.first << "\"} " << it.second->requestBytes << "\n";
+  os << "# TYPE gvirtus_reply_bytes_total counter\n";
+  for (auto &it : sorted)
+    os << "gvirtus_reply_bytes_total{side=\"" << msSide << "\",routine=\""
+       << it.first << "\"} " << it.second->replyBytes << "\n";
+
+  const char *names[] = {"gvirtus_latency_seconds", "gvirtus_execution_seconds",
+                         "gvirtus_wire_seconds"};
+  for (int h = 0; h < 3; h++) {
+    os << "# TYPE " << names[h] << " histogram\n";
+    for (auto &it : sorted) {
+      std::string labels =
+          "side=\"" + msSide + "\",routine=\"" + it.first + "\"";
+      const RoutineStats &stats = *it.second;
+      DumpPrometheusHistogram(
+          os, names[h], labels,
+          h == 0 ? stats.latency : h == 1 ? stats.execution : stats.wire);
+    }
+  }
+  os.precision(precision);
+}
+
+void Stats::DumpToFile() {
+  if (msFile.empty()) {
+    Dump(std::cerr, msFormat);
+    return;
+  }
+  std::ofstream out(msFile, std::ios::app);
+  if (out) Dump(out, msFormat);
+}
+
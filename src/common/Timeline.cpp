@@ -0,0 +1,242 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <gvirtus/common/Timeline.h>
+
+#include <gvirtus/common/SignalDumper.h>
+
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using gvirtus::common::SignalDumper;
+using gvirtus::common::Timeline;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::chrono::system_clock;
+
+static const char *msFrontendSteps[] = {"marshal", "send", "wait", "receive"};
+static const char *msBackendSteps[] = {"read", "dispatch", "execute", "reply"};
+
+bool Timeline::msEnabled = false;
+bool Timeline::msFrontend = false;
+size_t Timeline::msCapacity = 16384;
+std::string Timeline::msFile;
+Timeline::TimePoint Timeline::msSteadyStart;
+int64_t Timeline::msWallStart = 0;
+std::mutex Timeline::msThreadsMutex;
+std::vector<std::shared_ptr<Timeline::ThreadEvents>> *Timeline::mpThreads =
+    new std::vector<std::shared_ptr<Timeline::ThreadEvents>>();
+Timeline::ThreadEvents *Timeline::mpEnded = nullptr;
+thread_local Timeline::ThreadEvents *Timeline::tlsEvents = nullptr;
+
+void Timeline::Init(const char *side) {
+  /* one reading of each clock: the steady one orders, the wall one aligns */
+  msSteadyStart = steady_clock::now();
+  msWallStart =
+      duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+          .count();
+
+  char *file = getenv("GVIRTUS_TIMELINE");
+  if (file == NULL || *file == 0) return;
+  char *capacity = getenv("GVIRTUS_TIMELINE_EVENTS");
+  if (capacity != NULL && strtoull(capacity, NULL, 0) > 0)
+    msCapacity = strtoull(capacity, NULL, 0);
+  msFile = file;
+  /* so that processes sharing the environment write their own file */
+  size_t pid = msFile.find("%p");
+  if (pid != std::string::npos)
+    msFile.replace(pid, 2, std::to_string(getpid()));
+  msFrontend = strcmp(side, "frontend") == 0;
+  mpEnded = new ThreadEvents();
+  mpEnded->ring.resize(msCapacity);
+  msEnabled = true;
+  atexit(DumpToFile);
+  SignalDumper::Install(SIGUSR1, DumpToFile);
+}
+
+int64_t Timeline::WallClock(TimePoint t) {
+  return msWallStart + duration_cast<nanoseconds>(t - msSteadyStart).count();
+}
+
+void Timeline::Record(const char *routine, uint64_t session, uint64_t id,
+                      int backend, const Steps &steps, int64_t offset) {
+  if (!msEnabled) return;
+  ThreadEvents *events = GetThreadEvents();
+  std::lock_guard<std::mutex> lock(events->mutex);
+  Event &event = events->Next();
+  strncpy(event.routine, routine, sizeof(event.routine) - 1);
+  event.routine[sizeof(event.routine) - 1] = 0;
+  event.session = session;
+  event.id = id;
+  event.backend = backend;
+  event.tid = events->tid;
+  event.times[0] = steps.begin == TimePoint() ? INT64_MIN
+                                              : WallClock(steps.begin) - offset;
+  for (int i = 0; i < 4; i++)
+    event.times[i + 1] = WallClock(steps.marks[i]) - offset;
+}
+
+/**
+ * The ring of the calling thread, registered on first use. Rings outlive
+ * the threads that do not call EndThread(): what they recorded is still
+ * dumped.
+ */
+Timeline::ThreadEvents *Timeline::GetThreadEvents() {
+  if (tlsEvents != nullptr) return tlsEvents;
+  auto events = std::make_shared<ThreadEvents>();
+  events->ring.resize(msCapacity);
+  events->tid = (int32_t)syscall(SYS_gettid);
+  std::lock_guard<std::mutex> lock(msThreadsMutex);
+  mpThreads->push_back(events);
+  return tlsEvents = events.get();
+}
+
+void Timeline::EndThread() {
+  if (tlsEvents == nullptr) return;
+  std::lock_guard<std::mutex> lock(msThreadsMutex);
+  for (auto it = mpThreads->begin(); it != mpThreads->end(); ++it) {
+    if (it->get() != tlsEvents) continue;
+    {
+      std::lock_guard<std::mutex> thread_lock((*it)->mutex);
+      size_t size = (*it)->ring.size();
+      uint64_t first = (*it)->recorded > size ? (*it)->recorded - size : 0;
+      for (uint64_t i = first; i < (*it)->recorded; i++)
+        mpEnded->Next() = (*it)->ring[i % size];
+    }
+    mpThreads->erase(it);
+    break;
+  }
+  tlsEvents = nullptr;
+}
+
+/* trace event times are microseconds */
+static void DumpTime(std::ostream &os, const char *key, int64_t ns) {
+  char time[32];
+  snprintf(time, sizeof(time), "\"%s\":%" PRId64 ".%03d", key, ns / 1000,
+           (int)(ns % 1000));
+  os << time;
+}
+
+static void DumpSpan(std::ostream &os, const char *name, const char *category,
+                     int64_t begin, int64_t end, long tid,
+                     const std::string &args) {
+  os << "{\"name\":\"" << name << "\",\"cat\":\"" << category
+     << "\",\"ph\":\"X\",";
+  DumpTime(os, "ts", begin);
+  os << ",";
+  DumpTime(os, "dur", end > begin ? end - begin : 0);
+  os << ",\"pid\":" << getpid() << ",\"tid\":" << tid << ",\"args\":" << args
+     << "},\n";
+}
+
+/* an arrow from or to the step that contains its time */
+static void DumpFlow(std::ostream &os, bool start, const char *name,
+                     const std::string &id, int64_t begin, int64_t end,
+                     long tid) {
+  os << "{\"name\":\"" << name << "\",\"cat\":\"flow\",\"ph\":\""
+     << (start ? "s" : "f") << "\",\"id\":\"" << id << "\",";
+  DumpTime(os, "ts", begin + (end - begin) / 2);
+  os << (start ? "" : ",\"bp\":\"e\"") << ",\"pid\":" << getpid()
+     << ",\"tid\":" << tid << "},\n";
+}
+
+void Timeline::DumpEvent(std::ostream &os, const Event &event) {
+  const char **steps = msFrontend ? msFrontendSteps : msBackendSteps;
+  char session[17];
+  snprintf(session, sizeof(session), "%016" PRIx64, event.session);
+  std::string args = "{\"session\":\"" + std::string(session) +
+                     "\",\"id\":" + std::to_string(event.id);
+  if (event.backend >= 0)
+    args += ",\"backend\":" + std::to_string(event.backend);
+  args += "}";
+
+  int first = event.times[0] == INT64_MIN ? 1 : 0;
+  DumpSpan(os, event.routine, msFrontend ? "frontend" : "backend",
+           event.times[first], event.times[4], event.tid, args);
+  for (int i = first; i < 4; i++)
+    DumpSpan(os, steps[i], "step", event.times[i], event.times[i + 1],
+             event.tid, args);
+
+  /* without a session the two sides cannot be matched */
+  if (event.session == 0) return;
+  std::string id = std::string(session) + "." + std::to_string(event.id);
+  if (msFrontend) {
+    DumpFlow(os, true, "request", id + ".request", event.times[1],
+             event.times[2], event.tid);
+    DumpFlow(os, false, "reply", id + ".reply", event.times[3],
+             event.times[4], event.tid);
+  } else {
+    DumpFlow(os, false, "request", id + ".request", event.times[0],
+             event.times[1], event.tid);
+    DumpFlow(os, true, "reply", id + ".reply", event.times[3], event.times[4],
+             event.tid);
+  }
+}
+
+/**
+ * The JSON array format: the files of several processes are merged by
+ * joining their arrays.
+ */
+void Timeline::Dump(std::ostream &os) {
+  char host[256] = "";
+  gethostname(host, sizeof(host) - 1);
+  os << "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << getpid()
+     << ",\"args\":{\"name\":\"gvirtus " << (msFrontend ? "frontend" : "backend")
+     << " " << host << ":" << getpid() << "\"}},\n";
+
+  std::lock_guard<std::mutex> lock(msThreadsMutex);
+  if (mpEnded != nullptr) DumpEvents(os, *mpEnded);
+  for (auto &events : *mpThreads) {
+    std::lock_guard<std::mutex> thread_lock(events->mutex);
+    DumpEvents(os, *events);
+  }
+  /* ends the array with an event that needs no comma after it */
+  os << "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" << getpid()
+     << ",\"args\":{\"sort_index\":" << (msFrontend ? 0 : 1) << "}}\n]\n";
+  os.flush();
+}
+
+/* the events of a ring still there, oldest first */
+void Timeline::DumpEvents(std::ostream &os, ThreadEvents &events) {
+  size_t size = events.ring.size();
+  uint64_t first = events.recorded > size ? events.recorded - size : 0;
+  for (uint64_t i = first; i < events.recorded; i++)
+    DumpEvent(os, events.ring[i % size]);
+}
+
+void Timeline::DumpToFile() {
+  std::ofstream out(msFile, std::ios::trunc);
+  if (out)
+    Dump(out);
+  else
+    std::cerr << "GVIRTUS_TIMELINE: can't write " << msFile << std::endl;
+}
+
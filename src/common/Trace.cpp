@@ -0,0 +1,191 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <gvirtus/common/Trace.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using gvirtus::common::Trace;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::chrono::system_clock;
+
+const char Trace::Magic[8] = {'G', 'V', 'T', 'R', 'A', 'C', 'E', 0};
+
+bool Trace::msEnabled = false;
+size_t Trace::msBulk = 4096;
+std::mutex Trace::msMutex;
+FILE *Trace::msOut = NULL;
+std::atomic<uint64_t> Trace::msCompleted{0};
+std::atomic<uint32_t> Trace::msThreads{0};
+steady_clock::time_point Trace::msStart;
+thread_local uint64_t Trace::tlsStream = 0;
+
+void Trace::Init() {
+  char *path = getenv("GVIRTUS_TRACE");
+  if (path == NULL) return;
+  char *bulk = getenv("GVIRTUS_TRACE_BULK");
+  if (bulk != NULL) msBulk = strtoull(bulk, NULL, 0);
+
+  if ((msOut = fopen(path, "wb")) == NULL) {
+    std::cerr << "GVIRTUS_TRACE: can't open " << path << ": "
+              << strerror(errno) << std::endl;
+    return;
+  }
+  setvbuf(msOut, NULL, _IOFBF, 1 << 20);
+  msStart = steady_clock::now();
+  uint32_t version = Version;
+  uint32_t threshold = (uint32_t)msBulk;
+  uint64_t start =
+      duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+          .count();
+  fwrite(Magic, sizeof(Magic), 1, msOut);
+  fwrite(&version, sizeof(version), 1, msOut);
+  fwrite(&threshold, sizeof(threshold), 1, msOut);
+  fwrite(&start, sizeof(start), 1, msOut);
+  msEnabled = true;
+  atexit(Close);
+}
+
+uint64_t Trace::Now() {
+  return duration_cast<nanoseconds>(steady_clock::now() - msStart).count();
+}
+
+Trace::Pending Trace::Start(uint64_t stream) {
+  return {Now(), msCompleted.load(), stream};
+}
+
+void Trace::WritePayload(const char *data, size_t size) {
+  uint64_t length = size;
+  uint8_t elided = msBulk != 0 && size > msBulk && size > 2 * Edge;
+  fwrite(&length, sizeof(length), 1, msOut);
+  fwrite(&elided, sizeof(elided), 1, msOut);
+  if (!elided) {
+    fwrite(data, 1, size, msOut);
+    return;
+  }
+  uint64_t hash = Hash(data + Edge, size - 2 * Edge);
+  fwrite(data, 1, Edge, msOut);
+  fwrite(data + size - Edge, 1, Edge, msOut);
+  fwrite(&hash, sizeof(hash), 1, msOut);
+}
+
+void Trace::Record(const Pending &pending, const char *routine, int backend,
+                   const char *request, size_t request_size, int exit_code,
+                   const char *reply, size_t reply_size) {
+  static thread_local uint32_t thread = msThreads++;
+  uint64_t duration = Now() - pending.time;
+  uint32_t backend_index = (uint32_t)backend;
+  int32_t code = exit_code;
+  uint16_t length = (uint16_t)strlen(routine);
+
+  std::lock_guard<std::mutex> lock(msMutex);
+  if (msOut == NULL) return;
+  fwrite(&pending.time, sizeof(pending.time), 1, msOut);
+  fwrite(&duration, sizeof(duration), 1, msOut);
+  fwrite(&pending.after, sizeof(pending.after), 1, msOut);
+  fwrite(&pending.stream, sizeof(pending.stream), 1, msOut);
+  fwrite(&thread, sizeof(thread), 1, msOut);
+  fwrite(&backend_index, sizeof(backend_index), 1, msOut);
+  fwrite(&code, sizeof(code), 1, msOut);
+  fwrite(&length, sizeof(length), 1, msOut);
+  fwrite(routine, 1, length, msOut);
+  WritePayload(request, request_size);
+  WritePayload(reply, reply_size);
+  msCompleted++;
+}
+
+void Trace::Close() {
+  std::lock_guard<std::mutex> lock(msMutex);
+  if (msOut != NULL) fclose(msOut);
+  msOut = NULL;
+}
+
+uint64_t Trace::Hash(const char *data, size_t size) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, data + i, sizeof(word));
+    hash = (hash ^ word) * 0x100000001b3ull;
+  }
+  for (; i < size; i++) hash = (hash ^ (uint8_t)data[i]) * 0x100000001b3ull;
+  return hash;
+}
+
+std::string Trace::Payload::Expand() const {
+  if (!elided) return head;
+  std::string frame(size, '\0');
+  memcpy(&frame[0], head.data(), head.size());
+  memcpy(&frame[size - tail.size()], tail.data(), tail.size());
+  return frame;
+}
+
+Trace::Reader::Reader(const std::string &path) : mIn(path, std::ios::binary) {
+  char magic[sizeof(Magic)];
+  uint32_t version, threshold;
+  if (!mIn.read(magic, sizeof(magic)) ||
+      memcmp(magic, Magic, sizeof(Magic)) != 0)
+    throw "Trace::Reader: " + path + " is not a trace.";
+  if (!mIn.read((char *)&version, sizeof(version)) || version != Version)
+    throw "Trace::Reader: " + path + " has an unknown version.";
+  mIn.read((char *)&threshold, sizeof(threshold));
+  mIn.read((char *)&mStartTime, sizeof(mStartTime));
+}
+
+bool Trace::Reader::ReadPayload(Payload &payload) {
+  uint8_t elided;
+  if (!mIn.read((char *)&payload.size, sizeof(payload.size)) ||
+      !mIn.read((char *)&elided, sizeof(elided)))
+    return false;
+  payload.elided = elided != 0;
+  if (!payload.elided) {
+    payload.head.resize(payload.size);
+    payload.tail.clear();
+    payload.hash = 0;
+    return (bool)mIn.read(&payload.head[0], payload.size);
+  }
+  payload.head.resize(Edge);
+  payload.tail.resize(Edge);
+  return mIn.read(&payload.head[0], Edge) && mIn.read(&payload.tail[0], Edge) &&
+         mIn.read((char *)&payload.hash, sizeof(payload.hash));
+}
+
+bool Trace::Reader::Next(Frame &frame) {
+  uint16_t length;
+  if (!mIn.read((char *)&frame.time, sizeof(frame.time)) ||
+      !mIn.read((char *)&frame.duration, sizeof(frame.duration)) ||
+      !mIn.read((char *)&frame.after, sizeof(frame.after)) ||
+      !mIn.read((char *)&frame.stream, sizeof(frame.stream)) ||
+      !mIn.read((char *)&frame.thread, sizeof(frame.thread)) ||
+      !mIn.read((char *)&frame.backend, sizeof(frame.backend)) ||
+      !mIn.read((char *)&frame.exitCode, sizeof(frame.exitCode)) ||
+      !mIn.read((char *)&length, sizeof(length)))
+    return false;
+  frame.routine.resize(length);
+  if (!mIn.read(&frame.routine[0], length)) return false;
+  return ReadPayload(frame.request) && ReadPayload(frame.reply);
+}
@@ -32,7 +32,6 @@
  *
  *
  */
-#define DEBUG
 #include "gvirtus/communicators/Buffer.h"
 
 using namespace std;
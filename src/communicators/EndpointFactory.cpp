@@ -1,3 +1,2 @@
 #include "gvirtus/communicators/EndpointFactory.h"
 
-int gvirtus::communicators::EndpointFactory::ind_endpoint = 0;
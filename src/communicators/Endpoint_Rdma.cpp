@@ -66,10 +66,9 @@ gvirtus::communicators::Endpoint_Rdma &gvirtus::communicators::Endpoint_Rdma::po
 }
 
 void gvirtus::communicators::from_json(const nlohmann::json &j, Endpoint_Rdma &end) {
-    auto el = j["communicator"][EndpointFactory::index()]["endpoint"];
-
-    end.suite(el.at("suite"));
-    end.protocol(el.at("protocol"));
-    end.address(el.at("server_address"));
-    end.port(el.at("port"));
+    /* j is the "endpoint" object of one communicator entry */
+    end.suite(j.at("suite"));
+    end.protocol(j.at("protocol"));
+    end.address(j.at("server_address"));
+    end.port(j.at("port"));
 }
\ No newline at end of file
@@ -67,10 +67,9 @@ Endpoint_Tcp &Endpoint_Tcp::port(const std::string &port) {
 }
 
 void gvirtus::communicators::from_json(const nlohmann::json &j, Endpoint_Tcp &end) {
-  auto el = j["communicator"][EndpointFactory::index()]["endpoint"];
-
-  end.suite(el.at("suite"));
-  end.protocol(el.at("protocol"));
-  end.address(el.at("server_address"));
-  end.port(el.at("port"));
+  /* j is the "endpoint" object of one communicator entry */
+  end.suite(j.at("suite"));
+  end.protocol(j.at("protocol"));
+  end.address(j.at("server_address"));
+  end.port(j.at("port"));
 }
@@ -26,6 +26,14 @@ void Result::Dump(Communicator *c) {
   }
 }
 
+size_t Result::GetOutputSize() const {
+  return mpOutputBuffer != NULL ? mpOutputBuffer->GetBufferSize() : 0;
+}
+
+std::shared_ptr<gvirtus::communicators::Buffer> Result::GetOutputBuffer() const {
+  return mpOutputBuffer;
+}
+
 void Result::TimeTaken(double time_taken) {
   mTimeTaken = time_taken;
 }
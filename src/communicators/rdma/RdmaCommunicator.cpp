@@ -7,6 +7,7 @@
 #include <arpa/inet.h>
 #include "RdmaCommunicator.h"
 
+#include <gvirtus/common/Probe.h>
 #include <gvirtus/communicators/Endpoint.h>
 #include <gvirtus/communicators/Endpoint_Tcp.h>
 #include <gvirtus/communicators/Endpoint_Rdma.h>
@@ -169,6 +170,7 @@ size_t RdmaCommunicator::Read(char *buffer, size_t size) {
         memcpy(buffer, preregisteredBuffer, size);
     }
 
+    GVIRTUS_PROBE(read, this, size, size);
     return size;
 }
 
@@ -199,6 +201,7 @@ size_t RdmaCommunicator::Write(const char *buffer, size_t size) {
         free(actualBuffer);
     }
 
+    GVIRTUS_PROBE(write, this, size);
     return size;
 }
 
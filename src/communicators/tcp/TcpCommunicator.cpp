@@ -43,12 +43,14 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #else
 #include <WinSock2.h>
 static bool initialized = false;
 #endif
 
+#include <gvirtus/common/Probe.h>
 #include <gvirtus/communicators/Endpoint.h>
 #include <gvirtus/communicators/Endpoint_Rdma.h>
 #include <gvirtus/communicators/Endpoint_Tcp.h>
@@ -110,7 +112,7 @@ TcpCommunicator::TcpCommunicator(int fd, const char *hostname) {
 }
 
 TcpCommunicator::~TcpCommunicator() {
-    //    close(mSocketFd);
+    ReleaseStream();
     delete[] mInAddr;
 }
 
@@ -194,7 +196,13 @@ void TcpCommunicator::Connect() {
 #endif
 }
 
-void TcpCommunicator::Close() {}
+void TcpCommunicator::Close() {
+    if (mSocketFd < 0)
+        return;
+    // the peer reads end of stream, even if another process shares the socket
+    shutdown(mSocketFd, SHUT_RDWR);
+    ReleaseStream();
+}
 
 size_t TcpCommunicator::Read(char *buffer, size_t size) {
 #ifdef DEBUG
@@ -216,6 +224,7 @@ size_t TcpCommunicator::Read(char *buffer, size_t size) {
 #ifdef DEBUG
     printf("TcpCommunicator::Read() returned %zu\n", ret_value);
 #endif
+    GVIRTUS_PROBE(read, this, size, ret_value);
 
     return ret_value;
 }
@@ -234,6 +243,7 @@ size_t TcpCommunicator::Write(const char *buffer, size_t size) {
 #ifdef DEBUG
     printf("TcpCommunicator::Write() returned %zu\n", size);
 #endif
+    GVIRTUS_PROBE(write, this, size);
 
     return size;
 }
@@ -249,14 +259,34 @@ void TcpCommunicator::InitializeStream() {
     mpInputBuf = new filebuf(i);
     mpOutputBuf = new filebuf(o);
 #else
+    // each buffer closes its descriptor, so they must not share one
     mpInputBuf = new __gnu_cxx::stdio_filebuf<char>(mSocketFd, ios_base::in);
-    mpOutputBuf = new __gnu_cxx::stdio_filebuf<char>(mSocketFd, ios_base::out);
+    mpOutputBuf = new __gnu_cxx::stdio_filebuf<char>(dup(mSocketFd), ios_base::out);
 #endif
 
     mpInput = new istream(mpInputBuf);
     mpOutput = new ostream(mpOutputBuf);
 }
 
+void TcpCommunicator::ReleaseStream() {
+    if (mSocketFd < 0)
+        return;
+    if (mpInputBuf == nullptr) {
+        close(mSocketFd);
+    } else {
+        mpOutput->flush();
+        delete mpInput;
+        delete mpOutput;
+        delete mpInputBuf;
+        delete mpOutputBuf;
+        mpInput = nullptr;
+        mpOutput = nullptr;
+        mpInputBuf = nullptr;
+        mpOutputBuf = nullptr;
+    }
+    mSocketFd = -1;
+}
+
 extern "C" std::shared_ptr <TcpCommunicator> create_communicator(
         std::shared_ptr <gvirtus::communicators::Endpoint> end) {
     std::string arg =
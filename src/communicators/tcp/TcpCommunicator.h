@@ -66,19 +66,21 @@ class TcpCommunicator : public Communicator {
 
  private:
   void InitializeStream();
-  std::istream *mpInput;
-  std::ostream *mpOutput;
+  /* closes the socket, with the streams on it if any */
+  void ReleaseStream();
+  std::istream *mpInput = nullptr;
+  std::ostream *mpOutput = nullptr;
   std::string mHostname;
-  char *mInAddr;
+  char *mInAddr = nullptr;
   int mInAddrSize;
   short mPort;
-  int mSocketFd;
+  int mSocketFd = -1;
 #ifdef _WIN32
-  std::filebuf *mpInputBuf;
-  std::filebuf *mpOutputBuf;
+  std::filebuf *mpInputBuf = nullptr;
+  std::filebuf *mpOutputBuf = nullptr;
 #else
-  __gnu_cxx::stdio_filebuf<char> *mpInputBuf;
-  __gnu_cxx::stdio_filebuf<char> *mpOutputBuf;
+  __gnu_cxx::stdio_filebuf<char> *mpInputBuf = nullptr;
+  __gnu_cxx::stdio_filebuf<char> *mpOutputBuf = nullptr;
 #endif
 };
 }  // namespace gvirtus::communicators
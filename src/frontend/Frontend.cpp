@@ -33,8 +33,15 @@
  *
  */
 
+#include <gvirtus/common/Log.h>
+#include <gvirtus/common/Probe.h>
+#include <gvirtus/common/Stats.h>
+#include <gvirtus/common/Timeline.h>
+#include <gvirtus/common/Trace.h>
+#include <gvirtus/communicators/ClockSync.h>
 #include <gvirtus/communicators/CommunicatorFactory.h>
 #include <gvirtus/communicators/EndpointFactory.h>
+#include <gvirtus/communicators/LoadReport.h>
 #include <gvirtus/frontend/Frontend.h>
 
 #include <pthread.h>
@@ -43,7 +50,11 @@
 #include <unistd.h>
 #include <iostream>
 
+#include <algorithm>
 #include <chrono>
+#include <mutex>
+#include <numeric>
+#include <random>
 
 #include <stdlib.h> /* getenv */
 #include "log4cplus/configurator.h"
@@ -52,16 +63,29 @@
 
 using namespace std;
 
+using gvirtus::common::Timeline;
 using gvirtus::communicators::Buffer;
+using gvirtus::communicators::ClockSync;
 using gvirtus::communicators::Communicator;
 using gvirtus::communicators::CommunicatorFactory;
+using gvirtus::communicators::Endpoint;
 using gvirtus::communicators::EndpointFactory;
+using gvirtus::communicators::LoadReport;
 using gvirtus::frontend::Frontend;
 
 using std::chrono::steady_clock;
 
 static Frontend msFrontend;
+static std::mutex msFrontendsMutex;
+static std::once_flag msConfigured;
+static std::vector<std::shared_ptr<gvirtus::communicators::Endpoint>> msEndpoints;
+// 需要所有后端都看到的请求（例如注册），以及已经收到全部这些请求的后端
+static std::mutex msBroadcastMutex;
+static vector<pair<string, Buffer *>> *msBroadcasts = new vector<pair<string, Buffer *>>();
+static vector<bool> *msPrimed = new vector<bool>();
 map<pthread_t, Frontend *> *Frontend::mpFrontends = NULL;
+vector<void (*)(const char *)> *Frontend::mpPreExecuteHooks = NULL;
+vector<void (*)(const char *)> *Frontend::mpPostExecuteHooks = NULL;
 static bool initialized = false;
 
 log4cplus::Logger logger;
@@ -72,17 +96,89 @@ std::string getEnvVar(std::string const &key) {
 }
 
 /**
- * 初始化前端对象。
- * 该函数负责配置日志记录器，设置日志级别，获取配置文件路径，创建通信器并连接到后端。
- * 
- * @param c 指向通信器对象的指针。
+ * 询问一个后端的负载，连接只用于这一次询问。
+ *
+ * @return 后端无法连接或不提供负载报告时返回false。
  */
-void Frontend::Init(Communicator *c) {
-    
+static bool QueryLoad(const std::shared_ptr<Endpoint> &endpoint, double *score) {
+    try {
+        auto communicator = CommunicatorFactory::create_communicator(endpoint);
+        communicator->Connect();
+        communicator->Write(LoadReport::Routine, strlen(LoadReport::Routine) + 1);
+        Buffer().Dump(communicator.get());
+        communicator->Sync();
+
+        int exit_code;
+        double time_taken;
+        size_t out_buffer_size;
+        if (communicator->Read((char *) &exit_code, sizeof(int)) != sizeof(int) ||
+            communicator->Read((char *) &time_taken, sizeof(double)) != sizeof(double) ||
+            communicator->Read((char *) &out_buffer_size, sizeof(size_t)) != sizeof(size_t))
+            return false;
+        Buffer out;
+        if (out_buffer_size > 0)
+            out.Read<char>(communicator.get(), out_buffer_size);
+        communicator->Close();
+
+        if (exit_code != 0)
+            return false;
+        LoadReport report = LoadReport::Unmarshal(&out);
+        *score = report.Score();
+        GVIRTUS_LOG_DEBUG(logger, "🛈  - Backend " << endpoint->to_string() << ": " << report.sessions
+                                << " session(s), " << report.requests << " request(s), score " << *score);
+        return true;
+    }
+    catch (const string & ex) {
+        LOG4CPLUS_WARN(logger, "✖ - Backend " << endpoint->to_string() << " not available: " << ex);
+    }
+    catch (const char * ex) {
+        LOG4CPLUS_WARN(logger, "✖ - Backend " << endpoint->to_string() << " not available: " << ex);
+    }
+    return false;
+}
+
+/**
+ * 从一组等价的后端中选择负载最低的一个（power of two choices）：
+ * 随机取两个能回答的后端，比较它们的负载；不用询问整个池。
+ * 没有后端回答时随机选一个，连接时再报告错误。
+ */
+static std::shared_ptr<Endpoint> ChooseBackend(const std::vector<std::shared_ptr<Endpoint>> &pool) {
+    if (pool.size() == 1)
+        return pool[0];
+
+    std::vector<size_t> order(pool.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(std::random_device()()));
+
+    int asked = 0;
+    size_t best = order[0];
+    double best_score = 0;
+    for (size_t i = 0; i < order.size() && asked < 2; i++) {
+        double score;
+        if (!QueryLoad(pool[order[i]], &score))
+            continue;
+        if (asked == 0 || score < best_score) {
+            best = order[i];
+            best_score = score;
+        }
+        asked++;
+    }
+
+    LOG4CPLUS_INFO(logger, "🛈  - Using backend " << pool[best]->to_string() << " of a pool of " << pool.size());
+    return pool[best];
+}
+
+/**
+ * 配置前端，每个进程只执行一次。
+ * 该函数负责配置日志记录器，设置日志级别，获取配置文件路径并解析端点；
+ * 之后的线程只需要创建自己的通信器并连接到后端。
+ */
+void Frontend::Configure() {
+
     // 配置基本的日志记录器
     log4cplus::BasicConfigurator basicConfigurator;
     basicConfigurator.configure();
-    
+
     // 获取日志记录器实例
     // 这个宏函数是为了做编码适配的，来区分unicode编码与别的编码
     logger = log4cplus::Logger::getInstance(LOG4CPLUS_TEXT("GVirtuS Frontend"));
@@ -94,8 +190,9 @@ void Frontend::Init(Communicator *c) {
     // 设置日志记录器的日志级别
     logger.setLogLevel(logLevel);
 
-    // 获取当前线程的ID
-    pid_t tid = syscall(SYS_gettid);
+    gvirtus::common::Stats::Init("frontend");
+    gvirtus::common::Trace::Init();
+    Timeline::Init("frontend");
 
     // 获取配置文件路径
     std::string config_path = getEnvVar("GVIRTUS_CONFIG");
@@ -103,51 +200,62 @@ void Frontend::Init(Communicator *c) {
     // 如果配置文件路径为空，则尝试从GVIRTUS_HOME环境变量中获取
     if (config_path.empty()) {
         config_path = getEnvVar("GVIRTUS_HOME") + "/etc/properties.json";
-        
+
         // 如果GVIRTUS_HOME环境变量也为空，则使用默认路径
         if (config_path.empty()) {
             config_path = "./properties.json";
         }
     }
 
-    // 声明一个默认的端点
-    // 这是一个智能指针，用于自动管理内存
-    // ！！！！！！！！！！！！！！！！！！！！！似乎并未使用
-    // TODO: 这里的default_endpoint似乎没有被使用，应该删除
-    std::unique_ptr<char> default_endpoint;
-
-    // 如果当前线程的前端对象不存在，则创建一个新的前端对象
-    if (mpFrontends->find(tid) == mpFrontends->end()) {
-        Frontend *f = new Frontend();
-        mpFrontends->insert(make_pair(tid, f));
-    }
-
     // 记录前端版本信息
     LOG4CPLUS_INFO(logger, "🛈  - GVirtuS frontend version " + config_path);
 
     try {
-        // 根据配置文件路径创建端点
-        auto endpoint = EndpointFactory::get_endpoint(config_path);
-
-        // 根据端点创建通信器并连接到后端
-        mpFrontends->find(tid)->second->_communicator = CommunicatorFactory::get_communicator(endpoint);
-        mpFrontends->find(tid)->second->_communicator->obj_ptr()->Connect();
+        // 根据配置文件路径创建所有后端的端点，所有线程共用（只读）；
+        // 每个后端池在这里选定一个成员，进程的所有线程都使用它
+        for (auto &pool : EndpointFactory::get_backends(config_path))
+            msEndpoints.push_back(ChooseBackend(pool));
+        msPrimed->assign(msEndpoints.size(), false);
     }
     catch (const string & ex) {
         // 记录错误信息并退出程序
         LOG4CPLUS_ERROR(logger, "✖ - " << fs::path(__FILE__).filename() << ":" << __LINE__ << ":" << " Exception occurred: " << ex);
         exit(EXIT_FAILURE);
     }
+}
+
+/**
+ * 初始化当前线程的前端对象。
+ * 第一次调用时配置整个进程，然后创建通信器并连接到第一个后端，
+ * 其他后端在线程第一次选择它们时才连接。
+ * 
+ * @param c 指向通信器对象的指针。
+ */
+void Frontend::Init(Communicator *c) {
+    auto start = steady_clock::now();
+
+    std::call_once(msConfigured, Configure);
 
     // 初始化输入、输出和启动缓冲区
-    mpFrontends->find(tid)->second->mpInputBuffer = std::make_shared<Buffer>();
-    mpFrontends->find(tid)->second->mpOutputBuffer = std::make_shared<Buffer>();
-    mpFrontends->find(tid)->second->mpLaunchBuffer = std::make_shared<Buffer>();
-    
+    mpInputBuffer = std::make_shared<Buffer>();
+    mpOutputBuffer = std::make_shared<Buffer>();
+    mpLaunchBuffer = std::make_shared<Buffer>();
+
+    mCommunicators.resize(msEndpoints.size());
+    mRequestIds.resize(msEndpoints.size());
+    mSessions.resize(msEndpoints.size());
+    Connect(0);
+    mBackend = 0;
+    _communicator = mCommunicators[0];
+    Prime(0);
+
     // 设置退出码和初始化标志
-    mpFrontends->find(tid)->second->mExitCode = -1;
-    mpFrontends->find(tid)->second->mpInitialized = true;
+    mExitCode = -1;
+    mpInitialized = true;
 
+    mInitTime = std::chrono::duration<double>(steady_clock::now() - start).count();
+    GVIRTUS_LOG_DEBUG(logger, "🛈  - Thread " << syscall(SYS_gettid) << " frontend initialized in "
+                            << mInitTime * 1000000 << " us");
 }
 
 Frontend::~Frontend() {
@@ -156,8 +264,6 @@ Frontend::~Frontend() {
         return;
     }
 
-    pid_t tid = syscall(SYS_gettid);  // getting frontend's tid
-
     auto env = getenv("GVIRTUS_DUMP_STATS");
     auto dump_stats =
             env != nullptr && (strcasecmp(env, "on") == 0 || strcasecmp(env, "true") == 0 || strcmp(env, "1") == 0);
@@ -165,7 +271,8 @@ Frontend::~Frontend() {
     map<pthread_t, Frontend *>::iterator it;
     for (it = mpFrontends->begin(); it != mpFrontends->end(); it++) {
         if (dump_stats) {
-            std::cerr << "[GVIRTUS_STATS] Executed " << it->second->mRoutinesExecuted << " routine(s) in "
+            std::cerr << "[GVIRTUS_STATS] Initialized in " << it->second->mInitTime * 1000000 << " us\n"
+                      << "[GVIRTUS_STATS] Executed " << it->second->mRoutinesExecuted << " routine(s) in "
                       << it->second->mRoutineExecutionTime << " second(s)\n"
                       << "[GVIRTUS_STATS] Sent " << it->second->mDataSent / (1024 * 1024.0) << " Mb(s) in "
                       << it->second->mSendingTime
@@ -174,29 +281,39 @@ Frontend::~Frontend() {
                       << it->second->mReceivingTime
                       << " second(s)\n";
         }
-        mpFrontends->erase(it);
     }
+    mpFrontends->clear();
 }
 
 Frontend *Frontend::GetFrontend(Communicator *c) {
-    // mpFrontends是Frontend类的一个静态变量
-    // 由于为每个线程都创建了一个kv，所以不存在并发问题
-    // Frontend不是单例，每个线程拥有一个
-    if (mpFrontends == nullptr)
-        mpFrontends = new map<pthread_t, Frontend *>();
+    // Frontend不是单例，每个线程拥有一个；
+    // 线程找到自己的实例后直接从thread_local中取，不再查表
+    static thread_local Frontend *tlsFrontend = nullptr;
+    if (tlsFrontend != nullptr)
+        return tlsFrontend;
 
     //获取当前thread id，用于查找Frontend
     pid_t tid = syscall(SYS_gettid);  // getting frontend's tid
 
-    // 根据id查找 对应的Frontend* 实例，如果找到则返回
-    if (mpFrontends->find(tid) != mpFrontends->end())
-        return mpFrontends->find(tid)->second;
+    {
+        // mpFrontends被所有线程共享，修改时需要加锁
+        std::lock_guard<std::mutex> lock(msFrontendsMutex);
+        if (mpFrontends == nullptr)
+            mpFrontends = new map<pthread_t, Frontend *>();
+
+        // 根据id查找 对应的Frontend* 实例，如果找到则返回
+        auto it = mpFrontends->find(tid);
+        if (it != mpFrontends->end())
+            return tlsFrontend = it->second;
+    }
 
     // 找不到当前线程的Frontend则创建一个
     Frontend *f = new Frontend();
     try {
         f->Init(c);
-        mpFrontends->insert(make_pair(tid, f));
+        std::lock_guard<std::mutex> lock(msFrontendsMutex);
+        (*mpFrontends)[tid] = f;
+        tlsFrontend = f;
     }
     catch (const char *e) {
         cerr << "Error: cannot create Frontend ('" << e << "')" << endl;
@@ -205,43 +322,234 @@ Frontend *Frontend::GetFrontend(Communicator *c) {
     return f;
 }
 
+int Frontend::GetBackendCount() {
+    std::call_once(msConfigured, Configure);
+    return (int) msEndpoints.size();
+}
+
+void Frontend::SelectBackend(int backend) {
+    if (backend == mBackend)
+        return;
+
+    // 暂存的请求属于当前后端，切换之前先发送
+    if (mpPreExecuteHooks != nullptr)
+        for (auto hook : *mpPreExecuteHooks) hook(nullptr);
+
+    if (mCommunicators[backend] == nullptr)
+        Connect(backend);
+    Prime(backend);
+    mBackend = backend;
+    _communicator = mCommunicators[backend];
+}
+
+void Frontend::Broadcast(const char *routine, const Buffer *input_buffer) {
+    if (input_buffer == nullptr) input_buffer = mpInputBuffer.get();
+
+    if (msEndpoints.size() == 1) {
+        Execute(routine, input_buffer);
+        return;
+    }
+
+    if (mpPreExecuteHooks != nullptr)
+        for (auto hook : *mpPreExecuteHooks) hook(routine);
+
+    std::lock_guard<std::mutex> lock(msBroadcastMutex);
+    msBroadcasts->push_back(make_pair(string(routine), new Buffer(*input_buffer)));
+    for (int backend = 0; backend < (int) msEndpoints.size(); backend++)
+        if ((*msPrimed)[backend] && backend != mBackend)
+            ExecuteOn(backend, routine, input_buffer);
+    // 当前后端最后执行，留下它的应答
+    Execute(routine, input_buffer);
+}
+
+/**
+ * 为当前线程创建到某个后端的通信器并连接（通信器库只加载一次）。
+ */
+void Frontend::Connect(int backend) {
+    try {
+        mCommunicators[backend] = CommunicatorFactory::create_communicator(msEndpoints[backend]);
+        mCommunicators[backend]->Connect();
+        if (Timeline::IsEnabled())
+            SyncClock(backend);
+    }
+    catch (const string & ex) {
+        // 记录错误信息并退出程序
+        LOG4CPLUS_ERROR(logger, "✖ - " << fs::path(__FILE__).filename() << ":" << __LINE__ << ":" << " Exception occurred: " << ex);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * 为时间线给连接起一个会话名，并测量后端时钟与本进程时钟之差：
+ * 往返ClockSync::Rounds次，取最快的一次往返的估计，最后一次请求把它告诉后端，
+ * 后端据此把这个会话的请求写在本进程的时钟上。
+ */
+void Frontend::SyncClock(int backend) {
+    auto &communicator = mCommunicators[backend];
+    ClockSync sync;
+    while (sync.session == 0)
+        sync.session = std::mt19937_64(std::random_device()())();
+    mSessions[backend] = sync.session;
+
+    int64_t best_round_trip = INT64_MAX;
+    for (int round = 0; round <= ClockSync::Rounds; round++) {
+        Buffer in;
+        sync.Marshal(&in);
+        int64_t sent = Timeline::WallClock(steady_clock::now());
+        communicator->Write(ClockSync::Routine, strlen(ClockSync::Routine) + 1);
+        in.Dump(communicator.get());
+        communicator->Sync();
+
+        int exit_code;
+        double time_taken;
+        size_t out_buffer_size;
+        communicator->Read((char *) &exit_code, sizeof(int));
+        communicator->Read((char *) &time_taken, sizeof(double));
+        communicator->Read((char *) &out_buffer_size, sizeof(size_t));
+        Buffer out;
+        if (out_buffer_size > 0)
+            out.Read<char>(communicator.get(), out_buffer_size);
+        int64_t received = Timeline::WallClock(steady_clock::now());
+        if (exit_code != 0) {
+            LOG4CPLUS_WARN(logger, "✖ - Backend " << backend << " does not measure its clock: "
+                                   "its timeline is not aligned with this one");
+            return;
+        }
+
+        int64_t remote = out.Get<int64_t>();
+        if (round < ClockSync::Rounds && received - sent < best_round_trip) {
+            best_round_trip = received - sent;
+            sync.offset = remote - (sent + (received - sent) / 2);
+        }
+    }
+    GVIRTUS_LOG_DEBUG(logger, "🛈  - Backend " << backend << " clock is " << sync.offset
+                            << " ns ahead, measured in a round trip of " << best_round_trip << " ns");
+}
+
+/**
+ * 进程第一次使用某个后端时，按顺序重放所有广播过的请求。
+ */
+void Frontend::Prime(int backend) {
+    std::lock_guard<std::mutex> lock(msBroadcastMutex);
+    if ((*msPrimed)[backend])
+        return;
+    for (auto &request : *msBroadcasts)
+        ExecuteOn(backend, request.first.c_str(), request.second);
+    (*msPrimed)[backend] = true;
+}
+
+/**
+ * 在另一个后端上执行请求，不改变当前线程选择的后端。
+ */
+void Frontend::ExecuteOn(int backend, const char *routine, const Buffer *input_buffer) {
+    int selected = mBackend;
+    if (mCommunicators[backend] == nullptr)
+        Connect(backend);
+    mBackend = backend;
+    _communicator = mCommunicators[backend];
+    Execute(routine, input_buffer);
+    if (mExitCode != 0)
+        LOG4CPLUS_WARN(logger, "✖ - Backend " << backend << " returned " << mExitCode << " to " << routine);
+    mBackend = selected;
+    _communicator = mCommunicators[selected];
+}
+
+void Frontend::AddPreExecuteHook(void (*hook)(const char *)) {
+    if (mpPreExecuteHooks == nullptr)
+        mpPreExecuteHooks = new vector<void (*)(const char *)>();
+    mpPreExecuteHooks->push_back(hook);
+}
+
+void Frontend::AddPostExecuteHook(void (*hook)(const char *)) {
+    if (mpPostExecuteHooks == nullptr)
+        mpPostExecuteHooks = new vector<void (*)(const char *)>();
+    mpPostExecuteHooks->push_back(hook);
+}
+
 void Frontend::Execute(const char *routine, const Buffer *input_buffer) {
     if (input_buffer == nullptr) input_buffer = mpInputBuffer.get();
+    // 编组开始的时间属于这个请求，不属于钩子发出的请求
+    steady_clock::time_point prepared = mPrepared;
+    mPrepared = {};
+    // 流的标记属于这个请求，不属于钩子发出的请求
+    uint64_t stream = gvirtus::common::Trace::IsEnabled() ? gvirtus::common::Trace::TakeStream() : 0;
+
+    // 先发送插件暂存的请求（例如合并的小拷贝），保证执行顺序
+    if (mpPreExecuteHooks != nullptr)
+        for (auto hook : *mpPreExecuteHooks) hook(routine);
 
-    pid_t tid = syscall(SYS_gettid);
-    if (mpFrontends->find(tid) == mpFrontends->end()) {
+    if (_communicator == nullptr) {
         // error
         cerr << " ERROR - can't send any job request " << endl;//
         return;
     }
 
     /* sending job */
-    auto frontend = mpFrontends->find(tid)->second;//获取当前线程的Frontend实例
+    auto frontend = this;//当前线程的Frontend实例
     frontend->mRoutinesExecuted++;//记录执行的routine数量
+    uint64_t &id = frontend->mRequestIds[frontend->mBackend];
+    id++;
+    GVIRTUS_PROBE(request__start, routine, id, input_buffer->GetBufferSize());
+    gvirtus::common::Trace::Pending pending = {};
+    if (gvirtus::common::Trace::IsEnabled())
+        pending = gvirtus::common::Trace::Start(stream);
     auto start = steady_clock::now();//记录开始时间
-    frontend->_communicator->obj_ptr()->Write(routine, strlen(routine) + 1);//发送routine名称
+    frontend->_communicator->Write(routine, strlen(routine) + 1);//发送routine名称
     frontend->mDataSent += input_buffer->GetBufferSize(); //记录发送的数据量
-    input_buffer->Dump(frontend->_communicator->obj_ptr().get()); //发送input_buffer
-    frontend->_communicator->obj_ptr()->Sync();//同步
-    frontend->mSendingTime += std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start) .count() / 1000.0;
+    input_buffer->Dump(frontend->_communicator.get()); //发送input_buffer
+    frontend->_communicator->Sync();//同步
+    GVIRTUS_PROBE(request__sent, routine, id, input_buffer->GetBufferSize());
+    auto sent = steady_clock::now();
+    frontend->mSendingTime += std::chrono::duration<double>(sent - start).count();
     frontend->mpOutputBuffer->Reset();
 
-    frontend->_communicator->obj_ptr()->Read((char *) &frontend->mExitCode, sizeof(int));
+    frontend->_communicator->Read((char *) &frontend->mExitCode, sizeof(int));
     double time_taken;
-    frontend->_communicator->obj_ptr()->Read(reinterpret_cast<char *>(&time_taken), sizeof(time_taken));
+    frontend->_communicator->Read(reinterpret_cast<char *>(&time_taken), sizeof(time_taken));
     frontend->mRoutineExecutionTime += time_taken;
 
-    start = steady_clock::now();
+    auto replied = steady_clock::now();
     size_t out_buffer_size;
-    frontend->_communicator->obj_ptr()->Read((char *) &out_buffer_size, sizeof(size_t));
+    frontend->_communicator->Read((char *) &out_buffer_size, sizeof(size_t));
     frontend->mDataReceived += out_buffer_size;
     if (out_buffer_size > 0)
-        frontend->mpOutputBuffer->Read<char>( frontend->_communicator->obj_ptr().get(), out_buffer_size);
-    frontend->mReceivingTime += std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start).count() / 1000.0;
+        frontend->mpOutputBuffer->Read<char>( frontend->_communicator.get(), out_buffer_size);
+    auto end = steady_clock::now();
+    frontend->mReceivingTime += std::chrono::duration<double>(end - replied).count();
+    GVIRTUS_PROBE(reply__received, routine, id, frontend->mExitCode, out_buffer_size);
+    gvirtus::common::Stats::Record(routine, input_buffer->GetBufferSize(), out_buffer_size,
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+                                   (uint64_t) (time_taken * 1e9));
+    if (gvirtus::common::Trace::IsEnabled())
+        gvirtus::common::Trace::Record(pending, routine, frontend->mBackend, input_buffer->GetBuffer(),
+                                       input_buffer->GetBufferSize(), frontend->mExitCode,
+                                       frontend->mpOutputBuffer->GetBuffer(), out_buffer_size);
+    if (Timeline::IsEnabled())
+        Timeline::Record(routine, frontend->mSessions[frontend->mBackend], id, frontend->mBackend,
+                         {prepared, {start, sent, replied, end}});
+
+    if (mpPostExecuteHooks != nullptr)
+        for (auto hook : *mpPostExecuteHooks) hook(routine);
+}
+
+std::shared_ptr<Buffer> Frontend::ExecuteAside(const char *routine, const Buffer *input_buffer, int *exit_code) {
+    // 被中断的请求可能还在读取它的回复：回复和返回码保持不变
+    std::shared_ptr<Buffer> output = std::make_shared<Buffer>();
+    int interrupted = mExitCode;
+    steady_clock::time_point prepared = mPrepared;
+    mpOutputBuffer.swap(output);
+    Execute(routine, input_buffer);
+    mpOutputBuffer.swap(output);
+    *exit_code = mExitCode;
+    mExitCode = interrupted;
+    mPrepared = prepared;
+    return output;
 }
 
 void Frontend::Prepare() {
-    pid_t tid = syscall(SYS_gettid);
-    if (this->mpFrontends->find(tid) != mpFrontends->end())
-        mpFrontends->find(tid)->second->mpInputBuffer->Reset();
+    GVIRTUS_PROBE(marshal__start, mBackend);
+    if (Timeline::IsEnabled())
+        mPrepared = steady_clock::now();
+    if (mpInputBuffer != nullptr)
+        mpInputBuffer->Reset();
 }
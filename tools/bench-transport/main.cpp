@@ -0,0 +1,408 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Microbenchmark of a communicator: the round-trip latency of small
+ * messages, the unidirectional and bidirectional bandwidth of large ones and
+ * how the throughput scales with the number of connections. The results are
+ * written as one JSON object, to be diffed between transports and releases.
+ *
+ * The communicator is the one of the index-th endpoint of a configuration
+ * file, created through CommunicatorFactory as the frontend and the backend
+ * create theirs: any transport the factory loads can be measured. By default
+ * the echo server runs in the same process; --serve and --connect split it
+ * from the client to measure between two hosts.
+ *
+ * Usage: gvirtus-bench-transport [options]
+ *   --config PATH        configuration file (default: as the frontend finds it)
+ *   --index N            communicator of the configuration file (default 0)
+ *   --serve              only run the echo server
+ *   --connect            only run the client, against a --serve elsewhere
+ *   --iterations N       round trips per latency size (default 10000)
+ *   --max-size BYTES     largest bandwidth payload (default 1 GiB)
+ *   --max-connections N  largest connection count of the scaling runs (16)
+ *   --seconds S          duration of each scaling run (default 2)
+ *   --output PATH        where to write the JSON (default stdout)
+ */
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gvirtus/common/Stats.h>
+#include <gvirtus/communicators/CommunicatorFactory.h>
+#include <gvirtus/communicators/EndpointFactory.h>
+
+using gvirtus::common::Histogram;
+using gvirtus::communicators::Communicator;
+using gvirtus::communicators::CommunicatorFactory;
+using gvirtus::communicators::Endpoint;
+using gvirtus::communicators::EndpointFactory;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+/*
+ * What the client asks of the echo server, sent before the messages it is
+ * about: Echo sends each of the count messages of size bytes back, Sink
+ * reads them all and then answers one byte.
+ */
+enum Operation : uint32_t { Echo = 1, Sink = 2 };
+
+struct Command {
+  uint32_t operation;
+  uint32_t reserved;
+  uint64_t size;
+  uint64_t count;
+};
+
+static const size_t MinLatencySize = 8;
+static const size_t MaxLatencySize = 4 << 10;
+static const size_t MinBandwidthSize = 4 << 10;
+static const size_t ScalingSize = 64;
+static const uint64_t Warmup = 100;
+/* bytes moved by each bandwidth point, unless a single payload is larger */
+static const uint64_t BandwidthVolume = 256 << 20;
+
+static bool ReadFully(Communicator *communicator, char *buffer, size_t size) {
+  return size == 0 || communicator->Read(buffer, size) == size;
+}
+
+static void Serve(Communicator *client) {
+  Command command;
+  std::vector<char> buffer;
+  while (ReadFully(client, (char *)&command, sizeof(command))) {
+    if (buffer.size() < command.size) buffer.resize(command.size);
+    bool ok = true;
+    for (uint64_t i = 0; ok && i < command.count; i++) {
+      ok = ReadFully(client, buffer.data(), command.size);
+      if (ok && command.operation == Echo) {
+        client->Write(buffer.data(), command.size);
+        client->Sync();
+      }
+    }
+    if (!ok) break;
+    if (command.operation == Sink) {
+      char ack = 0;
+      client->Write(&ack, 1);
+      client->Sync();
+    }
+  }
+  client->Close();
+  delete client;
+}
+
+/* accepts connections for ever, each served by its own thread */
+static void EchoServer(std::shared_ptr<Communicator> server) {
+  for (;;) {
+    Communicator *client = const_cast<Communicator *>(server->Accept());
+    std::thread(Serve, client).detach();
+  }
+}
+
+static std::shared_ptr<Communicator> Connect(std::shared_ptr<Endpoint> end) {
+  std::shared_ptr<Communicator> communicator =
+      CommunicatorFactory::create_communicator(end);
+  communicator->Connect();
+  return communicator;
+}
+
+static void SendCommand(Communicator *communicator, Operation operation,
+                        uint64_t size, uint64_t count) {
+  Command command = {operation, 0, size, count};
+  communicator->Write((const char *)&command, sizeof(command));
+}
+
+static uint64_t Elapsed(steady_clock::time_point start) {
+  return duration_cast<nanoseconds>(steady_clock::now() - start).count();
+}
+
+static void WriteHistogram(std::ostream &out, const Histogram &histogram) {
+  out << "\"min_ns\": " << histogram.Min()
+      << ", \"p50_ns\": " << histogram.Percentile(0.5)
+      << ", \"p90_ns\": " << histogram.Percentile(0.9)
+      << ", \"p99_ns\": " << histogram.Percentile(0.99)
+      << ", \"p999_ns\": " << histogram.Percentile(0.999)
+      << ", \"max_ns\": " << histogram.Max() << ", \"mean_ns\": "
+      << (histogram.Count() == 0 ? 0 : histogram.Sum() / histogram.Count());
+}
+
+/* ping-pong of one message at a time */
+static void Latency(std::shared_ptr<Endpoint> end, uint64_t iterations,
+                    std::ostream &out) {
+  auto communicator = Connect(end);
+  std::vector<char> buffer(MaxLatencySize, 'x');
+  out << "  \"latency\": [";
+  for (size_t size = MinLatencySize; size <= MaxLatencySize; size *= 2) {
+    Histogram histogram;
+    SendCommand(communicator.get(), Echo, size, Warmup + iterations);
+    for (uint64_t i = 0; i < Warmup + iterations; i++) {
+      auto start = steady_clock::now();
+      communicator->Write(buffer.data(), size);
+      communicator->Sync();
+      if (!ReadFully(communicator.get(), buffer.data(), size))
+        throw std::string("latency: connection lost");
+      if (i >= Warmup) histogram.Record(Elapsed(start));
+    }
+    out << (size == MinLatencySize ? "\n" : ",\n") << "    {\"bytes\": " << size
+        << ", \"iterations\": " << iterations << ", ";
+    WriteHistogram(out, histogram);
+    out << "}";
+    std::cerr << "latency " << size << " B: p50 " << histogram.Percentile(0.5)
+              << " ns" << std::endl;
+  }
+  out << "\n  ],\n";
+  communicator->Close();
+}
+
+static double Unidirectional(Communicator *communicator,
+                             std::vector<char> &buffer, size_t size,
+                             uint64_t count) {
+  auto start = steady_clock::now();
+  SendCommand(communicator, Sink, size, count);
+  for (uint64_t i = 0; i < count; i++) {
+    communicator->Write(buffer.data(), size);
+    communicator->Sync();
+  }
+  char ack;
+  if (!ReadFully(communicator, &ack, 1))
+    throw std::string("bandwidth: connection lost");
+  return (double)size * count / (Elapsed(start) / 1e9);
+}
+
+/* one thread writes while another reads the echoes back */
+static double Bidirectional(Communicator *communicator,
+                            std::vector<char> &buffer, size_t size,
+                            uint64_t count) {
+  std::vector<char> echoes(size);
+  bool ok = true;
+  auto start = steady_clock::now();
+  SendCommand(communicator, Echo, size, count);
+  std::thread reader([&]() {
+    for (uint64_t i = 0; ok && i < count; i++)
+      ok = ReadFully(communicator, echoes.data(), size);
+  });
+  for (uint64_t i = 0; i < count; i++) {
+    communicator->Write(buffer.data(), size);
+    communicator->Sync();
+  }
+  reader.join();
+  if (!ok) throw std::string("bandwidth: connection lost");
+  return 2.0 * size * count / (Elapsed(start) / 1e9);
+}
+
+static void Bandwidth(std::shared_ptr<Endpoint> end, size_t max_size,
+                      std::ostream &out) {
+  auto communicator = Connect(end);
+  std::vector<char> buffer(max_size, 'x');
+  out << "  \"bandwidth\": [";
+  for (size_t size = MinBandwidthSize; size <= max_size; size *= 2) {
+    uint64_t count = std::max<uint64_t>(BandwidthVolume / size, 2);
+    double unidirectional =
+        Unidirectional(communicator.get(), buffer, size, count);
+    double bidirectional = Bidirectional(communicator.get(), buffer, size, count);
+    out << (size == MinBandwidthSize ? "\n" : ",\n")
+        << "    {\"bytes\": " << size << ", \"messages\": " << count
+        << ", \"unidirectional_bytes_per_s\": " << (uint64_t)unidirectional
+        << ", \"bidirectional_bytes_per_s\": " << (uint64_t)bidirectional
+        << "}";
+    std::cerr << "bandwidth " << size << " B: " << unidirectional / 1e6
+              << " MB/s, " << bidirectional / 1e6 << " MB/s both ways"
+              << std::endl;
+  }
+  out << "\n  ],\n";
+  communicator->Close();
+}
+
+/* small ping-pongs on concurrent connections, each with its own thread */
+static void Scaling(std::shared_ptr<Endpoint> end, int max_connections,
+                    double seconds, std::ostream &out) {
+  out << "  \"scaling\": [";
+  for (int connections = 1; connections <= max_connections; connections *= 2) {
+    std::vector<Histogram> histograms(connections);
+    std::vector<std::shared_ptr<Communicator>> communicators;
+    for (int i = 0; i < connections; i++) communicators.push_back(Connect(end));
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    auto deadline = steady_clock::now() + duration_cast<nanoseconds>(
+                                              duration<double>(seconds));
+    for (int i = 0; i < connections; i++) {
+      threads.emplace_back([&, i]() {
+        Communicator *communicator = communicators[i].get();
+        char buffer[ScalingSize] = {};
+        /* the server echoes until the connection is closed */
+        SendCommand(communicator, Echo, ScalingSize, UINT64_MAX);
+        while (steady_clock::now() < deadline) {
+          auto start = steady_clock::now();
+          communicator->Write(buffer, ScalingSize);
+          communicator->Sync();
+          if (!ReadFully(communicator, buffer, ScalingSize)) {
+            failed = true;
+            return;
+          }
+          histograms[i].Record(Elapsed(start));
+        }
+      });
+    }
+    for (auto &thread : threads) thread.join();
+    for (auto &communicator : communicators) communicator->Close();
+    if (failed) throw std::string("scaling: connection lost");
+
+    Histogram histogram;
+    for (auto &h : histograms) histogram.Merge(h);
+    double ops = histogram.Count() / seconds;
+    out << (connections == 1 ? "\n" : ",\n")
+        << "    {\"connections\": " << connections
+        << ", \"bytes\": " << ScalingSize
+        << ", \"round_trips_per_s\": " << (uint64_t)ops << ", ";
+    WriteHistogram(out, histogram);
+    out << "}";
+    std::cerr << "scaling " << connections << " connections: " << (uint64_t)ops
+              << " round trips/s" << std::endl;
+  }
+  out << "\n  ]\n";
+}
+
+static std::string DefaultConfig() {
+  const char *config = getenv("GVIRTUS_CONFIG");
+  if (config != NULL) return config;
+  const char *home = getenv("GVIRTUS_HOME");
+  if (home != NULL) return std::string(home) + "/etc/properties.json";
+  return "./properties.json";
+}
+
+int main(int argc, char **argv) {
+  std::string config = DefaultConfig();
+  std::string output;
+  int index = 0;
+  bool serve = true, connect = true;
+  uint64_t iterations = 10000;
+  size_t max_size = 1 << 30;
+  int max_connections = 16;
+  double seconds = 2.0;
+
+  static const struct option options[] = {
+      {"config", required_argument, NULL, 'c'},
+      {"index", required_argument, NULL, 'i'},
+      {"serve", no_argument, NULL, 's'},
+      {"connect", no_argument, NULL, 'C'},
+      {"iterations", required_argument, NULL, 'n'},
+      {"max-size", required_argument, NULL, 'm'},
+      {"max-connections", required_argument, NULL, 'p'},
+      {"seconds", required_argument, NULL, 't'},
+      {"output", required_argument, NULL, 'o'},
+      {NULL, 0, NULL, 0}};
+  int option;
+  while ((option = getopt_long(argc, argv, "", options, NULL)) != -1) {
+    switch (option) {
+      case 'c':
+        config = optarg;
+        break;
+      case 'i':
+        index = atoi(optarg);
+        break;
+      case 's':
+        connect = false;
+        break;
+      case 'C':
+        serve = false;
+        break;
+      case 'n':
+        iterations = strtoull(optarg, NULL, 0);
+        break;
+      case 'm':
+        max_size = strtoull(optarg, NULL, 0);
+        break;
+      case 'p':
+        max_connections = atoi(optarg);
+        break;
+      case 't':
+        seconds = atof(optarg);
+        break;
+      case 'o':
+        output = optarg;
+        break;
+      default:
+        std::cerr << "Usage: " << argv[0]
+                  << " [--config PATH] [--index N] [--serve | --connect]"
+                     " [--iterations N] [--max-size BYTES]"
+                     " [--max-connections N] [--seconds S] [--output PATH]"
+                  << std::endl;
+        return 1;
+    }
+  }
+  if (!serve && !connect) {
+    std::cerr << "--serve and --connect exclude each other" << std::endl;
+    return 1;
+  }
+
+  try {
+    std::shared_ptr<Endpoint> end = EndpointFactory::get_endpoint(config, index);
+
+    if (serve) {
+      std::shared_ptr<Communicator> server =
+          CommunicatorFactory::create_communicator(end);
+      server->Serve();
+      if (!connect) {
+        std::cerr << "serving " << end->to_string() << std::endl;
+        EchoServer(server);
+      }
+      std::thread(EchoServer, server).detach();
+    }
+
+    std::ofstream file;
+    if (!output.empty()) file.open(output);
+    std::ostream &out = output.empty() ? std::cout : file;
+    out << "{\n  \"endpoint\": \"" << end->to_string() << "\",\n"
+        << "  \"protocol\": \"" << end->protocol() << "\",\n"
+        << "  \"in_process_server\": " << (serve ? "true" : "false") << ",\n";
+    Latency(end, iterations, out);
+    Bandwidth(end, max_size, out);
+    Scaling(end, max_connections, seconds, out);
+    out << "}" << std::endl;
+  } catch (std::string &exc) {
+    std::cerr << exc << std::endl;
+    return 1;
+  } catch (const char *exc) {
+    std::cerr << exc << std::endl;
+    return 1;
+  } catch (std::exception &exc) {
+    std::cerr << exc.what() << std::endl;
+    return 1;
+  }
+  /* the server threads are still blocked in Accept and Read */
+  _exit(0);
+}
@@ -0,0 +1,499 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Microbenchmark of the serialization: the Buffer primitives alone,
+ * then whole requests shaped as the frontends marshal them (a GEMM, a cuDNN
+ * convolution, a kernel launch with 8 arguments, 64 MiB copies), unmarshalled
+ * as the backend handlers do and answered through an in-memory communicator.
+ * No GPU is needed: device pointers are never dereferenced.
+ *
+ * For each case: nanoseconds, heap allocations and bytes copied per call.
+ * The bytes copied are those serialized into the buffers, moved through the
+ * communicator, moved by realloc and copied out by the receiver.
+ *
+ * Usage: gvirtus-buffer-bench [seconds-per-case] [case-substring]
+ */
+
+#include <malloc.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gvirtus/communicators/Buffer.h>
+#include <gvirtus/communicators/Communicator.h>
+#include <gvirtus/communicators/Result.h>
+
+using gvirtus::common::pointer_t;
+using gvirtus::communicators::Buffer;
+using gvirtus::communicators::Communicator;
+using gvirtus::communicators::Result;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+/*
+ * The allocations are counted by interposing malloc, calloc and realloc on
+ * glibc's; operator new goes through malloc. Single threaded, so plain
+ * counters.
+ */
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+}
+
+static uint64_t gAllocations = 0;
+static uint64_t gCopied = 0;
+
+extern "C" void *malloc(size_t size) {
+  gAllocations++;
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size) {
+  gAllocations++;
+  return __libc_calloc(n, size);
+}
+
+/* a realloc that moves the block copies it: counted as bytes too */
+extern "C" void *realloc(void *ptr, size_t size) {
+  size_t old_size = ptr == NULL ? 0 : malloc_usable_size(ptr);
+  void *result = __libc_realloc(ptr, size);
+  if (result != ptr) {
+    gAllocations++;
+    gCopied += old_size < size ? old_size : size;
+  }
+  return result;
+}
+
+/**
+ * The two ends of a connection in one process: what is written is read
+ * back in order, as through a socket.
+ */
+class LoopbackCommunicator : public Communicator {
+ public:
+  LoopbackCommunicator() : mOffset(0) { mData.reserve(80 << 20); }
+  void Serve() {}
+  const Communicator *const Accept() const { return this; }
+  void Connect() {}
+  size_t Read(char *buffer, size_t size) {
+    if (mOffset + size > mData.size()) size = mData.size() - mOffset;
+    memcpy(buffer, mData.data() + mOffset, size);
+    mOffset += size;
+    if (mOffset == mData.size()) {
+      mData.clear();
+      mOffset = 0;
+    }
+    gCopied += size;
+    return size;
+  }
+  size_t Write(const char *buffer, size_t size) {
+    mData.insert(mData.end(), buffer, buffer + size);
+    gCopied += size;
+    return size;
+  }
+  void Sync() {}
+  void Close() {}
+
+ private:
+  std::vector<char> mData;
+  size_t mOffset;
+};
+
+/**
+ * The path of a request: the frontend's input buffer, reset by Prepare and
+ * dumped by Execute, the backend's input buffer, refilled from the
+ * communicator, and the frontend's output buffer. As in the processes, the
+ * three live across calls; the backend's output buffer is the handler's.
+ */
+class Session {
+ public:
+  Session()
+      : mInput(std::make_shared<Buffer>()),
+        mBackendInput(std::make_shared<Buffer>()),
+        mOutput(std::make_shared<Buffer>()) {}
+
+  /**
+   * Runs one request.
+   *
+   * @param marshal fills the frontend's input buffer.
+   * @param handle unmarshals the backend's input buffer and answers.
+   * @param unmarshal reads the frontend's output buffer.
+   */
+  void Execute(const char *routine, const std::function<void(Buffer *)> &marshal,
+               const std::function<std::shared_ptr<Result>(Buffer *)> &handle,
+               const std::function<void(Buffer *)> &unmarshal) {
+    mInput->Reset();
+    marshal(mInput.get());
+    gCopied += mInput->GetBufferSize();
+    mCommunicator.Write(routine, strlen(routine) + 1);
+    mInput->Dump(&mCommunicator);
+
+    char name[64];
+    size_t length = 0;
+    while (mCommunicator.Read(name + length, 1) == 1 && name[length] != 0)
+      length++;
+    mBackendInput->Reset(&mCommunicator);
+    std::shared_ptr<Result> result = handle(mBackendInput.get());
+    gCopied += result->GetOutputSize();
+    result->Dump(&mCommunicator);
+
+    int exit_code;
+    double time_taken;
+    size_t size;
+    mCommunicator.Read((char *)&exit_code, sizeof(exit_code));
+    mCommunicator.Read((char *)&time_taken, sizeof(time_taken));
+    mCommunicator.Read((char *)&size, sizeof(size));
+    mOutput->Reset();
+    if (size > 0) mOutput->Read<char>(&mCommunicator, size);
+    unmarshal(mOutput.get());
+  }
+
+ private:
+  LoopbackCommunicator mCommunicator;
+  std::shared_ptr<Buffer> mInput;
+  std::shared_ptr<Buffer> mBackendInput;
+  std::shared_ptr<Buffer> mOutput;
+};
+
+struct Case {
+  const char *name;
+  std::function<void()> call;
+};
+
+static const size_t CopySize = 64 << 20;
+
+struct dim3_t {
+  unsigned x, y, z;
+};
+
+static std::vector<Case> MakeCases(Session &session) {
+  static std::vector<char> host(CopySize, 'h');
+  static std::vector<char> device(CopySize, 'd');
+  static char raw[256];
+  static float alpha = 1.0f, beta = 0.0f;
+  /* a sink the compiler cannot see through */
+  [[maybe_unused]] static volatile uint64_t sink;
+
+  std::vector<Case> cases;
+
+  /* the primitives, on a buffer that already has its memory */
+  static Buffer buffer(1 << 20);
+  cases.push_back({"Add<int>", []() {
+                     buffer.Reset();
+                     buffer.Add(42);
+                     gCopied += sizeof(int);
+                   }});
+  cases.push_back({"AddConst<int>", []() {
+                     buffer.Reset();
+                     buffer.AddConst(42);
+                     gCopied += sizeof(int);
+                   }});
+  cases.push_back({"Add(float*, 64)", []() {
+                     buffer.Reset();
+                     buffer.Add((float *)raw, 64);
+                     gCopied += sizeof(size_t) + 64 * sizeof(float);
+                   }});
+  cases.push_back({"AddString", []() {
+                     buffer.Reset();
+                     buffer.AddString("_Z6kernelPfS_S_i");
+                     gCopied += 2 * sizeof(size_t) + 17;
+                   }});
+  cases.push_back({"Delegate<float>(64)", []() {
+                     buffer.Reset();
+                     sink = (uintptr_t)buffer.Delegate<float>(64);
+                     gCopied += sizeof(size_t);
+                   }});
+
+  /* readers over a prepared request, not owning its memory */
+  static Buffer prepared;
+  prepared.Add(42);
+  prepared.Add((float *)raw, 64);
+  static const char *bytes = prepared.GetBuffer();
+  static size_t length = prepared.GetBufferSize();
+  cases.push_back({"Get<int>", []() {
+                     Buffer in((char *)bytes, length);
+                     sink = in.Get<int>();
+                   }});
+  cases.push_back({"BackGet<size_t>", []() {
+                     Buffer in((char *)bytes, length);
+                     sink = in.BackGet<size_t>();
+                   }});
+  cases.push_back({"Assign<float>(64)", []() {
+                     Buffer in((char *)bytes, length);
+                     in.Get<int>();
+                     sink = (uintptr_t)in.Assign<float>(64);
+                   }});
+  cases.push_back({"AssignAll<float>", []() {
+                     Buffer in((char *)bytes, length);
+                     in.Get<int>();
+                     sink = (uintptr_t)in.AssignAll<float>();
+                   }});
+  cases.push_back({"Get<float>(64)", []() {
+                     Buffer in((char *)bytes, length);
+                     in.Get<int>();
+                     float *copy = in.Get<float>(64);
+                     gCopied += 64 * sizeof(float);
+                     sink = (uintptr_t)copy;
+                     delete[] copy;
+                   }});
+
+  /* whole requests, marshalled as the frontends and handlers do */
+  cases.push_back(
+      {"cublasSgemm_v2", [&session]() {
+         session.Execute(
+             "cublasSgemm_v2",
+             [](Buffer *in) {
+               in->Add<long long int>(0x1000);
+               in->Add<int>(0);
+               in->Add<int>(1);
+               in->Add<int>(1024);
+               in->Add<int>(1024);
+               in->Add<int>(1024);
+               in->Add(&alpha);
+               in->Add((pointer_t)0x7f0000000000);
+               in->Add<int>(1024);
+               in->Add((pointer_t)0x7f0000400000);
+               in->Add<int>(1024);
+               in->Add(&beta);
+               in->Add((pointer_t)0x7f0000800000);
+               in->Add<int>(1024);
+             },
+             [](Buffer *in) {
+               in->Get<long long int>();
+               in->Get<int>();
+               in->Get<int>();
+               sink = in->Get<int>() + in->Get<int>() + in->Get<int>();
+               float *a = in->Assign<float>();
+               in->GetFromMarshal<float *>();
+               in->Get<int>();
+               in->GetFromMarshal<float *>();
+               in->Get<int>();
+               float *b = in->Assign<float>();
+               in->GetFromMarshal<float *>();
+               in->Get<int>();
+               sink = (uintptr_t)a + (uintptr_t)b;
+               std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+               out->AddMarshal((pointer_t)0x7f0000800000);
+               return std::make_shared<Result>(0, out);
+             },
+             [](Buffer *out) { sink = out->GetFromMarshal<pointer_t>(); });
+       }});
+
+  cases.push_back(
+      {"cudnnConvolutionForward", [&session]() {
+         session.Execute(
+             "cudnnConvolutionForward",
+             [](Buffer *in) {
+               in->Add<long long int>(0x1000);
+               in->Add(alpha);
+               in->Add<long long int>(0x2000);
+               in->Add((pointer_t)0x7f0000000000);
+               in->Add<long long int>(0x3000);
+               in->Add((pointer_t)0x7f0000400000);
+               in->Add<long long int>(0x4000);
+               in->Add<int>(1);
+               in->Add((pointer_t)0x7f0000800000);
+               in->Add<size_t>(1 << 20);
+               in->Add(beta);
+               in->Add<long long int>(0x5000);
+               in->Add((pointer_t)0x7f0000c00000);
+             },
+             [](Buffer *in) {
+               in->Get<long long int>();
+               in->Get<float>();
+               in->Get<long long int>();
+               in->GetFromMarshal<void *>();
+               in->Get<long long int>();
+               in->GetFromMarshal<void *>();
+               in->Get<long long int>();
+               in->Get<int>();
+               in->GetFromMarshal<void *>();
+               in->Get<size_t>();
+               in->Get<float>();
+               in->Get<long long int>();
+               sink = in->GetFromMarshal<pointer_t>();
+               std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+               out->AddMarshal((pointer_t)0x7f0000c00000);
+               return std::make_shared<Result>(0, out);
+             },
+             [](Buffer *out) { sink = out->GetFromMarshal<pointer_t>(); });
+       }});
+
+  cases.push_back(
+      {"cudaLaunchKernel(8 args)", [&session]() {
+         session.Execute(
+             "cudaLaunchKernel",
+             [](Buffer *in) {
+               dim3_t grid = {256, 1, 1}, block = {256, 1, 1};
+               uint64_t args[8] = {};
+               in->Add((pointer_t)0x401000);
+               in->Add(grid);
+               in->Add(block);
+               in->Add<size_t>(0);
+               in->Add((pointer_t)0);
+               in->Add<char>((char *)args, sizeof(args));
+             },
+             [](Buffer *in) {
+               in->GetFromMarshal<void *>();
+               in->Get<dim3_t>();
+               in->Get<dim3_t>();
+               in->Get<size_t>();
+               in->Get<pointer_t>();
+               sink = (uintptr_t)in->AssignAll<char>();
+               return std::make_shared<Result>(0);
+             },
+             [](Buffer *) {});
+       }});
+
+  cases.push_back(
+      {"cudaMemcpy(64 MiB, HtoD)", [&session]() {
+         session.Execute(
+             "cudaMemcpy",
+             [](Buffer *in) {
+               in->Add((pointer_t)device.data());
+               in->Add<char>(host.data(), CopySize);
+               in->Add(CopySize);
+               in->Add<int>(1);
+             },
+             [](Buffer *in) {
+               in->BackGet<int>();
+               size_t count = in->BackGet<size_t>();
+               void *dst = in->GetFromMarshal<void *>();
+               char *src = in->AssignAll<char>();
+               memcpy(dst, src, count);
+               gCopied += count;
+               return std::make_shared<Result>(0);
+             },
+             [](Buffer *) {});
+       }});
+
+  /* the handler as it is: a bounce buffer, then Add */
+  cases.push_back(
+      {"cudaMemcpy(64 MiB, DtoH)", [&session]() {
+         session.Execute(
+             "cudaMemcpy",
+             [](Buffer *in) {
+               in->Add((const char *)"", 1);
+               in->Add((pointer_t)device.data());
+               in->Add(CopySize);
+               in->Add<int>(2);
+             },
+             [](Buffer *in) {
+               in->BackGet<int>();
+               size_t count = in->BackGet<size_t>();
+               char *dst = new char[count];
+               in->Assign<char>();
+               char *src = in->GetFromMarshal<char *>();
+               memcpy(dst, src, count);
+               std::shared_ptr<Buffer> out = std::make_shared<Buffer>();
+               out->Add<char>(dst, count);
+               delete[] dst;
+               gCopied += count;
+               return std::make_shared<Result>(0, out);
+             },
+             [](Buffer *out) {
+               memmove(host.data(), out->Assign<char>(CopySize), CopySize);
+               gCopied += CopySize;
+             });
+       }});
+
+  /* the same, copying straight into the reply with Delegate */
+  cases.push_back(
+      {"cudaMemcpy(64 MiB, DtoH, Delegate)", [&session]() {
+         session.Execute(
+             "cudaMemcpy",
+             [](Buffer *in) {
+               in->Add((const char *)"", 1);
+               in->Add((pointer_t)device.data());
+               in->Add(CopySize);
+               in->Add<int>(2);
+             },
+             [](Buffer *in) {
+               in->BackGet<int>();
+               size_t count = in->BackGet<size_t>();
+               in->Assign<char>();
+               char *src = in->GetFromMarshal<char *>();
+               /* room for the size that precedes the data, too */
+               std::shared_ptr<Buffer> out =
+                   std::make_shared<Buffer>(count + 2 * BLOCK_SIZE);
+               memcpy(out->Delegate<char>(count), src, count);
+               gCopied += count;
+               return std::make_shared<Result>(0, out);
+             },
+             [](Buffer *out) {
+               memmove(host.data(), out->Assign<char>(CopySize), CopySize);
+               gCopied += CopySize;
+             });
+       }});
+
+  return cases;
+}
+
+int main(int argc, char **argv) {
+  double seconds = argc > 1 ? atof(argv[1]) : 0.5;
+  std::string filter = argc > 2 ? argv[2] : "";
+
+  Session session;
+  std::vector<Case> cases = MakeCases(session);
+
+  std::cout << std::left << std::setw(36) << "case" << std::right
+            << std::setw(16) << "ns/call" << std::setw(14) << "allocs/call"
+            << std::setw(18) << "bytes/call" << std::endl;
+  for (auto &c : cases) {
+    if (std::string(c.name).find(filter) == std::string::npos) continue;
+    /* the first call sizes the buffers that live across calls */
+    c.call();
+
+    /* doubles the calls until a batch lasts the requested time */
+    uint64_t calls = 1, elapsed = 0, allocations = 0, copied = 0;
+    for (;;) {
+      gAllocations = 0;
+      gCopied = 0;
+      auto start = steady_clock::now();
+      for (uint64_t i = 0; i < calls; i++) c.call();
+      elapsed = duration_cast<nanoseconds>(steady_clock::now() - start).count();
+      allocations = gAllocations;
+      copied = gCopied;
+      if (elapsed >= seconds * 1e9) break;
+      calls *= 2;
+    }
+    std::cout << std::left << std::setw(36) << c.name << std::right
+              << std::setw(16) << std::fixed << std::setprecision(1)
+              << (double)elapsed / calls << std::setw(14)
+              << std::setprecision(2) << (double)allocations / calls
+              << std::setw(18) << std::setprecision(0)
+              << (double)copied / calls << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,442 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Checks the frames DescriptorShadow, of the cudnn frontend, sends:
+ * the Set calls it keeps, the signatures of the shadows and the
+ * cudnnShadowBatch frames, also when several threads use or destroy a shadow
+ * at once. It stands in for the Frontend, with a backend that decodes the
+ * frames as the cudnn plugin does and makes up the descriptors, so it needs
+ * neither a backend nor a device. Prints the mismatches.
+ *
+ * Usage: gvirtus-cudnn-shadow-check [threads]
+ *
+ * Exits with 1 if a check fails.
+ */
+
+#include <cudnn.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "CudnnFrontend.h"
+
+/**
+ * A request the backend got; a cudnnShadowBatch frame is decoded.
+ */
+struct Request {
+  struct Shadow {
+    uint64_t shadow;
+    uint64_t handle;
+    std::string create;
+    std::vector<std::pair<std::string, std::string>> calls;
+  };
+
+  int backend;
+  /* of the batch, the routine it runs */
+  std::string routine;
+  std::string arguments;
+  bool batch = false;
+  std::vector<Shadow> shadows;
+  std::vector<std::pair<size_t, uint64_t>> fixups;
+};
+
+/**
+ * The backends: they keep the requests and make up a descriptor for each
+ * shadow they are asked to create.
+ */
+class FakeBackend {
+ public:
+  int Serve(int backend, const char *routine, const Buffer *input,
+            Buffer *output) {
+    Buffer in((char *)input->GetBuffer(), input->GetBufferSize());
+    Request request;
+    request.backend = backend;
+    request.routine = routine;
+    if (request.routine != "cudnnShadowBatch") {
+      request.arguments.assign(input->GetBuffer(), input->GetBufferSize());
+      Keep(request);
+      return CUDNN_STATUS_SUCCESS;
+    }
+
+    /* long enough for other threads to come by */
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    request.batch = true;
+    request.shadows.resize(in.Get<size_t>());
+    for (auto &shadow : request.shadows) {
+      shadow.shadow = in.Get<uint64_t>();
+      shadow.handle = in.Get<uint64_t>();
+      shadow.create = in.AssignString();
+      shadow.calls.resize(in.Get<size_t>());
+      for (auto &call : shadow.calls) {
+        call.first = in.AssignString();
+        size_t size = in.Get<size_t>();
+        call.second.assign(in.Assign<char>(size), size);
+      }
+    }
+    request.routine = in.AssignString();
+    request.fixups.resize(in.Get<size_t>());
+    for (auto &fixup : request.fixups) {
+      fixup.first = in.Get<size_t>();
+      fixup.second = in.Get<uint64_t>();
+    }
+    size_t size = in.Get<size_t>();
+    request.arguments.assign(in.Assign<char>(size), size);
+
+    output->Add(request.shadows.size());
+    for (auto &shadow : request.shadows) {
+      uint64_t handle = shadow.handle;
+      if (handle == 0) handle = Create(backend, shadow.shadow);
+      output->Add(shadow.shadow);
+      output->Add(handle);
+      output->Add((int)1);
+    }
+    /* the routine has no output */
+    output->Add((size_t)0);
+    Keep(request);
+    return CUDNN_STATUS_SUCCESS;
+  }
+
+  std::vector<Request> Take() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::vector<Request> requests;
+    requests.swap(mRequests);
+    return requests;
+  }
+
+  /**
+   * The descriptors made for shadow on backend.
+   */
+  std::vector<uint64_t> Created(int backend, uint64_t shadow) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mCreated[{backend, shadow}];
+  }
+
+ private:
+  uint64_t Create(int backend, uint64_t shadow) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    uint64_t handle = 0x1000 + ++mLast;
+    mCreated[{backend, shadow}].push_back(handle);
+    return handle;
+  }
+
+  void Keep(const Request &request) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRequests.push_back(request);
+  }
+
+  std::mutex mMutex;
+  std::vector<Request> mRequests;
+  std::map<std::pair<int, uint64_t>, std::vector<uint64_t>> mCreated;
+  uint64_t mLast = 0;
+};
+
+static FakeBackend backend;
+
+/*
+ * The Frontend, as far as DescriptorShadow uses it: one per thread, whose
+ * requests the backend above serves.
+ */
+namespace gvirtus::frontend {
+Frontend::~Frontend() {}
+
+Frontend *Frontend::GetFrontend(communicators::Communicator *c) {
+  static thread_local Frontend *frontend = nullptr;
+  if (frontend == nullptr) {
+    frontend = new Frontend();
+    frontend->mpInputBuffer = std::make_shared<Buffer>();
+    frontend->mpOutputBuffer = std::make_shared<Buffer>();
+    frontend->mExitCode = 0;
+  }
+  return frontend;
+}
+
+void Frontend::Prepare() { mpInputBuffer->Reset(); }
+
+void Frontend::SelectBackend(int backend) { mBackend = backend; }
+
+void Frontend::Execute(const char *routine,
+                       const communicators::Buffer *input_buffer) {
+  if (input_buffer == NULL) input_buffer = mpInputBuffer.get();
+  mpOutputBuffer->Reset();
+  mExitCode = backend.Serve(mBackend, routine, input_buffer,
+                            mpOutputBuffer.get());
+}
+}  // namespace gvirtus::frontend
+
+static const long long int Handle = 0x77;
+
+static int failures = 0;
+
+static void Check(bool ok, const std::string &what) {
+  if (ok) return;
+  std::cout << what << std::endl;
+  failures++;
+}
+
+/*
+ * Marshals cudnnSetTensor4dDescriptor as the frontend does and hands it to
+ * DescriptorShadow; returns the arguments.
+ */
+static std::string SetTensor(uint64_t descriptor, int n, int c, int h, int w,
+                             bool *recorded = NULL) {
+  CudnnFrontend::Prepare();
+  CudnnFrontend::AddVariableForArguments<long long int>(
+      (long long int)descriptor);
+  CudnnFrontend::AddVariableForArguments<cudnnTensorFormat_t>(
+      CUDNN_TENSOR_NCHW);
+  CudnnFrontend::AddVariableForArguments<cudnnDataType_t>(CUDNN_DATA_FLOAT);
+  CudnnFrontend::AddVariableForArguments<int>(n);
+  CudnnFrontend::AddVariableForArguments<int>(c);
+  CudnnFrontend::AddVariableForArguments<int>(h);
+  CudnnFrontend::AddVariableForArguments<int>(w);
+  Buffer *input = Frontend::GetFrontend()->GetInputBuffer();
+  std::string arguments(input->GetBuffer(), input->GetBufferSize());
+  bool kept =
+      DescriptorShadow::Record(descriptor, "cudnnSetTensor4dDescriptor");
+  if (recorded != NULL) *recorded = kept;
+  return arguments;
+}
+
+/*
+ * Sends cudnnAddTensor, with descriptor after the handle; returns the
+ * arguments as marshalled, before any shadow is replaced.
+ */
+static std::string Use(uint64_t descriptor) {
+  CudnnFrontend::Prepare();
+  CudnnFrontend::AddVariableForArguments<long long int>(Handle);
+  CudnnFrontend::AddVariableForArguments<long long int>(
+      (long long int)descriptor);
+  CudnnFrontend::AddVariableForArguments<float>(1.0f);
+  Buffer *input = Frontend::GetFrontend()->GetInputBuffer();
+  std::string arguments(input->GetBuffer(), input->GetBufferSize());
+  memcpy(&arguments[sizeof(long long int)], &descriptor, sizeof(descriptor));
+  CudnnFrontend::Execute("cudnnAddTensor");
+  return arguments;
+}
+
+static std::string With(std::string arguments, size_t offset,
+                        uint64_t value) {
+  memcpy(&arguments[offset], &value, sizeof(value));
+  return arguments;
+}
+
+static std::string Signature(uint64_t descriptor) {
+  std::string signature;
+  if (!DescriptorShadow::Signature(descriptor, &signature)) return "none";
+  return signature;
+}
+
+/*
+ * The signature of a tensor shadow whose only call sent arguments.
+ */
+static std::string TensorSignature(const std::string &arguments) {
+  std::string signature("cudnnCreateTensorDescriptor");
+  std::string routine("cudnnSetTensor4dDescriptor");
+  size_t size = arguments.size() - sizeof(uint64_t);
+  signature.append(routine.c_str(), routine.size() + 1);
+  signature.append((const char *)&size, sizeof(size));
+  signature.append(arguments, sizeof(uint64_t), size);
+  return signature;
+}
+
+static uint64_t CreateTensor() {
+  return DescriptorShadow::Create("cudnnCreateTensorDescriptor");
+}
+
+/*
+ * Set calls are kept, the last of each routine only, and shadows set up
+ * alike sign alike.
+ */
+static void CheckRecord() {
+  bool recorded;
+  SetTensor(Handle, 1, 2, 3, 4, &recorded);
+  Check(!recorded, "record: a descriptor that is no shadow was kept");
+  Check(backend.Take().empty(), "record: Record sent a request");
+
+  uint64_t a = CreateTensor(), b = CreateTensor(), c = CreateTensor();
+  SetTensor(a, 1, 2, 3, 4, &recorded);
+  Check(recorded, "record: the call on a shadow was not kept");
+  std::string last = SetTensor(a, 5, 6, 7, 8);
+  SetTensor(b, 5, 6, 7, 8);
+  SetTensor(c, 1, 2, 3, 4);
+  Check(backend.Take().empty(), "record: setting up shadows sent requests");
+
+  Check(Signature(a) == TensorSignature(last),
+        "signature: not the create routine and the last call");
+  Check(Signature(a) == Signature(b),
+        "signature: shadows set up alike sign differently");
+  Check(Signature(a) != Signature(c),
+        "signature: shadows set up differently sign alike");
+  Check(Signature(Handle) == "none",
+        "signature: a descriptor that is no shadow signs");
+  Check(Signature(CreateTensor()) == "cudnnCreateTensorDescriptor",
+        "signature: a shadow never set up signs with calls");
+
+  DescriptorShadow::Destroy(a, "cudnnDestroyTensorDescriptor");
+  DescriptorShadow::Destroy(b, "cudnnDestroyTensorDescriptor");
+  DescriptorShadow::Destroy(c, "cudnnDestroyTensorDescriptor");
+  Check(backend.Take().empty(),
+        "record: destroying shadows never used sent requests");
+}
+
+/*
+ * A shadow is created with its first use, set up again with the first use
+ * after it changes, per backend, and destroyed wherever it was created.
+ */
+static void CheckFrames() {
+  Frontend *frontend = Frontend::GetFrontend();
+  uint64_t a = CreateTensor();
+  std::string set = SetTensor(a, 1, 2, 3, 4);
+
+  std::string arguments = Use(a);
+  std::vector<Request> requests = backend.Take();
+  std::vector<uint64_t> created = backend.Created(0, a);
+  Check(requests.size() == 1 && requests[0].batch && created.size() == 1,
+        "frame: the first use is not one cudnnShadowBatch creating the shadow");
+  if (requests.size() != 1 || !requests[0].batch || created.size() != 1) return;
+  uint64_t handle = created[0];
+  Request &first = requests[0];
+  Check(first.routine == "cudnnAddTensor", "frame: routine " + first.routine);
+  Check(first.arguments == arguments, "frame: the arguments differ");
+  Check(first.fixups.size() == 1 &&
+            first.fixups[0].first == sizeof(long long int) &&
+            first.fixups[0].second == a,
+        "frame: the shadow is not fixed up at its argument");
+  Check(first.shadows.size() == 1, "frame: not one shadow");
+  if (first.shadows.size() == 1) {
+    Request::Shadow &shadow = first.shadows[0];
+    Check(shadow.shadow == a && shadow.handle == 0,
+          "frame: the shadow is not sent to be created");
+    Check(shadow.create == "cudnnCreateTensorDescriptor",
+          "frame: create routine " + shadow.create);
+    Check(shadow.calls.size() == 1 &&
+              shadow.calls[0].first == "cudnnSetTensor4dDescriptor" &&
+              shadow.calls[0].second == set,
+          "frame: the kept call is not sent as recorded");
+  }
+
+  arguments = Use(a);
+  requests = backend.Take();
+  Check(requests.size() == 1 && !requests[0].batch &&
+            requests[0].arguments ==
+                With(arguments, sizeof(long long int), handle),
+        "frame: a shadow held up to date is not sent as its descriptor");
+
+  set = SetTensor(a, 2, 2, 2, 2);
+  Use(a);
+  requests = backend.Take();
+  Check(requests.size() == 1 && requests[0].batch &&
+            requests[0].shadows.size() == 1 &&
+            requests[0].shadows[0].handle == handle &&
+            requests[0].shadows[0].calls.size() == 1 &&
+            requests[0].shadows[0].calls[0].second == set,
+        "frame: a changed shadow is not set up again on its descriptor");
+  Check(backend.Created(0, a).size() == 1,
+        "frame: a changed shadow is created again");
+
+  frontend->SelectBackend(1);
+  Use(a);
+  frontend->SelectBackend(0);
+  requests = backend.Take();
+  created = backend.Created(1, a);
+  Check(requests.size() == 1 && requests[0].batch && requests[0].backend == 1 &&
+            created.size() == 1,
+        "frame: the shadow is not created on the other backend");
+
+  DescriptorShadow::Destroy(a, "cudnnDestroyTensorDescriptor");
+  requests = backend.Take();
+  std::map<int, uint64_t> destroyed;
+  for (auto &request : requests)
+    if (request.routine == "cudnnDestroyTensorDescriptor" &&
+        request.arguments.size() == sizeof(long long int))
+      destroyed[request.backend] = *(const uint64_t *)request.arguments.data();
+  Check(requests.size() == 2 && destroyed.size() == 2 &&
+            destroyed[0] == handle && created.size() == 1 &&
+            destroyed[1] == created[0],
+        "destroy: the descriptors of both backends are not destroyed");
+  Check(frontend->GetBackend() == 0,
+        "destroy: the backend of the thread changed");
+}
+
+/*
+ * Threads using a new shadow at once create it once; a thread destroying it
+ * meanwhile destroys what they created.
+ */
+static void CheckRace(int threads) {
+  uint64_t a = CreateTensor();
+  SetTensor(a, 1, 2, 3, 4);
+  std::atomic<int> ready(0);
+  std::vector<std::thread> workers;
+  for (int i = 0; i < threads; i++)
+    workers.emplace_back([&]() {
+      ready++;
+      while (ready.load() < threads) std::this_thread::yield();
+      Use(a);
+    });
+  for (auto &worker : workers) worker.join();
+  std::ostringstream created;
+  created << backend.Created(0, a).size();
+  Check(backend.Created(0, a).size() == 1,
+        "race: " + created.str() + " descriptors created for one shadow");
+  DescriptorShadow::Destroy(a, "cudnnDestroyTensorDescriptor");
+  backend.Take();
+
+  uint64_t b = CreateTensor();
+  SetTensor(b, 1, 2, 3, 4);
+  std::thread user([&]() { Use(b); });
+  /* while the backend creates it */
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  DescriptorShadow::Destroy(b, "cudnnDestroyTensorDescriptor");
+  user.join();
+  int destroyed = 0;
+  for (auto &request : backend.Take())
+    if (request.routine == "cudnnDestroyTensorDescriptor") destroyed++;
+  Check(destroyed == (int)backend.Created(0, b).size(),
+        "race: a descriptor created while its shadow was destroyed is left");
+}
+
+int main(int argc, char **argv) {
+  int threads = argc > 1 ? atoi(argv[1]) : 8;
+  if (!DescriptorShadow::IsEnabled()) {
+    std::cout << "GVIRTUS_CUDNN_SHADOW is 0" << std::endl;
+    return 2;
+  }
+  CheckRecord();
+  CheckFrames();
+  CheckRace(threads);
+  if (failures != 0) return 1;
+  std::cout << "cudnn-shadow-check: the frames are as expected" << std::endl;
+  return 0;
+}
@@ -0,0 +1,300 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Checks the answers of the cudart frontend against local backends
+ * loading the nulldev plugin. It is an ordinary CUDA application: run.sh
+ * starts the backends and runs it over the GVirtuS frontend library.
+ *
+ * Checks:
+ *   shadow     threads repeat device, error, stream and copy calls and print
+ *              what each call returned, in thread order; fails if a copy
+ *              reads back other data than it wrote. run.sh runs it with and
+ *              without the frontend's runtime shadow, and without combining
+ *              small copies, and compares the runs.
+ *   devicemap  the devices of several backends, GVIRTUS_CHECK_BACKENDS of
+ *              them with GVIRTUS_NULLDEV_DEVICES devices each, and backend b
+ *              with b + 1 MiB of memory: checks their count, that each
+ *              device shows the memory of its backend and that cudaSetDevice
+ *              sends the requests of a thread there. Prints the mismatches.
+ *   pool       prints the memory of device 0 in MiB, which tells the backend
+ *              of a pool the frontend was given, then keeps its session open
+ *              for iterations milliseconds; threads is not used. run.sh starts
+ *              many at once and counts them per backend.
+ *
+ * Usage: gvirtus-frontend-check CHECK [threads] [iterations]
+ */
+
+#include <cuda_runtime_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * What one thread saw: a line per call, with its return code and value.
+ */
+class Transcript {
+ public:
+  void Add(const char *call, cudaError_t error, long value = 0) {
+    mLines << call << " " << error << " " << value << "\n";
+  }
+
+  std::string Str() const { return mLines.str(); }
+
+ private:
+  std::ostringstream mLines;
+};
+
+/* copies whose data came back different: the answers alone can't tell */
+static std::atomic<int> copyMismatches(0);
+
+static int CompareCopy(const char *in, const char *out, size_t size) {
+  int diff = memcmp(in, out, size);
+  if (diff != 0) copyMismatches++;
+  return diff;
+}
+
+/*
+ * The calls the runtime shadow answers, around the requests that change
+ * what they should answer: a failed cudaSetDevice, a double free, work on a
+ * stream and its destruction.
+ */
+static void ShadowSteps(Transcript &t, int iterations) {
+  int device = -1;
+  t.Add("cudaGetDevice", cudaGetDevice(&device), device);
+  t.Add("cudaSetDevice", cudaSetDevice(0));
+  for (int i = 0; i < iterations; i++) {
+    t.Add("cudaGetDevice", cudaGetDevice(&device), device);
+    t.Add("cudaSetDevice", cudaSetDevice(0));
+    t.Add("cudaGetLastError", cudaGetLastError());
+
+    t.Add("cudaSetDevice", cudaSetDevice(1 << 20));
+    t.Add("cudaGetDevice", cudaGetDevice(&device), device);
+    t.Add("cudaPeekAtLastError", cudaPeekAtLastError());
+    t.Add("cudaGetLastError", cudaGetLastError());
+    t.Add("cudaGetLastError", cudaGetLastError());
+
+    cudaStream_t stream;
+    t.Add("cudaStreamCreate", cudaStreamCreate(&stream));
+    t.Add("cudaStreamQuery", cudaStreamQuery(stream));
+    t.Add("cudaStreamSynchronize", cudaStreamSynchronize(stream));
+    t.Add("cudaStreamSynchronize", cudaStreamSynchronize(stream));
+
+    void *devPtr = NULL;
+    char in[64], out[64] = {0};
+    for (int b = 0; b < (int)sizeof(in); b++) in[b] = (char)(i + b);
+    t.Add("cudaMalloc", cudaMalloc(&devPtr, sizeof(in)));
+    t.Add("cudaMemcpyAsync",
+          cudaMemcpyAsync(devPtr, in, sizeof(in), cudaMemcpyHostToDevice,
+                          stream));
+    t.Add("cudaStreamQuery", cudaStreamQuery(stream));
+    t.Add("cudaStreamSynchronize", cudaStreamSynchronize(stream));
+    t.Add("cudaMemcpy",
+          cudaMemcpy(out, devPtr, sizeof(out), cudaMemcpyDeviceToHost),
+          CompareCopy(in, out, sizeof(in)));
+    /* a synchronous copy too, leading with zeros, as a length would */
+    memset(in, 0, 8);
+    t.Add("cudaMemcpy",
+          cudaMemcpy(devPtr, in, sizeof(in), cudaMemcpyHostToDevice));
+    t.Add("cudaMemcpy",
+          cudaMemcpy(out, devPtr, sizeof(out), cudaMemcpyDeviceToHost),
+          CompareCopy(in, out, sizeof(in)));
+    t.Add("cudaFree", cudaFree(devPtr));
+    t.Add("cudaFree", cudaFree(devPtr));
+    t.Add("cudaPeekAtLastError", cudaPeekAtLastError());
+    t.Add("cudaGetLastError", cudaGetLastError());
+
+    t.Add("cudaStreamQuery", cudaStreamQuery(0));
+    t.Add("cudaStreamDestroy", cudaStreamDestroy(stream));
+    t.Add("cudaStreamQuery", cudaStreamQuery(stream));
+    t.Add("cudaGetLastError", cudaGetLastError());
+    t.Add("cudaGetLastError", cudaGetLastError());
+  }
+}
+
+static int GetEnvInt(const char *name, int value) {
+  char *val = getenv(name);
+  return val == NULL || *val == '\0' ? value : atoi(val);
+}
+
+/* the backends run.sh starts for devicemap */
+static int BackendDevices() { return GetEnvInt("GVIRTUS_NULLDEV_DEVICES", 1); }
+
+static size_t BackendMemory(int backend) { return (size_t)(backend + 1) << 20; }
+
+/*
+ * One device at a time: the memory a device shows, and how much a cudaMalloc
+ * gets once it is set, all of the memory of its backend and not a byte more,
+ * name the backend owning it.
+ */
+static int CheckDevices() {
+  int count = 0, devices = BackendDevices(), failed = 0;
+  int backends = GetEnvInt("GVIRTUS_CHECK_BACKENDS", 1);
+  cudaError_t error = cudaGetDeviceCount(&count);
+  if (error != cudaSuccess || count != backends * devices) {
+    std::cout << "cudaGetDeviceCount " << error << " " << count << ", not "
+              << backends * devices << "\n";
+    return 1;
+  }
+  for (int device = 0; device < count; device++) {
+    size_t memory = BackendMemory(device / devices);
+    cudaDeviceProp prop;
+    error = cudaGetDeviceProperties(&prop, device);
+    if (error != cudaSuccess || prop.totalGlobalMem != memory) {
+      std::cout << "device " << device << ": cudaGetDeviceProperties " << error
+                << " " << prop.totalGlobalMem << ", not " << memory << "\n";
+      failed++;
+    }
+
+    int current = -1;
+    error = cudaSetDevice(device);
+    if (error == cudaSuccess) error = cudaGetDevice(&current);
+    if (error != cudaSuccess || current != device) {
+      std::cout << "device " << device << ": cudaGetDevice " << error << " "
+                << current << " after cudaSetDevice\n";
+      failed++;
+      continue;
+    }
+
+    void *devPtr = NULL;
+    cudaError_t all = cudaMalloc(&devPtr, memory);
+    if (all == cudaSuccess) cudaFree(devPtr);
+    cudaError_t more = cudaMalloc(&devPtr, memory + 1);
+    if (more == cudaSuccess) cudaFree(devPtr);
+    cudaGetLastError();
+    if (all != cudaSuccess || more == cudaSuccess) {
+      std::cout << "device " << device << ": cudaMalloc " << all << " for "
+                << memory << " bytes, " << more << " for one more\n";
+      failed++;
+    }
+  }
+  return failed;
+}
+
+/*
+ * Threads moving between the devices of every backend at once: each
+ * allocation must stay on the backend of the device current when it was
+ * made. Only the calls that fail are added.
+ */
+static void DeviceMapSteps(Transcript &t, int iterations) {
+  int count = 0;
+  cudaError_t error = cudaGetDeviceCount(&count);
+  if (error != cudaSuccess || count == 0) {
+    t.Add("cudaGetDeviceCount", error, count);
+    return;
+  }
+  static std::atomic<int> next(0);
+  int first = next++;
+  for (int i = 0; i < iterations; i++) {
+    int device = (first + i) % count, current = -1;
+    if ((error = cudaSetDevice(device)) != cudaSuccess)
+      t.Add("cudaSetDevice", error, device);
+    if ((error = cudaGetDevice(&current)) != cudaSuccess || current != device)
+      t.Add("cudaGetDevice", error, current);
+
+    void *devPtr = NULL;
+    char in[64], out[64] = {0};
+    for (int b = 0; b < (int)sizeof(in); b++) in[b] = (char)(device + b);
+    if ((error = cudaMalloc(&devPtr, sizeof(in))) != cudaSuccess) {
+      t.Add("cudaMalloc", error, device);
+      continue;
+    }
+    if ((error = cudaMemcpy(devPtr, in, sizeof(in),
+                            cudaMemcpyHostToDevice)) != cudaSuccess ||
+        (error = cudaMemcpy(out, devPtr, sizeof(out),
+                            cudaMemcpyDeviceToHost)) != cudaSuccess ||
+        memcmp(in, out, sizeof(in)) != 0)
+      t.Add("cudaMemcpy", error, device);
+    if ((error = cudaFree(devPtr)) != cudaSuccess)
+      t.Add("cudaFree", error, device);
+  }
+}
+
+/**
+ * Runs steps on threads at once and returns what each thread saw, in thread
+ * order.
+ */
+static std::vector<std::string> RunThreads(int threads, int iterations,
+                                           void (*steps)(Transcript &, int)) {
+  std::vector<Transcript> transcripts(threads);
+  std::vector<std::thread> workers;
+  for (int i = 0; i < threads; i++)
+    workers.emplace_back(steps, std::ref(transcripts[i]), iterations);
+  for (auto &worker : workers) worker.join();
+  std::vector<std::string> seen;
+  for (auto &transcript : transcripts) seen.push_back(transcript.Str());
+  return seen;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0]
+              << " shadow|devicemap|pool [threads] [iterations]" << std::endl;
+    return 2;
+  }
+  std::string check = argv[1];
+  int threads = argc > 2 ? atoi(argv[2]) : 8;
+  int iterations = argc > 3 ? atoi(argv[3]) : 100;
+
+  if (check == "shadow") {
+    std::vector<std::string> seen = RunThreads(threads, iterations, ShadowSteps);
+    for (int i = 0; i < threads; i++)
+      std::cout << "thread " << i << "\n" << seen[i];
+    if (copyMismatches == 0) return 0;
+    std::cerr << copyMismatches << " copies read back different data"
+              << std::endl;
+    return 1;
+  }
+  if (check == "devicemap") {
+    int failed = CheckDevices();
+    std::vector<std::string> seen =
+        RunThreads(threads, iterations, DeviceMapSteps);
+    for (int i = 0; i < threads; i++) {
+      if (seen[i].empty()) continue;
+      std::cout << "thread " << i << "\n" << seen[i];
+      failed++;
+    }
+    return failed == 0 ? 0 : 1;
+  }
+  if (check == "pool") {
+    cudaDeviceProp prop;
+    cudaError_t error = cudaGetDeviceProperties(&prop, 0);
+    if (error != cudaSuccess) {
+      std::cerr << "cudaGetDeviceProperties " << error << std::endl;
+      return 1;
+    }
+    std::cout << (prop.totalGlobalMem >> 20) << std::endl;
+    std::this_thread::sleep_for(std::chrono::milliseconds(iterations));
+    return 0;
+  }
+  std::cerr << "Unknown check " << check << std::endl;
+  return 2;
+}
@@ -0,0 +1,136 @@
+#! /bin/bash
+#
+# Runs gvirtus-frontend-check over the frontend library of $GVIRTUS_HOME,
+# against backends started here, on this host, with the nulldev plugin.
+#
+# Usage: gvirtus-frontend-check.sh CHECK [threads] [iterations]
+#   shadow     one backend; the answers with and without the runtime shadow,
+#              and without combining small copies, must be the same, and the
+#              copies must read back what they wrote
+#   devicemap  two backends of two devices each; the frontend must number
+#              them as four and send each thread to the backend of its device
+#   pool       four backends in a pool, and as many frontends as threads (16
+#              by default) arriving one after the other, each staying
+#              iterations milliseconds (5000 by default); prints how many each
+#              backend got, and fails if they are more than two apart
+#
+# Exits with 1 if a check fails.
+
+check=${1:?Usage: $0 shadow|devicemap|pool [threads] [iterations]}
+shift
+if [ -z "$GVIRTUS_HOME" ]; then
+  echo "GVIRTUS_HOME is not set"
+  exit 2
+fi
+bin=$GVIRTUS_HOME/bin
+
+work=$(mktemp -d /tmp/gvirtus-frontend-check-XXXXXX)
+pids=()
+cleanup() {
+  [ ${#pids[@]} -gt 0 ] && kill ${pids[@]} 2>/dev/null
+  wait 2>/dev/null
+  rm -rf $work
+}
+trap cleanup EXIT
+
+endpoint() {
+  echo "{ \"suite\": \"tcp/ip\", \"protocol\": \"tcp\", \"server_address\": \"127.0.0.1\", \"port\": \"$1\" }"
+}
+
+# start_backends N [pool]: starts N backends, waits for them to accept
+# connections and writes the frontend configuration listing them all, or, with
+# pool, listing them as one pool. Backend i has i + 1 MiB of device memory,
+# which tells the backends apart.
+start_backends() {
+  local backends="" first="" port
+  for i in $(seq 0 $(($1 - 1))); do
+    port=$((20000 + RANDOM % 20000))
+    cat >$work/backend-$i.json <<EOF
+{
+  "communicator": [ { "endpoint": $(endpoint $port), "plugins": [ "nulldev" ] } ],
+  "secure_application": false
+}
+EOF
+    GVIRTUS_NULLDEV_MEMORY=$(((i + 1) << 20)) \
+      $bin/gvirtus-backend $work/backend-$i.json >$work/backend-$i.log 2>&1 &
+    pids+=($!)
+    for try in $(seq 50); do
+      (exec 3<>/dev/tcp/127.0.0.1/$port) 2>/dev/null && break
+      sleep 0.1
+    done
+    backends="$backends${backends:+, }$(endpoint $port)"
+    first=${first:-$port}
+  done
+  export GVIRTUS_CHECK_BACKENDS=$1
+  [ "$2" = pool ] && backends="[ $backends ]"
+  cat >$work/frontend.json <<EOF
+{
+  "communicator": [ { "endpoint": $(endpoint $first) } ],
+  "backends": [ $backends ],
+  "secure_application": false
+}
+EOF
+}
+
+export GVIRTUS_CONFIG=$work/frontend.json
+export LD_LIBRARY_PATH=$GVIRTUS_HOME/lib/frontend:$GVIRTUS_HOME/lib:$LD_LIBRARY_PATH
+
+case $check in
+  shadow)
+    start_backends 1
+    GVIRTUS_RUNTIME_SHADOW=off $bin/gvirtus-frontend-check shadow "$@" >$work/off.txt || exit 1
+    GVIRTUS_RUNTIME_SHADOW=on $bin/gvirtus-frontend-check shadow "$@" >$work/on.txt || exit 1
+    GVIRTUS_RUNTIME_SHADOW=on GVIRTUS_WRITE_COMBINE_MAX_COPY=0 \
+      $bin/gvirtus-frontend-check shadow "$@" >$work/uncombined.txt || exit 1
+    if ! diff -u $work/off.txt $work/on.txt; then
+      echo "shadow: the shadowed answers differ from the backend's"
+      exit 1
+    fi
+    if ! diff -u $work/uncombined.txt $work/on.txt; then
+      echo "shadow: the answers differ with the small copies combined"
+      exit 1
+    fi
+    echo "shadow: $(grep -vc '^thread' $work/on.txt) answers match"
+    ;;
+  devicemap)
+    export GVIRTUS_NULLDEV_DEVICES=2
+    start_backends 2
+    for shadow in off on; do
+      if ! GVIRTUS_RUNTIME_SHADOW=$shadow $bin/gvirtus-frontend-check devicemap "$@"; then
+        echo "devicemap: the devices of the backends are mapped wrong, with the runtime shadow $shadow"
+        exit 1
+      fi
+    done
+    echo "devicemap: 4 devices on 2 backends"
+    ;;
+  pool)
+    frontends=${1:-16}
+    start_backends 4 pool
+    for i in $(seq $frontends); do
+      $bin/gvirtus-frontend-check pool 1 ${2:-5000} >$work/frontend-$i.txt &
+      pids+=($!)
+      sleep 0.1
+    done
+    wait ${pids[@]:4}
+    min=$frontends max=0 total=0
+    for mib in 1 2 3 4; do
+      n=$(cat $work/frontend-*.txt | grep -cx $mib)
+      echo "pool: backend $((mib - 1)) served $n of $frontends frontends"
+      [ $n -lt $min ] && min=$n
+      [ $n -gt $max ] && max=$n
+      total=$((total + n))
+    done
+    if [ $total -ne $frontends ]; then
+      echo "pool: $((frontends - total)) frontends got no backend"
+      exit 1
+    fi
+    if [ $((max - min)) -gt 2 ]; then
+      echo "pool: the frontends are spread unevenly"
+      exit 1
+    fi
+    ;;
+  *)
+    echo "Unknown check $check"
+    exit 2
+    ;;
+esac
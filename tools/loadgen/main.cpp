@@ -0,0 +1,457 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Load generator for a backend: N simulated clients, one thread and
+ * one connection each, speak the frontend protocol directly and repeat a
+ * mix of cudart calls, as the cudart frontend marshals them. Every interval
+ * a JSON line reports the throughput, the latency percentiles of the calls
+ * and, given its pid, the CPU and the resident memory of the backend.
+ *
+ * The clients need no GPU and no frontend library. The backend they load
+ * is meant to run the nulldev plugin, so that what is measured is the
+ * backend and not a device.
+ *
+ * Mixes, each repeated as a step:
+ *   launch     8 kernel launches with 8 arguments, a stream synchronize
+ *   memcpy     a copy of --bytes to the device and one back
+ *   inference  the input (--bytes) to the device, 24 launches, 4 KiB back,
+ *              a stream synchronize: the cudart traffic of an inference
+ *              step of a small network
+ *
+ * Usage: gvirtus-loadgen [options]
+ *   --config PATH      configuration file (default: as the frontend finds it)
+ *   --index N          backend endpoint of the configuration file (default 0)
+ *   --clients N        simulated clients (default 10)
+ *   --mix NAME         launch, memcpy or inference (default launch)
+ *   --bytes N          size of the copies (default 1 MiB)
+ *   --seconds S        duration of the run (default 30)
+ *   --interval S       time between two reports (default 1)
+ *   --backend-pid PID  report the CPU and RSS of this local backend
+ */
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gvirtus/common/Stats.h>
+#include <gvirtus/communicators/Buffer.h>
+#include <gvirtus/communicators/CommunicatorFactory.h>
+#include <gvirtus/communicators/EndpointFactory.h>
+
+using gvirtus::common::Histogram;
+using gvirtus::common::pointer_t;
+using gvirtus::communicators::Buffer;
+using gvirtus::communicators::Communicator;
+using gvirtus::communicators::CommunicatorFactory;
+using gvirtus::communicators::Endpoint;
+using gvirtus::communicators::EndpointFactory;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+/* the values of cudaMemcpyKind */
+static const int HostToDevice = 1;
+static const int DeviceToHost = 2;
+
+struct Dim3 {
+  unsigned x, y, z;
+};
+
+/**
+ * A simulated frontend: one connection, and the input and output buffers
+ * the Frontend keeps across calls.
+ */
+class Client {
+ public:
+  Client(std::shared_ptr<Endpoint> end, int id) : mId(id) {
+    mCommunicator = CommunicatorFactory::create_communicator(end);
+    mCommunicator->Connect();
+  }
+
+  ~Client() { mCommunicator->Close(); }
+
+  inline Buffer *Input() {
+    mInput.Reset();
+    return &mInput;
+  }
+
+  inline Buffer *Output() { return &mOutput; }
+
+  /**
+   * Sends the input buffer and waits for the reply, as Frontend::Execute.
+   *
+   * @return false if the connection was lost.
+   */
+  bool Execute(const char *routine) {
+    auto start = steady_clock::now();
+    mCommunicator->Write(routine, strlen(routine) + 1);
+    mInput.Dump(mCommunicator.get());
+    int exit_code;
+    double time_taken;
+    size_t size;
+    if (mCommunicator->Read((char *)&exit_code, sizeof(int)) != sizeof(int) ||
+        mCommunicator->Read((char *)&time_taken, sizeof(double)) !=
+            sizeof(double) ||
+        mCommunicator->Read((char *)&size, sizeof(size_t)) != sizeof(size_t))
+      return false;
+    mOutput.Reset();
+    if (size > 0) mOutput.Read<char>(mCommunicator.get(), size);
+    uint64_t elapsed =
+        duration_cast<nanoseconds>(steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mLatency.Record(elapsed);
+    if (exit_code != 0) mErrors++;
+    return true;
+  }
+
+  void EndStep() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mSteps++;
+  }
+
+  /**
+   * Adds what happened since the last call to the interval's totals.
+   */
+  void Collect(Histogram &latency, uint64_t &steps, uint64_t &errors) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    latency.Merge(mLatency);
+    steps += mSteps;
+    errors += mErrors;
+    mLatency = Histogram();
+    mSteps = 0;
+    mErrors = 0;
+  }
+
+  inline int Id() const { return mId; }
+
+ private:
+  int mId;
+  std::shared_ptr<Communicator> mCommunicator;
+  Buffer mInput;
+  Buffer mOutput;
+  std::mutex mMutex;
+  Histogram mLatency;
+  uint64_t mSteps = 0;
+  uint64_t mErrors = 0;
+};
+
+/* the cudart calls, marshalled as in plugins/cudart/frontend */
+
+static bool RegisterFunction(Client &client, pointer_t host_function) {
+  Dim3 tid = {}, bid = {}, block = {}, grid = {};
+  int warp_size = 32;
+  Buffer *in = client.Input();
+  in->Add((pointer_t)0x1000);
+  in->Add(host_function);
+  in->AddString("loadgen_kernel");
+  in->AddString("loadgen_kernel");
+  in->Add(-1);
+  in->Add(&tid);
+  in->Add(&bid);
+  in->Add(&block);
+  in->Add(&grid);
+  in->Add(&warp_size);
+  return client.Execute("cudaRegisterFunction");
+}
+
+static bool Malloc(Client &client, size_t size, pointer_t *device) {
+  client.Input()->Add(size);
+  if (!client.Execute("cudaMalloc")) return false;
+  *device = client.Output()->GetFromMarshal<pointer_t>();
+  return true;
+}
+
+static bool LaunchKernel(Client &client, pointer_t function) {
+  Dim3 grid = {128, 1, 1}, block = {256, 1, 1};
+  uint64_t args[8] = {};
+  Buffer *in = client.Input();
+  in->Add(function);
+  in->Add(grid);
+  in->Add(block);
+  in->Add((size_t)0);
+  in->Add((pointer_t)0);
+  in->Add((char *)args, sizeof(args));
+  return client.Execute("cudaLaunchKernel");
+}
+
+static bool MemcpyToDevice(Client &client, pointer_t device,
+                           const std::vector<char> &host, size_t count) {
+  Buffer *in = client.Input();
+  in->Add(device);
+  in->Add((char *)host.data(), count);
+  in->Add(count);
+  in->Add(HostToDevice);
+  return client.Execute("cudaMemcpy");
+}
+
+static bool MemcpyToHost(Client &client, pointer_t device,
+                         std::vector<char> &host, size_t count) {
+  Buffer *in = client.Input();
+  in->Add((char *)"", 1);
+  in->Add(device);
+  in->Add(count);
+  in->Add(DeviceToHost);
+  if (!client.Execute("cudaMemcpy")) return false;
+  char *data = client.Output()->Assign<char>(count);
+  if (data != NULL) memcpy(host.data(), data, count);
+  return true;
+}
+
+static bool StreamSynchronize(Client &client) {
+  client.Input()->Add((pointer_t)0);
+  return client.Execute("cudaStreamSynchronize");
+}
+
+static std::atomic<bool> running{true};
+static std::atomic<int> lost{0};
+
+static void Run(Client *client, std::string mix, size_t bytes) {
+  pointer_t function = 0x400000 + 0x100 * (pointer_t)client->Id();
+  std::vector<char> host(std::max<size_t>(bytes, 4 << 10), 'x');
+  pointer_t device = 0;
+  bool ok = true;
+
+  if (mix == "launch" || mix == "inference")
+    ok = RegisterFunction(*client, function);
+  if (ok && (mix == "memcpy" || mix == "inference"))
+    ok = Malloc(*client, host.size(), &device);
+
+  while (ok && running) {
+    if (mix == "launch") {
+      for (int i = 0; ok && i < 8; i++) ok = LaunchKernel(*client, function);
+      ok = ok && StreamSynchronize(*client);
+    } else if (mix == "memcpy") {
+      ok = MemcpyToDevice(*client, device, host, bytes) &&
+           MemcpyToHost(*client, device, host, bytes);
+    } else {
+      ok = MemcpyToDevice(*client, device, host, bytes);
+      for (int i = 0; ok && i < 24; i++) ok = LaunchKernel(*client, function);
+      ok = ok && MemcpyToHost(*client, device, host, 4 << 10) &&
+           StreamSynchronize(*client);
+    }
+    if (ok) client->EndStep();
+  }
+  if (!ok) lost++;
+}
+
+/**
+ * CPU time, in seconds, and resident memory, in bytes, of a local process.
+ *
+ * @return false if the process cannot be read.
+ */
+static bool ProcessUsage(int pid, double *cpu, uint64_t *rss) {
+  std::ifstream stat("/proc/" + std::to_string(pid) + "/stat");
+  std::string line;
+  if (!std::getline(stat, line)) return false;
+  /* the fields after the command, which may hold spaces, from the state */
+  std::string::size_type end = line.rfind(')');
+  if (end == std::string::npos) return false;
+  std::istringstream fields(line.substr(end + 2));
+  std::string field;
+  uint64_t utime = 0, stime = 0;
+  for (int i = 3; fields >> field; i++) {
+    if (i == 14) utime = strtoull(field.c_str(), NULL, 10);
+    if (i == 15) {
+      stime = strtoull(field.c_str(), NULL, 10);
+      break;
+    }
+  }
+  *cpu = (double)(utime + stime) / sysconf(_SC_CLK_TCK);
+
+  std::ifstream statm("/proc/" + std::to_string(pid) + "/statm");
+  uint64_t size, resident;
+  if (!(statm >> size >> resident)) return false;
+  *rss = resident * sysconf(_SC_PAGESIZE);
+  return true;
+}
+
+static std::string DefaultConfig() {
+  const char *config = getenv("GVIRTUS_CONFIG");
+  if (config != NULL) return config;
+  const char *home = getenv("GVIRTUS_HOME");
+  if (home != NULL) return std::string(home) + "/etc/properties.json";
+  return "./properties.json";
+}
+
+int main(int argc, char **argv) {
+  std::string config = DefaultConfig();
+  std::string mix = "launch";
+  int index = 0;
+  int clients = 10;
+  size_t bytes = 1 << 20;
+  double seconds = 30.0;
+  double interval = 1.0;
+  int backend_pid = 0;
+
+  static const struct option options[] = {
+      {"config", required_argument, NULL, 'c'},
+      {"index", required_argument, NULL, 'i'},
+      {"clients", required_argument, NULL, 'n'},
+      {"mix", required_argument, NULL, 'm'},
+      {"bytes", required_argument, NULL, 'b'},
+      {"seconds", required_argument, NULL, 't'},
+      {"interval", required_argument, NULL, 'r'},
+      {"backend-pid", required_argument, NULL, 'p'},
+      {NULL, 0, NULL, 0}};
+  int option;
+  while ((option = getopt_long(argc, argv, "", options, NULL)) != -1) {
+    switch (option) {
+      case 'c':
+        config = optarg;
+        break;
+      case 'i':
+        index = atoi(optarg);
+        break;
+      case 'n':
+        clients = atoi(optarg);
+        break;
+      case 'm':
+        mix = optarg;
+        break;
+      case 'b':
+        bytes = strtoull(optarg, NULL, 0);
+        break;
+      case 't':
+        seconds = atof(optarg);
+        break;
+      case 'r':
+        interval = atof(optarg);
+        break;
+      case 'p':
+        backend_pid = atoi(optarg);
+        break;
+      default:
+        std::cerr << "Usage: " << argv[0]
+                  << " [--config PATH] [--index N] [--clients N]"
+                     " [--mix launch|memcpy|inference] [--bytes N]"
+                     " [--seconds S] [--interval S] [--backend-pid PID]"
+                  << std::endl;
+        return 1;
+    }
+  }
+  if (mix != "launch" && mix != "memcpy" && mix != "inference") {
+    std::cerr << "Unknown mix " << mix << std::endl;
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<Client>> pool;
+  try {
+    std::shared_ptr<Endpoint> end = EndpointFactory::get_endpoint(config, index);
+    /* one at a time: the backend's listen backlog is short */
+    for (int i = 0; i < clients; i++)
+      pool.push_back(std::unique_ptr<Client>(new Client(end, i)));
+  } catch (std::string &exc) {
+    std::cerr << exc << std::endl;
+    return 1;
+  } catch (const char *exc) {
+    std::cerr << exc << std::endl;
+    return 1;
+  } catch (std::exception &exc) {
+    std::cerr << exc.what() << std::endl;
+    return 1;
+  }
+
+  std::vector<std::thread> threads;
+  for (auto &client : pool) threads.emplace_back(Run, client.get(), mix, bytes);
+
+  auto start = steady_clock::now();
+  auto last = start;
+  double last_cpu = 0;
+  uint64_t rss = 0;
+  if (backend_pid != 0) ProcessUsage(backend_pid, &last_cpu, &rss);
+  Histogram total;
+  uint64_t total_steps = 0, total_errors = 0;
+  auto next = start;
+  for (;;) {
+    next += duration_cast<steady_clock::duration>(duration<double>(interval));
+    std::this_thread::sleep_until(next);
+    auto now = steady_clock::now();
+    bool done = now - start >= duration<double>(seconds);
+    if (done) running = false;
+
+    Histogram latency;
+    uint64_t steps = 0, errors = 0;
+    for (auto &client : pool) client->Collect(latency, steps, errors);
+    double elapsed = duration<double>(now - last).count();
+    last = now;
+
+    std::cout << "{\"t\": " << duration<double>(now - start).count()
+              << ", \"mix\": \"" << mix << "\", \"clients\": " << clients
+              << ", \"lost\": " << lost << ", \"calls_per_s\": "
+              << (uint64_t)(latency.Count() / elapsed)
+              << ", \"steps_per_s\": " << (uint64_t)(steps / elapsed)
+              << ", \"errors\": " << errors
+              << ", \"p50_ns\": " << latency.Percentile(0.5)
+              << ", \"p90_ns\": " << latency.Percentile(0.9)
+              << ", \"p99_ns\": " << latency.Percentile(0.99)
+              << ", \"p999_ns\": " << latency.Percentile(0.999)
+              << ", \"max_ns\": " << latency.Max();
+    double cpu;
+    if (backend_pid != 0 && ProcessUsage(backend_pid, &cpu, &rss)) {
+      std::cout << ", \"backend_cpu\": " << (cpu - last_cpu) / elapsed
+                << ", \"backend_rss_bytes\": " << rss;
+      last_cpu = cpu;
+    }
+    std::cout << "}" << std::endl;
+
+    total.Merge(latency);
+    total_steps += steps;
+    total_errors += errors;
+    if (done) break;
+  }
+
+  for (auto &thread : threads) thread.join();
+  double elapsed = duration<double>(steady_clock::now() - start).count();
+  std::cout << "{\"summary\": true, \"seconds\": " << elapsed << ", \"mix\": \""
+            << mix << "\", \"clients\": " << clients << ", \"lost\": " << lost
+            << ", \"calls\": " << total.Count()
+            << ", \"calls_per_s\": " << (uint64_t)(total.Count() / elapsed)
+            << ", \"steps_per_s\": " << (uint64_t)(total_steps / elapsed)
+            << ", \"errors\": " << total_errors
+            << ", \"p50_ns\": " << total.Percentile(0.5)
+            << ", \"p90_ns\": " << total.Percentile(0.9)
+            << ", \"p99_ns\": " << total.Percentile(0.99)
+            << ", \"p999_ns\": " << total.Percentile(0.999)
+            << ", \"max_ns\": " << total.Max();
+  if (backend_pid != 0) std::cout << ", \"backend_rss_bytes\": " << rss;
+  std::cout << "}" << std::endl;
+  return 0;
+}
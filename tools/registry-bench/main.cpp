@@ -0,0 +1,188 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Stress benchmark of the backend registries: client threads resolve
+ * kernels as cudaLaunchKernel does (host function -> device function ->
+ * parameter information) while one more thread keeps registering modules.
+ *
+ * Usage: gvirtus-registry-bench [max-clients] [seconds-per-run] [functions]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gvirtus/common/Registry.h>
+
+using gvirtus::common::Registry;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+/* stands for NvInfoFunction: a kernel's parameter layout */
+typedef std::vector<int> Info;
+
+/**
+ * The registries as CudaRtHandler keeps them.
+ */
+class ShardedTables {
+ public:
+  void Register(const void *host, const std::string &device) {
+    mInfo.Put(device, std::make_shared<const Info>(4, 8));
+    mHost2Device.Put(host, device);
+  }
+
+  size_t Resolve(const void *host) {
+    std::string device;
+    std::shared_ptr<const Info> info;
+    if (!mHost2Device.Find(host, &device) || !mInfo.Find(device, &info))
+      return 0;
+    return info->size();
+  }
+
+ private:
+  Registry<const void *, std::string> mHost2Device;
+  Registry<std::string, std::shared_ptr<const Info>> mInfo;
+};
+
+/**
+ * The same tables, hashed as the registries are, behind one mutex: the
+ * simplest correct alternative.
+ */
+class LockedTables {
+ public:
+  void Register(const void *host, const std::string &device) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mInfo[device] = Info(4, 8);
+    mHost2Device[host] = device;
+  }
+
+  size_t Resolve(const void *host) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mHost2Device.find(host);
+    if (it == mHost2Device.end()) return 0;
+    auto info = mInfo.find(it->second);
+    return info == mInfo.end() ? 0 : info->second.size();
+  }
+
+ private:
+  std::mutex mMutex;
+  std::unordered_map<const void *, std::string> mHost2Device;
+  std::unordered_map<std::string, Info> mInfo;
+};
+
+static const void *HostFunction(size_t i) {
+  return (const void *)(0x400000 + 16 * i);
+}
+
+static std::string DeviceFunction(size_t i) {
+  return "_Z6kernelILi" + std::to_string(i) + "EEvPfS0_i";
+}
+
+/**
+ * Runs clients resolving launches for seconds.
+ *
+ * @return launches resolved per second.
+ */
+template <class Tables>
+static double Run(int clients, double seconds, size_t functions) {
+  Tables tables;
+  for (size_t i = 0; i < functions; i++)
+    tables.Register(HostFunction(i), DeviceFunction(i));
+
+  std::atomic<bool> stop(false);
+  std::atomic<uint64_t> launches(0);
+
+  /* a session loading modules while the others launch */
+  std::thread registrar([&] {
+    for (size_t i = functions; !stop; i++) {
+      tables.Register(HostFunction(i), DeviceFunction(i));
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  });
+
+  std::vector<std::thread> threads;
+  for (int c = 0; c < clients; c++)
+    threads.emplace_back([&, c] {
+      uint64_t n = 0, x = c + 1;
+      while (!stop) {
+        /* xorshift: launches spread over the registered kernels */
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        if (tables.Resolve(HostFunction(x % functions)) == 0) abort();
+        n++;
+      }
+      launches += n;
+    });
+
+  auto start = steady_clock::now();
+  std::this_thread::sleep_for(duration<double>(seconds));
+  stop = true;
+  for (auto &t : threads) t.join();
+  registrar.join();
+  return launches / duration<double>(steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+  int max_clients = argc > 1 ? atoi(argv[1])
+                             : (int)std::thread::hardware_concurrency();
+  double seconds = argc > 2 ? atof(argv[2]) : 1.0;
+  size_t functions = argc > 3 ? (size_t)atol(argv[3]) : 1024;
+  if (max_clients < 1) max_clients = 1;
+
+  /* the client counts: powers of two, then max_clients */
+  std::vector<int> runs;
+  for (int clients = 1; clients < max_clients; clients *= 2)
+    runs.push_back(clients);
+  runs.push_back(max_clients);
+
+  std::cout << "hardware threads " << std::thread::hardware_concurrency()
+            << ", " << functions << " functions, " << seconds
+            << " s per run; each run has one registering thread more than "
+               "its clients"
+            << std::endl;
+  std::cout << std::setw(8) << "clients" << std::setw(9) << "threads"
+            << std::setw(16) << "registry/s" << std::setw(16) << "locked/s"
+            << std::setw(10) << "speedup" << std::endl;
+  for (int clients : runs) {
+    double sharded = Run<ShardedTables>(clients, seconds, functions);
+    double locked = Run<LockedTables>(clients, seconds, functions);
+    std::cout << std::setw(8) << clients << std::setw(9) << clients + 1
+              << std::setw(16) << std::fixed
+              << std::setprecision(0) << sharded << std::setw(16) << locked
+              << std::setw(9) << std::setprecision(2) << sharded / locked
+              << "x" << std::endl;
+  }
+  return 0;
+}
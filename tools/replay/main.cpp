@@ -0,0 +1,368 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Sends the requests of a trace (see gvirtus/common/Trace.h) to a
+ * backend again, one connection per recorded thread, and compares the run
+ * with the recorded one.
+ *
+ * A request waits for the replies its thread had read when it was recorded,
+ * whatever thread they were for, and, unless --fast, for its recorded time.
+ * The handles in the replies (device pointers, streams, library handles)
+ * differ from run to run: in the replies of the routines that make handles
+ * (see MakesHandles()), every 8 bytes that differ from the recorded ones and
+ * look like a handle are remembered, and replaced where the later requests
+ * carry them. The replies of the other routines, such as the data of a
+ * copy, are not searched. Pointers into the middle of an allocation are sent
+ * as recorded.
+ *
+ * The requests of every backend of the recording go to the one backend.
+ *
+ * Usage: gvirtus-replay [options] TRACE
+ *   --config PATH  configuration file (default: as the frontend finds it)
+ *   --index N      backend endpoint of the configuration file (default 0)
+ *   --fast         send every request as soon as it may, not at its time
+ *   --speed X      at X times the recorded pace (default 1)
+ */
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gvirtus/common/Stats.h>
+#include <gvirtus/common/Trace.h>
+#include <gvirtus/communicators/Buffer.h>
+#include <gvirtus/communicators/CommunicatorFactory.h>
+#include <gvirtus/communicators/EndpointFactory.h>
+
+using gvirtus::common::Histogram;
+using gvirtus::common::Trace;
+using gvirtus::communicators::Buffer;
+using gvirtus::communicators::Communicator;
+using gvirtus::communicators::CommunicatorFactory;
+using gvirtus::communicators::Endpoint;
+using gvirtus::communicators::EndpointFactory;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+/* smaller values are counts, sizes and flags, never handles */
+static const uint64_t MinHandle = 0x10000;
+
+/*
+ * The routines whose replies carry new handles, by a part of their name:
+ * allocations, runtime and library objects, plans, opened IPC handles and
+ * the addresses of symbols and mapped memory.
+ */
+static bool MakesHandles(const std::string &routine) {
+  static const char *const markers[] = {
+      "Alloc",   "Create",        "Plan",          "Open",       "Attach",
+      "Address", "DevicePointer", "MappedPointer", "ModuleLoad", "ModuleGet"};
+  for (const char *marker : markers)
+    if (routine.find(marker) != std::string::npos) return true;
+  return false;
+}
+
+/**
+ * The handles of the recording and those the backend answered instead.
+ */
+class Relocations {
+ public:
+  /**
+   * Remembers the 8-byte values of recorded that replayed replaced.
+   */
+  void Learn(const char *recorded, const char *replayed, size_t size) {
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i++) {
+      uint64_t from, to;
+      memcpy(&from, recorded + i, sizeof(from));
+      memcpy(&to, replayed + i, sizeof(to));
+      if (from == to || from < MinHandle || to == 0) continue;
+      mMap[from] = to;
+      mMin = std::min(mMin, from);
+      mMax = std::max(mMax, from);
+      i += sizeof(uint64_t) - 1;
+    }
+  }
+
+  /**
+   * Replaces the recorded handles in data.
+   */
+  void Apply(char *data, size_t size) {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    if (mMap.empty()) return;
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i++) {
+      uint64_t value;
+      memcpy(&value, data + i, sizeof(value));
+      if (value < mMin || value > mMax) continue;
+      auto it = mMap.find(value);
+      if (it == mMap.end()) continue;
+      memcpy(data + i, &it->second, sizeof(it->second));
+      i += sizeof(uint64_t) - 1;
+    }
+  }
+
+  size_t Size() {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    return mMap.size();
+  }
+
+ private:
+  std::shared_mutex mMutex;
+  std::unordered_map<uint64_t, uint64_t> mMap;
+  uint64_t mMin = UINT64_MAX;
+  uint64_t mMax = 0;
+};
+
+/**
+ * Which frames have been answered, by their position in the trace.
+ */
+class Progress {
+ public:
+  explicit Progress(size_t frames) : mDone(frames, false) {}
+
+  /* until the first count frames of the trace have been answered */
+  void WaitFor(uint64_t count) {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mChanged.wait(lock, [&]() { return mAnswered >= count; });
+  }
+
+  void Done(size_t frame) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mDone[frame] = true;
+    while (mAnswered < mDone.size() && mDone[mAnswered]) mAnswered++;
+    mChanged.notify_all();
+  }
+
+ private:
+  std::mutex mMutex;
+  std::condition_variable mChanged;
+  std::vector<bool> mDone;
+  /* the frames before this one have all been answered */
+  uint64_t mAnswered = 0;
+};
+
+struct Totals {
+  std::mutex mutex;
+  Histogram recorded;
+  Histogram replayed;
+  uint64_t frames = 0;
+  uint64_t mismatches = 0;
+  uint64_t lost = 0;
+};
+
+static std::vector<Trace::Frame> frames;
+static Relocations relocations;
+static Totals totals;
+
+static void Replay(std::shared_ptr<Endpoint> end,
+                   const std::vector<size_t> &thread, Progress *progress,
+                   steady_clock::time_point start, uint64_t first,
+                   double speed) {
+  std::shared_ptr<Communicator> communicator;
+  try {
+    communicator = CommunicatorFactory::create_communicator(end);
+    communicator->Connect();
+  } catch (...) {
+    communicator = nullptr;
+  }
+
+  Histogram recorded, replayed;
+  uint64_t mismatches = 0;
+  size_t i = 0;
+  for (; communicator != nullptr && i < thread.size(); i++) {
+    const Trace::Frame &frame = frames[thread[i]];
+    progress->WaitFor(frame.after);
+    if (speed > 0)
+      std::this_thread::sleep_until(
+          start + duration_cast<steady_clock::duration>(
+                      duration<double>((frame.time - first) / 1e9 / speed)));
+
+    std::string request = frame.request.Expand();
+    /* the elided bytes are zeros: no handle there */
+    if (frame.request.elided) {
+      relocations.Apply(&request[0], Trace::Edge);
+      relocations.Apply(&request[request.size() - Trace::Edge], Trace::Edge);
+    } else {
+      relocations.Apply(&request[0], request.size());
+    }
+
+    auto sent = steady_clock::now();
+    communicator->Write(frame.routine.c_str(), frame.routine.size() + 1);
+    Buffer(&request[0], request.size()).Dump(communicator.get());
+    int exit_code;
+    double time_taken;
+    size_t size;
+    if (communicator->Read((char *)&exit_code, sizeof(int)) != sizeof(int) ||
+        communicator->Read((char *)&time_taken, sizeof(double)) !=
+            sizeof(double) ||
+        communicator->Read((char *)&size, sizeof(size_t)) != sizeof(size_t))
+      break;
+    std::string reply(size, '\0');
+    if (size > 0 && communicator->Read(&reply[0], size) != size) break;
+    replayed.Record(
+        duration_cast<nanoseconds>(steady_clock::now() - sent).count());
+    recorded.Record(frame.duration);
+    if (exit_code != frame.exitCode) mismatches++;
+
+    const Trace::Payload &expected = frame.reply;
+    bool learn = MakesHandles(frame.routine);
+    if (learn && expected.elided && size == expected.size) {
+      relocations.Learn(expected.head.data(), reply.data(), Trace::Edge);
+      relocations.Learn(expected.tail.data(), &reply[size - Trace::Edge],
+                        Trace::Edge);
+    } else if (learn && !expected.elided) {
+      relocations.Learn(expected.head.data(), reply.data(),
+                        std::min<size_t>(size, expected.head.size()));
+    }
+    progress->Done(thread[i]);
+  }
+  if (communicator != nullptr) communicator->Close();
+
+  /* the others must not wait for what this thread will never send */
+  for (size_t j = i; j < thread.size(); j++) progress->Done(thread[j]);
+
+  std::lock_guard<std::mutex> lock(totals.mutex);
+  totals.recorded.Merge(recorded);
+  totals.replayed.Merge(replayed);
+  totals.frames += i;
+  totals.mismatches += mismatches;
+  if (i < thread.size()) totals.lost++;
+}
+
+static std::string DefaultConfig() {
+  const char *config = getenv("GVIRTUS_CONFIG");
+  if (config != NULL) return config;
+  const char *home = getenv("GVIRTUS_HOME");
+  if (home != NULL) return std::string(home) + "/etc/properties.json";
+  return "./properties.json";
+}
+
+int main(int argc, char **argv) {
+  std::string config = DefaultConfig();
+  int index = 0;
+  double speed = 1.0;
+
+  static const struct option options[] = {
+      {"config", required_argument, NULL, 'c'},
+      {"index", required_argument, NULL, 'i'},
+      {"fast", no_argument, NULL, 'f'},
+      {"speed", required_argument, NULL, 's'},
+      {NULL, 0, NULL, 0}};
+  int option;
+  while ((option = getopt_long(argc, argv, "", options, NULL)) != -1) {
+    switch (option) {
+      case 'c':
+        config = optarg;
+        break;
+      case 'i':
+        index = atoi(optarg);
+        break;
+      case 'f':
+        speed = 0;
+        break;
+      case 's':
+        speed = atof(optarg);
+        break;
+      default:
+        optind = argc + 1;
+        break;
+    }
+  }
+  if (optind != argc - 1) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--config PATH] [--index N] [--fast | --speed X] TRACE"
+              << std::endl;
+    return 1;
+  }
+
+  std::shared_ptr<Endpoint> end;
+  std::map<uint32_t, std::vector<size_t>> threads;
+  try {
+    Trace::Reader reader(argv[optind]);
+    Trace::Frame frame;
+    while (reader.Next(frame)) {
+      threads[frame.thread].push_back(frames.size());
+      frames.push_back(frame);
+    }
+    end = EndpointFactory::get_endpoint(config, index);
+  } catch (std::string &exc) {
+    std::cerr << exc << std::endl;
+    return 1;
+  } catch (const char *exc) {
+    std::cerr << exc << std::endl;
+    return 1;
+  } catch (std::exception &exc) {
+    std::cerr << exc.what() << std::endl;
+    return 1;
+  }
+  if (frames.empty()) {
+    std::cerr << "The trace has no requests." << std::endl;
+    return 1;
+  }
+
+  uint64_t first = UINT64_MAX, last = 0;
+  for (auto &frame : frames) {
+    first = std::min(first, frame.time);
+    last = std::max(last, frame.time + frame.duration);
+  }
+
+  Progress progress(frames.size());
+  std::vector<std::thread> replayers;
+  auto start = steady_clock::now();
+  for (auto &thread : threads)
+    replayers.emplace_back(Replay, end, std::cref(thread.second), &progress,
+                           start, first, speed);
+  for (auto &replayer : replayers) replayer.join();
+  double elapsed = duration<double>(steady_clock::now() - start).count();
+
+  std::cout << "{\"frames\": " << totals.frames << ", \"recorded_frames\": "
+            << frames.size() << ", \"threads\": " << threads.size()
+            << ", \"lost_threads\": " << totals.lost
+            << ", \"seconds\": " << elapsed
+            << ", \"recorded_seconds\": " << (last - first) / 1e9
+            << ", \"exit_code_mismatches\": " << totals.mismatches
+            << ", \"relocations\": " << relocations.Size()
+            << ", \"p50_ns\": " << totals.replayed.Percentile(0.5)
+            << ", \"p99_ns\": " << totals.replayed.Percentile(0.99)
+            << ", \"recorded_p50_ns\": " << totals.recorded.Percentile(0.5)
+            << ", \"recorded_p99_ns\": " << totals.recorded.Percentile(0.99)
+            << "}" << std::endl;
+  return totals.lost == 0 && totals.mismatches == 0 ? 0 : 2;
+}
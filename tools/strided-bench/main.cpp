@@ -0,0 +1,301 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  Checks and times the strided packing used by the pitched 2D/3D
+ * copies and the BLAS vector/matrix helpers. No GPU is needed.
+ *
+ * First every case is packed and unpacked against a byte-by-byte reference:
+ * odd widths and pitches, 3D regions whose slices are more rows apart than
+ * they hold, element sizes with and without a fast path and positive and
+ * negative increments. Unpacking must leave the padding untouched. Then the
+ * layouts the wrappers see most are timed, in GB/s of logical bytes, next to
+ * a memcpy of the same size.
+ *
+ * Usage: gvirtus-strided-bench [seconds-per-case]
+ *
+ * Exits with 1 if a case does not match the reference.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gvirtus/common/Strided.h>
+
+using gvirtus::common::Strided;
+using gvirtus::common::StridedLayout;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+static const unsigned char Padding = 0xa5;
+
+static void Fill(std::vector<unsigned char> &buffer, std::mt19937 &random) {
+  for (auto &b : buffer) b = (unsigned char)random();
+}
+
+/* the bytes a layout spans, from its first to its last logical byte */
+static size_t Span(const StridedLayout &layout) {
+  if (Strided::PackedSize(layout) == 0) return 0;
+  return (layout.depth - 1) * layout.slicePitch +
+         (layout.height - 1) * layout.pitch + layout.width;
+}
+
+static size_t Span(size_t n, size_t elemSize, long inc) {
+  return n == 0 ? 0 : (n - 1) * (size_t)labs(inc) * elemSize + elemSize;
+}
+
+static void NaivePack(const unsigned char *src, const StridedLayout &layout,
+                      unsigned char *dst) {
+  for (size_t z = 0; z < layout.depth; z++)
+    for (size_t y = 0; y < layout.height; y++)
+      for (size_t x = 0; x < layout.width; x++)
+        *dst++ = src[z * layout.slicePitch + y * layout.pitch + x];
+}
+
+static void NaiveUnpack(const unsigned char *src, const StridedLayout &layout,
+                        unsigned char *dst) {
+  for (size_t z = 0; z < layout.depth; z++)
+    for (size_t y = 0; y < layout.height; y++)
+      for (size_t x = 0; x < layout.width; x++)
+        dst[z * layout.slicePitch + y * layout.pitch + x] = *src++;
+}
+
+/* element i of a BLAS vector: counted from the far end when inc < 0 */
+static size_t ElementOffset(size_t i, size_t n, size_t elemSize, long inc) {
+  size_t k = inc > 0 ? i : n - 1 - i;
+  return k * (size_t)labs(inc) * elemSize;
+}
+
+static void NaivePackElements(const unsigned char *src, size_t n,
+                              size_t elemSize, long inc, unsigned char *dst) {
+  for (size_t i = 0; i < n; i++)
+    for (size_t b = 0; b < elemSize; b++)
+      *dst++ = src[ElementOffset(i, n, elemSize, inc) + b];
+}
+
+static void NaiveUnpackElements(const unsigned char *src, size_t n,
+                                size_t elemSize, long inc,
+                                unsigned char *dst) {
+  for (size_t i = 0; i < n; i++)
+    for (size_t b = 0; b < elemSize; b++)
+      dst[ElementOffset(i, n, elemSize, inc) + b] = *src++;
+}
+
+/**
+ * Packs and unpacks one layout with Strided and with the reference.
+ *
+ * @return false if they differ.
+ */
+static bool CheckLayout(const StridedLayout &layout, std::mt19937 &random) {
+  size_t packed = Strided::PackedSize(layout);
+  std::vector<unsigned char> region(Span(layout));
+  Fill(region, random);
+
+  std::vector<unsigned char> got(packed), want(packed);
+  Strided::Pack(region.data(), layout, got.data());
+  NaivePack(region.data(), layout, want.data());
+  if (got != want) return false;
+
+  std::vector<unsigned char> gotRegion(region.size(), Padding);
+  std::vector<unsigned char> wantRegion(region.size(), Padding);
+  Strided::Unpack(got.data(), layout, gotRegion.data());
+  NaiveUnpack(want.data(), layout, wantRegion.data());
+  return gotRegion == wantRegion;
+}
+
+static bool CheckElements(size_t n, size_t elemSize, long inc,
+                          std::mt19937 &random) {
+  size_t packed = n * elemSize;
+  std::vector<unsigned char> region(Span(n, elemSize, inc));
+  Fill(region, random);
+
+  std::vector<unsigned char> got(packed), want(packed);
+  Strided::PackElements(region.data(), n, elemSize, inc, got.data());
+  NaivePackElements(region.data(), n, elemSize, inc, want.data());
+  if (got != want) return false;
+
+  std::vector<unsigned char> gotRegion(region.size(), Padding);
+  std::vector<unsigned char> wantRegion(region.size(), Padding);
+  Strided::UnpackElements(got.data(), n, elemSize, inc, gotRegion.data());
+  NaiveUnpackElements(want.data(), n, elemSize, inc, wantRegion.data());
+  return gotRegion == wantRegion;
+}
+
+static std::string Describe(const StridedLayout &layout) {
+  return "width " + std::to_string(layout.width) + " height " +
+         std::to_string(layout.height) + " depth " +
+         std::to_string(layout.depth) + " pitch " +
+         std::to_string(layout.pitch) + " slicePitch " +
+         std::to_string(layout.slicePitch);
+}
+
+/**
+ * Runs every correctness case.
+ *
+ * @return the number of cases that failed.
+ */
+static int CheckAll() {
+  std::mt19937 random(42);
+  int cases = 0, failed = 0;
+  auto report = [&](bool ok, const std::string &what) {
+    cases++;
+    if (ok) return;
+    failed++;
+    std::cerr << "MISMATCH " << what << std::endl;
+  };
+
+  for (size_t width : {0, 1, 3, 7, 13, 64, 1000, 4097})
+    for (size_t extra : {0, 1, 5, 64})
+      for (size_t height : {1, 2, 17}) {
+        StridedLayout layout = Strided::Layout2D(width, height, width + extra);
+        report(CheckLayout(layout, random), "2D " + Describe(layout));
+        for (size_t depth : {1, 3, 5})
+          for (size_t rows : {0, 2}) {
+            layout = Strided::Layout3D(width, height, depth, width + extra,
+                                       height + rows);
+            report(CheckLayout(layout, random), "3D " + Describe(layout));
+          }
+      }
+
+  for (size_t rows : {1, 3, 31})
+    for (size_t cols : {1, 4, 9})
+      for (size_t elemSize : {4, 8, 16})
+        for (size_t ld : {rows, rows + 1, rows + 7}) {
+          StridedLayout layout =
+              Strided::LayoutMatrix(rows, cols, elemSize, ld);
+          report(CheckLayout(layout, random), "matrix " + Describe(layout));
+        }
+
+  for (size_t n : {0, 1, 2, 7, 100, 1001})
+    for (size_t elemSize : {1, 3, 4, 8, 12, 16})
+      for (long inc : {1, 2, 3, 17, -1, -2, -5})
+        report(CheckElements(n, elemSize, inc, random),
+               "elements n " + std::to_string(n) + " elemSize " +
+                   std::to_string(elemSize) + " inc " + std::to_string(inc));
+
+  std::cout << cases - failed << "/" << cases << " cases match the reference"
+            << std::endl;
+  return failed;
+}
+
+/* the GB/s of call, moving bytes logical bytes each time */
+static double Throughput(const std::function<void()> &call, size_t bytes,
+                         double seconds) {
+  call();
+  uint64_t calls = 0;
+  auto start = steady_clock::now();
+  double elapsed;
+  do {
+    call();
+    calls++;
+    elapsed = duration<double>(steady_clock::now() - start).count();
+  } while (elapsed < seconds);
+  return (double)bytes * calls / elapsed / 1e9;
+}
+
+struct Shape {
+  const char *name;
+  StridedLayout layout;
+  /* for the element cases: layout.width is unused */
+  size_t n, elemSize;
+  long inc;
+};
+
+static void BenchAll(double seconds) {
+  std::vector<Shape> shapes = {
+      {"2D 4000x4096 pitch 4096", Strided::Layout2D(4000, 4096, 4096)},
+      {"2D 1000x16384 pitch 1024", Strided::Layout2D(1000, 16384, 1024)},
+      {"2D 61x65536 pitch 64", Strided::Layout2D(61, 65536, 64)},
+      {"3D 1000x256x64 ysize 260",
+       Strided::Layout3D(1000, 256, 64, 1024, 260)},
+      {"matrix double 2000x2048 ld 2048",
+       Strided::LayoutMatrix(2000, 2048, 8, 2048)},
+      {"vector float inc 2", {}, 1 << 22, 4, 2},
+      {"vector double inc 3", {}, 1 << 22, 8, 3},
+      {"vector double inc -2", {}, 1 << 22, 8, -2},
+      {"vector complex inc 4", {}, 1 << 21, 16, 4},
+      {"vector 12-byte inc 2", {}, 1 << 21, 12, 2},
+  };
+
+  std::cout << std::left << std::setw(36) << "layout" << std::right
+            << std::setw(12) << "MiB" << std::setw(12) << "pack GB/s"
+            << std::setw(14) << "unpack GB/s" << std::setw(14) << "memcpy GB/s"
+            << std::endl;
+  for (auto &shape : shapes) {
+    bool elements = shape.n > 0;
+    size_t packed = elements ? shape.n * shape.elemSize
+                             : Strided::PackedSize(shape.layout);
+    std::vector<unsigned char> region(
+        elements ? Span(shape.n, shape.elemSize, shape.inc)
+                 : Span(shape.layout));
+    std::vector<unsigned char> dense(packed), copy(packed);
+
+    double pack, unpack;
+    if (elements) {
+      pack = Throughput(
+          [&] {
+            Strided::PackElements(region.data(), shape.n, shape.elemSize,
+                                  shape.inc, dense.data());
+          },
+          packed, seconds);
+      unpack = Throughput(
+          [&] {
+            Strided::UnpackElements(dense.data(), shape.n, shape.elemSize,
+                                    shape.inc, region.data());
+          },
+          packed, seconds);
+    } else {
+      pack = Throughput(
+          [&] { Strided::Pack(region.data(), shape.layout, dense.data()); },
+          packed, seconds);
+      unpack = Throughput(
+          [&] { Strided::Unpack(dense.data(), shape.layout, region.data()); },
+          packed, seconds);
+    }
+    double baseline = Throughput(
+        [&] { memcpy(copy.data(), dense.data(), packed); }, packed, seconds);
+
+    std::cout << std::left << std::setw(36) << shape.name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(12)
+              << packed / 1048576.0 << std::setw(12) << std::setprecision(2)
+              << pack << std::setw(14) << unpack << std::setw(14) << baseline
+              << std::endl;
+  }
+}
+
+int main(int argc, char **argv) {
+  double seconds = argc > 1 ? atof(argv[1]) : 0.5;
+
+  if (CheckAll() != 0) return 1;
+  BenchAll(seconds);
+  return 0;
+}
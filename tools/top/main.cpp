@@ -0,0 +1,334 @@
+/*
+ * gVirtuS -- A GPGPU transparent virtualization component.
+ *
+ * Copyright (C) 2009-2010  The University of Napoli Parthenope at Naples.
+ *
+ * This file is part of gVirtuS.
+ *
+ * gVirtuS is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * gVirtuS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with gVirtuS; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file   main.cpp
+ *
+ * @brief  top for a backend: attaches to the counters a backend publishes
+ * in shared memory (see gvirtus/common/LiveStats.h) and shows, refreshed
+ * every interval, its sessions and its routines with their request rate,
+ * bandwidth and latency over the interval. Nothing is sent to the backend.
+ *
+ * Usage: gvirtus-top [options] [PID | SEGMENT]
+ *   --sort KEY        rate, bandwidth or latency (default rate)
+ *   --interval S      seconds between refreshes (default 1)
+ *   --iterations N    refreshes before exiting (default: until interrupted)
+ *   --rows N          routines shown (default 20)
+ *
+ * Without an argument the backend is the one running on this host.
+ */
+
+#include <dirent.h>
+#include <getopt.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gvirtus/common/LiveStats.h>
+
+using gvirtus::common::LiveStats;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::system_clock;
+
+enum SortKey { Rate, Bandwidth, Latency };
+
+/* highlights the headers, on a terminal */
+static const char *msReverse = "";
+static const char *msNormal = "";
+
+struct Sample {
+  uint64_t requests = 0;
+  uint64_t requestBytes = 0;
+  uint64_t replyBytes = 0;
+  uint64_t latency = 0;
+  uint64_t execution = 0;
+
+  void Read(const LiveStats::Counters &counters) {
+    requests = counters.requests.load(std::memory_order_relaxed);
+    requestBytes = counters.requestBytes.load(std::memory_order_relaxed);
+    replyBytes = counters.replyBytes.load(std::memory_order_relaxed);
+    latency = counters.latency.load(std::memory_order_relaxed);
+    execution = counters.execution.load(std::memory_order_relaxed);
+  }
+};
+
+/* what a slot did between two samples */
+struct Row {
+  std::string name;
+  Sample total;
+  double rate = 0;
+  double inBandwidth = 0;
+  double outBandwidth = 0;
+  /* microseconds, averaged over the interval or, if idle, over all */
+  double latency = 0;
+  double execution = 0;
+  /* sessions only */
+  int tid = 0;
+  double age = 0;
+  int64_t memory = 0;
+};
+
+static Row Compare(const Sample &before, const Sample &after,
+                   double seconds) {
+  Row row;
+  row.total = after;
+  /* a slot reused between the samples starts again from zero */
+  Sample from = after.requests < before.requests ? Sample() : before;
+  uint64_t requests = after.requests - from.requests;
+  row.rate = requests / seconds;
+  row.inBandwidth = (after.requestBytes - from.requestBytes) / seconds;
+  row.outBandwidth = (after.replyBytes - from.replyBytes) / seconds;
+  if (requests == 0) from = Sample(), requests = after.requests;
+  if (requests > 0) {
+    row.latency = (after.latency - from.latency) / 1e3 / requests;
+    row.execution = (after.execution - from.execution) / 1e3 / requests;
+  }
+  return row;
+}
+
+static void Sort(std::vector<Row> &rows, SortKey key) {
+  std::sort(rows.begin(), rows.end(), [key](const Row &a, const Row &b) {
+    switch (key) {
+      case Bandwidth:
+        return a.inBandwidth + a.outBandwidth > b.inBandwidth + b.outBandwidth;
+      case Latency:
+        return a.latency > b.latency;
+      default:
+        return a.rate != b.rate ? a.rate > b.rate
+                                : a.total.requests > b.total.requests;
+    }
+  });
+}
+
+static void PrintHeader(const char *first) {
+  printf("%s%-40s %10s %10s %10s %10s %10s %12s", msReverse, first, "req/s",
+         "in MB/s", "out MB/s", "lat us", "exec us", "requests");
+}
+
+static void PrintCounters(const Row &row) {
+  printf(" %10.0f %10.2f %10.2f %10.1f %10.1f %12llu", row.rate,
+         row.inBandwidth / 1e6, row.outBandwidth / 1e6, row.latency,
+         row.execution, (unsigned long long)row.total.requests);
+}
+
+/**
+ * The segment of the only backend endpoint of this host, empty if there are
+ * none or several.
+ */
+static std::string FindSegment() {
+  std::vector<std::string> found;
+  DIR *dir = opendir("/dev/shm");
+  if (dir == NULL) return "";
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL)
+    if (strncmp(entry->d_name, "gvirtus-", 8) == 0 &&
+        strspn(entry->d_name + 8, "0123456789") == strlen(entry->d_name + 8))
+      found.push_back(entry->d_name);
+  closedir(dir);
+  if (found.size() == 1) return found[0];
+  for (auto &name : found) std::cerr << "backend " << name.substr(8) << std::endl;
+  return "";
+}
+
+int main(int argc, char **argv) {
+  SortKey key = Rate;
+  double interval = 1;
+  long iterations = -1;
+  size_t rows = 20;
+
+  static const struct option options[] = {
+      {"sort", required_argument, NULL, 's'},
+      {"interval", required_argument, NULL, 'i'},
+      {"iterations", required_argument, NULL, 'n'},
+      {"rows", required_argument, NULL, 'r'},
+      {NULL, 0, NULL, 0}};
+  int option;
+  bool usage = false;
+  while ((option = getopt_long(argc, argv, "", options, NULL)) != -1) {
+    switch (option) {
+      case 's':
+        if (strcmp(optarg, "rate") == 0)
+          key = Rate;
+        else if (strcmp(optarg, "bandwidth") == 0)
+          key = Bandwidth;
+        else if (strcmp(optarg, "latency") == 0)
+          key = Latency;
+        else
+          usage = true;
+        break;
+      case 'i':
+        interval = atof(optarg);
+        break;
+      case 'n':
+        iterations = atol(optarg);
+        break;
+      case 'r':
+        rows = strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage = true;
+        break;
+    }
+  }
+  if (usage || optind < argc - 1 || interval <= 0) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--sort rate|bandwidth|latency] [--interval S]"
+                 " [--iterations N] [--rows N] [PID | SEGMENT]"
+              << std::endl;
+    return 1;
+  }
+
+  std::string name;
+  if (optind < argc)
+    name = strspn(argv[optind], "0123456789") == strlen(argv[optind])
+               ? LiveStats::DefaultName(atoi(argv[optind]))
+               : argv[optind];
+  else if ((name = FindSegment()).empty()) {
+    std::cerr << "Name the backend: there is not one backend on this host."
+              << std::endl;
+    return 1;
+  }
+
+  const LiveStats::Segment *segment;
+  try {
+    segment = LiveStats::Attach(name);
+  } catch (std::string &exc) {
+    std::cerr << exc << std::endl;
+    return 1;
+  }
+
+  std::vector<Sample> sessions(LiveStats::MaxSessions);
+  std::vector<uint64_t> generations(LiveStats::MaxSessions);
+  std::vector<Sample> routines(LiveStats::MaxRoutines);
+  auto sample = [&]() {
+    for (size_t i = 0; i < LiveStats::MaxSessions; i++) {
+      generations[i] =
+          segment->sessions[i].generation.load(std::memory_order_acquire);
+      sessions[i].Read(segment->sessions[i].counters);
+    }
+    for (size_t i = 0; i < LiveStats::MaxRoutines; i++)
+      routines[i].Read(segment->routines[i].counters);
+  };
+  sample();
+
+  bool terminal = isatty(STDOUT_FILENO);
+  if (terminal) {
+    msReverse = "\033[7m";
+    msNormal = "\033[0m";
+  }
+  for (long iteration = 0; iterations < 0 || iteration < iterations;
+       iteration++) {
+    auto before_sessions = sessions;
+    auto before_generations = generations;
+    auto before_routines = routines;
+    auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::duration<double>(interval));
+    if (kill(segment->pid, 0) != 0 && errno == ESRCH) {
+      std::cerr << "The backend " << segment->pid << " has exited."
+                << std::endl;
+      return 0;
+    }
+    sample();
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    int64_t now =
+        duration_cast<nanoseconds>(system_clock::now().time_since_epoch())
+            .count();
+
+    std::vector<Row> session_rows;
+    for (size_t i = 0; i < LiveStats::MaxSessions; i++) {
+      const LiveStats::Session &session = segment->sessions[i];
+      if (generations[i] % 2 == 0) continue;
+      Row row = Compare(before_generations[i] == generations[i]
+                            ? before_sessions[i]
+                            : Sample(),
+                        sessions[i], seconds);
+      row.name = "session " + std::to_string(i);
+      row.tid = session.tid.load(std::memory_order_relaxed);
+      row.age =
+          (now - session.connected.load(std::memory_order_relaxed)) / 1e9;
+      row.memory = session.memory.load(std::memory_order_relaxed);
+      session_rows.push_back(row);
+    }
+    std::vector<Row> routine_rows;
+    for (size_t i = 0; i < LiveStats::MaxRoutines; i++) {
+      const LiveStats::Routine &routine = segment->routines[i];
+      if (routine.state.load(std::memory_order_acquire) != 2) continue;
+      Row row = Compare(before_routines[i], routines[i], seconds);
+      row.name = routine.name;
+      routine_rows.push_back(row);
+    }
+    Sort(session_rows, key);
+    Sort(routine_rows, key);
+
+    Row total;
+    for (auto &row : session_rows) {
+      total.rate += row.rate;
+      total.inBandwidth += row.inBandwidth;
+      total.outBandwidth += row.outBandwidth;
+      total.memory += row.memory;
+    }
+
+    if (terminal) printf("\033[H\033[2J");
+    printf("gvirtus-backend %d, up %.0f s: %zu session(s), %.0f req/s, "
+           "%.2f MB/s in, %.2f MB/s out, %.1f MiB of device memory",
+           segment->pid, (now - segment->started) / 1e9, session_rows.size(),
+           total.rate, total.inBandwidth / 1e6, total.outBandwidth / 1e6,
+           total.memory / 1048576.0);
+    uint64_t lost = segment->sessionsLost.load(std::memory_order_relaxed);
+    if (lost > 0)
+      printf(", %llu session(s) not counted", (unsigned long long)lost);
+    printf("\n\n");
+
+    PrintHeader("SESSION");
+    printf(" %8s %8s %10s%s\n", "TID", "AGE s", "MEM MiB", msNormal);
+    for (auto &row : session_rows) {
+      printf("%-40s", row.name.c_str());
+      PrintCounters(row);
+      printf(" %8d %8.0f %10.1f\n", row.tid, row.age, row.memory / 1048576.0);
+    }
+    printf("\n");
+    PrintHeader("ROUTINE");
+    printf("%s\n", msNormal);
+    for (size_t i = 0; i < routine_rows.size() && i < rows; i++) {
+      printf("%-40.40s", routine_rows[i].name.c_str());
+      PrintCounters(routine_rows[i]);
+      printf("\n");
+    }
+    if (!terminal) printf("\n");
+    fflush(stdout);
+  }
+  return 0;
+}